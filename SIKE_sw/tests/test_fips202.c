@@ -0,0 +1,106 @@
+/********************************************************************************************
+* vOW4SIKE on HW: a HW/SW co-design implementation of the vOW algorithm on SIKE
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/vOW4SIKE_on_HW
+* Released under MIT license
+*
+* Based on the SIDH library (https://github.com/microsoft/PQCrypto-SIDH) and the vOW4SIKE
+* library (https://github.com/microsoft/vOW4SIKE)
+*
+* Abstract: testing/benchmarking the 4-way SHAKE functions against the one-state ones
+*********************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../src/sha3/fips202.h"
+
+#define MAX_INPUT_BYTES   600         // Over 3 blocks of SHAKE128 and 4 of SHAKE256
+#define MAX_OUTPUT_BYTES  400
+#define BENCH_BYTES       4096        // Input bytes per instance in the benchmark
+#define BENCH_LOOPS       200
+
+typedef void (*shake_t)(unsigned char *, unsigned long long, const unsigned char *, unsigned long long);
+typedef void (*shakex4_t)(unsigned char *, unsigned char *, unsigned char *, unsigned char *, unsigned long long,
+                          const unsigned char *, const unsigned char *, const unsigned char *, const unsigned char *, unsigned long long);
+
+
+static int test_shakex4(const char *name, shake_t shake, shakex4_t shakex4)
+{ // Outputs of the 4 instances against the one-state function, for all input lengths up to MAX_INPUT_BYTES
+    static unsigned char in[4][MAX_INPUT_BYTES], out[4][MAX_OUTPUT_BYTES], ref[MAX_OUTPUT_BYTES];
+    static const unsigned long long outlens[] = { 1, 16, 32, 136, 168, 200, MAX_OUTPUT_BYTES };
+    unsigned long long inlen;
+    unsigned int o, j, i, mismatches = 0, checks = 0;
+
+    for (j = 0; j < 4; j++)
+        for (i = 0; i < MAX_INPUT_BYTES; i++)
+            in[j][i] = (unsigned char)rand();
+
+    for (inlen = 0; inlen <= MAX_INPUT_BYTES; inlen++) {
+        for (o = 0; o < sizeof(outlens)/sizeof(outlens[0]); o++) {
+            shakex4(out[0], out[1], out[2], out[3], outlens[o], in[0], in[1], in[2], in[3], inlen);
+            for (j = 0; j < 4; j++) {
+                shake(ref, outlens[o], in[j], inlen);
+                mismatches += (memcmp(ref, out[j], (size_t)outlens[o]) != 0);
+                checks++;
+            }
+        }
+    }
+    printf("  %s: %u outputs checked, %u mismatches\n", name, checks, mismatches);
+    return (mismatches == 0) ? PASSED : FAILURE;
+}
+
+
+static void bench_shakex4(const char *name, shake_t shake, shakex4_t shakex4)
+{ // Cycles per input byte of 4 instances with the one-state and the 4-way functions
+    static unsigned char in[4][BENCH_BYTES], out[4][32];
+    unsigned long long cycles1, cycles4, cycles;
+    unsigned int n, j;
+
+    for (j = 0; j < 4; j++)
+        memset(in[j], (int)j, BENCH_BYTES);
+
+    cycles1 = 0;
+    for (n = 0; n < BENCH_LOOPS; n++) {
+        cycles = cpucycles();
+        for (j = 0; j < 4; j++)
+            shake(out[j], 32, in[j], BENCH_BYTES);
+        cycles1 += cpucycles() - cycles;
+        in[n % 4][0] ^= out[0][0];
+    }
+    cycles4 = 0;
+    for (n = 0; n < BENCH_LOOPS; n++) {
+        cycles = cpucycles();
+        shakex4(out[0], out[1], out[2], out[3], 32, in[0], in[1], in[2], in[3], BENCH_BYTES);
+        cycles4 += cpucycles() - cycles;
+        in[n % 4][0] ^= out[0][0];
+    }
+    printf("  %s on %d-byte inputs: one-state %6.2f, 4-way %6.2f ", name, BENCH_BYTES,
+           (double)cycles1 / (4.0 * BENCH_LOOPS * BENCH_BYTES), (double)cycles4 / (4.0 * BENCH_LOOPS * BENCH_BYTES));
+    print_unit;
+    printf(" per byte\n");
+}
+
+
+int main()
+{
+    int Status = PASSED;
+
+    printf("\nTesting the 4-way SHAKE functions");
+#if defined(__AVX2__)
+    printf(" (4-way AVX2 Keccak)");
+#else
+    printf(" (one-state Keccak four times)");
+#endif
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+    Status |= test_shakex4("shake128x4", shake128, shake128x4);
+    Status |= test_shakex4("shake256x4", shake256, shake256x4);
+    printf("\n  4-way SHAKE tests ..................................................... %s\n\n", (Status == PASSED) ? "PASSED" : "FAILED");
+
+    bench_shakex4("shake128x4", shake128, shake128x4);
+    bench_shakex4("shake256x4", shake256, shake256x4);
+    printf("\n");
+    return Status;
+}
@@ -0,0 +1,159 @@
+/********************************************************************************************
+* vOW4SIKE on HW: a HW/SW co-design implementation of the vOW algorithm on SIKE
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/vOW4SIKE_on_HW
+* Released under MIT license
+*
+* Based on the SIDH library (https://github.com/microsoft/PQCrypto-SIDH) and the vOW4SIKE
+* library (https://github.com/microsoft/vOW4SIKE)
+*
+* Abstract: two-limb modular arithmetic for P128 on x64 platforms, inlined into the GF(p^2) functions of fpx.c
+*
+* The P128 primes p = 2^eA*3^eB*f - 1 have less than 80 bits, so a field element in [0, 2^128-1] fits in one
+* uint128_t and a product of two elements in [0, 4p-1] fits in lo + hi*2^128 with a 32-bit hi. Since p = -1 mod 2^32,
+* m*p = m*(p+1) - m only takes one multiplication by (p+1)/2^32 < 2^44 per digit of the Montgomery reduction.
+* All the results are equal to those of the assembly functions, so the attack statistics do not change.
+*********************************************************************************************/
+
+typedef struct { uint128_t lo; int64_t hi; } dfelm2l_t;            // Double-precision value lo + hi*2^128, with hi signed
+
+#define P128_2L         (((uint128_t)p128[1] << 64) | p128[0])
+#define P128x2_2L       (((uint128_t)p128x2[1] << 64) | p128x2[0])
+#define P128x4_2L       (((uint128_t)p128x4[1] << 64) | p128x4[0])
+#define P128C32_2L      (((uint128_t)p128p1[1] << 32) | (p128p1[0] >> 32))     // (p128+1)/2^32
+
+
+static __inline uint128_t load_2l(const digit_t* a)
+{ // Field element as one 128-bit value
+    return ((uint128_t)a[1] << 64) | a[0];
+}
+
+
+static __inline void store_2l(const uint128_t a, digit_t* c)
+{ // 128-bit value as field element
+    c[0] = (digit_t)a;
+    c[1] = (digit_t)(a >> 64);
+}
+
+
+static __inline uint128_t fpadd_2l(const uint128_t a, const uint128_t b)
+{ // Modular addition, a+b mod 2*p128 for a, b in [0, 2*p128-1]
+    __int128 t = (__int128)(a + b - P128x2_2L);
+
+    return (uint128_t)(t + ((t >> 127) & P128x2_2L));
+}
+
+
+static __inline uint128_t fpsub_2l(const uint128_t a, const uint128_t b)
+{ // Modular subtraction, a-b mod 2*p128 for a, b in [0, 2*p128-1]
+    __int128 t = (__int128)(a - b);
+
+    return (uint128_t)(t + ((t >> 127) & P128x2_2L));
+}
+
+
+static __inline void mp_add_2l(const digit_t* a, const digit_t* b, digit_t* c)
+{ // Addition without correction, c = a+b
+    store_2l(load_2l(a) + load_2l(b), c);
+}
+
+
+static __inline void mp_sub_p2_2l(const digit_t* a, const digit_t* b, digit_t* c)
+{ // Subtraction with correction with 2*p128, c = a-b+2p
+    store_2l(load_2l(a) - load_2l(b) + P128x2_2L, c);
+}
+
+
+static __inline void mul_2l(const uint128_t a, const uint128_t b, dfelm2l_t* c)
+{ // Multiplication, c = a*b for a, b < 2^80
+    uint64_t a0 = (uint64_t)a, a1 = (uint64_t)(a >> 64), b0 = (uint64_t)b, b1 = (uint64_t)(b >> 64);
+    uint128_t lo = (uint128_t)a0*b0, mid = (uint128_t)a0*b1 + (uint128_t)a1*b0;
+
+    c->lo = lo + (mid << 64);
+    c->hi = (int64_t)((uint64_t)(mid >> 64) + a1*b1 + (c->lo < lo));
+}
+
+
+static __inline void sub_2l(const dfelm2l_t* a, const dfelm2l_t* b, dfelm2l_t* c)
+{ // Double-precision subtraction, c = a-b
+    int64_t borrow = (a->lo < b->lo);
+
+    c->lo = a->lo - b->lo;
+    c->hi = a->hi - b->hi - borrow;
+}
+
+
+static __inline uint128_t rdc_2l(const dfelm2l_t* a)
+{ // Montgomery reduction exploiting p128 = -1 mod 2^32, c = a*2^-128 mod p128.
+  // It runs over two 64-bit digits: with m = -t*p128^-1 mod 2^64, t + m*p128 = t - m + m*(p128+1) needs a single multiplication
+  // m*(p128+1)/2^32, and t - m + m*(p128+1) = 0 mod 2^64 only leaves the carry out of the low digit.
+  // For a in [0, p128*2^128-1] the output is in [0, 2*p128-1], for a in [-p128*2^128, -1] it is in [-p128+1, p128-1].
+  // In both cases it matches rdc_mont(), i.e., (a + m*p128)/2^128 for the only m in [0, 2^128-1] making the division exact.
+    __int128 t;
+    uint64_t x, m;
+    uint128_t u;
+
+    x = (uint64_t)a->lo;
+    m = x*Montgomery_rprime1[0];
+    u = (uint128_t)m*P128C32_2L;
+    t = (__int128)((a->lo >> 64) | ((uint128_t)a->hi << 64));
+    t += (__int128)((u >> 32) + (((uint128_t)x + (uint64_t)(u << 32)) >> 64));
+    
+    x = (uint64_t)t;
+    m = x*Montgomery_rprime1[0];
+    u = (uint128_t)m*P128C32_2L;
+    t = (t >> 64) + (__int128)((u >> 32) + (((uint128_t)x + (uint64_t)(u << 32)) >> 64));
+    return (uint128_t)t;
+}
+
+
+static __inline void fpmul_mont_2l(const digit_t* ma, const digit_t* mb, digit_t* mc)
+{ // Montgomery multiplication, mc = ma*mb*2^-128 mod p128 in [0, 2*p128-1] for ma, mb in [0, 2*p128-1]
+    dfelm2l_t t;
+
+    mul_2l(load_2l(ma), load_2l(mb), &t);
+    store_2l(rdc_2l(&t), mc);
+}
+
+
+static __inline void fp2add_2l(const f2elm_t a, const f2elm_t b, f2elm_t c)
+{ // GF(p^2) addition, c = a+b in GF(p^2)
+    store_2l(fpadd_2l(load_2l(a[0]), load_2l(b[0])), c[0]);
+    store_2l(fpadd_2l(load_2l(a[1]), load_2l(b[1])), c[1]);
+}
+
+
+static __inline void fp2sub_2l(const f2elm_t a, const f2elm_t b, f2elm_t c)
+{ // GF(p^2) subtraction, c = a-b in GF(p^2)
+    store_2l(fpsub_2l(load_2l(a[0]), load_2l(b[0])), c[0]);
+    store_2l(fpsub_2l(load_2l(a[1]), load_2l(b[1])), c[1]);
+}
+
+
+static __inline void fp2sqr_mont_2l(const f2elm_t a, f2elm_t c)
+{ // GF(p^2) squaring, c = a^2 in GF(p^2), following fp2sqr_mont()
+    uint128_t a0 = load_2l(a[0]), a1 = load_2l(a[1]);
+    dfelm2l_t t0, t1;
+
+    mul_2l(a0 + a1, a0 - a1 + P128x4_2L, &t0);    // t0 = (a0+a1)(a0-a1+4p)
+    mul_2l(a0 + a0, a1, &t1);                     // t1 = 2a0*a1
+    store_2l(rdc_2l(&t0), c[0]);
+    store_2l(rdc_2l(&t1), c[1]);
+}
+
+
+static __inline void fp2mul_mont_2l(const f2elm_t a, const f2elm_t b, f2elm_t c)
+{ // GF(p^2) multiplication, c = a*b in GF(p^2), following fp2mul_mont()
+    uint128_t a0 = load_2l(a[0]), a1 = load_2l(a[1]), b0 = load_2l(b[0]), b1 = load_2l(b[1]);
+    dfelm2l_t t0, t1, t2;
+
+    mul_2l(a0, b0, &t0);                          // t0 = a0*b0
+    mul_2l(a1, b1, &t1);                          // t1 = a1*b1
+    mul_2l(a0 + a1, b0 + b1, &t2);                // t2 = (a0+a1)*(b0+b1)
+    sub_2l(&t2, &t0, &t2);
+    sub_2l(&t2, &t1, &t2);                        // t2 = (a0+a1)*(b0+b1) - a0*b0 - a1*b1
+    sub_2l(&t0, &t1, &t0);                        // t0 = a0*b0 - a1*b1
+    store_2l(rdc_2l(&t2), c[1]);
+    store_2l(rdc_2l(&t0) + (P128_2L & (uint128_t)(__int128)(t0.hi >> 63)), c[0]);   // Adding p if a0*b0 - a1*b1 < 0
+}
@@ -70,6 +70,7 @@
 #define fpinv_mont_ct                 fpinv128_mont_ct
 #define fpinv_chain_mont              fpinv128_chain_mont
 #define fpinv_mont_bingcd             fpinv128_mont_bingcd
+#define fpinv_mont_safegcd            fpinv128_mont_safegcd
 #define fp2copy                       fp2copy128
 #define fp2zero                       fp2zero128
 #define fp2add                        fp2add128
@@ -82,6 +83,10 @@
 #define fp2correction                 fp2correction128
 #define fp2mul_mont                   fp2mul128_mont
 #define fp2sqr_mont                   fp2sqr128_mont
+#define fp2mul_simd                   fp2mul128_simd
+#define fp2sqr_simd                   fp2sqr128_simd
+#define fp2add_simd                   fp2add128_simd
+#define fp2sub_simd                   fp2sub128_simd
 #define fp2inv_mont                   fp2inv128_mont
 #define fp2inv_mont_ct                fp2inv128_mont_ct
 #define fp2inv_mont_bingcd            fp2inv128_mont_bingcd
@@ -94,5 +99,9 @@
 #define random_mod_order_A            random_mod_order_A_SIDHp128
 #define random_mod_order_B            random_mod_order_B_SIDHp128
 
+#if defined(FIELD_TWO_LIMBS)
+#include "AMD64/fp_x64_inline.c"
+#endif
 #include "../fpx.c"
+#include "../fpx_simd.c"
 #include "../ec_isogeny.c"
\ No newline at end of file
@@ -83,6 +83,7 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define fpinv_mont_ct                 fpinv377_mont_ct
 #define fpinv_chain_mont              fpinv377_chain_mont
 #define fpinv_mont_bingcd             fpinv377_mont_bingcd
+#define fpinv_mont_safegcd            fpinv377_mont_safegcd
 #define fp2copy                       fp2copy377
 #define fp2zero                       fp2zero377
 #define fp2add                        fp2add377
@@ -95,6 +96,10 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define fp2correction                 fp2correction377
 #define fp2mul_mont                   fp2mul377_mont
 #define fp2sqr_mont                   fp2sqr377_mont
+#define fp2mul_simd                   fp2mul377_simd
+#define fp2sqr_simd                   fp2sqr377_simd
+#define fp2add_simd                   fp2add377_simd
+#define fp2sub_simd                   fp2sub377_simd
 #define fp2inv_mont                   fp2inv377_mont
 #define fp2inv_mont_ct                fp2inv377_mont_ct
 #define fp2inv_mont_bingcd            fp2inv377_mont_bingcd
@@ -113,6 +118,7 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define EphemeralSecretAgreement_B    EphemeralSecretAgreement_B_SIDHp377
 
 #include "../fpx.c"
+#include "../fpx_simd.c"
 #include "../ec_isogeny.c"
 #include "../sidh.c"    
 #include "../sike.c"
\ No newline at end of file
@@ -102,6 +102,7 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define fpinv_mont_ct                 fpinv434_mont_ct
 #define fpinv_chain_mont              fpinv434_chain_mont
 #define fpinv_mont_bingcd             fpinv434_mont_bingcd
+#define fpinv_mont_safegcd            fpinv434_mont_safegcd
 #define fp2copy                       fp2copy434
 #define fp2zero                       fp2zero434
 #define fp2add                        fp2add434
@@ -114,6 +115,10 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define fp2correction                 fp2correction434
 #define fp2mul_mont                   fp2mul434_mont
 #define fp2sqr_mont                   fp2sqr434_mont
+#define fp2mul_simd                   fp2mul434_simd
+#define fp2sqr_simd                   fp2sqr434_simd
+#define fp2add_simd                   fp2add434_simd
+#define fp2sub_simd                   fp2sub434_simd
 #define fp2inv_mont                   fp2inv434_mont
 #define fp2inv_mont_ct                fp2inv434_mont_ct
 #define fp2inv_mont_bingcd            fp2inv434_mont_bingcd
@@ -132,6 +137,7 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define EphemeralSecretAgreement_B    EphemeralSecretAgreement_B_SIDHp434
 
 #include "../fpx.c"
+#include "../fpx_simd.c"
 #include "../ec_isogeny.c"
 #include "../sidh.c"    
 #include "../sike.c"
\ No newline at end of file
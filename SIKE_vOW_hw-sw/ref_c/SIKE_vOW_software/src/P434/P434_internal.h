@@ -56,8 +56,8 @@
 #define SECRETKEY_A_BYTES       ((OALICE_BITS + 7) / 8)
 #define SECRETKEY_B_BYTES       ((OBOB_BITS - 1 + 7) / 8)
 #define FP2_ENCODED_BYTES       2*((NBITS_FIELD + 7) / 8)
-// Fixed parameters for isogeny tree computation in vOW algorithm
-#define LENSTRAT                8
+// Fixed parameters for isogeny tree computation in vOW algorithm: strategies of up to LENSTRAT entries (instances with e <= 2*LENSTRAT+4)
+#define LENSTRAT                14
 
 
 // SIDH's basic element definitions and point representations
@@ -69,6 +69,15 @@ typedef felm_t  f2elm_t[2];                                           // Datatyp
 typedef struct { f2elm_t X; f2elm_t Z; } point_proj;                  // Point representation in projective XZ Montgomery coordinates.
 typedef point_proj point_proj_t[1]; 
 
+#define MAX_WALKS               8                                     // Maximum number of vOW walks advanced together in lockstep
+typedef struct { f2elm_t X[MAX_WALKS]; f2elm_t Z[MAX_WALKS]; } point_proj_batch;  // Points of several walks in structure-of-arrays layout, one array per coordinate
+typedef point_proj_batch point_proj_batch_t[1];
+
+#define SIMD_LANES              MAX_WALKS                             // Lanes of the lane-parallel GF(p^2) arithmetic 
+#define NLIMBS_SIMD             ((NBITS_FIELD+4+27)/28)               // Maximum number of limbs per lane (AVX2 backend)
+typedef uint64_t vfelm_t[NLIMBS_SIMD*SIMD_LANES];                     // SIMD_LANES field elements stored limb-major, see fpx_simd.c
+typedef vfelm_t vf2elm_t[2];                                          // SIMD_LANES elements of GF(p434^2)
+
 #ifdef COMPRESS
     typedef struct { f2elm_t X; f2elm_t Y; f2elm_t Z; } point_full_proj;  // Point representation in full projective XYZ Montgomery coordinates 
     typedef point_full_proj point_full_proj_t[1]; 
@@ -173,6 +182,15 @@ void from_mont(const digit_t* ma, digit_t* c);
 // Field inversion, a = a^-1 in GF(p434)
 void fpinv434_mont(digit_t* a);
 
+// Field inversion, a = a^-1 in GF(p434) using the binary GCD 
+void fpinv434_mont_bingcd(digit_t* a);
+
+// Field inversion, a = a^-1 in GF(p434) using the safegcd algorithm with 62-bit jumps (variable-time)
+void fpinv434_mont_safegcd(digit_t* a);
+
+// Field inversion, a = a^-1 in GF(p434) using an addition chain
+void fpinv434_mont_ct(digit_t* a);
+
 /************ GF(p^2) arithmetic functions *************/
 
 // Conversion of GF(p^2) element from Montgomery to standard representation, and encoding by removing leading 0 bytes
@@ -220,6 +238,41 @@ void from_fp2mont(const f2elm_t ma, f2elm_t c);
 // GF(p434^2) inversion using Montgomery arithmetic, a = (a0-i*a1)/(a0^2+a1^2)
 void fp2inv434_mont(f2elm_t a);
 
+/************ Lane-parallel GF(p^2) arithmetic functions *************/
+
+// Backend of the lane-parallel arithmetic in use (SIMD_SCALAR, SIMD_AVX2 or SIMD_AVX512)
+extern unsigned int fp2simd_backend;
+
+// Is the backend compiled in and supported by the CPU?
+bool fp2simd_supported(const unsigned int backend);
+
+// Selects the backend of the lane-parallel arithmetic, SIMD_AUTO picks the widest one supported by the CPU
+bool fp2simd_select(unsigned int backend);
+
+// Name of a backend
+const char* fp2simd_name(const unsigned int backend);
+
+// Number of lanes per vector of the backend in use
+unsigned int fp2simd_lanes(void);
+
+// Loads n GF(p434^2) elements in Montgomery representation into the lanes of c
+void to_fp2simd(const f2elm_t *a, vf2elm_t c, const unsigned int n);
+
+// Stores the first n lanes of a as GF(p434^2) elements in Montgomery representation
+void from_fp2simd(const vf2elm_t a, f2elm_t *c, const unsigned int n);
+
+// GF(p434^2) multiplication in the first n lanes, c = a*b
+void fp2mul434_simd(const vf2elm_t a, const vf2elm_t b, vf2elm_t c, const unsigned int n);
+
+// GF(p434^2) squaring in the first n lanes, c = a^2
+void fp2sqr434_simd(const vf2elm_t a, vf2elm_t c, const unsigned int n);
+
+// GF(p434^2) addition in the first n lanes, c = a+b
+void fp2add434_simd(const vf2elm_t a, const vf2elm_t b, vf2elm_t c, const unsigned int n);
+
+// GF(p434^2) subtraction in the first n lanes, c = a-b
+void fp2sub434_simd(const vf2elm_t a, const vf2elm_t b, vf2elm_t c, const unsigned int n);
+
 /************ Elliptic curve and isogeny functions *************/
 
 // Computes the j-invariant of a Montgomery curve with projective constant.
@@ -264,5 +317,23 @@ void get_A(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xR, f2elm_t A);
 // Isogeny tree traversal
 void TraverseTree(f2elm_t jinv, point_proj_t R, f2elm_t A24plus, f2elm_t C24, const unsigned int *strat, unsigned int lenstrat, bool keygen, point_proj_t PhiP, point_proj_t PhiQ, point_proj_t PhiR);
 
+// Computes [2^e](X:Z) for n walks in lockstep, each on its own curve
+void xDBLe_batch(point_proj_batch_t P, const f2elm_t* A24plus, const f2elm_t* C24, const int e, const unsigned int n);
+
+// Differential additions for n walks in lockstep
+void xADD_batch(point_proj_batch_t Q, const point_proj_batch_t P2, const f2elm_t* xPQ, const unsigned int n);
+
+// Computes the 4-isogenies of n projective points of order 4
+void get_4_isog_batch(const point_proj_batch_t P, f2elm_t* A24plus, f2elm_t* C24, f2elm_t coeff[3][MAX_WALKS], const unsigned int n);
+
+// Evaluates n 4-isogenies at n points
+void eval_4_isog_batch(point_proj_batch_t P, f2elm_t coeff[3][MAX_WALKS], const unsigned int n);
+
+// Computes the j-invariants of n Montgomery curves with projective constants using a single inversion
+void j_inv_batch(const f2elm_t* A, const f2elm_t* C, f2elm_t* jinv, const unsigned int n);
+
+// Isogeny tree traversal for n walks in lockstep
+void TraverseTree_batch(f2elm_t* jinv, point_proj_batch_t R, f2elm_t* A24plus, f2elm_t* C24, const unsigned int *strat, unsigned int lenstrat, const unsigned int n);
+
 
 #endif
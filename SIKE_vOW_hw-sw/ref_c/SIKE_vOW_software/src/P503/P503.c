@@ -108,6 +108,7 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define fpinv_mont_ct                 fpinv503_mont_ct
 #define fpinv_chain_mont              fpinv503_chain_mont
 #define fpinv_mont_bingcd             fpinv503_mont_bingcd
+#define fpinv_mont_safegcd            fpinv503_mont_safegcd
 #define fp2copy                       fp2copy503
 #define fp2zero                       fp2zero503
 #define fp2add                        fp2add503
@@ -120,6 +121,10 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define fp2correction                 fp2correction503
 #define fp2mul_mont                   fp2mul503_mont
 #define fp2sqr_mont                   fp2sqr503_mont
+#define fp2mul_simd                   fp2mul503_simd
+#define fp2sqr_simd                   fp2sqr503_simd
+#define fp2add_simd                   fp2add503_simd
+#define fp2sub_simd                   fp2sub503_simd
 #define fp2inv_mont                   fp2inv503_mont
 #define fp2inv_mont_ct                fp2inv503_mont_ct
 #define fp2inv_mont_bingcd            fp2inv503_mont_bingcd
@@ -137,6 +142,7 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define EphemeralSecretAgreement_B    EphemeralSecretAgreement_B_SIDHp503
 
 #include "../fpx.c"
+#include "../fpx_simd.c"
 #include "../ec_isogeny.c"
 #include "../sidh.c"    
 #include "../sike.c"
\ No newline at end of file
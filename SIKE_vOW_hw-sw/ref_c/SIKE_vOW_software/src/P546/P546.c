@@ -105,6 +105,7 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define fpinv_mont_ct                 fpinv546_mont_ct
 #define fpinv_chain_mont              fpinv546_chain_mont
 #define fpinv_mont_bingcd             fpinv546_mont_bingcd
+#define fpinv_mont_safegcd            fpinv546_mont_safegcd
 #define fp2copy                       fp2copy546
 #define fp2zero                       fp2zero546
 #define fp2add                        fp2add546
@@ -117,6 +118,10 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define fp2correction                 fp2correction546
 #define fp2mul_mont                   fp2mul546_mont
 #define fp2sqr_mont                   fp2sqr546_mont
+#define fp2mul_simd                   fp2mul546_simd
+#define fp2sqr_simd                   fp2sqr546_simd
+#define fp2add_simd                   fp2add546_simd
+#define fp2sub_simd                   fp2sub546_simd
 #define fp2inv_mont                   fp2inv546_mont
 #define fp2inv_mont_ct                fp2inv546_mont_ct
 #define fp2inv_mont_bingcd            fp2inv546_mont_bingcd
@@ -134,6 +139,7 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define EphemeralSecretAgreement_B    EphemeralSecretAgreement_B_SIDHp546
 
 #include "../fpx.c"
+#include "../fpx_simd.c"
 #include "../ec_isogeny.c"
 #include "../sidh.c"    
 #include "../sike.c"
\ No newline at end of file
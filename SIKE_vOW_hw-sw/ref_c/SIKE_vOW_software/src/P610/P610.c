@@ -107,8 +107,10 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define fpmul_mont                    fpmul610_mont
 #define fpsqr_mont                    fpsqr610_mont
 #define fpinv_mont                    fpinv610_mont
+#define fpinv_mont_ct                 fpinv610_mont_ct
 #define fpinv_chain_mont              fpinv610_chain_mont
 #define fpinv_mont_bingcd             fpinv610_mont_bingcd
+#define fpinv_mont_safegcd            fpinv610_mont_safegcd
 #define fp2copy                       fp2copy610
 #define fp2zero                       fp2zero610
 #define fp2add                        fp2add610
@@ -121,7 +123,12 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define fp2correction                 fp2correction610
 #define fp2mul_mont                   fp2mul610_mont
 #define fp2sqr_mont                   fp2sqr610_mont
+#define fp2mul_simd                   fp2mul610_simd
+#define fp2sqr_simd                   fp2sqr610_simd
+#define fp2add_simd                   fp2add610_simd
+#define fp2sub_simd                   fp2sub610_simd
 #define fp2inv_mont                   fp2inv610_mont
+#define fp2inv_mont_ct                fp2inv610_mont_ct
 #define fp2inv_mont_bingcd            fp2inv610_mont_bingcd
 #define fpequal_non_constant_time     fpequal610_non_constant_time
 #define mp_add_asm                    mp_add610_asm
@@ -138,6 +145,7 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define EphemeralSecretAgreement_B    EphemeralSecretAgreement_B_SIDHp610
 
 #include "../fpx.c"
+#include "../fpx_simd.c"
 #include "../ec_isogeny.c"
 #include "../sidh.c"
 #include "../sike.c"
\ No newline at end of file
@@ -109,6 +109,7 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define fpinv_mont_ct                 fpinv697_mont_ct
 #define fpinv_chain_mont              fpinv697_chain_mont
 #define fpinv_mont_bingcd             fpinv697_mont_bingcd
+#define fpinv_mont_safegcd            fpinv697_mont_safegcd
 #define fp2copy                       fp2copy697
 #define fp2zero                       fp2zero697
 #define fp2add                        fp2add697
@@ -121,6 +122,10 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define fp2correction                 fp2correction697
 #define fp2mul_mont                   fp2mul697_mont
 #define fp2sqr_mont                   fp2sqr697_mont
+#define fp2mul_simd                   fp2mul697_simd
+#define fp2sqr_simd                   fp2sqr697_simd
+#define fp2add_simd                   fp2add697_simd
+#define fp2sub_simd                   fp2sub697_simd
 #define fp2inv_mont                   fp2inv697_mont
 #define fp2inv_mont_ct                fp2inv697_mont_ct
 #define fp2inv_mont_bingcd            fp2inv697_mont_bingcd
@@ -138,6 +143,7 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define EphemeralSecretAgreement_B    EphemeralSecretAgreement_B_SIDHp697
 
 #include "../fpx.c"
+#include "../fpx_simd.c"
 #include "../ec_isogeny.c"
 #include "../sidh.c"    
 #include "../sike.c"
\ No newline at end of file
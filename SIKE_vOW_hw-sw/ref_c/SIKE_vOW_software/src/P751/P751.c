@@ -112,6 +112,7 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define fpinv_mont_ct                 fpinv751_mont_ct
 #define fpinv_chain_mont              fpinv751_chain_mont
 #define fpinv_mont_bingcd             fpinv751_mont_bingcd
+#define fpinv_mont_safegcd            fpinv751_mont_safegcd
 #define fp2copy                       fp2copy751
 #define fp2zero                       fp2zero751
 #define fp2add                        fp2add751
@@ -124,6 +125,10 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define fp2correction                 fp2correction751
 #define fp2mul_mont                   fp2mul751_mont
 #define fp2sqr_mont                   fp2sqr751_mont
+#define fp2mul_simd                   fp2mul751_simd
+#define fp2sqr_simd                   fp2sqr751_simd
+#define fp2add_simd                   fp2add751_simd
+#define fp2sub_simd                   fp2sub751_simd
 #define fp2inv_mont                   fp2inv751_mont
 #define fp2inv_mont_ct                fp2inv751_mont_ct
 #define fp2inv_mont_bingcd            fp2inv751_mont_bingcd
@@ -141,6 +146,7 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define EphemeralSecretAgreement_B    EphemeralSecretAgreement_B_SIDHp751
 
 #include "../fpx.c"
+#include "../fpx_simd.c"
 #include "../ec_isogeny.c"
 #include "../sidh.c"
 #include "../sike.c"
\ No newline at end of file
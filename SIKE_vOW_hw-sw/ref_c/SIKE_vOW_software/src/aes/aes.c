@@ -25,6 +25,22 @@ void AES128_enc(const uint8_t *plaintext, const uint8_t *schedule, uint8_t *ciph
 #endif
 }
 
+void AES128_cbc_mac(const uint8_t *input, size_t nblocks, const uint8_t *schedule, uint8_t *mac) {
+#ifdef AES_ENABLE_NI
+    aes128_cbc_mac_ni(input, nblocks, schedule, mac);
+#else
+    aes128_cbc_mac_c(input, nblocks, schedule, mac);
+#endif
+}
+
+void AES128_ctr(uint64_t counter, size_t nblocks, const uint8_t *schedule, uint8_t *ciphertext) {
+#ifdef AES_ENABLE_NI
+    aes128_ctr_ni(counter, nblocks, schedule, ciphertext);
+#else
+    aes128_ctr_c(counter, nblocks, schedule, ciphertext);
+#endif
+}
+
 void AES128_free_schedule(uint8_t *schedule) {
     memset(schedule, 0, 16*11);
 }
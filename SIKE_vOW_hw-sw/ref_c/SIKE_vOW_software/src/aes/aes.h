@@ -23,6 +23,18 @@ void AES128_load_schedule(const uint8_t *key, uint8_t *schedule);
  */
 void AES128_enc(const uint8_t *plaintext, const uint8_t *schedule, uint8_t *ciphertext);
 
+/**
+ * AES128 in CBC mode with a zero IV over nblocks full blocks of input, returning the last ciphertext block in mac.
+ * Assumes key schedule was generated by AES128_load_schedule().
+ */
+void AES128_cbc_mac(const uint8_t *input, size_t nblocks, const uint8_t *schedule, uint8_t *mac);
+
+/**
+ * AES128 in CTR mode: encrypts the nblocks blocks holding counter, counter+1, ... in their first 8 bytes (and zeros in the others).
+ * Assumes key schedule was generated by AES128_load_schedule().
+ */
+void AES128_ctr(uint64_t counter, size_t nblocks, const uint8_t *schedule, uint8_t *ciphertext);
+
 /**
  * Function to free a key schedule.
  *
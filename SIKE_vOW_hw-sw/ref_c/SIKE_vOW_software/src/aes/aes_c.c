@@ -322,6 +322,35 @@ void aes128_enc_c(const uint8_t* input, const uint8_t* schedule, uint8_t* output
 }
 
 
+void aes128_cbc_mac_c(const uint8_t* input, size_t nblocks, const uint8_t* schedule, uint8_t* mac)
+{
+  uint8_t block[16] = {0};
+  size_t b, j;
+
+  for (b = 0; b < nblocks; b++) {
+    for (j = 0; j < 16; j++)
+      block[j] ^= input[16*b + j];
+    aes128_enc_c(block, schedule, mac);
+    memcpy(block, mac, 16);
+  }
+  memcpy(mac, block, 16);
+}
+
+
+void aes128_ctr_c(uint64_t counter, size_t nblocks, const uint8_t* schedule, uint8_t* ciphertext)
+{
+  uint8_t block[16] = {0};
+  uint64_t c;
+  size_t b;
+
+  for (b = 0; b < nblocks; b++) {
+    c = counter + b;
+    memcpy(block, &c, sizeof(c));
+    aes128_enc_c(block, schedule, ciphertext + 16*b);
+  }
+}
+
+
 void aes256_enc_c(const uint8_t* input, const uint8_t* schedule, uint8_t* output)
 {
   // Copy input to output, and work in-memory on output
@@ -11,7 +11,11 @@
 
 void aes128_load_schedule_ni(const uint8_t *key, uint8_t *schedule);
 void aes128_enc_ni(const uint8_t *plaintext, const uint8_t *schedule, uint8_t *ciphertext);
+void aes128_cbc_mac_ni(const uint8_t *input, size_t nblocks, const uint8_t *schedule, uint8_t *mac);
+void aes128_ctr_ni(uint64_t counter, size_t nblocks, const uint8_t *schedule, uint8_t *ciphertext);
 void aes128_load_schedule_c(const uint8_t *key, uint8_t *schedule);
 void aes128_enc_c(const uint8_t *plaintext, const uint8_t *schedule, uint8_t *ciphertext);
+void aes128_cbc_mac_c(const uint8_t *input, size_t nblocks, const uint8_t *schedule, uint8_t *mac);
+void aes128_ctr_c(uint64_t counter, size_t nblocks, const uint8_t *schedule, uint8_t *ciphertext);
 
 #endif
@@ -2,6 +2,7 @@
 //
 // This version includes AES128 and AES256, and only implements encryption.
 
+#include <stddef.h>
 #include <stdint.h>
 #include <wmmintrin.h>
 #include "../config.h"
@@ -58,3 +59,59 @@ void aes128_enc_ni(const uint8_t *plaintext, const uint8_t *_schedule, uint8_t *
 
 	_mm_storeu_si128((__m128i *) ciphertext, m);
 }
+
+
+// CBC chaining with the round keys and the chaining value held in registers
+void aes128_cbc_mac_ni(const uint8_t *input, size_t nblocks, const uint8_t *_schedule, uint8_t *mac) {
+	const __m128i *schedule = (const __m128i *) _schedule;
+	__m128i k[11], m = _mm_setzero_si128();
+	size_t b, i;
+
+	for (i = 0; i < 11; i++) {
+		k[i] = _mm_loadu_si128(&schedule[i]);
+	}
+	for (b = 0; b < nblocks; b++) {
+		m = _mm_xor_si128(m, _mm_loadu_si128((const __m128i *) (input + 16*b)));
+		m = _mm_xor_si128(m, k[0]);
+		for (i = 1; i < 10; i++) {
+			m = _mm_aesenc_si128(m, k[i]);
+		}
+		m = _mm_aesenclast_si128(m, k[10]);
+	}
+
+	_mm_storeu_si128((__m128i *) mac, m);
+}
+
+
+#define CTR_LANES 8
+
+// CTR mode on CTR_LANES counters at a time, with their rounds interleaved to hide the latency of AESENC
+void aes128_ctr_ni(uint64_t counter, size_t nblocks, const uint8_t *_schedule, uint8_t *ciphertext) {
+	const __m128i *schedule = (const __m128i *) _schedule;
+	__m128i k[11], m[CTR_LANES];
+	size_t b, i, j;
+
+	for (i = 0; i < 11; i++) {
+		k[i] = _mm_loadu_si128(&schedule[i]);
+	}
+	for (b = 0; b + CTR_LANES <= nblocks; b += CTR_LANES) {
+		for (j = 0; j < CTR_LANES; j++) {
+			m[j] = _mm_xor_si128(_mm_set_epi64x(0, (long long)(counter + b + j)), k[0]);
+		}
+		for (i = 1; i < 10; i++) {
+			for (j = 0; j < CTR_LANES; j++) {
+				m[j] = _mm_aesenc_si128(m[j], k[i]);
+			}
+		}
+		for (j = 0; j < CTR_LANES; j++) {
+			_mm_storeu_si128((__m128i *) (ciphertext + 16*(b + j)), _mm_aesenclast_si128(m[j], k[10]));
+		}
+	}
+	for (; b < nblocks; b++) {
+		m[0] = _mm_xor_si128(_mm_set_epi64x(0, (long long)(counter + b)), k[0]);
+		for (i = 1; i < 10; i++) {
+			m[0] = _mm_aesenc_si128(m[0], k[i]);
+		}
+		_mm_storeu_si128((__m128i *) (ciphertext + 16*b), _mm_aesenclast_si128(m[0], k[10]));
+	}
+}
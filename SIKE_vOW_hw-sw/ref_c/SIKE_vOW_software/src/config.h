@@ -108,6 +108,19 @@ typedef uint64_t uint128_t[2];
 #error-- "Unsupported configuration"
 #endif
 
+// Lane-parallel GF(p^2) arithmetic for the lockstep vOW walks (fpx_simd.c). The backends are compiled in with 
+// _SIMD_AVX2_ and _SIMD_AVX512_, and selected at run time
+
+#define SIMD_SCALAR     0    // No SIMD, one walk at a time
+#define SIMD_AVX2       1    // AVX2, 4 lanes of 28-bit limbs
+#define SIMD_AVX512     2    // AVX-512 IFMA, 8 lanes of 52-bit limbs
+#define SIMD_AUTO       3    // Widest backend supported by the CPU
+
+#if (defined(_SIMD_AVX2_) || defined(_SIMD_AVX512_)) && (TARGET == TARGET_AMD64) && (OS_TARGET == OS_LINUX) && \
+    (COMPILER == COMPILER_GCC || COMPILER == COMPILER_CLANG) && !defined(MontgomeryMultiplier_HARDWARE)
+#define SIMD_SUPPORT
+#endif
+
 // Macro definitions
 
 #define NBITS_TO_NBYTES(nbits) (((nbits) + 7) / 8)                                             // Conversion macro from number of bits to number of bytes
@@ -6,9 +6,16 @@
     extern const uint64_t Montgomery_one[NWORDS64_FIELD];
     #define fpcopy                        fpcopy128
     #define fpzero                        fpzero128
+    #define fpadd                         fpadd128
+    #define fpdiv2                        fpdiv2_128
+    #define fpcorrection                  fpcorrection128
+    #define fpmul_mont                    fpmul128_mont
+    #define fpsqr_mont                    fpsqr128_mont
     #define fpsub                         fpsub128
     #define fpneg                         fpneg128
     #define fp2copy                       fp2copy128
+    #define fp2zero                       fp2zero128
+    #define fp2div2                       fp2div2_128
     #define fp2add                        fp2add128
     #define fp2sub                        fp2sub128
     #define fp2neg                        fp2neg128
@@ -17,16 +24,22 @@
     #define fp2sqr_mont                   fp2sqr128_mont
     #define fpinv_mont                    fpinv128_mont
     #define fp2inv_mont                   fp2inv128_mont
-    #define MEMORY_LOG_SIZE               9          
-    #define MEMORY_SIZE                   512           // Memory limited to 32-bit, assumes that MEMORY_SIZE <= 2^RADIX
+    #define DEFAULT_MEMORY_LOG_SIZE       9             // Default w = 2^9 triples, can be changed at runtime
 #elif defined(P377)
     #include "P377/P377_internal.h"
     extern const uint64_t Montgomery_one[NWORDS64_FIELD];
     #define fpcopy                        fpcopy377
     #define fpzero                        fpzero377
+    #define fpadd                         fpadd377
+    #define fpdiv2                        fpdiv2_377
+    #define fpcorrection                  fpcorrection377
+    #define fpmul_mont                    fpmul377_mont
+    #define fpsqr_mont                    fpsqr377_mont
     #define fpsub                         fpsub377
     #define fpneg                         fpneg377
     #define fp2copy                       fp2copy377
+    #define fp2zero                       fp2zero377
+    #define fp2div2                       fp2div2_377
     #define fp2add                        fp2add377
     #define fp2sub                        fp2sub377
     #define fp2neg                        fp2neg377
@@ -35,16 +48,22 @@
     #define fp2sqr_mont                   fp2sqr377_mont
     #define fpinv_mont                    fpinv377_mont
     #define fp2inv_mont                   fp2inv377_mont
-    #define MEMORY_LOG_SIZE               10          
-    #define MEMORY_SIZE                   1024          
+    #define DEFAULT_MEMORY_LOG_SIZE       10            // Default w = 2^10 triples, can be changed at runtime
 #elif defined(P434)
     #include "P434/P434_internal.h"
     extern const uint64_t Montgomery_one[NWORDS64_FIELD];
     #define fpcopy                        fpcopy434
     #define fpzero                        fpzero434
+    #define fpadd                         fpadd434
+    #define fpdiv2                        fpdiv2_434
+    #define fpcorrection                  fpcorrection434
+    #define fpmul_mont                    fpmul434_mont
+    #define fpsqr_mont                    fpsqr434_mont
     #define fpsub                         fpsub434
     #define fpneg                         fpneg434
     #define fp2copy                       fp2copy434
+    #define fp2zero                       fp2zero434
+    #define fp2div2                       fp2div2_434
     #define fp2add                        fp2add434
     #define fp2sub                        fp2sub434
     #define fp2neg                        fp2neg434
@@ -53,16 +72,22 @@
     #define fp2sqr_mont                   fp2sqr434_mont
     #define fpinv_mont                    fpinv434_mont
     #define fp2inv_mont                   fp2inv434_mont
-    #define MEMORY_LOG_SIZE               10          
-    #define MEMORY_SIZE                   1024          
+    #define DEFAULT_MEMORY_LOG_SIZE       10            // Default w = 2^10 triples, can be changed at runtime
 #elif defined(P503)
     #include "P503/P503_internal.h"
     extern const uint64_t Montgomery_one[NWORDS64_FIELD];
     #define fpcopy                        fpcopy503
     #define fpzero                        fpzero503
+    #define fpadd                         fpadd503
+    #define fpdiv2                        fpdiv2_503
+    #define fpcorrection                  fpcorrection503
+    #define fpmul_mont                    fpmul503_mont
+    #define fpsqr_mont                    fpsqr503_mont
     #define fpsub                         fpsub503
     #define fpneg                         fpneg503
     #define fp2copy                       fp2copy503
+    #define fp2zero                       fp2zero503
+    #define fp2div2                       fp2div2_503
     #define fp2add                        fp2add503
     #define fp2sub                        fp2sub503
     #define fp2neg                        fp2neg503
@@ -71,8 +96,103 @@
     #define fp2sqr_mont                   fp2sqr503_mont
     #define fpinv_mont                    fpinv503_mont
     #define fp2inv_mont                   fp2inv503_mont
-    #define MEMORY_LOG_SIZE               10          
-    #define MEMORY_SIZE                   1024          
+    #define DEFAULT_MEMORY_LOG_SIZE       10            // Default w = 2^10 triples, can be changed at runtime
+#elif defined(P546)
+    #include "P546/P546_internal.h"
+    extern const uint64_t Montgomery_one[NWORDS64_FIELD];
+    #define fpcopy                        fpcopy546
+    #define fpzero                        fpzero546
+    #define fpadd                         fpadd546
+    #define fpdiv2                        fpdiv2_546
+    #define fpcorrection                  fpcorrection546
+    #define fpmul_mont                    fpmul546_mont
+    #define fpsqr_mont                    fpsqr546_mont
+    #define fpsub                         fpsub546
+    #define fpneg                         fpneg546
+    #define fp2copy                       fp2copy546
+    #define fp2zero                       fp2zero546
+    #define fp2div2                       fp2div2_546
+    #define fp2add                        fp2add546
+    #define fp2sub                        fp2sub546
+    #define fp2neg                        fp2neg546
+    #define fp2correction                 fp2correction546
+    #define fp2mul_mont                   fp2mul546_mont
+    #define fp2sqr_mont                   fp2sqr546_mont
+    #define fpinv_mont                    fpinv546_mont
+    #define fp2inv_mont                   fp2inv546_mont
+    #define DEFAULT_MEMORY_LOG_SIZE       10            // Default w = 2^10 triples, can be changed at runtime
+#elif defined(P610)
+    #include "P610/P610_internal.h"
+    extern const uint64_t Montgomery_one[NWORDS64_FIELD];
+    #define fpcopy                        fpcopy610
+    #define fpzero                        fpzero610
+    #define fpadd                         fpadd610
+    #define fpdiv2                        fpdiv2_610
+    #define fpcorrection                  fpcorrection610
+    #define fpmul_mont                    fpmul610_mont
+    #define fpsqr_mont                    fpsqr610_mont
+    #define fpsub                         fpsub610
+    #define fpneg                         fpneg610
+    #define fp2copy                       fp2copy610
+    #define fp2zero                       fp2zero610
+    #define fp2div2                       fp2div2_610
+    #define fp2add                        fp2add610
+    #define fp2sub                        fp2sub610
+    #define fp2neg                        fp2neg610
+    #define fp2correction                 fp2correction610
+    #define fp2mul_mont                   fp2mul610_mont
+    #define fp2sqr_mont                   fp2sqr610_mont
+    #define fpinv_mont                    fpinv610_mont
+    #define fp2inv_mont                   fp2inv610_mont
+    #define DEFAULT_MEMORY_LOG_SIZE       10            // Default w = 2^10 triples, can be changed at runtime
+#elif defined(P697)
+    #include "P697/P697_internal.h"
+    extern const uint64_t Montgomery_one[NWORDS64_FIELD];
+    #define fpcopy                        fpcopy697
+    #define fpzero                        fpzero697
+    #define fpadd                         fpadd697
+    #define fpdiv2                        fpdiv2_697
+    #define fpcorrection                  fpcorrection697
+    #define fpmul_mont                    fpmul697_mont
+    #define fpsqr_mont                    fpsqr697_mont
+    #define fpsub                         fpsub697
+    #define fpneg                         fpneg697
+    #define fp2copy                       fp2copy697
+    #define fp2zero                       fp2zero697
+    #define fp2div2                       fp2div2_697
+    #define fp2add                        fp2add697
+    #define fp2sub                        fp2sub697
+    #define fp2neg                        fp2neg697
+    #define fp2correction                 fp2correction697
+    #define fp2mul_mont                   fp2mul697_mont
+    #define fp2sqr_mont                   fp2sqr697_mont
+    #define fpinv_mont                    fpinv697_mont
+    #define fp2inv_mont                   fp2inv697_mont
+    #define DEFAULT_MEMORY_LOG_SIZE       10            // Default w = 2^10 triples, can be changed at runtime
+#elif defined(P751)
+    #include "P751/P751_internal.h"
+    extern const uint64_t Montgomery_one[NWORDS64_FIELD];
+    #define fpcopy                        fpcopy751
+    #define fpzero                        fpzero751
+    #define fpadd                         fpadd751
+    #define fpdiv2                        fpdiv2_751
+    #define fpcorrection                  fpcorrection751
+    #define fpmul_mont                    fpmul751_mont
+    #define fpsqr_mont                    fpsqr751_mont
+    #define fpsub                         fpsub751
+    #define fpneg                         fpneg751
+    #define fp2copy                       fp2copy751
+    #define fp2zero                       fp2zero751
+    #define fp2div2                       fp2div2_751
+    #define fp2add                        fp2add751
+    #define fp2sub                        fp2sub751
+    #define fp2neg                        fp2neg751
+    #define fp2correction                 fp2correction751
+    #define fp2mul_mont                   fp2mul751_mont
+    #define fp2sqr_mont                   fp2sqr751_mont
+    #define fpinv_mont                    fpinv751_mont
+    #define fp2inv_mont                   fp2inv751_mont
+    #define DEFAULT_MEMORY_LOG_SIZE       10            // Default w = 2^10 triples, can be changed at runtime
 #endif
 
 typedef uint64_t f2elm_t64[2*NWORDS64_FIELD];
@@ -10,6 +10,8 @@
 *
 * Abstract: elliptic curve and isogeny functions
 *********************************************************************************************/
+#include "profile.h"
+
 #ifdef XDBLE_HARDWARE
 #include <xDBLe_hw.h>
 #endif
@@ -410,10 +412,36 @@ static void LADDER3PT(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xPQ, con
     swap_points(R, R2, mask);
 }
 
-unsigned long dbleloop_count = 0;
-unsigned long dbl_count = 0;
-unsigned long get4iso_count = 0;
-unsigned long eval4iso_count = 0;
+#if defined(_PROFILE_)
+PROFILE_THREAD_LOCAL profile_t profile_thread;
+profile_t profile_total;
+
+void profile_flush(void)
+{ // Adds the counters of the calling thread to the totals and clears them
+#pragma omp critical(vow_profile)
+    {
+        for (unsigned int i = 0; i < PROFILE_STAGES; i++) {
+            profile_total.cycles[i] += profile_thread.cycles[i];
+            profile_total.calls[i] += profile_thread.calls[i];
+            profile_thread.cycles[i] = 0;
+            profile_thread.calls[i] = 0;
+        }
+    }
+}
+
+void profile_reset(void)
+{ // Clears the totals and the counters of the calling thread
+#pragma omp critical(vow_profile)
+    {
+        for (unsigned int i = 0; i < PROFILE_STAGES; i++) {
+            profile_total.cycles[i] = 0;
+            profile_total.calls[i] = 0;
+            profile_thread.cycles[i] = 0;
+            profile_thread.calls[i] = 0;
+        }
+    }
+}
+#endif
 
 void TraverseTree(f2elm_t jinv, point_proj_t R, f2elm_t A24plus, f2elm_t C24, const unsigned int *strat, unsigned int lenstrat, bool keygen,
                   point_proj_t phiP, point_proj_t phiQ, point_proj_t phiR) 
@@ -428,12 +456,11 @@ void TraverseTree(f2elm_t jinv, point_proj_t R, f2elm_t A24plus, f2elm_t C24, co
             fp2copy(R->Z, pts[npts]->Z);
             pts_index[npts++] = index;
             m = strat[ii++];
-            dbleloop_count++;                   // COUNTER
-            dbl_count+=2*m;                     // COUNTER
+            PROFILE_BEGIN(PROFILE_XDBLE);
             xDBLe(R, R, A24plus, C24, (int)(2*m));
+            PROFILE_END(PROFILE_XDBLE);
             index += m;
         }
-        get4iso_count++;                        // COUNTER
 
 #ifdef GET_4_ISOG_AND_EVAL_4_ISOG_HARDWARE
             // start get_4_isog computation
@@ -451,7 +478,6 @@ void TraverseTree(f2elm_t jinv, point_proj_t R, f2elm_t A24plus, f2elm_t C24, co
                                           (digit_t*)&(C24[1]), 
                                           1, 0, 0);
             // first eval_4_isog computation
-           eval4iso_count++;
            get_4_isog_and_eval_4_isog_hw((digit_t*)&((pts[0]->X)[0]), 
                                          (digit_t*)&((pts[0]->X)[1]), 
                                          (digit_t*)&((pts[0]->Z)[0]), 
@@ -469,7 +495,6 @@ void TraverseTree(f2elm_t jinv, point_proj_t R, f2elm_t A24plus, f2elm_t C24, co
             if (keygen) {
                 for (i = 1; i < npts; i++)  {
                     // middle eval_4_isog computations
-                    eval4iso_count++;
                     get_4_isog_and_eval_4_isog_hw((digit_t*)&((pts[i]->X)[0]), 
                                                   (digit_t*)&((pts[i]->X)[1]), 
                                                   (digit_t*)&((pts[i]->Z)[0]), 
@@ -544,7 +569,6 @@ void TraverseTree(f2elm_t jinv, point_proj_t R, f2elm_t A24plus, f2elm_t C24, co
           else {
               for (i = 1; i < npts; i++)  {
                   // middle eval_4_isog computations
-                  eval4iso_count++;
                   get_4_isog_and_eval_4_isog_hw((digit_t*)&((pts[i]->X)[0]), 
                                                 (digit_t*)&((pts[i]->X)[1]), 
                                                 (digit_t*)&((pts[i]->Z)[0]), 
@@ -576,7 +600,9 @@ void TraverseTree(f2elm_t jinv, point_proj_t R, f2elm_t A24plus, f2elm_t C24, co
           }
 
 #else
+        PROFILE_BEGIN(PROFILE_GET_4_ISOG);
         get_4_isog(R, A24plus, C24, coeff);
+        PROFILE_END(PROFILE_GET_4_ISOG);
         if (keygen) {
             eval_4_isog(phiP, coeff);
             eval_4_isog(phiQ, coeff);
@@ -584,8 +610,9 @@ void TraverseTree(f2elm_t jinv, point_proj_t R, f2elm_t A24plus, f2elm_t C24, co
         }
 
         for (i = 0; i < npts; i++) {
-            eval4iso_count++;                   // COUNTER
+            PROFILE_BEGIN(PROFILE_EVAL_4_ISOG);
             eval_4_isog(pts[i], coeff);
+            PROFILE_END(PROFILE_EVAL_4_ISOG);
         }
 #endif
 
@@ -594,7 +621,6 @@ void TraverseTree(f2elm_t jinv, point_proj_t R, f2elm_t A24plus, f2elm_t C24, co
         index = pts_index[npts-1];
         npts -= 1;
     }
-    get4iso_count++;                            // COUNTER
 #ifdef GET_4_ISOG_AND_EVAL_4_ISOG_HARDWARE 
     // start get_4_isog computation
     get_4_isog_and_eval_4_isog_hw((digit_t*)&((R->X)[0]), 
@@ -611,7 +637,9 @@ void TraverseTree(f2elm_t jinv, point_proj_t R, f2elm_t A24plus, f2elm_t C24, co
                                   (digit_t*)&(C24[1]), 
                                   1, 0, 0);
 #else
+    PROFILE_BEGIN(PROFILE_GET_4_ISOG);
     get_4_isog(R, A24plus, C24, coeff);
+    PROFILE_END(PROFILE_GET_4_ISOG);
 #endif
     if (keygen) {
 #ifdef GET_4_ISOG_AND_EVAL_4_ISOG_HARDWARE
@@ -684,6 +712,353 @@ void TraverseTree(f2elm_t jinv, point_proj_t R, f2elm_t A24plus, f2elm_t C24, co
         fp2add(A24plus, A24plus, A24plus);
         fp2sub(A24plus, C24, A24plus);
         fp2add(A24plus, A24plus, A24plus);
+        PROFILE_BEGIN(PROFILE_J_INV);
         j_inv(A24plus, C24, jinv);
+        PROFILE_END(PROFILE_J_INV);
+    }
+}
+
+// Lockstep versions of the functions above for several vOW walks. Each field operation is applied to all walks 
+// before moving on to the next one, so that independent operations are issued back to back.
+
+void xDBLe_batch(point_proj_batch_t P, const f2elm_t* A24plus, const f2elm_t* C24, const int e, const unsigned int n)
+{ // Computes [2^e](X:Z) in place for n walks, each on its own Montgomery curve with projective constants A+2C and 4C.
+  // Input: projective Montgomery x-coordinates P[k] = (XP:ZP) and curve constants A24plus[k], C24[k], for k < n.
+  // Output: projective Montgomery x-coordinates P[k] <- (2^e)*P[k].
+    f2elm_t t0[MAX_WALKS], t1[MAX_WALKS];
+    unsigned int k;
+    int i;
+
+    for (i = 0; i < e; i++) {
+        for (k = 0; k < n; k++) {
+            mp2_sub_p2(P->X[k], P->Z[k], t0[k]);    // t0 = X1-Z1
+            mp2_add(P->X[k], P->Z[k], t1[k]);       // t1 = X1+Z1
+        }
+        for (k = 0; k < n; k++)
+            fp2sqr_mont(t0[k], t0[k]);              // t0 = (X1-Z1)^2 
+        for (k = 0; k < n; k++)
+            fp2sqr_mont(t1[k], t1[k]);              // t1 = (X1+Z1)^2 
+        for (k = 0; k < n; k++)
+            fp2mul_mont(C24[k], t0[k], P->Z[k]);    // Z2 = C24*(X1-Z1)^2   
+        for (k = 0; k < n; k++) {
+            fp2mul_mont(t1[k], P->Z[k], P->X[k]);   // X2 = C24*(X1-Z1)^2*(X1+Z1)^2
+            mp2_sub_p2(t1[k], t0[k], t1[k]);        // t1 = (X1+Z1)^2-(X1-Z1)^2 
+        }
+        for (k = 0; k < n; k++) {
+            fp2mul_mont(A24plus[k], t1[k], t0[k]);  // t0 = A24plus*[(X1+Z1)^2-(X1-Z1)^2]
+            mp2_add(P->Z[k], t0[k], P->Z[k]);       // Z2 = A24plus*[(X1+Z1)^2-(X1-Z1)^2] + C24*(X1-Z1)^2
+        }
+        for (k = 0; k < n; k++)
+            fp2mul_mont(P->Z[k], t1[k], P->Z[k]);   // Z2 = [A24plus*[(X1+Z1)^2-(X1-Z1)^2] + C24*(X1-Z1)^2]*[(X1+Z1)^2-(X1-Z1)^2]
+    }
+}
+
+
+void xADD_batch(point_proj_batch_t Q, const point_proj_batch_t P2, const f2elm_t* xPQ, const unsigned int n)
+{ // Differential additions Q[k] <- P2[k]+Q[k] for n walks, with affine differences xPQ[k] (see xADD()).
+    f2elm_t t0[MAX_WALKS], t1[MAX_WALKS], t2[MAX_WALKS];
+    unsigned int k;
+
+    for (k = 0; k < n; k++) {
+        mp2_add(P2->X[k], P2->Z[k], t0[k]);             // t0 = XP+ZP
+        mp2_sub_p2(P2->X[k], P2->Z[k], t1[k]);          // t1 = XP-ZP
+        mp2_sub_p2(Q->X[k], Q->Z[k], t2[k]);            // t2 = XQ-ZQ
+        mp2_add(Q->X[k], Q->Z[k], Q->X[k]);             // XQ = XQ+ZQ
+    }
+    for (k = 0; k < n; k++)
+        fp2mul_mont(t0[k], t2[k], t0[k]);               // t0 = (XP+ZP)*(XQ-ZQ)
+    for (k = 0; k < n; k++)
+        fp2mul_mont(t1[k], Q->X[k], t1[k]);             // t1 = (XP-ZP)*(XQ+ZQ)
+    for (k = 0; k < n; k++) {
+        mp2_sub_p2(t0[k], t1[k], Q->Z[k]);              // ZQ = (XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)
+        mp2_add(t0[k], t1[k], Q->X[k]);                 // XQ = (XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)
+    }
+    for (k = 0; k < n; k++)
+        fp2sqr_mont(Q->Z[k], Q->Z[k]);                  // ZQ = [(XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)]^2
+    for (k = 0; k < n; k++)
+        fp2sqr_mont(Q->X[k], Q->X[k]);                  // XQ = [(XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)]^2
+    for (k = 0; k < n; k++)
+        fp2mul_mont(Q->Z[k], xPQ[k], Q->Z[k]);          // ZQ = xPQ*[(XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)]^2
+}
+
+
+void get_4_isog_batch(const point_proj_batch_t P, f2elm_t* A24plus, f2elm_t* C24, f2elm_t coeff[3][MAX_WALKS], const unsigned int n)
+{ // Computes the corresponding 4-isogenies of n projective Montgomery points of order 4 (see get_4_isog()).
+    unsigned int k;
+
+    for (k = 0; k < n; k++) {
+        mp2_sub_p2(P->X[k], P->Z[k], coeff[1][k]);      // coeff[1] = X4-Z4
+        mp2_add(P->X[k], P->Z[k], coeff[2][k]);         // coeff[2] = X4+Z4
+    }
+    for (k = 0; k < n; k++)
+        fp2sqr_mont(P->Z[k], coeff[0][k]);              // coeff[0] = Z4^2
+    for (k = 0; k < n; k++)
+        fp2sqr_mont(P->X[k], A24plus[k]);               // A24plus = X4^2
+    for (k = 0; k < n; k++) {
+        mp2_add(coeff[0][k], coeff[0][k], coeff[0][k]); // coeff[0] = 2*Z4^2
+        mp2_add(A24plus[k], A24plus[k], A24plus[k]);    // A24plus = 2*X4^2
+    }
+    for (k = 0; k < n; k++)
+        fp2sqr_mont(coeff[0][k], C24[k]);               // C24 = 4*Z4^4
+    for (k = 0; k < n; k++)
+        fp2sqr_mont(A24plus[k], A24plus[k]);            // A24plus = 4*X4^4
+    for (k = 0; k < n; k++)
+        mp2_add(coeff[0][k], coeff[0][k], coeff[0][k]); // coeff[0] = 4*Z4^2
+}
+
+
+void eval_4_isog_batch(point_proj_batch_t P, f2elm_t coeff[3][MAX_WALKS], const unsigned int n)
+{ // Evaluates n 4-isogenies, each at its own point P[k] = (X:Z) in place (see eval_4_isog()).
+    f2elm_t t0[MAX_WALKS], t1[MAX_WALKS];
+    unsigned int k;
+
+    for (k = 0; k < n; k++) {
+        mp2_add(P->X[k], P->Z[k], t0[k]);               // t0 = X+Z
+        mp2_sub_p2(P->X[k], P->Z[k], t1[k]);            // t1 = X-Z
+    }
+    for (k = 0; k < n; k++)
+        fp2mul_mont(t0[k], coeff[1][k], P->X[k]);       // X = (X+Z)*coeff[1]
+    for (k = 0; k < n; k++)
+        fp2mul_mont(t1[k], coeff[2][k], P->Z[k]);       // Z = (X-Z)*coeff[2]
+    for (k = 0; k < n; k++)
+        fp2mul_mont(t0[k], t1[k], t0[k]);               // t0 = (X+Z)*(X-Z)
+    for (k = 0; k < n; k++) {
+        fp2mul_mont(coeff[0][k], t0[k], t0[k]);         // t0 = coeff[0]*(X+Z)*(X-Z)
+        mp2_add(P->X[k], P->Z[k], t1[k]);               // t1 = (X-Z)*coeff[2] + (X+Z)*coeff[1]
+        mp2_sub_p2(P->X[k], P->Z[k], P->Z[k]);          // Z = (X-Z)*coeff[2] - (X+Z)*coeff[1]
+    }
+    for (k = 0; k < n; k++)
+        fp2sqr_mont(t1[k], t1[k]);                      // t1 = [(X-Z)*coeff[2] + (X+Z)*coeff[1]]^2
+    for (k = 0; k < n; k++) {
+        fp2sqr_mont(P->Z[k], P->Z[k]);                  // Z = [(X-Z)*coeff[2] - (X+Z)*coeff[1]]^2
+        mp2_add(t1[k], t0[k], P->X[k]);                 // X = coeff[0]*(X+Z)*(X-Z) + [(X-Z)*coeff[2] + (X+Z)*coeff[1]]^2
+    }
+    for (k = 0; k < n; k++) {
+        mp2_sub_p2(P->Z[k], t0[k], t0[k]);              // t0 = [(X-Z)*coeff[2] - (X+Z)*coeff[1]]^2 - coeff[0]*(X+Z)*(X-Z)
+        fp2mul_mont(P->X[k], t1[k], P->X[k]);           // Xfinal
+    }
+    for (k = 0; k < n; k++)
+        fp2mul_mont(P->Z[k], t0[k], P->Z[k]);           // Zfinal
+}
+
+
+void j_inv_batch(const f2elm_t* A, const f2elm_t* C, f2elm_t* jinv, const unsigned int n)
+{ // Computes the j-invariants of n Montgomery curves with projective constants, sharing a single inversion (Montgomery's trick).
+  // Input: A[k],C[k] in GF(p^2), for k < n.
+  // Output: jinv[k] = 256*(A^2-3*C^2)^3/(C^4*(A^2-4*C^2)) (see j_inv()).
+    f2elm_t t0[MAX_WALKS], t1[MAX_WALKS], prod[MAX_WALKS], inv;
+    unsigned int k;
+
+    if (n == 0)
+        return;
+
+    // Numerators t0 and denominators jinv as in j_inv()
+    for (k = 0; k < n; k++)
+        fp2sqr_mont(A[k], jinv[k]);                 // jinv = A^2        
+    for (k = 0; k < n; k++)
+        fp2sqr_mont(C[k], t1[k]);                   // t1 = C^2
+    for (k = 0; k < n; k++) {
+        fp2add(t1[k], t1[k], t0[k]);                // t0 = t1+t1
+        fp2sub(jinv[k], t0[k], t0[k]);              // t0 = jinv-t0
+        fp2sub(t0[k], t1[k], t0[k]);                // t0 = t0-t1
+        fp2sub(t0[k], t1[k], jinv[k]);              // jinv = t0-t1
+    }
+    for (k = 0; k < n; k++)
+        fp2sqr_mont(t1[k], t1[k]);                  // t1 = t1^2
+    for (k = 0; k < n; k++) {
+        fp2mul_mont(jinv[k], t1[k], jinv[k]);       // jinv = jinv*t1
+        fp2add(t0[k], t0[k], t0[k]);                // t0 = t0+t0
+        fp2add(t0[k], t0[k], t0[k]);                // t0 = t0+t0
+    }
+    for (k = 0; k < n; k++)
+        fp2sqr_mont(t0[k], t1[k]);                  // t1 = t0^2
+    for (k = 0; k < n; k++) {
+        fp2mul_mont(t0[k], t1[k], t0[k]);           // t0 = t0*t1
+        fp2add(t0[k], t0[k], t0[k]);                // t0 = t0+t0
+        fp2add(t0[k], t0[k], t0[k]);                // t0 = t0+t0
+    }
+
+    // Simultaneous inversion of the denominators
+    fp2copy(jinv[0], prod[0]);
+    for (k = 1; k < n; k++)
+        fp2mul_mont(prod[k-1], jinv[k], prod[k]);   // prod[k] = jinv[0]*...*jinv[k]
+    fp2copy(prod[n-1], inv);
+    fp2inv_mont(inv);                               // inv = 1/(jinv[0]*...*jinv[n-1])
+    for (k = n-1; k > 0; k--) {
+        fp2mul_mont(inv, prod[k-1], t1[k]);         // t1 = 1/jinv[k]
+        fp2mul_mont(inv, jinv[k], inv);             // inv = 1/(jinv[0]*...*jinv[k-1])
+        fp2mul_mont(t0[k], t1[k], jinv[k]);         // jinv = t0/jinv
     }
-}
\ No newline at end of file
+    fp2mul_mont(t0[0], inv, jinv[0]);
+}
+
+
+#if defined(SIMD_SUPPORT)
+
+// Versions of the lockstep functions on the lane-parallel arithmetic (fpx_simd.c), with one walk per lane
+
+static void xDBLe_simd(vf2elm_t X, vf2elm_t Z, const vf2elm_t A24plus, const vf2elm_t C24, const int e, const unsigned int n)
+{ // Computes [2^e](X:Z) in place for the walks in the first n lanes (see xDBLe_batch()).
+    vf2elm_t t0, t1;
+    int i;
+
+    for (i = 0; i < e; i++) {
+        fp2sub_simd(X, Z, t0, n);                   // t0 = X1-Z1
+        fp2add_simd(X, Z, t1, n);                   // t1 = X1+Z1
+        fp2sqr_simd(t0, t0, n);                     // t0 = (X1-Z1)^2 
+        fp2sqr_simd(t1, t1, n);                     // t1 = (X1+Z1)^2 
+        fp2mul_simd(C24, t0, Z, n);                 // Z2 = C24*(X1-Z1)^2   
+        fp2mul_simd(t1, Z, X, n);                   // X2 = C24*(X1-Z1)^2*(X1+Z1)^2
+        fp2sub_simd(t1, t0, t1, n);                 // t1 = (X1+Z1)^2-(X1-Z1)^2 
+        fp2mul_simd(A24plus, t1, t0, n);            // t0 = A24plus*[(X1+Z1)^2-(X1-Z1)^2]
+        fp2add_simd(Z, t0, Z, n);                   // Z2 = A24plus*[(X1+Z1)^2-(X1-Z1)^2] + C24*(X1-Z1)^2
+        fp2mul_simd(Z, t1, Z, n);                   // Z2 = [A24plus*[(X1+Z1)^2-(X1-Z1)^2] + C24*(X1-Z1)^2]*[(X1+Z1)^2-(X1-Z1)^2]
+    }
+}
+
+
+static void get_4_isog_simd(const vf2elm_t X, const vf2elm_t Z, vf2elm_t A24plus, vf2elm_t C24, vf2elm_t* coeff, const unsigned int n)
+{ // Computes the 4-isogenies of the points of order 4 in the first n lanes (see get_4_isog_batch()).
+    fp2sub_simd(X, Z, coeff[1], n);                 // coeff[1] = X4-Z4
+    fp2add_simd(X, Z, coeff[2], n);                 // coeff[2] = X4+Z4
+    fp2sqr_simd(Z, coeff[0], n);                    // coeff[0] = Z4^2
+    fp2sqr_simd(X, A24plus, n);                     // A24plus = X4^2
+    fp2add_simd(coeff[0], coeff[0], coeff[0], n);   // coeff[0] = 2*Z4^2
+    fp2add_simd(A24plus, A24plus, A24plus, n);      // A24plus = 2*X4^2
+    fp2sqr_simd(coeff[0], C24, n);                  // C24 = 4*Z4^4
+    fp2sqr_simd(A24plus, A24plus, n);               // A24plus = 4*X4^4
+    fp2add_simd(coeff[0], coeff[0], coeff[0], n);   // coeff[0] = 4*Z4^2
+}
+
+
+static void eval_4_isog_simd(vf2elm_t X, vf2elm_t Z, vf2elm_t* coeff, const unsigned int n)
+{ // Evaluates the 4-isogenies in the first n lanes at the points (X:Z) in place (see eval_4_isog_batch()).
+    vf2elm_t t0, t1;
+
+    fp2add_simd(X, Z, t0, n);                       // t0 = X+Z
+    fp2sub_simd(X, Z, t1, n);                       // t1 = X-Z
+    fp2mul_simd(t0, coeff[1], X, n);                // X = (X+Z)*coeff[1]
+    fp2mul_simd(t1, coeff[2], Z, n);                // Z = (X-Z)*coeff[2]
+    fp2mul_simd(t0, t1, t0, n);                     // t0 = (X+Z)*(X-Z)
+    fp2mul_simd(coeff[0], t0, t0, n);               // t0 = coeff[0]*(X+Z)*(X-Z)
+    fp2add_simd(X, Z, t1, n);                       // t1 = (X-Z)*coeff[2] + (X+Z)*coeff[1]
+    fp2sub_simd(X, Z, Z, n);                        // Z = (X-Z)*coeff[2] - (X+Z)*coeff[1]
+    fp2sqr_simd(t1, t1, n);                         // t1 = [(X-Z)*coeff[2] + (X+Z)*coeff[1]]^2
+    fp2sqr_simd(Z, Z, n);                           // Z = [(X-Z)*coeff[2] - (X+Z)*coeff[1]]^2
+    fp2add_simd(t1, t0, X, n);                      // X = coeff[0]*(X+Z)*(X-Z) + [(X-Z)*coeff[2] + (X+Z)*coeff[1]]^2
+    fp2sub_simd(Z, t0, t0, n);                      // t0 = [(X-Z)*coeff[2] - (X+Z)*coeff[1]]^2 - coeff[0]*(X+Z)*(X-Z)
+    fp2mul_simd(X, t1, X, n);                       // Xfinal
+    fp2mul_simd(Z, t0, Z, n);                       // Zfinal
+}
+
+
+static void TraverseTree_simd(f2elm_t* jinv, point_proj_batch_t R, f2elm_t* A24plus, f2elm_t* C24, const unsigned int *strat, unsigned int lenstrat, const unsigned int n)
+{ // Isogeny tree traversal for the walks in the first n lanes (see TraverseTree_batch()).
+  // Output: the j-invariants of the n codomain curves.
+    vf2elm_t X, Z, A, C, ptsX[MAX_INT_POINTS_ALICE], ptsZ[MAX_INT_POINTS_ALICE], coeff[3];
+    unsigned int i, k, m, row, ii = 0, index = 0, npts = 0, pts_index[MAX_INT_POINTS_ALICE];
+
+    to_fp2simd((const f2elm_t*)R->X, X, n);
+    to_fp2simd((const f2elm_t*)R->Z, Z, n);
+    to_fp2simd((const f2elm_t*)A24plus, A, n);
+    to_fp2simd((const f2elm_t*)C24, C, n);
+
+    for (row = 1; row < lenstrat; row++) {
+        while (index < lenstrat - row) {
+            memcpy(ptsX[npts], X, sizeof(vf2elm_t));
+            memcpy(ptsZ[npts], Z, sizeof(vf2elm_t));
+            pts_index[npts++] = index;
+            m = strat[ii++];
+            PROFILE_BEGIN(PROFILE_XDBLE);
+            xDBLe_simd(X, Z, (const vfelm_t*)A, (const vfelm_t*)C, (int)(2*m), n);
+            PROFILE_END(PROFILE_XDBLE);
+            index += m;
+        }
+        PROFILE_BEGIN(PROFILE_GET_4_ISOG);
+        get_4_isog_simd((const vfelm_t*)X, (const vfelm_t*)Z, A, C, coeff, n);
+        PROFILE_END(PROFILE_GET_4_ISOG);
+
+        for (i = 0; i < npts; i++) {
+            PROFILE_BEGIN(PROFILE_EVAL_4_ISOG);
+            eval_4_isog_simd(ptsX[i], ptsZ[i], coeff, n);
+            PROFILE_END(PROFILE_EVAL_4_ISOG);
+        }
+
+        memcpy(X, ptsX[npts-1], sizeof(vf2elm_t));
+        memcpy(Z, ptsZ[npts-1], sizeof(vf2elm_t));
+        index = pts_index[npts-1];
+        npts -= 1;
+    }
+    PROFILE_BEGIN(PROFILE_GET_4_ISOG);
+    get_4_isog_simd((const vfelm_t*)X, (const vfelm_t*)Z, A, C, coeff, n);
+    PROFILE_END(PROFILE_GET_4_ISOG);
+
+    from_fp2simd((const vfelm_t*)A, A24plus, n);
+    from_fp2simd((const vfelm_t*)C, C24, n);
+
+    for (k = 0; k < n; k++) {
+        fp2add(A24plus[k], A24plus[k], A24plus[k]);
+        fp2sub(A24plus[k], C24[k], A24plus[k]);
+        fp2add(A24plus[k], A24plus[k], A24plus[k]);
+    }
+    PROFILE_BEGIN(PROFILE_J_INV);
+    j_inv_batch((const f2elm_t*)A24plus, (const f2elm_t*)C24, jinv, n);
+    PROFILE_END(PROFILE_J_INV);
+}
+
+#endif
+
+
+void TraverseTree_batch(f2elm_t* jinv, point_proj_batch_t R, f2elm_t* A24plus, f2elm_t* C24, const unsigned int *strat, unsigned int lenstrat, const unsigned int n)
+{ // Isogeny tree traversal for n walks in lockstep, following the same strategy (see TraverseTree() without keygen).
+  // The traversal runs on the lane-parallel arithmetic if a SIMD backend has been selected and there are several walks.
+  // Output: the j-invariants of the n codomain curves.
+    point_proj_batch_t pts[MAX_INT_POINTS_ALICE];
+    f2elm_t coeff[3][MAX_WALKS];
+    unsigned int i, k, m, row, ii = 0, index = 0, npts = 0, pts_index[MAX_INT_POINTS_ALICE];
+
+#if defined(SIMD_SUPPORT)
+    if (fp2simd_backend != SIMD_SCALAR && n > 1) {
+        TraverseTree_simd(jinv, R, A24plus, C24, strat, lenstrat, n);
+        return;
+    }
+#endif
+    for (row = 1; row < lenstrat; row++) {
+        while (index < lenstrat - row) {
+            copy_words((digit_t*)R->X, (digit_t*)pts[npts]->X, 2*NWORDS_FIELD*n);
+            copy_words((digit_t*)R->Z, (digit_t*)pts[npts]->Z, 2*NWORDS_FIELD*n);
+            pts_index[npts++] = index;
+            m = strat[ii++];
+            PROFILE_BEGIN(PROFILE_XDBLE);
+            xDBLe_batch(R, (const f2elm_t*)A24plus, (const f2elm_t*)C24, (int)(2*m), n);
+            PROFILE_END(PROFILE_XDBLE);
+            index += m;
+        }
+        PROFILE_BEGIN(PROFILE_GET_4_ISOG);
+        get_4_isog_batch(R, A24plus, C24, coeff, n);
+        PROFILE_END(PROFILE_GET_4_ISOG);
+
+        for (i = 0; i < npts; i++) {
+            PROFILE_BEGIN(PROFILE_EVAL_4_ISOG);
+            eval_4_isog_batch(pts[i], coeff, n);
+            PROFILE_END(PROFILE_EVAL_4_ISOG);
+        }
+
+        copy_words((digit_t*)pts[npts-1]->X, (digit_t*)R->X, 2*NWORDS_FIELD*n);
+        copy_words((digit_t*)pts[npts-1]->Z, (digit_t*)R->Z, 2*NWORDS_FIELD*n);
+        index = pts_index[npts-1];
+        npts -= 1;
+    }
+    PROFILE_BEGIN(PROFILE_GET_4_ISOG);
+    get_4_isog_batch(R, A24plus, C24, coeff, n);
+    PROFILE_END(PROFILE_GET_4_ISOG);
+
+    for (k = 0; k < n; k++) {
+        fp2add(A24plus[k], A24plus[k], A24plus[k]);
+        fp2sub(A24plus[k], C24[k], A24plus[k]);
+        fp2add(A24plus[k], A24plus[k], A24plus[k]);
+    }
+    PROFILE_BEGIN(PROFILE_J_INV);
+    j_inv_batch((const f2elm_t*)A24plus, (const f2elm_t*)C24, jinv, n);
+    PROFILE_END(PROFILE_J_INV);
+}
@@ -112,6 +112,8 @@ void fpmul_mont(const felm_t ma, const felm_t mb, felm_t mc)
     // fp2mul_mont_hw((digit_t*)&ma, (digit_t*)&zero, (digit_t*)&mb, (digit_t*)&zero, (digit_t*)&mc, (digit_t*)&mc_not_used);
     fp2mul_mont_hw((digit_t*)ma, (digit_t*)zero, (digit_t*)mb, (digit_t*)zero, (digit_t*)mc, (digit_t*)mc_not_used);
     // fpcorrection434(mc);
+#elif defined(FIELD_TWO_LIMBS)
+    fpmul_mont_2l(ma, mb, mc);
 #else
     dfelm_t temp = {0};
 
@@ -127,6 +129,8 @@ void fpsqr_mont(const felm_t ma, felm_t mc)
     // fp2mul_mont_hw((digit_t*)&ma, (digit_t*)&zero, (digit_t*)&mb, (digit_t*)&zero, (digit_t*)&mc, (digit_t*)&mc_not_used);
     fp2mul_mont_hw((digit_t*)ma, (digit_t*)zero, (digit_t*)ma, (digit_t*)zero, (digit_t*)mc, (digit_t*)mc_not_used);
     // fpcorrection434(mc);
+#elif defined(FIELD_TWO_LIMBS)
+    fpmul_mont_2l(ma, ma, mc);
 #else
     dfelm_t temp = {0};
 
@@ -155,14 +159,22 @@ void fp2neg(f2elm_t a)
 
 __inline void fp2add(const f2elm_t a, const f2elm_t b, f2elm_t c)
 { // GF(p^2) addition, c = a+b in GF(p^2).
+#if defined(FIELD_TWO_LIMBS)
+    fp2add_2l(a, b, c);
+#else
     fpadd(a[0], b[0], c[0]);
     fpadd(a[1], b[1], c[1]);
+#endif
 }
 
 __inline void fp2sub(const f2elm_t a, const f2elm_t b, f2elm_t c)
 { // GF(p^2) subtraction, c = a-b in GF(p^2).
+#if defined(FIELD_TWO_LIMBS)
+    fp2sub_2l(a, b, c);
+#else
     fpsub(a[0], b[0], c[0]);
     fpsub(a[1], b[1], c[1]);
+#endif
 }
 
 void fp2div2(const f2elm_t a, f2elm_t c)
@@ -179,7 +191,11 @@ void fp2correction(f2elm_t a)
 
 __inline static void mp_addfast(const digit_t *a, const digit_t *b, digit_t *c)
 { // Multiprecision addition, c = a+b.
-#if (OS_TARGET == OS_WIN) || defined(GENERIC_IMPLEMENTATION)
+#if defined(FIELD_TWO_LIMBS)
+
+    mp_add_2l(a, b, c);
+
+#elif (OS_TARGET == OS_WIN) || defined(GENERIC_IMPLEMENTATION)
 
     mp_add(a, b, c, NWORDS_FIELD);
 
@@ -200,8 +216,13 @@ __inline static void mp2_add(const f2elm_t a, const f2elm_t b, f2elm_t c)
 
 __inline static void mp2_sub_p2(const f2elm_t a, const f2elm_t b, f2elm_t c)       
 { // GF(p^2) subtraction with correction with 2*p, c = a-b+2p in GF(p^2).    
+#if defined(FIELD_TWO_LIMBS)
+    mp_sub_p2_2l(a[0], b[0], c[0]);
+    mp_sub_p2_2l(a[1], b[1], c[1]);
+#else
     mp_sub_p2(a[0], b[0], c[0]);  
     mp_sub_p2(a[1], b[1], c[1]);
+#endif
 }
 
 
@@ -223,6 +244,8 @@ void fp2sqr_mont(const f2elm_t a, f2elm_t c)
   // Output: c = c0+c1*i, where c0, c1 are in [0, 2*p-1] 
 #ifdef MontgomeryMultiplier_HARDWARE 
     fp2mul_mont_hw((digit_t*)&a[0], (digit_t*)&a[1], (digit_t*)&a[0], (digit_t*)&a[1], c[0], c[1]);
+#elif defined(FIELD_TWO_LIMBS)
+    fp2sqr_mont_2l(a, c);
 #else
     felm_t t1, t2, t3;
     
@@ -284,6 +307,8 @@ void fp2mul_mont(const f2elm_t a, const f2elm_t b, f2elm_t c)
   // Output: c = c0+c1*i, where c0, c1 are in [0, 2*p-1] 
 #ifdef MontgomeryMultiplier_HARDWARE 
     fp2mul_mont_hw((digit_t*)&a[0], (digit_t*)&a[1], (digit_t*)&b[0], (digit_t*)&b[1], c[0], c[1]);
+#elif defined(FIELD_TWO_LIMBS)
+    fp2mul_mont_2l(a, b, c);
 #else
     felm_t t1, t2;
     dfelm_t tt1, tt2, tt3; 
@@ -1170,7 +1195,7 @@ static __inline void fpinv_mont_bingcd_partial(const felm_t a, felm_t x1, unsign
     }
 }
 
-void fpinv_mont(felm_t a)
+void fpinv_mont_bingcd(felm_t a)
 {   // Field inversion via the binary GCD using Montgomery arithmetic, a = a^-1*R mod p.
     // SECURITY NOTE: This function does not run in constant-time and is therefore only suitable for
     //                operations not involving any secret data.
@@ -1188,6 +1213,224 @@ void fpinv_mont(felm_t a)
     fpmul_mont(x, t, a);
 }
 
+#if (RADIX == 64) && defined(__SIZEOF_INT128__)
+
+// Variable-time inversion based on the safegcd algorithm from D. J. Bernstein and B.-Y. Yang, "Fast constant-time gcd 
+// computation and modular inversion", TCHES 2019. Divsteps are done in batches of 62 on the low words of f and g only, 
+// and the resulting 2x2 transition matrix is then applied to the full values. Field elements are handled in signed 
+// radix 2^62: every limb is in [0, 2^62) except for the most significant one, which carries the sign.
+
+#define NLIMBS62_FIELD      (NBITS_FIELD/62 + 1)        // Number of 62-bit limbs of a field element
+#define MASK62              ((uint64_t)-1 >> 2)
+
+typedef int64_t felm62_t[NLIMBS62_FIELD];               // Field element in signed radix 2^62
+
+typedef struct { int64_t u, v, q, r; } trans62_t;       // Transition matrix of 62 divsteps, multiplied by 2^62
+
+static __inline void fp_to_signed62(const digit_t *a, felm62_t r)
+{ // Conversion of an element in [0, 2^(62*NLIMBS62_FIELD)) to signed radix 2^62
+    unsigned int i, w, s;
+
+    for (i = 0; i < NLIMBS62_FIELD; i++) {
+        w = (62*i) / RADIX;
+        s = (62*i) % RADIX;
+        r[i] = 0;
+        if (w < NWORDS_FIELD) 
+            r[i] = (int64_t)((a[w] >> s) & MASK62);
+        if (s > 2 && w + 1 < NWORDS_FIELD)
+            r[i] |= (int64_t)((a[w + 1] << (RADIX - s)) & MASK62);
+    }
+}
+
+static __inline void fp_from_signed62(const felm62_t r, felm_t a)
+{ // Conversion of a normalized element (all limbs in [0, 2^62)) from signed radix 2^62
+    unsigned int i, w, s;
+
+    fpzero(a);
+    for (i = 0; i < NLIMBS62_FIELD; i++) {
+        w = (62*i) / RADIX;
+        s = (62*i) % RADIX;
+        if (w < NWORDS_FIELD) 
+            a[w] |= (digit_t)r[i] << s;
+        if (s > 2 && w + 1 < NWORDS_FIELD)
+            a[w + 1] |= (digit_t)r[i] >> (RADIX - s);
+    }
+}
+
+static __inline int64_t divsteps_62(int64_t eta, uint64_t f0, uint64_t g0, trans62_t *t)
+{ // Performs 62 divsteps on the low words f0 (odd) and g0, eta = -delta. Zero bits of g are skipped all at once, and 
+  // as many bits of g as allowed by eta are cleared with a single multiple of f using f^-1 mod 2^4 or mod 2^6.
+    uint64_t u = 1, v = 0, q = 0, r = 1, f = f0, g = g0, m, w, tmp;
+    int i = 62, limit, zeros;
+
+    while (true) {
+        zeros = __builtin_ctzll(g | ((uint64_t)-1 << i));   // The sentinel bit stops the count at i
+        g >>= zeros;
+        u <<= zeros;
+        v <<= zeros;
+        eta -= zeros;
+        i -= zeros;
+        if (i == 0)
+            break;
+        // f and g are odd
+        if (eta < 0) {
+            eta = -eta;
+            tmp = f; f = g; g = 0 - tmp;
+            tmp = u; u = q; q = 0 - tmp;
+            tmp = v; v = r; r = 0 - tmp;
+            limit = ((int)eta + 1 > i) ? i : (int)eta + 1;
+            m = ((uint64_t)-1 >> (64 - limit)) & 63;
+            w = (f * g * (f * f - 2)) & m;                   // w = -g/f mod 2^limit
+        } else {
+            limit = ((int)eta + 1 > i) ? i : (int)eta + 1;
+            m = ((uint64_t)-1 >> (64 - limit)) & 15;
+            w = f + (((f + 1) & 4) << 1);                    // w = f^-1 mod 16
+            w = ((0 - w) * g) & m;
+        }
+        g += f * w;
+        q += u * w;
+        r += v * w;
+    }
+    t->u = (int64_t)u;
+    t->v = (int64_t)v;
+    t->q = (int64_t)q;
+    t->r = (int64_t)r;
+    return eta;
+}
+
+static __inline void update_fg_62(felm62_t f, felm62_t g, const trans62_t *t, const unsigned int len)
+{ // [f, g] = t*[f, g]/2^62, only the len least significant limbs are in use
+    __int128 cf, cg;
+    unsigned int i;
+
+    cf = (__int128)t->u * f[0] + (__int128)t->v * g[0];
+    cg = (__int128)t->q * f[0] + (__int128)t->r * g[0];
+    cf >>= 62;                                               // The 62 least significant bits are zero
+    cg >>= 62;
+    for (i = 1; i < len; i++) {
+        cf += (__int128)t->u * f[i] + (__int128)t->v * g[i];
+        cg += (__int128)t->q * f[i] + (__int128)t->r * g[i];
+        f[i - 1] = (int64_t)((uint64_t)cf & MASK62);
+        g[i - 1] = (int64_t)((uint64_t)cg & MASK62);
+        cf >>= 62;
+        cg >>= 62;
+    }
+    f[len - 1] = (int64_t)cf;
+    g[len - 1] = (int64_t)cg;
+}
+
+static __inline void update_de_62(felm62_t d, felm62_t e, const trans62_t *t, const felm62_t p62, const uint64_t pinv62)
+{ // [d, e] = t*[d, e]/2^62 mod p, with d and e in (-2p, p) on input and output
+    int64_t sd = d[NLIMBS62_FIELD - 1] >> 63, se = e[NLIMBS62_FIELD - 1] >> 63, md, me;
+    __int128 cd, ce;
+    unsigned int i;
+
+    md = (t->u & sd) + (t->v & se);                          // Add p*[u, q] if d < 0 and p*[v, r] if e < 0
+    me = (t->q & sd) + (t->r & se);
+    cd = (__int128)t->u * d[0] + (__int128)t->v * e[0];
+    ce = (__int128)t->q * d[0] + (__int128)t->r * e[0];
+    md -= (int64_t)((pinv62 * (uint64_t)cd + (uint64_t)md) & MASK62);   // Make the 62 least significant bits zero
+    me -= (int64_t)((pinv62 * (uint64_t)ce + (uint64_t)me) & MASK62);
+    cd += (__int128)p62[0] * md;
+    ce += (__int128)p62[0] * me;
+    cd >>= 62;
+    ce >>= 62;
+    for (i = 1; i < NLIMBS62_FIELD; i++) {
+        cd += (__int128)t->u * d[i] + (__int128)t->v * e[i] + (__int128)p62[i] * md;
+        ce += (__int128)t->q * d[i] + (__int128)t->r * e[i] + (__int128)p62[i] * me;
+        d[i - 1] = (int64_t)((uint64_t)cd & MASK62);
+        e[i - 1] = (int64_t)((uint64_t)ce & MASK62);
+        cd >>= 62;
+        ce >>= 62;
+    }
+    d[NLIMBS62_FIELD - 1] = (int64_t)cd;
+    e[NLIMBS62_FIELD - 1] = (int64_t)ce;
+}
+
+static __inline void normalize_62(felm62_t r, const int64_t sign, const felm62_t p62)
+{ // r = sign*r mod p in [0, p), for r in (-2p, p)
+    int64_t cond_add, cond_negate = sign >> 63;
+    unsigned int i, j;
+
+    for (j = 0; j < 2; j++) {
+        cond_add = r[NLIMBS62_FIELD - 1] >> 63;              // Add p if r < 0, then negate if requested (first pass only)
+        for (i = 0; i < NLIMBS62_FIELD; i++) {
+            r[i] += p62[i] & cond_add;
+            if (j == 0)
+                r[i] = (r[i] ^ cond_negate) - cond_negate;
+        }
+        for (i = 0; i < NLIMBS62_FIELD - 1; i++) {
+            r[i + 1] += r[i] >> 62;
+            r[i] &= MASK62;
+        }
+    }
+}
+
+void fpinv_mont_safegcd(felm_t a)
+{   // Field inversion via the safegcd algorithm using Montgomery arithmetic, a = a^-1*R mod p.
+    // SECURITY NOTE: This function does not run in constant-time and is therefore only suitable for
+    //                operations not involving any secret data.
+    felm62_t f, g, d = {0}, e = {0}, p62;
+    trans62_t t;
+    felm_t x;
+    uint64_t pinv62 = (uint64_t)((digit_t *)PRIME)[0], fn, gn, cond;
+    int64_t eta = -1;
+    unsigned int i, len = NLIMBS62_FIELD;
+
+    for (i = 0; i < 5; i++)                                  // p^-1 mod 2^64 by Newton iteration, starting from 3 correct bits
+        pinv62 *= 2 - (uint64_t)((digit_t *)PRIME)[0] * pinv62;
+    fp_to_signed62((digit_t *)PRIME, p62);
+    fpcopy(a, x);
+    fpcorrection(x);
+    fp_to_signed62(x, g);
+    memcpy(f, p62, sizeof(felm62_t));
+    e[0] = 1;
+
+    while (true) {
+        eta = divsteps_62(eta, (uint64_t)f[0], (uint64_t)g[0], &t);
+        update_de_62(d, e, &t, p62, pinv62);
+        update_fg_62(f, g, &t, len);
+        if (g[0] == 0) {
+            cond = 0;
+            for (i = 1; i < len; i++)
+                cond |= (uint64_t)g[i];
+            if (cond == 0)
+                break;                                       // g = 0, so f = +-1
+        }
+        fn = (uint64_t)f[len - 1];
+        gn = (uint64_t)g[len - 1];
+        cond = (uint64_t)((int64_t)len - 2) >> 63;
+        cond |= fn ^ (uint64_t)((int64_t)fn >> 63);
+        cond |= gn ^ (uint64_t)((int64_t)gn >> 63);
+        if (cond == 0) {                                     // Drop the top limbs of f and g once they are both 0 or -1
+            f[len - 2] |= (int64_t)(fn << 62);
+            g[len - 2] |= (int64_t)(gn << 62);
+            len--;
+        }
+    }
+    normalize_62(d, f[len - 1], p62);                        // d = (a*R)^-1 mod p
+    fp_from_signed62(d, x);
+
+    fpmul_mont(x, (digit_t *)&Montgomery_R2, x);
+    fpmul_mont(x, (digit_t *)&Montgomery_R2, a);             // a = a^-1*R^2
+}
+
+#else
+
+void fpinv_mont_safegcd(felm_t a)
+{   // The signed 62-bit representation requires 128-bit integer support: fall back to the binary GCD.
+    fpinv_mont_bingcd(a);
+}
+
+#endif
+
+void fpinv_mont(felm_t a)
+{   // Field inversion using Montgomery arithmetic, a = a^-1*R mod p.
+    // SECURITY NOTE: This function does not run in constant-time and is therefore only suitable for
+    //                operations not involving any secret data.
+    fpinv_mont_safegcd(a);
+}
+
 void fp2inv_mont(f2elm_t a)
 { // GF(p^2) inversion using Montgomery arithmetic, a = (a0-i*a1)/(a0^2+a1^2).
     f2elm_t t1;
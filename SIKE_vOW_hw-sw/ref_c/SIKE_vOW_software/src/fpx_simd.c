@@ -0,0 +1,292 @@
+/********************************************************************************************
+* vOW4SIKE on HW: a HW/SW co-design implementation of the vOW algorithm on SIKE
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/vOW4SIKE_on_HW
+* Released under MIT license
+*
+* Based on the SIDH library (https://github.com/microsoft/PQCrypto-SIDH) and the vOW4SIKE
+* library (https://github.com/microsoft/vOW4SIKE)
+*
+* Abstract: lane-parallel GF(p^2) arithmetic for the lockstep vOW walks
+*
+* Up to SIMD_LANES elements are stored limb-major in a vf2elm_t, so that limb i of all the elements can be loaded
+* into one vector. Two backends are available: AVX2 with 4 lanes of 28-bit limbs (32x32-bit multiplications) and
+* AVX-512 IFMA with 8 lanes of 52-bit limbs. Both use Montgomery arithmetic with their own Montgomery constant
+* 2^(radix*limbs), so elements are converted from and to the usual representation with to_fp2simd()/from_fp2simd().
+* The backend is chosen at run time with fp2simd_select(), the scalar backend (the default) leaves the SIMD
+* functions unused.
+*********************************************************************************************/
+
+#if defined(SIMD_SUPPORT)
+#include <immintrin.h>
+#endif
+
+unsigned int fp2simd_backend = SIMD_SCALAR;    // Backend in use, set by fp2simd_select()
+
+#if defined(SIMD_SUPPORT)
+
+static void simd_split(const digit_t *a, uint64_t *r, const unsigned int radix, const unsigned int nlimbs)
+{ // Splits a field element into nlimbs limbs of radix bits, with radix < 64
+    unsigned int i, bit, w, s;
+
+    for (i = 0; i < nlimbs; i++) {
+        bit = i*radix;
+        w = bit / RADIX;
+        s = bit % RADIX;
+        r[i] = 0;
+        if (w < NWORDS_FIELD)
+            r[i] = (uint64_t)(a[w] >> s);
+        if (s + radix > RADIX && w + 1 < NWORDS_FIELD)
+            r[i] |= (uint64_t)(a[w + 1] << (RADIX - s));
+        r[i] &= ((uint64_t)1 << radix) - 1;
+    }
+}
+
+static void simd_join(const uint64_t *r, digit_t *a, const unsigned int radix, const unsigned int nlimbs)
+{ // Joins nlimbs normalized limbs of radix bits into a field element
+    unsigned int i, bit, w, s;
+
+    fpzero(a);
+    for (i = 0; i < nlimbs; i++) {
+        bit = i*radix;
+        w = bit / RADIX;
+        s = bit % RADIX;
+        if (w < NWORDS_FIELD)
+            a[w] |= (digit_t)(r[i] << s);
+        if (s + radix > RADIX && w + 1 < NWORDS_FIELD)
+            a[w + 1] |= (digit_t)(r[i] >> (RADIX - s));
+    }
+}
+
+static uint64_t simd_inv64(const uint64_t a)
+{ // a^-1 mod 2^64 for odd a, by Newton iteration starting from 3 correct bits
+    uint64_t x = a;
+    unsigned int i;
+
+    for (i = 0; i < 5; i++)
+        x *= 2 - a*x;
+    return x;
+}
+
+static void simd_power2(felm_t a, const unsigned int e)
+{ // a = 2^e mod p in [0, p-1]
+    unsigned int i;
+
+    fpzero(a);
+    a[0] = 1;
+    for (i = 0; i < e; i++)
+        fpadd(a, a, a);
+    fpcorrection(a);
+}
+
+#if defined(_SIMD_AVX2_)
+
+// AVX2 backend: 4 lanes of 28-bit limbs, products of 56 bits are accumulated in full
+
+#define SIMD_NAME(f)            f##_avx2
+#define SIMD_TARGET             __attribute__((target("avx2")))
+#define VRADIX                  28
+#define VLIMBS                  ((NBITS_FIELD+4+27)/28)        // 16p < 2^(VRADIX*VLIMBS)
+#define VLANES                  4
+#define vec_t                   __m256i
+#define V_LOAD(p)               _mm256_loadu_si256((const __m256i*)(p))
+#define V_STORE(p, a)           _mm256_storeu_si256((__m256i*)(p), a)
+#define V_SET1(x)               _mm256_set1_epi64x((long long)(x))
+#define V_ZERO()                _mm256_setzero_si256()
+#define V_ADD(a, b)             _mm256_add_epi64(a, b)
+#define V_SUB(a, b)             _mm256_sub_epi64(a, b)
+#define V_AND(a, b)             _mm256_and_si256(a, b)
+#define V_ANDNOT(a, b)          _mm256_andnot_si256(a, b)
+#define V_OR(a, b)              _mm256_or_si256(a, b)
+#define V_SRL(a, n)             _mm256_srli_epi64(a, n)
+#define V_SRA(a, n)             _mm256_or_si256(_mm256_srli_epi64(a, n), _mm256_slli_epi64(_mm256_cmpgt_epi64(_mm256_setzero_si256(), a), 64 - (n)))
+#define V_MULLO(a, b)           _mm256_mul_epu32(a, b)
+#define V_MULADD(lo, hi, a, b)  (lo) = _mm256_add_epi64(lo, _mm256_mul_epu32(a, b))
+
+#include "fpx_simd_lanes.c"
+
+#undef SIMD_NAME
+#undef SIMD_TARGET
+#undef VRADIX
+#undef VLIMBS
+#undef VLANES
+#undef vec_t
+#undef V_LOAD
+#undef V_STORE
+#undef V_SET1
+#undef V_ZERO
+#undef V_ADD
+#undef V_SUB
+#undef V_AND
+#undef V_ANDNOT
+#undef V_OR
+#undef V_SRL
+#undef V_SRA
+#undef V_MULLO
+#undef V_MULADD
+
+#endif
+
+#if defined(_SIMD_AVX512_)
+
+// AVX-512 IFMA backend: 8 lanes of 52-bit limbs, the low and high halves of the 104-bit products go to adjacent columns
+
+#define SIMD_NAME(f)            f##_avx512
+#define SIMD_TARGET             __attribute__((target("avx512f,avx512ifma")))
+#define VRADIX                  52
+#define VLIMBS                  ((NBITS_FIELD+4+51)/52)        // 16p < 2^(VRADIX*VLIMBS)
+#define VLANES                  8
+#define vec_t                   __m512i
+#define V_LOAD(p)               _mm512_loadu_si512((const void*)(p))
+#define V_STORE(p, a)           _mm512_storeu_si512((void*)(p), a)
+#define V_SET1(x)               _mm512_set1_epi64((long long)(x))
+#define V_ZERO()                _mm512_setzero_si512()
+#define V_ADD(a, b)             _mm512_add_epi64(a, b)
+#define V_SUB(a, b)             _mm512_sub_epi64(a, b)
+#define V_AND(a, b)             _mm512_and_si512(a, b)
+#define V_ANDNOT(a, b)          _mm512_andnot_si512(a, b)
+#define V_OR(a, b)              _mm512_or_si512(a, b)
+#define V_SRL(a, n)             _mm512_srli_epi64(a, n)
+#define V_SRA(a, n)             _mm512_srai_epi64(a, n)
+#define V_MULLO(a, b)           _mm512_madd52lo_epu64(_mm512_setzero_si512(), a, b)
+#define V_MULADD(lo, hi, a, b)  { (lo) = _mm512_madd52lo_epu64(lo, a, b); (hi) = _mm512_madd52hi_epu64(hi, a, b); }
+
+#include "fpx_simd_lanes.c"
+
+#undef SIMD_NAME
+#undef SIMD_TARGET
+#undef VRADIX
+#undef VLIMBS
+#undef VLANES
+#undef vec_t
+#undef V_LOAD
+#undef V_STORE
+#undef V_SET1
+#undef V_ZERO
+#undef V_ADD
+#undef V_SUB
+#undef V_AND
+#undef V_ANDNOT
+#undef V_OR
+#undef V_SRL
+#undef V_SRA
+#undef V_MULLO
+#undef V_MULADD
+
+#endif
+
+#endif
+
+
+bool fp2simd_supported(const unsigned int backend)
+{ // Is the backend compiled in and supported by the CPU?
+    switch (backend) {
+    case SIMD_SCALAR:
+        return true;
+#if defined(SIMD_SUPPORT) && defined(_SIMD_AVX2_)
+    case SIMD_AVX2:
+        return __builtin_cpu_supports("avx2");
+#endif
+#if defined(SIMD_SUPPORT) && defined(_SIMD_AVX512_)
+    case SIMD_AVX512:
+        return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+#endif
+    default:
+        return false;
+    }
+}
+
+bool fp2simd_select(unsigned int backend)
+{ // Selects the backend of the lane-parallel arithmetic. SIMD_AUTO picks AVX-512 IFMA if the CPU supports it and the
+  // scalar backend otherwise: with 28-bit limbs, AVX2 only beats the MULX assembly for the smallest primes (see arith_tests).
+  // Returns false if the backend is not available, in which case the selection is left unchanged.
+  // Not thread-safe: to be called before starting the walkers.
+    if (backend == SIMD_AUTO) {
+        backend = SIMD_SCALAR;
+        if (fp2simd_supported(SIMD_AVX512))
+            backend = SIMD_AVX512;
+    }
+    if (!fp2simd_supported(backend))
+        return false;
+
+#if defined(SIMD_SUPPORT) && defined(_SIMD_AVX2_)
+    if (backend == SIMD_AVX2)
+        setup_avx2();
+#endif
+#if defined(SIMD_SUPPORT) && defined(_SIMD_AVX512_)
+    if (backend == SIMD_AVX512)
+        setup_avx512();
+#endif
+    fp2simd_backend = backend;
+    return true;
+}
+
+const char* fp2simd_name(const unsigned int backend)
+{ // Name of the backend
+    switch (backend) {
+    case SIMD_SCALAR: return "scalar";
+    case SIMD_AVX2:   return "avx2";
+    case SIMD_AVX512: return "avx512";
+    default:          return "auto";
+    }
+}
+
+unsigned int fp2simd_lanes(void)
+{ // Number of lanes per vector of the selected backend
+    switch (fp2simd_backend) {
+    case SIMD_AVX2:   return 4;
+    case SIMD_AVX512: return 8;
+    default:          return 1;
+    }
+}
+
+#if defined(SIMD_SUPPORT)
+
+#if defined(_SIMD_AVX2_)
+#define SIMD_CALL_AVX2(f, ...)      if (fp2simd_backend == SIMD_AVX2) { f(__VA_ARGS__); return; }
+#else
+#define SIMD_CALL_AVX2(f, ...)
+#endif
+#if defined(_SIMD_AVX512_)
+#define SIMD_CALL_AVX512(f, ...)    if (fp2simd_backend == SIMD_AVX512) { f(__VA_ARGS__); return; }
+#else
+#define SIMD_CALL_AVX512(f, ...)
+#endif
+#define SIMD_DISPATCH(f, ...)       SIMD_CALL_AVX512(f##_avx512, __VA_ARGS__) SIMD_CALL_AVX2(f##_avx2, __VA_ARGS__)
+
+void to_fp2simd(const f2elm_t *a, vf2elm_t c, const unsigned int n)
+{ // Loads n GF(p^2) elements in Montgomery representation into the lanes of c
+    SIMD_DISPATCH(to, a, c, n);
+}
+
+void from_fp2simd(const vf2elm_t a, f2elm_t *c, const unsigned int n)
+{ // Stores the first n lanes of a as GF(p^2) elements in Montgomery representation
+    SIMD_DISPATCH(from, a, c, n);
+}
+
+void fp2mul_simd(const vf2elm_t a, const vf2elm_t b, vf2elm_t c, const unsigned int n)
+{ // GF(p^2) multiplication in the first n lanes, c = a*b
+    SIMD_DISPATCH(fp2mul, a, b, c, n);
+}
+
+void fp2sqr_simd(const vf2elm_t a, vf2elm_t c, const unsigned int n)
+{ // GF(p^2) squaring in the first n lanes, c = a^2
+    SIMD_DISPATCH(fp2sqr, a, c, n);
+}
+
+void fp2add_simd(const vf2elm_t a, const vf2elm_t b, vf2elm_t c, const unsigned int n)
+{ // GF(p^2) addition in the first n lanes, c = a+b
+    SIMD_DISPATCH(fp2add, a, b, c, n);
+}
+
+void fp2sub_simd(const vf2elm_t a, const vf2elm_t b, vf2elm_t c, const unsigned int n)
+{ // GF(p^2) subtraction in the first n lanes, c = a-b
+    SIMD_DISPATCH(fp2sub, a, b, c, n);
+}
+
+#undef SIMD_CALL_AVX2
+#undef SIMD_CALL_AVX512
+#undef SIMD_DISPATCH
+
+#endif
@@ -0,0 +1,218 @@
+/********************************************************************************************
+* vOW4SIKE on HW: a HW/SW co-design implementation of the vOW algorithm on SIKE
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/vOW4SIKE_on_HW
+* Released under MIT license
+*
+* Based on the SIDH library (https://github.com/microsoft/PQCrypto-SIDH) and the vOW4SIKE
+* library (https://github.com/microsoft/vOW4SIKE)
+*
+* Abstract: lane-parallel GF(p^2) arithmetic for one SIMD backend. This file is included by fpx_simd.c once per
+*           backend, after defining the vector type vec_t, the V_* primitives, VRADIX, VLIMBS, VLANES, SIMD_NAME()
+*           and SIMD_TARGET.
+*********************************************************************************************/
+
+#define VMASK    (((uint64_t)1 << VRADIX) - 1)
+#define VLIMB(x, i, h)    (&(x)[(i)*SIMD_LANES + (h)*VLANES])     // Limb i of the lanes in vector h
+
+static uint64_t SIMD_NAME(p)[VLIMBS];       // p in radix 2^VRADIX
+static uint64_t SIMD_NAME(px2)[VLIMBS];     // 2*p in radix 2^VRADIX
+static uint64_t SIMD_NAME(pinv);            // -p^-1 mod 2^VRADIX
+static vfelm_t SIMD_NAME(to_const);         // 2^(2*VRADIX*VLIMBS)/R mod p in all lanes
+static vfelm_t SIMD_NAME(from_const);       // R mod p in all lanes
+
+
+static void SIMD_NAME(setup)(void)
+{ // Precomputes the constants of the backend
+    felm_t t;
+    uint64_t to_limbs[VLIMBS], from_limbs[VLIMBS];
+    unsigned int i, k;
+
+    simd_split((digit_t*)PRIME, SIMD_NAME(p), VRADIX, VLIMBS);
+    mp_add((digit_t*)PRIME, (digit_t*)PRIME, t, NWORDS_FIELD);
+    simd_split(t, SIMD_NAME(px2), VRADIX, VLIMBS);
+    SIMD_NAME(pinv) = (0 - simd_inv64((uint64_t)((digit_t*)PRIME)[0])) & VMASK;
+
+    simd_power2(t, 2*VRADIX*VLIMBS - MAXBITS_FIELD);
+    simd_split(t, to_limbs, VRADIX, VLIMBS);
+    simd_split((digit_t*)&Montgomery_one, from_limbs, VRADIX, VLIMBS);
+    for (i = 0; i < VLIMBS; i++) {
+        for (k = 0; k < SIMD_LANES; k++) {
+            SIMD_NAME(to_const)[i*SIMD_LANES + k] = to_limbs[i];
+            SIMD_NAME(from_const)[i*SIMD_LANES + k] = from_limbs[i];
+        }
+    }
+}
+
+
+SIMD_TARGET static __inline void SIMD_NAME(fpmul)(const uint64_t *a, const uint64_t *b, uint64_t *c, const unsigned int h)
+{ // Montgomery multiplication in the lanes of vector h, c = a*b*2^(-VRADIX*VLIMBS) mod p, with a, b < 4p and c < 2p.
+  // Operand scanning with interleaved reduction. The columns are accumulated in 64-bit lanes and only the column
+  // being reduced is carried, the others are normalized at the end.
+    vec_t A[VLIMBS], T[2*VLIMBS+1], bi, m, mask = V_SET1(VMASK), pinv = V_SET1(SIMD_NAME(pinv));
+    unsigned int i, j;
+
+    for (j = 0; j < VLIMBS; j++)
+        A[j] = V_LOAD(VLIMB(a, j, h));
+    for (j = 0; j < 2*VLIMBS+1; j++)
+        T[j] = V_ZERO();
+
+    for (i = 0; i < VLIMBS; i++) {
+        bi = V_LOAD(VLIMB(b, i, h));
+        for (j = 0; j < VLIMBS; j++)
+            V_MULADD(T[i+j], T[i+j+1], A[j], bi);                  // T += a*b[i]*2^(VRADIX*i)
+        m = V_AND(V_MULLO(T[i], pinv), mask);
+        for (j = 0; j < VLIMBS; j++)
+            V_MULADD(T[i+j], T[i+j+1], m, V_SET1(SIMD_NAME(p)[j]));  // T += m*p*2^(VRADIX*i), clears column i
+        T[i+1] = V_ADD(T[i+1], V_SRL(T[i], VRADIX));
+    }
+
+    for (j = VLIMBS; j < 2*VLIMBS; j++) {
+        T[j+1] = V_ADD(T[j+1], V_SRL(T[j], VRADIX));
+        V_STORE(VLIMB(c, j - VLIMBS, h), V_AND(T[j], mask));
+    }
+}
+
+
+SIMD_TARGET static __inline void SIMD_NAME(fpadd_lazy)(const uint64_t *a, const uint64_t *b, uint64_t *c, const unsigned int h)
+{ // Addition without reduction in the lanes of vector h, c = a+b < 4p for a, b < 2p
+    vec_t t, carry = V_ZERO(), mask = V_SET1(VMASK);
+    unsigned int i;
+
+    for (i = 0; i < VLIMBS; i++) {
+        t = V_ADD(V_ADD(V_LOAD(VLIMB(a, i, h)), V_LOAD(VLIMB(b, i, h))), carry);
+        carry = V_SRL(t, VRADIX);
+        V_STORE(VLIMB(c, i, h), V_AND(t, mask));
+    }
+}
+
+
+SIMD_TARGET static __inline void SIMD_NAME(fpadd)(const uint64_t *a, const uint64_t *b, uint64_t *c, const unsigned int h)
+{ // Modular addition in the lanes of vector h, c = a+b mod 2p in [0, 2p-1] for a, b < 2p
+    vec_t s[VLIMBS], d[VLIMBS], carry = V_ZERO(), borrow = V_ZERO(), mask = V_SET1(VMASK);
+    unsigned int i;
+
+    for (i = 0; i < VLIMBS; i++) {
+        s[i] = V_ADD(V_ADD(V_LOAD(VLIMB(a, i, h)), V_LOAD(VLIMB(b, i, h))), carry);
+        carry = V_SRL(s[i], VRADIX);
+        s[i] = V_AND(s[i], mask);
+        d[i] = V_ADD(V_SUB(s[i], V_SET1(SIMD_NAME(px2)[i])), borrow);   // d = a+b-2p
+        borrow = V_SRA(d[i], VRADIX);
+        d[i] = V_AND(d[i], mask);
+    }
+    for (i = 0; i < VLIMBS; i++)                                         // c = (d < 0) ? a+b : d
+        V_STORE(VLIMB(c, i, h), V_OR(V_AND(borrow, s[i]), V_ANDNOT(borrow, d[i])));
+}
+
+
+SIMD_TARGET static __inline void SIMD_NAME(fpsub)(const uint64_t *a, const uint64_t *b, uint64_t *c, const unsigned int h)
+{ // Modular subtraction in the lanes of vector h, c = a-b mod 2p in [0, 2p-1] for a, b < 2p
+    vec_t d[VLIMBS], s[VLIMBS], borrow = V_ZERO(), carry = V_ZERO(), mask = V_SET1(VMASK);
+    unsigned int i;
+
+    for (i = 0; i < VLIMBS; i++) {
+        d[i] = V_ADD(V_SUB(V_LOAD(VLIMB(a, i, h)), V_LOAD(VLIMB(b, i, h))), borrow);
+        borrow = V_SRA(d[i], VRADIX);
+        d[i] = V_AND(d[i], mask);
+        s[i] = V_ADD(V_ADD(d[i], V_SET1(SIMD_NAME(px2)[i])), carry);      // s = a-b+2p
+        carry = V_SRL(s[i], VRADIX);
+        s[i] = V_AND(s[i], mask);
+    }
+    for (i = 0; i < VLIMBS; i++)                                         // c = (a-b < 0) ? s : a-b
+        V_STORE(VLIMB(c, i, h), V_OR(V_AND(borrow, s[i]), V_ANDNOT(borrow, d[i])));
+}
+
+
+SIMD_TARGET static void SIMD_NAME(fp2mul)(const vf2elm_t a, const vf2elm_t b, vf2elm_t c, const unsigned int n)
+{ // GF(p^2) multiplication in the first n lanes, c = a*b, using Karatsuba
+    vfelm_t t0, t1, t2;
+    unsigned int h;
+
+    for (h = 0; h*VLANES < n; h++) {
+        SIMD_NAME(fpadd_lazy)(a[0], a[1], t0, h);     // t0 = a0+a1
+        SIMD_NAME(fpadd_lazy)(b[0], b[1], t1, h);     // t1 = b0+b1
+        SIMD_NAME(fpmul)(t0, t1, t2, h);              // t2 = (a0+a1)*(b0+b1)
+        SIMD_NAME(fpmul)(a[0], b[0], t0, h);          // t0 = a0*b0
+        SIMD_NAME(fpmul)(a[1], b[1], t1, h);          // t1 = a1*b1
+        SIMD_NAME(fpsub)(t0, t1, c[0], h);            // c0 = a0*b0 - a1*b1
+        SIMD_NAME(fpadd)(t0, t1, t0, h);
+        SIMD_NAME(fpsub)(t2, t0, c[1], h);            // c1 = (a0+a1)*(b0+b1) - a0*b0 - a1*b1
+    }
+}
+
+
+SIMD_TARGET static void SIMD_NAME(fp2sqr)(const vf2elm_t a, vf2elm_t c, const unsigned int n)
+{ // GF(p^2) squaring in the first n lanes, c = a^2
+    vfelm_t t0, t1, t2;
+    unsigned int h;
+
+    for (h = 0; h*VLANES < n; h++) {
+        SIMD_NAME(fpadd_lazy)(a[0], a[1], t0, h);     // t0 = a0+a1
+        SIMD_NAME(fpsub)(a[0], a[1], t1, h);          // t1 = a0-a1
+        SIMD_NAME(fpadd_lazy)(a[0], a[0], t2, h);     // t2 = 2*a0
+        SIMD_NAME(fpmul)(t0, t1, c[0], h);            // c0 = (a0+a1)(a0-a1)
+        SIMD_NAME(fpmul)(t2, a[1], c[1], h);          // c1 = 2*a0*a1
+    }
+}
+
+
+SIMD_TARGET static void SIMD_NAME(fp2add)(const vf2elm_t a, const vf2elm_t b, vf2elm_t c, const unsigned int n)
+{ // GF(p^2) addition in the first n lanes, c = a+b
+    unsigned int h;
+
+    for (h = 0; h*VLANES < n; h++) {
+        SIMD_NAME(fpadd)(a[0], b[0], c[0], h);
+        SIMD_NAME(fpadd)(a[1], b[1], c[1], h);
+    }
+}
+
+
+SIMD_TARGET static void SIMD_NAME(fp2sub)(const vf2elm_t a, const vf2elm_t b, vf2elm_t c, const unsigned int n)
+{ // GF(p^2) subtraction in the first n lanes, c = a-b
+    unsigned int h;
+
+    for (h = 0; h*VLANES < n; h++) {
+        SIMD_NAME(fpsub)(a[0], b[0], c[0], h);
+        SIMD_NAME(fpsub)(a[1], b[1], c[1], h);
+    }
+}
+
+
+SIMD_TARGET static void SIMD_NAME(to)(const f2elm_t *a, vf2elm_t c, const unsigned int n)
+{ // Loads n GF(p^2) elements in Montgomery representation into the lanes of c, c[k] = a[k]*2^(VRADIX*VLIMBS)/R
+    uint64_t limbs[VLIMBS];
+    unsigned int i, j, k, h;
+
+    for (i = 0; i < 2; i++) {
+        for (k = 0; k < SIMD_LANES; k++) {
+            if (k < n)
+                simd_split(a[k][i], limbs, VRADIX, VLIMBS);
+            for (j = 0; j < VLIMBS; j++)
+                c[i][j*SIMD_LANES + k] = (k < n) ? limbs[j] : 0;
+        }
+        for (h = 0; h*VLANES < n; h++)
+            SIMD_NAME(fpmul)(c[i], SIMD_NAME(to_const), c[i], h);
+    }
+}
+
+
+SIMD_TARGET static void SIMD_NAME(from)(const vf2elm_t a, f2elm_t *c, const unsigned int n)
+{ // Stores the lanes of a into n GF(p^2) elements in Montgomery representation, c[k] = a[k]*R/2^(VRADIX*VLIMBS)
+    vfelm_t t;
+    uint64_t limbs[VLIMBS];
+    unsigned int i, j, k, h;
+
+    for (i = 0; i < 2; i++) {
+        for (h = 0; h*VLANES < n; h++)
+            SIMD_NAME(fpmul)(a[i], SIMD_NAME(from_const), t, h);
+        for (k = 0; k < n; k++) {
+            for (j = 0; j < VLIMBS; j++)
+                limbs[j] = t[j*SIMD_LANES + k];
+            simd_join(limbs, c[k][i], VRADIX, VLIMBS);
+        }
+    }
+}
+
+#undef VMASK
+#undef VLIMB
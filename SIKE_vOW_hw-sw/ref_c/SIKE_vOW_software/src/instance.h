@@ -14,12 +14,26 @@ typedef struct
     unsigned int NBYTES_STATE;
     unsigned int NWORDS_STATE;
     unsigned int NBITS_OVERFLOW;
-    unsigned int MAX_STEPS;           // ceil(20 / THETA), where THETA = 2.25 * sqrt(w / S)
-    unsigned int MAX_DIST;            // BETA * w;
     unsigned int MAX_FUNCTION_VERSIONS;
-    unsigned int DIST_BOUND;          // Floor(THETA * 2^(e-1 - log(w)));
-    unsigned int STRAT[LENSTRAT];
+    unsigned int STRAT[LENSTRAT];     // The first e/2-2 entries are used
     CurveAndPointsSIDHv2 ES[2];       // Starting curve
     CurveAndPointsSIDHv2 EE;          // Ending curve
     uint64_t jinv[2*NWORDS_FIELD];    // For verifying
-} instance_t;
\ No newline at end of file
+} instance_t;
+
+// Instance file: this header, followed by the instance_t, the doubling tables of the two starting curves and the doubling
+// table of the ending curve, each of table_rows = 2*(NBITS_STATE+1) f2elm_t64 rows. The file is written by gen_instance_XXX
+// and only read by binaries built for the same prime and platform, so the instance and tables are stored in their in-memory layout.
+#define INSTANCE_MAGIC         "vOWinst"
+#define INSTANCE_FORMAT        1
+
+typedef struct
+{
+    char magic[8];
+    uint32_t format;
+    uint32_t nwords_field;            // 64-bit words per GF(p) element
+    uint32_t lenstrat;                // Capacity of instance_t.STRAT
+    uint32_t instance_size;           // sizeof(instance_t)
+    uint32_t table_rows;              // f2elm_t64 rows per doubling table, 2*(NBITS_STATE+1)
+    uint32_t reserved;
+} instance_file_t;
@@ -11,6 +11,9 @@ void init_prng(prng_state_t *state, unsigned long seed)
     unsigned char inp[16] = {0}, i;
 
     state->count = 0;
+#if defined(USE_BUFFERED_PRNG)
+    state->available = 0;
+#endif
     for (i = 0; i < 4; i++)
         inp[i] = (seed >> 8 * i) & 0xFF;  // Length of seed = 32 bits
     AES128_load_schedule(inp, state->aes_key_schedule);
@@ -25,17 +28,40 @@ void init_prng(prng_state_t *state, unsigned long seed)
 
 void sample_prng(prng_state_t *state, unsigned char *buffer, unsigned long nbytes)
 {
-#if defined(USE_AES_PRNG)    
+#if defined(USE_AES_PRNG) && defined(USE_BUFFERED_PRNG)
+    /* AES-CTR mode with plaintext = 0, PRNG_BUFFER_BLOCKS blocks at a time */
+    unsigned long n;
+
+    while (nbytes > 0) {
+        if (state->available == 0 && nbytes >= sizeof(state->buffer)) {
+            n = nbytes / 16;                // Whole blocks go directly to the output, which gives the same stream
+            AES128_ctr(state->count + 1, n, state->aes_key_schedule, buffer);
+            state->count += n;
+            buffer += 16 * n;
+            nbytes -= 16 * n;
+            continue;
+        }
+        if (state->available == 0) {
+            AES128_ctr(state->count + 1, PRNG_BUFFER_BLOCKS, state->aes_key_schedule, state->buffer);
+            state->count += PRNG_BUFFER_BLOCKS;
+            state->available = sizeof(state->buffer);
+        }
+        n = (nbytes < state->available) ? nbytes : state->available;
+        memcpy(buffer, &state->buffer[sizeof(state->buffer) - state->available], n);
+        state->available -= (uint32_t)n;
+        buffer += n;
+        nbytes -= n;
+    }
+#elif defined(USE_AES_PRNG)
     /* AES-CTR mode with plaintext = 0 */
     /* Assumes that count doesn't exceed 64-bits */
     unsigned char inp[16] = {0};
+    unsigned long nblocks = (nbytes > 16) ? (nbytes - 1) / 16 : 0;
 
-    while (nbytes > 16) {
-        *((uint64_t *)inp) = ++state->count;
-        AES128_enc(inp, state->aes_key_schedule, buffer);
-        nbytes -= 16;
-        buffer += 16;
-    }  
+    AES128_ctr(state->count + 1, nblocks, state->aes_key_schedule, buffer);  // All blocks but the last one
+    state->count += nblocks;
+    buffer += 16 * nblocks;
+    nbytes -= 16 * nblocks;
     *((uint64_t *)inp) = ++state->count;
     AES128_enc(inp, state->aes_key_schedule, inp);      
     memcpy(buffer, inp, nbytes);
@@ -47,78 +73,375 @@ void sample_prng(prng_state_t *state, unsigned char *buffer, unsigned long nbyte
 #endif
 }
 
-void XOF(unsigned char *output, unsigned char *input, unsigned long nbytes_output, unsigned long nbytes_input, unsigned long salt)
-{
-#ifdef USE_XXHASH_XOF
-    // xxhash
+void XOF_XXH64(unsigned char *output, unsigned char *input, unsigned long nbytes_output, unsigned long nbytes_input, unsigned long salt)
+{ // xxhash: XXH64 chained on its previous output for each 8 bytes, written a word at a time
     unsigned long long round_output = salt;
-    int hash_round = 0;
-    unsigned int i;
+    unsigned long i;
 
-    for (i = 0; i < nbytes_output; i++) {
-        switch (i & 7)
-        {
-        case 0:
-            round_output = XXH64(input, nbytes_input, round_output);
-            output[8 * hash_round] = ((unsigned char *)&round_output)[0];
-            break;
-        case 1:
-            output[8 * hash_round + 1] = ((unsigned char *)&round_output)[1];
-            break;
-        case 2:
-            output[8 * hash_round + 2] = ((unsigned char *)&round_output)[2];
-            break;
-        case 3:
-            output[8 * hash_round + 3] = ((unsigned char *)&round_output)[3];
-            break;
-        case 4:
-            output[8 * hash_round + 4] = ((unsigned char *)&round_output)[4];
-            break;
-        case 5:
-            output[8 * hash_round + 5] = ((unsigned char *)&round_output)[5];
-            break;
-        case 6:
-            output[8 * hash_round + 6] = ((unsigned char *)&round_output)[6];
-            break;
-        case 7:
-            output[8 * hash_round + 7] = ((unsigned char *)&round_output)[7];
-            hash_round++;
-            break;
-        }
+    for (i = 0; i < nbytes_output; i += 8) {
+        round_output = XXH64(input, nbytes_input, round_output);
+        memcpy(output + i, &round_output, (nbytes_output - i < 8) ? nbytes_output - i : 8);
     }
+}
 
-#elif defined(USE_AES_XOF)
-    (void)nbytes_input;
+void XOF_XXH3(unsigned char *output, unsigned char *input, unsigned long nbytes_output, unsigned long nbytes_input, unsigned long salt)
+{ // XXH3: a single 64-bit hash if the output fits in a word (NBYTES_STATE <= 8), otherwise one 128-bit hash per 16 bytes, 
+  // seeded with the salt and the block index
+    unsigned long i;
+
+    if (nbytes_output <= 8) {
+        XXH64_hash_t h = XXH3_64bits_withSeed(input, nbytes_input, salt);
+        memcpy(output, &h, nbytes_output);
+        return;
+    }
+    for (i = 0; i < nbytes_output; i += 16) {
+        XXH128_hash_t h = XXH3_128bits_withSeed(input, nbytes_input, (XXH64_hash_t)salt ^ ((XXH64_hash_t)(i / 16) << 32));
+        memcpy(output + i, &h, (nbytes_output - i < 16) ? nbytes_output - i : 16);
+    }
+}
+
+// Key schedule of the AES XOF, rebuilt only when the salt (the function version) changes. Each thread (walker, helper or 
+// locator) keeps its own, since walkers can be on different function versions while locating collisions
+typedef struct
+{
+    unsigned char schedule[16 * 11] ALIGN_FOOTER(32);
+    unsigned long salt;
+    bool loaded;
+} xof_aes_key_t;
+
+#if defined(_OPENMP) && (OS_TARGET == OS_WIN)
+static __declspec(thread) xof_aes_key_t xof_aes_key;
+#elif defined(_OPENMP)
+static __thread xof_aes_key_t xof_aes_key;
+#else
+static xof_aes_key_t xof_aes_key;
+#endif
 
-    /* AES-CBC mode */
-    unsigned char aes_key_schedule[16 * 11];
-    unsigned char key[16] = {0}, temp[32] = {0};
-    unsigned char* inp = &temp[16];
-    unsigned int nblocks = (unsigned int)(nbytes_input+15)/16;
-    unsigned char j;
+void XOF_AES(unsigned char *output, unsigned char *input, unsigned long nbytes_output, unsigned long nbytes_input, unsigned long salt)
+{ // AES-CBC keyed with the salt. Outputs of up to 16 bytes are the first 16 bytes of the last block of the CBC-MAC of all full
+  // blocks of the input but the last one, and longer outputs continue with the encryption of the last block
+    xof_aes_key_t *key = &xof_aes_key;
+    unsigned char block[32] = {0};
+    unsigned long nblocks = (nbytes_input + 15) / 16, rem, j;
 
-    for (int i = 0; i < 4; i++) 
-        key[i] = ((unsigned char *)&salt)[i];  // Set key
-    AES128_load_schedule(key, aes_key_schedule);
+    if (!key->loaded || key->salt != salt) {
+        unsigned char k[16] = {0};
+
+        for (j = 0; j < 4; j++)
+            k[j] = ((unsigned char *)&salt)[j];  // Set key
+        AES128_load_schedule(k, key->schedule);
+        key->salt = salt;
+        key->loaded = true;
+    }
 
     if (nbytes_input <= 16) {  // Assumes nbytes_output <= 16
-        memcpy(inp, input, nbytes_input);
-        AES128_enc(inp, aes_key_schedule, inp);
-        memcpy(output, inp, nbytes_output);
+        memcpy(block, input, nbytes_input);
+        AES128_enc(block, key->schedule, block);
     } else {  // Assumes nbytes_output <= 32
-        memcpy(inp, input, 16);    
-        for (int i = 0; i < (int)nblocks-2; i++) {
-            AES128_enc(inp, aes_key_schedule, temp);
-            for (j = 0; j < 16; j++) 
-                inp[j] = input[j+16] ^ temp[j];
-            input += 16;
-        } 
-        AES128_enc(inp, aes_key_schedule, temp);
-        memset(inp, 0, 16);
-        for (j = 0; j < nbytes_input-16*(nblocks-1); j++) 
-            inp[j] = input[j+16] ^ temp[j];    
-        AES128_enc(inp, aes_key_schedule, inp);
-        memcpy(output, temp, nbytes_output);
+        AES128_cbc_mac(input, nblocks - 1, key->schedule, block);
+        if (nbytes_output > 16) {
+            rem = nbytes_input - 16 * (nblocks - 1);
+            for (j = 0; j < rem; j++)
+                block[16 + j] = input[16 * (nblocks - 1) + j] ^ block[j];
+            AES128_enc(&block[16], key->schedule, &block[16]);
+        }
+    }
+    memcpy(output, block, nbytes_output);
+}
+
+static void xof_shake_prefix(unsigned char *buffer, const unsigned char *input, const unsigned long nbytes_input, const unsigned long salt)
+{ // buffer = the salt (8 bytes, little-endian) followed by the input
+    uint64_t salt64 = (uint64_t)salt;
+    unsigned int i;
+
+    for (i = 0; i < 8; i++)
+        buffer[i] = (unsigned char)(salt64 >> (8 * i));
+    memcpy(buffer + 8, input, nbytes_input);
+}
+
+void XOF_SHAKE(unsigned char *output, unsigned char *input, unsigned long nbytes_output, unsigned long nbytes_input, unsigned long salt)
+{ // SHAKE128 of the salt and the input, a collision-resistant alternative to xxHash. Assumes nbytes_input <= XOF_SHAKE_MAX_INPUT
+    unsigned char buffer[8 + XOF_SHAKE_MAX_INPUT];
+
+    xof_shake_prefix(buffer, input, nbytes_input, salt);
+    shake128(output, nbytes_output, buffer, 8 + nbytes_input);
+}
+
+void XOF(unsigned char *output, unsigned char *input, unsigned long nbytes_output, unsigned long nbytes_input, unsigned long salt)
+{
+#if defined(USE_XXHASH_XOF)
+    XOF_XXH64(output, input, nbytes_output, nbytes_input, salt);
+
+#elif defined(USE_XXH3_XOF)
+    XOF_XXH3(output, input, nbytes_output, nbytes_input, salt);
+
+#elif defined(USE_AES_XOF)
+    XOF_AES(output, input, nbytes_output, nbytes_input, salt);
+
+#elif defined(USE_SHAKE_XOF)
+    XOF_SHAKE(output, input, nbytes_output, nbytes_input, salt);
+#endif
+}
+
+
+/********************************************************************************************
+* Batched XOF. With XXH64, VLANES inputs are hashed at a time in the 64-bit lanes of the selected backend:
+* AVX2 (4 lanes, with 64-bit multiplications made of three 32x32-bit ones) or AVX-512 (8 lanes, with AVX512DQ).
+*********************************************************************************************/
+
+#define XOF_BATCH_MAX_LANES     8
+
+static unsigned int xof_batch_backend = SIMD_AUTO;
+
+#if defined(SIMD_SUPPORT)
+
+#include <immintrin.h>
+
+#define XXH_PRIME64_1   11400714785074694791ULL
+#define XXH_PRIME64_2   14029467366897019727ULL
+#define XXH_PRIME64_3    1609587929392839161ULL
+#define XXH_PRIME64_4    9650029242287828579ULL
+#define XXH_PRIME64_5    2870177450012600261ULL
+
+static inline uint64_t xof_read(const unsigned char *p, const unsigned int nbytes)
+{ // The nbytes bytes at p, little-endian
+    uint64_t w = 0;
+
+    memcpy(&w, p, nbytes);
+    return w;
+}
+
+#if defined(_SIMD_AVX2_)
+
+static __attribute__((target("avx2"))) __m256i mul64_avx2(const __m256i a, const uint64_t b)
+{ // Low 64 bits of the lane products a*b
+    __m256i lo = _mm256_mul_epu32(a, _mm256_set1_epi64x((long long)b));
+    __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_set1_epi64x((long long)b)), 
+                                     _mm256_mul_epu32(a, _mm256_set1_epi64x((long long)(b >> 32))));
+    return _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+}
+
+static inline __attribute__((target("avx2"))) __m256i loadn_avx2(unsigned char *const *in, const unsigned long offset, const unsigned int nbytes)
+{
+    return _mm256_set_epi64x((long long)xof_read(in[3] + offset, nbytes), (long long)xof_read(in[2] + offset, nbytes), 
+                             (long long)xof_read(in[1] + offset, nbytes), (long long)xof_read(in[0] + offset, nbytes));
+}
+
+static inline __attribute__((target("avx2"))) void load_stripe_avx2(__m256i *w, unsigned char *const *in, const unsigned long offset)
+{ // 4x4 transposition of the 64-bit words of the 4 stripes
+    __m256i r0 = _mm256_loadu_si256((const __m256i*)(in[0] + offset)), r1 = _mm256_loadu_si256((const __m256i*)(in[1] + offset));
+    __m256i r2 = _mm256_loadu_si256((const __m256i*)(in[2] + offset)), r3 = _mm256_loadu_si256((const __m256i*)(in[3] + offset));
+    __m256i t0 = _mm256_unpacklo_epi64(r0, r1), t1 = _mm256_unpackhi_epi64(r0, r1);
+    __m256i t2 = _mm256_unpacklo_epi64(r2, r3), t3 = _mm256_unpackhi_epi64(r2, r3);
+
+    w[0] = _mm256_permute2x128_si256(t0, t2, 0x20);
+    w[1] = _mm256_permute2x128_si256(t1, t3, 0x20);
+    w[2] = _mm256_permute2x128_si256(t0, t2, 0x31);
+    w[3] = _mm256_permute2x128_si256(t1, t3, 0x31);
+}
+
+#define SIMD_NAME(f)            f##_avx2
+#define SIMD_TARGET             __attribute__((target("avx2")))
+#define VLANES                  4
+#define vec_t                   __m256i
+#define V_LOAD(p)               _mm256_loadu_si256((const __m256i*)(p))
+#define V_STORE(p, a)           _mm256_storeu_si256((__m256i*)(p), a)
+#define V_SET1(x)               _mm256_set1_epi64x((long long)(x))
+#define V_ZERO()                _mm256_setzero_si256()
+#define V_ADD(a, b)             _mm256_add_epi64(a, b)
+#define V_SUB(a, b)             _mm256_sub_epi64(a, b)
+#define V_XOR(a, b)             _mm256_xor_si256(a, b)
+#define V_SRL(a, n)             _mm256_srli_epi64(a, n)
+#define V_ROTL(a, n)            _mm256_or_si256(_mm256_slli_epi64(a, n), _mm256_srli_epi64(a, 64 - (n)))
+#define V_MUL(a, b)             mul64_avx2(a, b)
+#define V_LOADN(in, o, n)       loadn_avx2(in, o, n)
+#define V_LOAD_STRIPE(w, in, o) load_stripe_avx2(w, in, o)
+
+#include "xxhash/xxhash_lanes.c"
+
+#undef SIMD_NAME
+#undef SIMD_TARGET
+#undef VLANES
+#undef vec_t
+#undef V_LOAD
+#undef V_STORE
+#undef V_SET1
+#undef V_ZERO
+#undef V_ADD
+#undef V_SUB
+#undef V_XOR
+#undef V_SRL
+#undef V_ROTL
+#undef V_MUL
+#undef V_LOADN
+#undef V_LOAD_STRIPE
+
+#endif
+
+#if defined(_SIMD_AVX512_)
+
+static inline __attribute__((target("avx512f"))) __m512i loadn_avx512(unsigned char *const *in, const unsigned long offset, const unsigned int nbytes)
+{
+    return _mm512_set_epi64((long long)xof_read(in[7] + offset, nbytes), (long long)xof_read(in[6] + offset, nbytes), 
+                            (long long)xof_read(in[5] + offset, nbytes), (long long)xof_read(in[4] + offset, nbytes), 
+                            (long long)xof_read(in[3] + offset, nbytes), (long long)xof_read(in[2] + offset, nbytes), 
+                            (long long)xof_read(in[1] + offset, nbytes), (long long)xof_read(in[0] + offset, nbytes));
+}
+
+static inline __attribute__((target("avx512f"))) void load_stripe_avx512(__m512i *w, unsigned char *const *in, const unsigned long offset)
+{ // 8x4 transposition of the 64-bit words of the 8 stripes: inputs j and j+4 share a vector, then 4x4 transpositions
+    const __m512i even = _mm512_set_epi64(13, 12, 5, 4, 9, 8, 1, 0), odd = _mm512_set_epi64(15, 14, 7, 6, 11, 10, 3, 2);
+    __m512i r[4], t0, t1, t2, t3;
+    unsigned int j;
+
+    for (j = 0; j < 4; j++)
+        r[j] = _mm512_inserti64x4(_mm512_castsi256_si512(_mm256_loadu_si256((const __m256i*)(in[j] + offset))), 
+                                  _mm256_loadu_si256((const __m256i*)(in[j + 4] + offset)), 1);
+    t0 = _mm512_unpacklo_epi64(r[0], r[1]);
+    t1 = _mm512_unpackhi_epi64(r[0], r[1]);
+    t2 = _mm512_unpacklo_epi64(r[2], r[3]);
+    t3 = _mm512_unpackhi_epi64(r[2], r[3]);
+    w[0] = _mm512_permutex2var_epi64(t0, even, t2);
+    w[1] = _mm512_permutex2var_epi64(t1, even, t3);
+    w[2] = _mm512_permutex2var_epi64(t0, odd, t2);
+    w[3] = _mm512_permutex2var_epi64(t1, odd, t3);
+}
+
+#define SIMD_NAME(f)            f##_avx512
+#define SIMD_TARGET             __attribute__((target("avx512f,avx512dq")))
+#define VLANES                  8
+#define vec_t                   __m512i
+#define V_LOAD(p)               _mm512_loadu_si512((const void*)(p))
+#define V_STORE(p, a)           _mm512_storeu_si512((void*)(p), a)
+#define V_SET1(x)               _mm512_set1_epi64((long long)(x))
+#define V_ZERO()                _mm512_setzero_si512()
+#define V_ADD(a, b)             _mm512_add_epi64(a, b)
+#define V_SUB(a, b)             _mm512_sub_epi64(a, b)
+#define V_XOR(a, b)             _mm512_xor_si512(a, b)
+#define V_SRL(a, n)             _mm512_srli_epi64(a, n)
+#define V_ROTL(a, n)            _mm512_rol_epi64(a, n)
+#define V_MUL(a, b)             _mm512_mullo_epi64(a, _mm512_set1_epi64((long long)(b)))
+#define V_LOADN(in, o, n)       loadn_avx512(in, o, n)
+#define V_LOAD_STRIPE(w, in, o) load_stripe_avx512(w, in, o)
+
+#include "xxhash/xxhash_lanes.c"
+
+#undef SIMD_NAME
+#undef SIMD_TARGET
+#undef VLANES
+#undef vec_t
+#undef V_LOAD
+#undef V_STORE
+#undef V_SET1
+#undef V_ZERO
+#undef V_ADD
+#undef V_SUB
+#undef V_XOR
+#undef V_SRL
+#undef V_ROTL
+#undef V_MUL
+#undef V_LOADN
+#undef V_LOAD_STRIPE
+
+#endif
+
+static void XOF_XXH64_lanes(unsigned char *const *output, unsigned char *const *input, const unsigned int n, const unsigned long nbytes_output, 
+                            const unsigned long nbytes_input, const unsigned long salt, const unsigned int lanes, 
+                            void (*kernel)(uint64_t *, unsigned char *const *, const unsigned long))
+{ // XOF_XXH64() of groups of lanes inputs with the kernel, padding the last group with copies of its first input
+    unsigned char *group[XOF_BATCH_MAX_LANES];
+    uint64_t hash[XOF_BATCH_MAX_LANES];
+    unsigned int k, j, m;
+    unsigned long i;
+
+    for (k = 0; k < n; k += lanes) {
+        m = (n - k < lanes) ? n - k : lanes;
+        for (j = 0; j < lanes; j++) {
+            group[j] = input[k + ((j < m) ? j : 0)];
+            hash[j] = (uint64_t)salt;
+        }
+        for (i = 0; i < nbytes_output; i += 8) {  // Chained on the previous output, as in XOF_XXH64()
+            kernel(hash, group, nbytes_input);
+            for (j = 0; j < m; j++)
+                memcpy(output[k + j] + i, &hash[j], (nbytes_output - i < 8) ? nbytes_output - i : 8);
+        }
+    }
+}
+
+#endif
+
+bool XOF_batch_supported(const unsigned int backend)
+{ // Is the backend compiled in for the batched XOF and supported by the CPU?
+    switch (backend) {
+    case SIMD_SCALAR:
+        return true;
+#if defined(SIMD_SUPPORT) && defined(_SIMD_AVX2_)
+    case SIMD_AVX2:
+        return __builtin_cpu_supports("avx2");
+#endif
+#if defined(SIMD_SUPPORT) && defined(_SIMD_AVX512_)
+    case SIMD_AVX512:
+        return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq");
+#endif
+    default:
+        return false;
+    }
+}
+
+bool XOF_batch_select(const unsigned int backend)
+{ // Selects the backend of the batched XOF. SIMD_AUTO (the default) picks the widest one supported by the CPU.
+  // Returns false if the backend is not available. Not thread-safe: to be called before starting the walkers.
+    if (backend != SIMD_AUTO && !XOF_batch_supported(backend))
+        return false;
+    xof_batch_backend = backend;
+    return true;
+}
+
+unsigned int XOF_batch_backend(void)
+{ // Backend used by XOF_batch()
+    if (xof_batch_backend != SIMD_AUTO)
+        return xof_batch_backend;
+    if (XOF_batch_supported(SIMD_AVX512))
+        return SIMD_AVX512;
+    if (XOF_batch_supported(SIMD_AVX2))
+        return SIMD_AVX2;
+    return SIMD_SCALAR;
+}
+
+void XOF_batch(unsigned char *const *output, unsigned char *const *input, const unsigned int n, const unsigned long nbytes_output, 
+               const unsigned long nbytes_input, const unsigned long salt)
+{ // XOF(output[k], input[k], nbytes_output, nbytes_input, salt) for k = 0..n-1
+    unsigned int k = 0;
+
+#if defined(USE_SHAKE_XOF)
+    unsigned char buffer[4][8 + XOF_SHAKE_MAX_INPUT];
+    unsigned int j, m, lane[4];
+
+    for (; k + 1 < n; k += 4) {  // Groups of 4, the last one padded with its first input (which rewrites the same output)
+        m = (n - k < 4) ? n - k : 4;
+        for (j = 0; j < 4; j++)
+            lane[j] = (j < m) ? j : 0;
+        for (j = 0; j < m; j++)
+            xof_shake_prefix(buffer[j], input[k + j], nbytes_input, salt);
+        shake128x4(output[k + lane[0]], output[k + lane[1]], output[k + lane[2]], output[k + lane[3]], nbytes_output, 
+                   buffer[lane[0]], buffer[lane[1]], buffer[lane[2]], buffer[lane[3]], 8 + nbytes_input);
+    }
+#elif defined(USE_XXHASH_XOF) && defined(SIMD_SUPPORT)
+    unsigned int backend = XOF_batch_backend();
+
+#if defined(_SIMD_AVX512_)
+    if (backend == SIMD_AVX512 && n > 1) {
+        XOF_XXH64_lanes(output, input, n, nbytes_output, nbytes_input, salt, 8, xxh64_lanes_avx512);
+        return;
     }
 #endif
+#if defined(_SIMD_AVX2_)
+    if (backend == SIMD_AVX2 && n > 1) {
+        XOF_XXH64_lanes(output, input, n, nbytes_output, nbytes_input, salt, 4, xxh64_lanes_avx2);
+        return;
+    }
+#endif
+#endif
+    for (; k < n; k++)
+        XOF(output[k], input[k], nbytes_output, nbytes_input, salt);
 }
@@ -5,23 +5,32 @@
 // prng selection
 #define USE_AES_PRNG    // If commented out it uses linear rand
 
-// XOF selection
-#define USE_XXHASH_XOF
-//#define USE_AES_XOF
+// With USE_BUFFERED_PRNG ("make PRNG=BUFFERED"), the AES PRNG encrypts PRNG_BUFFER_BLOCKS counters at a time into a buffer kept in
+// the PRNG state of each walker, and serves the sampled bytes from it. Its output differs from the default AES PRNG, which encrypts
+// a counter block per call and drops the unused bytes, but it is equally deterministic for a given seed
+#define PRNG_BUFFER_BLOCKS  8
 
-#if defined(USE_AES_PRNG) || defined(USE_AES_XOF)
-#include "aes/aes.h"
+// XOF selection: xxHash (XXH64) unless USE_XXH3_XOF, USE_AES_XOF or USE_SHAKE_XOF is defined (e.g., with "make XOF=XXH3")
+#if !defined(USE_XXH3_XOF) && !defined(USE_AES_XOF) && !defined(USE_SHAKE_XOF)
+#define USE_XXHASH_XOF
 #endif
 
-#if defined(USE_XXHASH_XOF)
+#define XOF_SHAKE_MAX_INPUT     256     // Longest input of the SHAKE XOF, which hashes a copy of it after the salt
+
+// All the XOFs are built, so that the benchmarks can compare them
+#include "aes/aes.h"
 #include "xxhash/xxhash.h"
-#endif
+#include "sha3/fips202.h"
 
 typedef struct
 {
 #if defined(USE_AES_PRNG)
     unsigned char aes_key_schedule[16 * 11] ALIGN_FOOTER(32);
     uint64_t count;
+#if defined(USE_BUFFERED_PRNG)
+    unsigned char buffer[16 * PRNG_BUFFER_BLOCKS] ALIGN_FOOTER(32);
+    uint32_t available;             // Bytes of the buffer not served yet, at its end
+#endif
 #else
     unsigned long A;
     unsigned long B;
@@ -33,3 +42,16 @@ typedef struct
 void init_prng(prng_state_t *state, unsigned long seed);
 void sample_prng(prng_state_t *state, unsigned char *buffer, unsigned long nbytes);
 void XOF(unsigned char *output, unsigned char *input, unsigned long nbytes_output, unsigned long nbytes_input, unsigned long salt);
+void XOF_XXH64(unsigned char *output, unsigned char *input, unsigned long nbytes_output, unsigned long nbytes_input, unsigned long salt);
+void XOF_XXH3(unsigned char *output, unsigned char *input, unsigned long nbytes_output, unsigned long nbytes_input, unsigned long salt);
+void XOF_AES(unsigned char *output, unsigned char *input, unsigned long nbytes_output, unsigned long nbytes_input, unsigned long salt);
+void XOF_SHAKE(unsigned char *output, unsigned char *input, unsigned long nbytes_output, unsigned long nbytes_input, unsigned long salt);
+
+// Batched XOF: XOF() of n inputs with the same salt and the same output. With XXH64, the inputs are hashed in the lanes of the 
+// backend selected with XOF_batch_select() (SIMD_SCALAR, SIMD_AVX2 or SIMD_AVX512, the widest supported by the CPU by default).
+// With SHAKE, they are hashed 4 at a time with shake128x4()
+void XOF_batch(unsigned char *const *output, unsigned char *const *input, const unsigned int n, const unsigned long nbytes_output, 
+               const unsigned long nbytes_input, const unsigned long salt);
+bool XOF_batch_supported(const unsigned int backend);
+bool XOF_batch_select(const unsigned int backend);
+unsigned int XOF_batch_backend(void);
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "config.h"
+
+// Per-stage cycle profiler of the vOW hot path, compiled in with "make PROFILE=TRUE" (-D _PROFILE_).
+// Each thread adds the cycles and calls of the stages it runs to its own counters, so that the walkers do not share
+// cache lines, and profile_flush() adds them to profile_total at the end of each parallel region. Without _PROFILE_
+// the PROFILE_* macros expand to nothing.
+
+typedef enum
+{
+    PROFILE_THREADS,                // Time spent by all threads in vOW(), the reference for the other stages
+    PROFILE_SAMPLE,                 // SampleSIDH()
+    PROFILE_LADDER,                 // LadderThreePtSIDH() (kernel point)
+    PROFILE_XDBLE,                  // TraverseTree(): multiplications by 4
+    PROFILE_GET_4_ISOG,             // TraverseTree(): 4-isogeny computations
+    PROFILE_EVAL_4_ISOG,            // TraverseTree(): 4-isogeny evaluations
+    PROFILE_J_INV,                  // j-invariant of the codomain curve
+    PROFILE_FP2_ENCODE,             // Encoding of the j-invariant
+    PROFILE_XOF,                    // Hash of the j-invariant into the next state
+    PROFILE_DISTINGUISHED,          // DistinguishedSIDH()
+    PROFILE_MEMORY_READ,            // Reading a triple (and its trail checkpoints) from memory
+    PROFILE_MEMORY_WRITE,           // Writing a triple (and its trail checkpoints) to memory
+    PROFILE_BACKTRACK,              // BacktrackSIDH(), including the random function steps it takes
+    PROFILE_STAGES
+} profile_stage_t;
+
+#if defined(_PROFILE_)
+
+#if (OS_TARGET == OS_WIN)
+#include <intrin.h>
+#define PROFILE_THREAD_LOCAL __declspec(thread)
+#else
+#include <time.h>
+#define PROFILE_THREAD_LOCAL __thread
+#endif
+
+typedef struct
+{
+    unsigned long long cycles[PROFILE_STAGES];
+    unsigned long long calls[PROFILE_STAGES];
+    unsigned long long start[PROFILE_STAGES];  // Counter value when the stage was entered
+} profile_t;
+
+extern PROFILE_THREAD_LOCAL profile_t profile_thread;  // Counters of the calling thread
+extern profile_t profile_total;                         // Counters flushed by all threads
+
+void profile_flush(void);
+void profile_reset(void);
+
+static inline unsigned long long profile_cycles(void)
+{ // Access system counter, as cpucycles() in the tests
+#if (OS_TARGET == OS_WIN) && (TARGET == TARGET_AMD64 || TARGET == TARGET_x86)
+    return __rdtsc();
+#elif (OS_TARGET == OS_LINUX) && (TARGET == TARGET_AMD64 || TARGET == TARGET_x86)
+    unsigned int hi, lo;
+
+    __asm volatile ("rdtsc\n\t" : "=a" (lo), "=d"(hi));
+    return ((unsigned long long)lo) | (((unsigned long long)hi) << 32);
+#else
+    struct timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (unsigned long long)time.tv_sec*1000000000ULL + (unsigned long long)time.tv_nsec;
+#endif
+}
+
+#define PROFILE_BEGIN(stage)    (profile_thread.start[stage] = profile_cycles())
+#define PROFILE_END(stage)      do { profile_thread.cycles[stage] += profile_cycles() - profile_thread.start[stage]; profile_thread.calls[stage]++; } while (0)
+#define PROFILE_FLUSH()         profile_flush()
+#define PROFILE_RESET()         profile_reset()
+
+#else
+
+#define PROFILE_BEGIN(stage)    ((void)0)
+#define PROFILE_END(stage)      ((void)0)
+#define PROFILE_FLUSH()         ((void)0)
+#define PROFILE_RESET()         ((void)0)
+
+#endif
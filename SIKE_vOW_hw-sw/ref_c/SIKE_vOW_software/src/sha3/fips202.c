@@ -570,4 +570,413 @@ void cshake256_simple(unsigned char *output, unsigned long long outlen, uint16_t
     for (i = 0; i < outlen%SHAKE256_RATE; i++)
       output[i] = t[i];
   }
-}
\ No newline at end of file
+}
+
+
+/********** 4-way SHAKE ***********/
+// Four independent SHAKE instances, one per 64-bit lane of AVX2 vectors: lane j of state[i] is word i of instance j.
+// The instances absorb inputs of the same length and squeeze outputs of the same length. Without AVX2, the x4 functions
+// run the one-state versions four times.
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+
+#define XOR256(a, b)        _mm256_xor_si256(a, b)
+#define ROL256(a, offset)   _mm256_or_si256(_mm256_slli_epi64(a, offset), _mm256_srli_epi64(a, 64-(offset)))
+#define ROL256_8(a)         _mm256_shuffle_epi8(a, _mm256_set_epi8(14,13,12,11,10,9,8,15, 6,5,4,3,2,1,0,7, 14,13,12,11,10,9,8,15, 6,5,4,3,2,1,0,7))
+#define ROL256_56(a)        _mm256_shuffle_epi8(a, _mm256_set_epi8(8,15,14,13,12,11,10,9, 0,7,6,5,4,3,2,1, 8,15,14,13,12,11,10,9, 0,7,6,5,4,3,2,1))
+
+
+void KeccakF1600_StatePermute4x(__m256i *state)
+{
+  int round;
+
+        __m256i Aba, Abe, Abi, Abo, Abu;
+        __m256i Aga, Age, Agi, Ago, Agu;
+        __m256i Aka, Ake, Aki, Ako, Aku;
+        __m256i Ama, Ame, Ami, Amo, Amu;
+        __m256i Asa, Ase, Asi, Aso, Asu;
+        __m256i BCa, BCe, BCi, BCo, BCu;
+        __m256i Da, De, Di, Do, Du;
+        __m256i Eba, Ebe, Ebi, Ebo, Ebu;
+        __m256i Ega, Ege, Egi, Ego, Egu;
+        __m256i Eka, Eke, Eki, Eko, Eku;
+        __m256i Ema, Eme, Emi, Emo, Emu;
+        __m256i Esa, Ese, Esi, Eso, Esu;
+
+        //copyFromState(A, state)
+        Aba = state[ 0];
+        Abe = state[ 1];
+        Abi = state[ 2];
+        Abo = state[ 3];
+        Abu = state[ 4];
+        Aga = state[ 5];
+        Age = state[ 6];
+        Agi = state[ 7];
+        Ago = state[ 8];
+        Agu = state[ 9];
+        Aka = state[10];
+        Ake = state[11];
+        Aki = state[12];
+        Ako = state[13];
+        Aku = state[14];
+        Ama = state[15];
+        Ame = state[16];
+        Ami = state[17];
+        Amo = state[18];
+        Amu = state[19];
+        Asa = state[20];
+        Ase = state[21];
+        Asi = state[22];
+        Aso = state[23];
+        Asu = state[24];
+
+        for( round = 0; round < NROUNDS; round += 2 )
+        {
+            //    prepareTheta
+            BCa = XOR256(XOR256(XOR256(Aba, Aga), XOR256(Aka, Ama)), Asa);
+            BCe = XOR256(XOR256(XOR256(Abe, Age), XOR256(Ake, Ame)), Ase);
+            BCi = XOR256(XOR256(XOR256(Abi, Agi), XOR256(Aki, Ami)), Asi);
+            BCo = XOR256(XOR256(XOR256(Abo, Ago), XOR256(Ako, Amo)), Aso);
+            BCu = XOR256(XOR256(XOR256(Abu, Agu), XOR256(Aku, Amu)), Asu);
+
+            //thetaRhoPiChiIotaPrepareTheta(round  , A, E)
+            Da = XOR256(BCu, ROL256(BCe, 1));
+            De = XOR256(BCa, ROL256(BCi, 1));
+            Di = XOR256(BCe, ROL256(BCo, 1));
+            Do = XOR256(BCi, ROL256(BCu, 1));
+            Du = XOR256(BCo, ROL256(BCa, 1));
+
+            Aba = XOR256(Aba, Da);
+            BCa = Aba;
+            Age = XOR256(Age, De);
+            BCe = ROL256(Age, 44);
+            Aki = XOR256(Aki, Di);
+            BCi = ROL256(Aki, 43);
+            Amo = XOR256(Amo, Do);
+            BCo = ROL256(Amo, 21);
+            Asu = XOR256(Asu, Du);
+            BCu = ROL256(Asu, 14);
+            Eba = XOR256(BCa, _mm256_andnot_si256(BCe, BCi));
+            Eba = XOR256(Eba, _mm256_set1_epi64x((long long)KeccakF_RoundConstants[round]));
+            Ebe = XOR256(BCe, _mm256_andnot_si256(BCi, BCo));
+            Ebi = XOR256(BCi, _mm256_andnot_si256(BCo, BCu));
+            Ebo = XOR256(BCo, _mm256_andnot_si256(BCu, BCa));
+            Ebu = XOR256(BCu, _mm256_andnot_si256(BCa, BCe));
+
+            Abo = XOR256(Abo, Do);
+            BCa = ROL256(Abo, 28);
+            Agu = XOR256(Agu, Du);
+            BCe = ROL256(Agu, 20);
+            Aka = XOR256(Aka, Da);
+            BCi = ROL256(Aka, 3);
+            Ame = XOR256(Ame, De);
+            BCo = ROL256(Ame, 45);
+            Asi = XOR256(Asi, Di);
+            BCu = ROL256(Asi, 61);
+            Ega = XOR256(BCa, _mm256_andnot_si256(BCe, BCi));
+            Ege = XOR256(BCe, _mm256_andnot_si256(BCi, BCo));
+            Egi = XOR256(BCi, _mm256_andnot_si256(BCo, BCu));
+            Ego = XOR256(BCo, _mm256_andnot_si256(BCu, BCa));
+            Egu = XOR256(BCu, _mm256_andnot_si256(BCa, BCe));
+
+            Abe = XOR256(Abe, De);
+            BCa = ROL256(Abe, 1);
+            Agi = XOR256(Agi, Di);
+            BCe = ROL256(Agi, 6);
+            Ako = XOR256(Ako, Do);
+            BCi = ROL256(Ako, 25);
+            Amu = XOR256(Amu, Du);
+            BCo = ROL256_8(Amu);
+            Asa = XOR256(Asa, Da);
+            BCu = ROL256(Asa, 18);
+            Eka = XOR256(BCa, _mm256_andnot_si256(BCe, BCi));
+            Eke = XOR256(BCe, _mm256_andnot_si256(BCi, BCo));
+            Eki = XOR256(BCi, _mm256_andnot_si256(BCo, BCu));
+            Eko = XOR256(BCo, _mm256_andnot_si256(BCu, BCa));
+            Eku = XOR256(BCu, _mm256_andnot_si256(BCa, BCe));
+
+            Abu = XOR256(Abu, Du);
+            BCa = ROL256(Abu, 27);
+            Aga = XOR256(Aga, Da);
+            BCe = ROL256(Aga, 36);
+            Ake = XOR256(Ake, De);
+            BCi = ROL256(Ake, 10);
+            Ami = XOR256(Ami, Di);
+            BCo = ROL256(Ami, 15);
+            Aso = XOR256(Aso, Do);
+            BCu = ROL256_56(Aso);
+            Ema = XOR256(BCa, _mm256_andnot_si256(BCe, BCi));
+            Eme = XOR256(BCe, _mm256_andnot_si256(BCi, BCo));
+            Emi = XOR256(BCi, _mm256_andnot_si256(BCo, BCu));
+            Emo = XOR256(BCo, _mm256_andnot_si256(BCu, BCa));
+            Emu = XOR256(BCu, _mm256_andnot_si256(BCa, BCe));
+
+            Abi = XOR256(Abi, Di);
+            BCa = ROL256(Abi, 62);
+            Ago = XOR256(Ago, Do);
+            BCe = ROL256(Ago, 55);
+            Aku = XOR256(Aku, Du);
+            BCi = ROL256(Aku, 39);
+            Ama = XOR256(Ama, Da);
+            BCo = ROL256(Ama, 41);
+            Ase = XOR256(Ase, De);
+            BCu = ROL256(Ase, 2);
+            Esa = XOR256(BCa, _mm256_andnot_si256(BCe, BCi));
+            Ese = XOR256(BCe, _mm256_andnot_si256(BCi, BCo));
+            Esi = XOR256(BCi, _mm256_andnot_si256(BCo, BCu));
+            Eso = XOR256(BCo, _mm256_andnot_si256(BCu, BCa));
+            Esu = XOR256(BCu, _mm256_andnot_si256(BCa, BCe));
+
+            //    prepareTheta
+            BCa = XOR256(XOR256(XOR256(Eba, Ega), XOR256(Eka, Ema)), Esa);
+            BCe = XOR256(XOR256(XOR256(Ebe, Ege), XOR256(Eke, Eme)), Ese);
+            BCi = XOR256(XOR256(XOR256(Ebi, Egi), XOR256(Eki, Emi)), Esi);
+            BCo = XOR256(XOR256(XOR256(Ebo, Ego), XOR256(Eko, Emo)), Eso);
+            BCu = XOR256(XOR256(XOR256(Ebu, Egu), XOR256(Eku, Emu)), Esu);
+
+            //thetaRhoPiChiIotaPrepareTheta(round+1, E, A)
+            Da = XOR256(BCu, ROL256(BCe, 1));
+            De = XOR256(BCa, ROL256(BCi, 1));
+            Di = XOR256(BCe, ROL256(BCo, 1));
+            Do = XOR256(BCi, ROL256(BCu, 1));
+            Du = XOR256(BCo, ROL256(BCa, 1));
+
+            Eba = XOR256(Eba, Da);
+            BCa = Eba;
+            Ege = XOR256(Ege, De);
+            BCe = ROL256(Ege, 44);
+            Eki = XOR256(Eki, Di);
+            BCi = ROL256(Eki, 43);
+            Emo = XOR256(Emo, Do);
+            BCo = ROL256(Emo, 21);
+            Esu = XOR256(Esu, Du);
+            BCu = ROL256(Esu, 14);
+            Aba = XOR256(BCa, _mm256_andnot_si256(BCe, BCi));
+            Aba = XOR256(Aba, _mm256_set1_epi64x((long long)KeccakF_RoundConstants[round+1]));
+            Abe = XOR256(BCe, _mm256_andnot_si256(BCi, BCo));
+            Abi = XOR256(BCi, _mm256_andnot_si256(BCo, BCu));
+            Abo = XOR256(BCo, _mm256_andnot_si256(BCu, BCa));
+            Abu = XOR256(BCu, _mm256_andnot_si256(BCa, BCe));
+
+            Ebo = XOR256(Ebo, Do);
+            BCa = ROL256(Ebo, 28);
+            Egu = XOR256(Egu, Du);
+            BCe = ROL256(Egu, 20);
+            Eka = XOR256(Eka, Da);
+            BCi = ROL256(Eka, 3);
+            Eme = XOR256(Eme, De);
+            BCo = ROL256(Eme, 45);
+            Esi = XOR256(Esi, Di);
+            BCu = ROL256(Esi, 61);
+            Aga = XOR256(BCa, _mm256_andnot_si256(BCe, BCi));
+            Age = XOR256(BCe, _mm256_andnot_si256(BCi, BCo));
+            Agi = XOR256(BCi, _mm256_andnot_si256(BCo, BCu));
+            Ago = XOR256(BCo, _mm256_andnot_si256(BCu, BCa));
+            Agu = XOR256(BCu, _mm256_andnot_si256(BCa, BCe));
+
+            Ebe = XOR256(Ebe, De);
+            BCa = ROL256(Ebe, 1);
+            Egi = XOR256(Egi, Di);
+            BCe = ROL256(Egi, 6);
+            Eko = XOR256(Eko, Do);
+            BCi = ROL256(Eko, 25);
+            Emu = XOR256(Emu, Du);
+            BCo = ROL256_8(Emu);
+            Esa = XOR256(Esa, Da);
+            BCu = ROL256(Esa, 18);
+            Aka = XOR256(BCa, _mm256_andnot_si256(BCe, BCi));
+            Ake = XOR256(BCe, _mm256_andnot_si256(BCi, BCo));
+            Aki = XOR256(BCi, _mm256_andnot_si256(BCo, BCu));
+            Ako = XOR256(BCo, _mm256_andnot_si256(BCu, BCa));
+            Aku = XOR256(BCu, _mm256_andnot_si256(BCa, BCe));
+
+            Ebu = XOR256(Ebu, Du);
+            BCa = ROL256(Ebu, 27);
+            Ega = XOR256(Ega, Da);
+            BCe = ROL256(Ega, 36);
+            Eke = XOR256(Eke, De);
+            BCi = ROL256(Eke, 10);
+            Emi = XOR256(Emi, Di);
+            BCo = ROL256(Emi, 15);
+            Eso = XOR256(Eso, Do);
+            BCu = ROL256_56(Eso);
+            Ama = XOR256(BCa, _mm256_andnot_si256(BCe, BCi));
+            Ame = XOR256(BCe, _mm256_andnot_si256(BCi, BCo));
+            Ami = XOR256(BCi, _mm256_andnot_si256(BCo, BCu));
+            Amo = XOR256(BCo, _mm256_andnot_si256(BCu, BCa));
+            Amu = XOR256(BCu, _mm256_andnot_si256(BCa, BCe));
+
+            Ebi = XOR256(Ebi, Di);
+            BCa = ROL256(Ebi, 62);
+            Ego = XOR256(Ego, Do);
+            BCe = ROL256(Ego, 55);
+            Eku = XOR256(Eku, Du);
+            BCi = ROL256(Eku, 39);
+            Ema = XOR256(Ema, Da);
+            BCo = ROL256(Ema, 41);
+            Ese = XOR256(Ese, De);
+            BCu = ROL256(Ese, 2);
+            Asa = XOR256(BCa, _mm256_andnot_si256(BCe, BCi));
+            Ase = XOR256(BCe, _mm256_andnot_si256(BCi, BCo));
+            Asi = XOR256(BCi, _mm256_andnot_si256(BCo, BCu));
+            Aso = XOR256(BCo, _mm256_andnot_si256(BCu, BCa));
+            Asu = XOR256(BCu, _mm256_andnot_si256(BCa, BCe));
+        }
+
+        //copyToState(state, A)
+        state[ 0] = Aba;
+        state[ 1] = Abe;
+        state[ 2] = Abi;
+        state[ 3] = Abo;
+        state[ 4] = Abu;
+        state[ 5] = Aga;
+        state[ 6] = Age;
+        state[ 7] = Agi;
+        state[ 8] = Ago;
+        state[ 9] = Agu;
+        state[10] = Aka;
+        state[11] = Ake;
+        state[12] = Aki;
+        state[13] = Ako;
+        state[14] = Aku;
+        state[15] = Ama;
+        state[16] = Ame;
+        state[17] = Ami;
+        state[18] = Amo;
+        state[19] = Amu;
+        state[20] = Asa;
+        state[21] = Ase;
+        state[22] = Asi;
+        state[23] = Aso;
+        state[24] = Asu;
+}
+
+
+static void keccakx4_absorb(__m256i *s, unsigned int r, const unsigned char *m0, const unsigned char *m1, const unsigned char *m2, 
+                            const unsigned char *m3, unsigned long long int mlen, unsigned char p)
+{
+  unsigned long long i;
+  unsigned char t[4][200];
+
+  for (i = 0; i < 25; ++i)
+    s[i] = _mm256_setzero_si256();
+
+  while (mlen >= r)
+  {
+    for (i = 0; i < r / 8; ++i)
+      s[i] = XOR256(s[i], _mm256_set_epi64x((long long)load64(m3 + 8 * i), (long long)load64(m2 + 8 * i), 
+                                            (long long)load64(m1 + 8 * i), (long long)load64(m0 + 8 * i)));
+
+    KeccakF1600_StatePermute4x(s);
+    mlen -= r;
+    m0 += r;
+    m1 += r;
+    m2 += r;
+    m3 += r;
+  }
+
+  memset(t, 0, sizeof(t));
+  memcpy(t[0], m0, mlen);
+  memcpy(t[1], m1, mlen);
+  memcpy(t[2], m2, mlen);
+  memcpy(t[3], m3, mlen);
+  for (i = 0; i < 4; ++i)
+  {
+    t[i][mlen] = p;
+    t[i][r - 1] |= 128;
+  }
+  for (i = 0; i < r / 8; ++i)
+    s[i] = XOR256(s[i], _mm256_set_epi64x((long long)load64(t[3] + 8 * i), (long long)load64(t[2] + 8 * i), 
+                                          (long long)load64(t[1] + 8 * i), (long long)load64(t[0] + 8 * i)));
+}
+
+
+static void keccakx4_squeezeblocks(unsigned char *h0, unsigned char *h1, unsigned char *h2, unsigned char *h3, 
+                                   unsigned long long int nblocks, __m256i *s, unsigned int r)
+{
+  uint64_t w[4];
+  unsigned int i;
+
+  while(nblocks > 0)
+  {
+    KeccakF1600_StatePermute4x(s);
+    for (i = 0; i < (r>>3); i++)
+    {
+      _mm256_storeu_si256((__m256i*)w, s[i]);
+      store64(h0+8*i, w[0]);
+      store64(h1+8*i, w[1]);
+      store64(h2+8*i, w[2]);
+      store64(h3+8*i, w[3]);
+    }
+    h0 += r;
+    h1 += r;
+    h2 += r;
+    h3 += r;
+    nblocks--;
+  }
+}
+
+
+static void shakex4(unsigned char *out0, unsigned char *out1, unsigned char *out2, unsigned char *out3, unsigned long long outlen, 
+                    const unsigned char *in0, const unsigned char *in1, const unsigned char *in2, const unsigned char *in3, 
+                    unsigned long long inlen, unsigned int r)
+{
+  __m256i s[25];
+  unsigned char t[4][SHAKE128_RATE];
+  unsigned long long nblocks = outlen/r;
+
+  /* Absorb input */
+  keccakx4_absorb(s, r, in0, in1, in2, in3, inlen, 0x1F);
+
+  /* Squeeze output */
+  keccakx4_squeezeblocks(out0, out1, out2, out3, nblocks, s, r);
+
+  outlen -= nblocks*r;
+  if (outlen)
+  {
+    keccakx4_squeezeblocks(t[0], t[1], t[2], t[3], 1, s, r);
+    memcpy(out0 + nblocks*r, t[0], outlen);
+    memcpy(out1 + nblocks*r, t[1], outlen);
+    memcpy(out2 + nblocks*r, t[2], outlen);
+    memcpy(out3 + nblocks*r, t[3], outlen);
+  }
+}
+
+
+void shake128x4(unsigned char *out0, unsigned char *out1, unsigned char *out2, unsigned char *out3, unsigned long long outlen, 
+                const unsigned char *in0, const unsigned char *in1, const unsigned char *in2, const unsigned char *in3, unsigned long long inlen)
+{
+  shakex4(out0, out1, out2, out3, outlen, in0, in1, in2, in3, inlen, SHAKE128_RATE);
+}
+
+
+void shake256x4(unsigned char *out0, unsigned char *out1, unsigned char *out2, unsigned char *out3, unsigned long long outlen, 
+                const unsigned char *in0, const unsigned char *in1, const unsigned char *in2, const unsigned char *in3, unsigned long long inlen)
+{
+  shakex4(out0, out1, out2, out3, outlen, in0, in1, in2, in3, inlen, SHAKE256_RATE);
+}
+
+#else
+
+void shake128x4(unsigned char *out0, unsigned char *out1, unsigned char *out2, unsigned char *out3, unsigned long long outlen, 
+                const unsigned char *in0, const unsigned char *in1, const unsigned char *in2, const unsigned char *in3, unsigned long long inlen)
+{
+  shake128(out0, outlen, in0, inlen);
+  shake128(out1, outlen, in1, inlen);
+  shake128(out2, outlen, in2, inlen);
+  shake128(out3, outlen, in3, inlen);
+}
+
+
+void shake256x4(unsigned char *out0, unsigned char *out1, unsigned char *out2, unsigned char *out3, unsigned long long outlen, 
+                const unsigned char *in0, const unsigned char *in1, const unsigned char *in2, const unsigned char *in3, unsigned long long inlen)
+{
+  shake256(out0, outlen, in0, inlen);
+  shake256(out1, outlen, in1, inlen);
+  shake256(out2, outlen, in2, inlen);
+  shake256(out3, outlen, in3, inlen);
+}
+
+#endif
@@ -66,7 +66,7 @@ static void copy_trip(trip_t *s, const trip_t *t)
 static digit_t MemIndexSIDH(private_state_t *private_state)
 {
     // Assumes that MEMORY_SIZE <= 2^RADIX
-    return (digit_t)((private_state->current.current_state[0] + private_state->random_functions) & (MEMORY_SIZE - 1));
+    return (digit_t)((private_state->current.current_state[0] + private_state->random_functions) & (private_state->MEMORY_SIZE - 1));
 }
 
 static unsigned int GetMSBSIDH(const unsigned char *m)
@@ -83,15 +83,125 @@ static unsigned int GetMSBSIDH(const unsigned char *m)
 
 
 // Functions for accessing memory
+// Each slot is a single word holding a packed triple (see vow.h), so that walkers sharing the memory read and 
+// write whole triples with plain atomic loads and stores and can never observe a half-written one.
 
-static void read_from_memory(trip_t *t, shared_state_t *S, digit_t address)
-{ // Reads triple from memory at specified address
-    copy_trip(t, &S->memory[address]);
+static inline uint64_t low_mask(unsigned int bits)
+{
+    return (bits >= 64) ? (uint64_t)-1 : (((uint64_t)1 << bits) - 1);
+}
+
+static mem_slot_t pack_trip(const trip_t *t, const shared_state_t *S, uint32_t function_version)
+{ // Packs a distinguished triple, dropping the bits of current_state that are implied by its address and distinguishedness
+    unsigned int log_dist = insts_constants.NBITS_STATE - S->MEMORY_LOG_SIZE;
+    uint64_t val, slot;
+
+    // Distinguisher value, as computed in DistinguishedSIDH()
+    val = ((uint64_t)t->current_state[0] >> S->MEMORY_LOG_SIZE) + (uint64_t)function_version * S->DIST_BOUND;
+    val &= low_mask(log_dist);
+
+    slot = (uint64_t)t->current_steps;
+    slot |= val << S->STEPS_BITS;
+    slot |= ((uint64_t)t->initial_state[0] & low_mask(insts_constants.NBITS_STATE)) << (S->STEPS_BITS + S->DIST_BITS);
+    if (S->TAG_BITS != 0)
+        slot |= ((uint64_t)function_version & low_mask(S->TAG_BITS)) << (64 - S->TAG_BITS);
+    return slot;
+}
+
+static bool unpack_trip(trip_t *t, mem_slot_t slot, const shared_state_t *S, digit_t address, uint32_t function_version)
+{ // Unpacks the triple stored at the given address. Returns false if the slot is empty or holds a point of another function version
+    unsigned int log_dist = insts_constants.NBITS_STATE - S->MEMORY_LOG_SIZE;
+    uint64_t val, high, low;
+
+    t->current_steps = (uint32_t)(slot & low_mask(S->STEPS_BITS));
+    if (slot == 0 || (S->TAG_BITS != 0 && (slot >> (64 - S->TAG_BITS)) != ((uint64_t)function_version & low_mask(S->TAG_BITS)))) {
+        t->current_steps = 0;
+        return false;
+    }
+    val = (slot >> S->STEPS_BITS) & low_mask(S->DIST_BITS);
+    high = (val - (uint64_t)function_version * S->DIST_BOUND) & low_mask(log_dist);
+    low = ((uint64_t)address - function_version) & (S->MEMORY_SIZE - 1);  // Inverts MemIndexSIDH()
+    t->current_state[0] = (digit_t)((high << S->MEMORY_LOG_SIZE) | low);
+    t->initial_state[0] = (digit_t)((slot >> (S->STEPS_BITS + S->DIST_BITS)) & low_mask(insts_constants.NBITS_STATE));
+    return true;
+}
+
+bool read_from_memory(trip_t *t, shared_state_t *S, digit_t address, uint32_t function_version)
+{ // Reads triple from memory at specified address. Returns false if the slot is empty or was written for another function version
+    mem_slot_t slot;
+
+#if defined(_OPENMP)
+    slot = __atomic_load_n(&S->memory[address], __ATOMIC_RELAXED);
+#else
+    slot = S->memory[address];
+#endif
+    return unpack_trip(t, slot, S, address, function_version);
+}
+
+bool write_to_memory(trip_t *t, shared_state_t *S, digit_t address, uint32_t function_version)
+{ // Writes distinguished triple to memory at specified address
+    mem_slot_t slot = pack_trip(t, S, function_version);
+
+#if defined(_OPENMP)
+    __atomic_store_n(&S->memory[address], slot, __ATOMIC_RELAXED);
+#else
+    S->memory[address] = slot;
+#endif
+    return true;
+}
+
+// Each row of the trail side table is tagged with the packed triple of its slot. A writer clears the tag while it stores the 
+// checkpoints, and a reader only accepts them if it finds the same tag before and after copying them. If two walkers write 
+// the same row at once a reader can still get mixed checkpoints, which can only make locating miss the collision.
+
+static uint64_t *trail_row(shared_state_t *S, digit_t address)
+{
+    return &S->trails[(uint64_t)address * (S->TRAIL_POINTS + 2)];
+}
+
+bool read_trail_from_memory(trail_t *trail, const trip_t *t, shared_state_t *S, digit_t address, uint32_t function_version)
+{ // Reads the trail checkpoints of the triple t read from memory at the specified address. Returns false if they are not 
+  // available, e.g., if the row was overwritten since or is being written
+    uint64_t *row = trail_row(S, address), tag = pack_trip(t, S, function_version);
+    unsigned int i;
+
+#if defined(_OPENMP)
+    if (__atomic_load_n(&row[0], __ATOMIC_ACQUIRE) != tag)
+        return false;
+    trail->count = (uint32_t)__atomic_load_n(&row[1], __ATOMIC_RELAXED);
+    for (i = 0; i < trail->count && i < S->TRAIL_POINTS; i++)
+        trail->points[i][0] = (digit_t)__atomic_load_n(&row[i + 2], __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return (__atomic_load_n(&row[0], __ATOMIC_RELAXED) == tag && trail->count <= S->TRAIL_POINTS);
+#else
+    if (row[0] != tag || row[1] > S->TRAIL_POINTS)
+        return false;
+    trail->count = (uint32_t)row[1];
+    for (i = 0; i < trail->count; i++)
+        trail->points[i][0] = (digit_t)row[i + 2];
+    return true;
+#endif
 }
 
-static void write_to_memory(trip_t *t, shared_state_t *S, digit_t address)
-{ // Writes triple to memory at specified address
-    copy_trip(&S->memory[address], t);
+void write_trail_to_memory(const trail_t *trail, const trip_t *t, shared_state_t *S, digit_t address, uint32_t function_version)
+{ // Writes the trail checkpoints of the distinguished triple t written to memory at the specified address
+    uint64_t *row = trail_row(S, address);
+    uint32_t count = (trail->count < S->TRAIL_POINTS) ? trail->count : S->TRAIL_POINTS;
+    unsigned int i;
+
+#if defined(_OPENMP)
+    __atomic_store_n(&row[0], 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&row[1], (uint64_t)count, __ATOMIC_RELAXED);
+    for (i = 0; i < count; i++)
+        __atomic_store_n(&row[i + 2], (uint64_t)trail->points[i][0], __ATOMIC_RELAXED);
+    __atomic_store_n(&row[0], pack_trip(t, S, function_version), __ATOMIC_RELEASE);
+#else
+    row[1] = count;
+    for (i = 0; i < count; i++)
+        row[i + 2] = (uint64_t)trail->points[i][0];
+    row[0] = pack_trip(t, S, function_version);
+#endif
 }
 
 static void fix_overflow(st_t s)
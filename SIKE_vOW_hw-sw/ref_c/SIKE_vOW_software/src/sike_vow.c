@@ -1,37 +1,268 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
 #include "sidh_vow_base.c"
 #include "vow.c"
+#include "vow_net.c"
+#if (OS_TARGET == OS_WIN)
+#include <intrin.h>
+#elif (OS_TARGET == OS_LINUX) && (TARGET == TARGET_ARM64)
+#include <time.h>
+#endif
 
 #ifdef XADD_LOOP_HARDWARE
 #include <xADD_loop_hw.h>
 #endif
 
+// Doubling tables of the current instance: the built-in ones, or those of the file mapped by load_instance()
+static const f2elm_t64 *dbl_table_es = (const f2elm_t64 *)DBL_TABLE_ES;
+static const f2elm_t64 *dbl_table_ee = (const f2elm_t64 *)DBL_TABLE_EE;
+
 
 // Functions for initialization
 
+static unsigned int bit_length(uint64_t x)
+{
+    unsigned int bits = 0;
+
+    while (x != 0) {
+        bits++;
+        x >>= 1;
+    }
+    return bits;
+}
+
+static bool set_memory_parameters(shared_state_t *S, unsigned int memory_log_size)
+{ // Derives the vOW parameters for a memory of w = 2^memory_log_size triples
+  // Returns false if w is not supported for the current instance
+    double theta;
+
+    S->memory = NULL;
+    S->trails = NULL;
+    S->TRAIL_INTERVAL = 0;
+    S->TRAIL_POINTS = 0;
+    S->checkpoint = NULL;
+    S->checkpoint_size = 0;
+    S->checkpoint_interval = 0.;
+    S->resume = false;
+    S->links = NULL;
+    S->STORE_BATCH = 0;
+    S->store_fd = -1;
+    S->store_port = 0;
+    if (memory_log_size == 0 || memory_log_size > MAX_MEMORY_LOG_SIZE || memory_log_size >= RADIX || memory_log_size >= insts_constants.NBITS_STATE)
+        return false;
+    S->MEMORY_LOG_SIZE = memory_log_size;
+    S->MEMORY_SIZE = (uint64_t)1 << memory_log_size;
+
+    // Fraction of distinguished points
+    theta = insts_constants.ALPHA * sqrt((double)S->MEMORY_SIZE / pow(2, insts_constants.NBITS_STATE));
+    S->MAX_STEPS = (uint32_t)ceil(insts_constants.GAMMA / theta);
+    S->MAX_DIST = (uint64_t)(insts_constants.BETA * (double)S->MEMORY_SIZE);
+    S->DIST_BOUND = (uint64_t)floor(theta * pow(2, insts_constants.NBITS_STATE - memory_log_size));
+
+    // Layout of the packed triples, which must fit in one memory word
+    S->STEPS_BITS = bit_length(S->MAX_STEPS);
+    S->DIST_BITS = bit_length(S->DIST_BOUND);
+    if (S->STEPS_BITS + S->DIST_BITS + insts_constants.NBITS_STATE > 8*sizeof(mem_slot_t))
+        return false;
+    S->TAG_BITS = 8*sizeof(mem_slot_t) - (S->STEPS_BITS + S->DIST_BITS + insts_constants.NBITS_STATE);
+    return true;
+}
+
+bool init_shared_memory(shared_state_t *S, unsigned int memory_log_size)
+{ // Allocates an empty memory of w = 2^memory_log_size triples and derives the vOW parameters for it
+  // Returns false if w is not supported for the current instance or cannot be allocated
+    if (!set_memory_parameters(S, memory_log_size))
+        return false;
+
+    // Zeroed memory: empty slots
+    S->memory = (mem_slot_t *)calloc((size_t)S->MEMORY_SIZE, sizeof(mem_slot_t));
+    return (S->memory != NULL);
+}
+
+#if !defined(HRDW) && (OS_TARGET == OS_LINUX)
+
+#define CHECKPOINT_PAGE_SIZE    4096
+
+static uint64_t round_up(uint64_t x, uint64_t a)
+{
+    return (x + a - 1) / a * a;
+}
+
+static bool map_checkpoint(shared_state_t *S, int fd, uint64_t size)
+{ // Maps the checkpoint file, so that the memory and walkers are used in place
+    void *p = mmap(NULL, (size_t)size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    close(fd);
+    if (p == MAP_FAILED)
+        return false;
+    S->checkpoint = (checkpoint_t *)p;
+    S->checkpoint_size = size;
+    S->memory = (mem_slot_t *)((unsigned char *)p + S->checkpoint->memory_offset);
+    return true;
+}
+
+bool init_shared_memory_file(shared_state_t *S, unsigned int memory_log_size, uint16_t cores, const char *path)
+{ // Creates a checkpoint file holding an empty memory of w = 2^memory_log_size triples and the states of the given number of walkers
+  // Returns false if w is not supported for the current instance or the file cannot be created
+    checkpoint_t header;
+    uint64_t size;
+    int fd;
+
+    if (cores == 0 || !set_memory_parameters(S, memory_log_size))
+        return false;
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CHECKPOINT_MAGIC, sizeof(header.magic));
+    header.format = CHECKPOINT_FORMAT;
+    memcpy(header.MODULUS, insts_constants.MODULUS, sizeof(header.MODULUS));
+    header.e = insts_constants.e;
+    header.PRNG_SEED = insts_constants.PRNG_SEED;
+    header.MEMORY_LOG_SIZE = memory_log_size;
+    header.N_OF_CORES = cores;
+    header.private_state_size = sizeof(private_state_t);
+    header.walkers_offset = round_up(sizeof(checkpoint_t), 64);
+    header.memory_offset = round_up(header.walkers_offset + (uint64_t)cores * sizeof(private_state_t), CHECKPOINT_PAGE_SIZE);
+    size = header.memory_offset + S->MEMORY_SIZE * sizeof(mem_slot_t);
+
+    // A fresh file reads as zeros: empty memory slots
+    fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+        return false;
+    if (ftruncate(fd, (off_t)size) != 0 || pwrite(fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header)) {
+        close(fd);
+        return false;
+    }
+    if (!map_checkpoint(S, fd, size))
+        return false;
+    S->N_OF_CORES = cores;
+    return true;
+}
+
+bool resume_shared_memory(shared_state_t *S, const char *path)
+{ // Maps the checkpoint file of an interrupted attack, restoring its memory, walkers and progress
+  // Returns false if the file cannot be read or was written for another instance or binary
+    checkpoint_t header;
+    struct stat st;
+    int fd;
+
+    fd = open(path, O_RDWR);
+    if (fd < 0)
+        return false;
+    if (pread(fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header) || fstat(fd, &st) != 0 ||
+        memcmp(header.magic, CHECKPOINT_MAGIC, sizeof(header.magic)) != 0 || header.format != CHECKPOINT_FORMAT ||
+        strncmp(header.MODULUS, insts_constants.MODULUS, sizeof(header.MODULUS)) != 0 || header.e != insts_constants.e ||
+        header.PRNG_SEED != insts_constants.PRNG_SEED || header.private_state_size != sizeof(private_state_t) ||
+        header.N_OF_CORES == 0 || header.N_OF_CORES > UINT16_MAX || !set_memory_parameters(S, header.MEMORY_LOG_SIZE) ||
+        (uint64_t)st.st_size != header.memory_offset + S->MEMORY_SIZE * sizeof(mem_slot_t)) {
+        close(fd);
+        return false;
+    }
+    if (!map_checkpoint(S, fd, (uint64_t)st.st_size))
+        return false;
+
+    S->N_OF_CORES = (uint16_t)header.N_OF_CORES;
+    if (header.walkers_valid) {
+        S->resume = true;
+        S->collect_vow_stats = header.collect_vow_stats;
+        S->N_OF_WALKS = (uint16_t)header.N_OF_WALKS;
+        S->function_version = header.function_version;
+        S->current_dist = header.current_dist;
+    }
+    return true;
+}
+
+#endif
+
+bool init_trail_memory(shared_state_t *S, uint32_t interval)
+{ // Allocates the side table holding checkpoints every interval steps of the trails of the triples in memory (see BacktrackSIDH()).
+  // To be called after the memory is initialized. Returns false if interval is 0 or the table cannot be allocated
+    uint32_t points = (S->MAX_STEPS - 1) / interval;
+
+    if (interval == 0)
+        return false;
+    S->TRAIL_INTERVAL = interval;
+    S->TRAIL_POINTS = (points < MAX_TRAIL_POINTS) ? points : MAX_TRAIL_POINTS;
+
+    // Zeroed rows: no checkpoints
+    S->trails = (uint64_t *)calloc((size_t)S->MEMORY_SIZE, (S->TRAIL_POINTS + 2) * sizeof(uint64_t));
+    return (S->trails != NULL);
+}
+
+void free_shared_memory(shared_state_t *S)
+{
+    free(S->trails);
+    S->trails = NULL;
+#if !defined(HRDW) && (OS_TARGET == OS_LINUX)
+    close_store(S);
+    if (S->checkpoint != NULL) {
+        munmap(S->checkpoint, (size_t)S->checkpoint_size);
+        S->checkpoint = NULL;
+        S->memory = NULL;
+        return;
+    }
+#endif
+    free(S->memory);
+    S->memory = NULL;
+}
+
 void init_stats(shared_state_t *S)
 {
     // Statistics
     S->collect_vow_stats = false;  // By default don't collect stats (=> terminate run when successful)
+    S->N_OF_CORES = 1;
+    S->N_OF_WALKS = 1;
+    S->LOCATE_THREADS = 1;
+    S->N_OF_LOCATORS = 0;
+    S->locate_queue = NULL;
+    S->function_version = 1;
+    S->current_dist = 0;
     S->success = false;
     S->wall_time = 0.;
     S->collisions = 0;
     S->mem_collisions = 0;
     S->dist_points = 0;
+    S->dist_cols = 0;
+    S->collision_set = NULL;
+    S->collision_set_size = 0;
     S->number_steps_collect = 0;
     S->number_steps_locate = 0;
     S->number_steps = 0;
     S->final_avg_random_functions = 0.;
+    S->queued_collisions = 0;
+    S->located_queued = 0;
+    S->located_inline = 0;
+    S->max_queue_depth = 0;
+    S->sum_queue_depth = 0;
+    S->sum_locate_latency = 0.;
+    S->max_locate_latency = 0.;
+    S->store_workers = 0;
+    S->store_batches = 0;
+    S->store_dropped = 0;
+    S->store_collisions = 0;
 }
 
 // Functions for private state initialization
 
 void init_private_state(shared_state_t *S, private_state_t *private_state)
 {
-    private_state->thread_id = 0;              // A different ID should be fixed for each core (ID beginning with 0).
+    unsigned long salt;
+
+#if defined(_OPENMP)
+    private_state->thread_id = omp_get_thread_num();  // A different ID for each core (ID beginning with 0)
+#else
+    private_state->thread_id = 0;
+#endif
+    private_state->MEMORY_SIZE = S->MEMORY_SIZE;
+    private_state->MEMORY_LOG_SIZE = S->MEMORY_LOG_SIZE;
+    private_state->DIST_BOUND = S->DIST_BOUND;
+    private_state->TRAIL_INTERVAL = S->TRAIL_INTERVAL;
+    private_state->TRAIL_POINTS = S->TRAIL_POINTS;
+    private_state->LOCATE_THREADS = S->LOCATE_THREADS;
     private_state->current_dist = 0;
-    private_state->random_functions = 1;
-    private_state->function_version = 1;
+    private_state->function_version = S->function_version;
+    private_state->random_functions = private_state->function_version;
 
     private_state->collect_vow_stats = S->collect_vow_stats;
     private_state->collisions = 0;
@@ -42,10 +273,14 @@ void init_private_state(shared_state_t *S, private_state_t *private_state)
 
     private_state->current.current_steps = 0;
     private_state->trip.current_steps = 0;
+    private_state->n_walks = (S->N_OF_WALKS >= 1 && S->N_OF_WALKS <= MAX_WALKS) ? S->N_OF_WALKS : 1;
 
-    // PRNG: initial seed could be pre-fixed in advance for each core
-    XOF((unsigned char *)(&private_state->PRNG_SEED), (unsigned char *)(&insts_constants.PRNG_SEED), sizeof(private_state->PRNG_SEED), sizeof(insts_constants.PRNG_SEED), (unsigned long)private_state->thread_id + 1);
+    // PRNG: the initial seed is salted with the thread ID so that each core walks from different points, or in a distributed 
+    // attack with the worker ID assigned by the store server, so that the walkers of different workers do too
+    salt = (S->links != NULL) ? (unsigned long)S->links[private_state->thread_id].worker_id : (unsigned long)private_state->thread_id + 1;
+    XOF((unsigned char *)(&private_state->PRNG_SEED), (unsigned char *)(&insts_constants.PRNG_SEED), sizeof(private_state->PRNG_SEED), sizeof(insts_constants.PRNG_SEED), salt);
     init_prng(&private_state->prng_state, (unsigned long)private_state->PRNG_SEED);
+    SampleWalksSIDH(private_state);
 }
 
 
@@ -53,11 +288,23 @@ void init_private_state(shared_state_t *S, private_state_t *private_state)
 
 void SampleSIDH(private_state_t *private_state)
 { // Sample a new starting point
+    PROFILE_BEGIN(PROFILE_SAMPLE);
+    memset(private_state->current.current_state, 0, sizeof(st_t));  // The PRNG only fills the low NBYTES_STATE bytes
     sample_prng(&private_state->prng_state, (unsigned char*)private_state->current.current_state, (unsigned long)insts_constants.NBYTES_STATE);
 
     private_state->current.current_steps = 0;
     fix_overflow(private_state->current.current_state);
     copy_st(private_state->current.initial_state, private_state->current.current_state);
+    PROFILE_END(PROFILE_SAMPLE);
+}
+
+void SampleWalksSIDH(private_state_t *private_state)
+{ // Sample new starting points for all the walks of a walker
+    for (unsigned int k = 0; k < private_state->n_walks; k++) {
+        SampleSIDH(private_state);
+        copy_trip(&private_state->walks[k], &private_state->current);
+        private_state->trails[k].count = 0;
+    }
 }
 
 static void LadderThreePtSIDH(point_proj_t R, const CurveAndPointsSIDH E, const f2elm_t64* dbl_table, const unsigned char c, const unsigned char *m)
@@ -136,14 +383,16 @@ static void GetIsogeny(f2elm_t jinv, const CurveAndPointsSIDH E, const f2elm_t64
     point_proj_t R, A24, unused1, unused2, unused3;
 
     // Retrieve kernel point
+    PROFILE_BEGIN(PROFILE_LADDER);
     LadderThreePtSIDH(R, E, dbl_table, c, k);
+    PROFILE_END(PROFILE_LADDER);
 
     fp2copy(E.a24, A24->X);
     fpcopy((digit_t *)Montgomery_one, (digit_t *)A24->Z);
     fpzero((digit_t *)(A24->Z)[1]);
         
     // Traverse tree 
-    TraverseTree(jinv, R, A24->X, A24->Z, insts_constants.STRAT, LENSTRAT+1, false, unused1, unused2, unused3);
+    TraverseTree(jinv, R, A24->X, A24->Z, insts_constants.STRAT, insts_constants.e/2 - 1, false, unused1, unused2, unused3);
 
     // Frobenius
     fp2correction(jinv);
@@ -151,6 +400,99 @@ static void GetIsogeny(f2elm_t jinv, const CurveAndPointsSIDH E, const f2elm_t64
         fpneg(jinv[1]);
 }
 
+#if !defined(XADD_LOOP_HARDWARE) && !defined(XDBLE_HARDWARE) && !defined(GET_4_ISOG_AND_EVAL_4_ISOG_HARDWARE)
+
+static void LadderThreePtSIDH_batch(point_proj_batch_t R, const CurveAndPointsSIDH **E, const f2elm_t64 **dbl_table, const unsigned char *c, const unsigned char **m, const unsigned int n)
+{ // Lockstep version of LadderThreePtSIDH() for n walks, each with its own curve, doubling table, c and m
+    point_proj_batch_t U, D, P;  // U is the point added to in the current step, D the difference point, P the table points
+    unsigned int order[MAX_WALKS], len[MAX_WALKS], i, j, k, w, n_active;
+    unsigned char bit, u_is_R2[MAX_WALKS];
+
+    // Sort walks by decreasing ladder length, so that the walks still running are always the first n_active ones
+    for (k = 0; k < n; k++) {
+        len[k] = GetMSBSIDH(m[k]) + c[k];  // Skip top zeroes of m
+        for (j = k; j > 0 && len[order[j - 1]] < len[k]; j--)
+            order[j] = order[j - 1];
+        order[j] = k;
+    }
+
+    // Initializing points: U = R = xP and D = R2 = xPQ
+    for (k = 0; k < n; k++) {
+        w = order[k];
+        fp2copy(E[w]->xp, U->X[k]);
+        fpcopy((digit_t*)&Montgomery_one, U->Z[k][0]);
+        fpzero(U->Z[k][1]);
+        fp2copy(E[w]->xpq, D->X[k]);
+        fpcopy((digit_t*)&Montgomery_one, D->Z[k][0]);
+        fpzero(D->Z[k][1]);
+        u_is_R2[k] = 0;
+    }
+
+    for (j = 0, n_active = n; ; j++) {
+        while (n_active > 0 && len[order[n_active - 1]] <= j)
+            n_active--;
+        if (n_active == 0)
+            break;
+        for (k = 0; k < n_active; k++) {
+            w = order[k];
+            i = j + 2 - c[w];  // Ignore c
+            bit = (m[w][i >> 3] >> (i & 0x07)) & 1;
+            if (bit != u_is_R2[k]) {
+                // R2->PQ, P, R->Q if the bit is set, R->Q, P, R2->PQ otherwise
+                fp2copy(U->X[k], P->X[k]);
+                fp2copy(U->Z[k], P->Z[k]);
+                fp2copy(D->X[k], U->X[k]);
+                fp2copy(D->Z[k], U->Z[k]);
+                fp2copy(P->X[k], D->X[k]);
+                fp2copy(P->Z[k], D->Z[k]);
+                u_is_R2[k] = bit;
+            }
+            fp2copy(((point_proj_t*)dbl_table[w])[j]->X, P->X[k]);
+            fp2copy(((point_proj_t*)dbl_table[w])[j]->Z, P->Z[k]);
+        }
+        xADD_batch(U, P, (const f2elm_t*)D->X, n_active);
+        for (k = 0; k < n_active; k++)
+            fp2mul_mont(U->X[k], D->Z[k], U->X[k]);
+    }
+
+    // Return R in the original order of the walks
+    for (k = 0; k < n; k++) {
+        w = order[k];
+        fp2copy(u_is_R2[k] ? D->X[k] : U->X[k], R->X[w]);
+        fp2copy(u_is_R2[k] ? D->Z[k] : U->Z[k], R->Z[w]);
+    }
+}
+
+static void GetIsogeny_batch(f2elm_t *jinv, const CurveAndPointsSIDH **E, const f2elm_t64 **dbl_table, const unsigned char *c, const unsigned char **k, const unsigned int n)
+{ // Degree-2^(e/2) isogeny computations for n walks in lockstep
+    point_proj_batch_t R;
+    f2elm_t A24plus[MAX_WALKS], C24[MAX_WALKS];
+    unsigned int w;
+
+    // Retrieve kernel points
+    PROFILE_BEGIN(PROFILE_LADDER);
+    LadderThreePtSIDH_batch(R, E, dbl_table, c, k, n);
+    PROFILE_END(PROFILE_LADDER);
+
+    for (w = 0; w < n; w++) {
+        fp2copy(E[w]->a24, A24plus[w]);
+        fpcopy((digit_t *)Montgomery_one, C24[w][0]);
+        fpzero(C24[w][1]);
+    }
+
+    // Traverse tree 
+    TraverseTree_batch(jinv, R, A24plus, C24, insts_constants.STRAT, insts_constants.e/2 - 1, n);
+
+    // Frobenius
+    for (w = 0; w < n; w++) {
+        fp2correction(jinv[w]);
+        if (jinv[w][1][0] & 1)
+            fpneg(jinv[w][1]);
+    }
+}
+
+#endif
+
 static void UpdateStSIDH(unsigned char jinvariant[FP2_ENCODED_BYTES], st_t r, const st_t s, uint32_t function_version)
 {
     f2elm_t jinv;
@@ -164,87 +506,696 @@ static void UpdateStSIDH(unsigned char jinvariant[FP2_ENCODED_BYTES], st_t r, co
     if (c == 0) {
         index = (s[0] >> 1) & 1;
 ////////////////////////////// NOTE: THE CORE COMPUTATION TO BE HW ACCELERATED
-        GetIsogeny(jinv, ES[index], (f2elm_t64*)DBL_TABLE_ES[2*(insts_constants.NBITS_STATE+1)*index], c, (unsigned char*)s);
+        GetIsogeny(jinv, ES[index], &dbl_table_es[2*(insts_constants.NBITS_STATE+1)*index], c, (unsigned char*)s);
     } else {
 ////////////////////////////// NOTE: THE CORE COMPUTATION TO BE HW ACCELERATED
-        GetIsogeny(jinv, *EE, (f2elm_t64*)DBL_TABLE_EE, c, (unsigned char*)s);
+        GetIsogeny(jinv, *EE, dbl_table_ee, c, (unsigned char*)s);
     }
     //////////////////// RISC-V TAKES IT FROM HERE
 
     // Hash j into (c,b,k)
+    PROFILE_BEGIN(PROFILE_FP2_ENCODE);
     fp2_encode(jinv, jinvariant);  // Unique encoding (includes fpcorrection)
+    PROFILE_END(PROFILE_FP2_ENCODE);
+    PROFILE_BEGIN(PROFILE_XOF);
     XOF((unsigned char*)r, jinvariant, (unsigned long)insts_constants.NBYTES_STATE, FP2_ENCODED_BYTES, (unsigned long)function_version);
     fix_overflow(r);
+    PROFILE_END(PROFILE_XOF);
+}
+
+static void UpdateStSIDH_batch(unsigned char jinvariant[][FP2_ENCODED_BYTES], st_t *r, st_t *s, const unsigned int n, uint32_t function_version)
+{ // Lockstep version of UpdateStSIDH() for n states
+    unsigned int k;
+#if defined(XADD_LOOP_HARDWARE) || defined(XDBLE_HARDWARE) || defined(GET_4_ISOG_AND_EVAL_4_ISOG_HARDWARE)
+    // The accelerators compute one isogeny at a time
+    for (k = 0; k < n; k++)
+        UpdateStSIDH(jinvariant[k], r[k], s[k], function_version);
+#else
+    f2elm_t jinv[MAX_WALKS];
+    const CurveAndPointsSIDH *E[MAX_WALKS];
+    const f2elm_t64 *dbl_table[MAX_WALKS];
+    const unsigned char *m[MAX_WALKS];
+    unsigned char c[MAX_WALKS];
+    unsigned char *xof_in[MAX_WALKS], *xof_out[MAX_WALKS];
+    unsigned int index;
+    CurveAndPointsSIDH* ES = (CurveAndPointsSIDH*)&insts_constants.ES;
+    CurveAndPointsSIDH* EE = (CurveAndPointsSIDH*)&insts_constants.EE;
+
+    // Get the j-invariants of the corresponding curves
+    for (k = 0; k < n; k++) {
+        c[k] = GetC_SIDH(s[k]);
+        m[k] = (const unsigned char*)s[k];
+        if (c[k] == 0) {
+            index = (s[k][0] >> 1) & 1;
+            E[k] = &ES[index];
+            dbl_table[k] = &dbl_table_es[2*(insts_constants.NBITS_STATE+1)*index];
+        } else {
+            E[k] = EE;
+            dbl_table[k] = dbl_table_ee;
+        }
+    }
+    GetIsogeny_batch(jinv, E, dbl_table, c, m, n);
+
+    // Hash each j into (c,b,k), all the walks in one batch
+    for (k = 0; k < n; k++) {
+        PROFILE_BEGIN(PROFILE_FP2_ENCODE);
+        fp2_encode(jinv[k], jinvariant[k]);  // Unique encoding (includes fpcorrection)
+        PROFILE_END(PROFILE_FP2_ENCODE);
+        xof_in[k] = jinvariant[k];
+        xof_out[k] = (unsigned char*)r[k];
+    }
+    PROFILE_BEGIN(PROFILE_XOF);
+    XOF_batch(xof_out, xof_in, n, (unsigned long)insts_constants.NBYTES_STATE, FP2_ENCODED_BYTES, (unsigned long)function_version);
+    for (k = 0; k < n; k++)
+        fix_overflow(r[k]);
+    PROFILE_END(PROFILE_XOF);
+#endif
 }
 
 void UpdateSIDH(private_state_t *private_state)
-{ // Compute random function step
-    unsigned char j[FP2_ENCODED_BYTES];
+{ // Compute random function step for all the walks of a walker, in lockstep
+    unsigned char j[MAX_WALKS][FP2_ENCODED_BYTES];
+    st_t states[MAX_WALKS];
+    unsigned int k;
 
-    UpdateStSIDH(j, private_state->current.current_state, private_state->current.current_state, private_state->function_version);
-    private_state->number_steps_collect += 1;
+    for (k = 0; k < private_state->n_walks; k++)
+        copy_st(states[k], private_state->walks[k].current_state);
+    UpdateStSIDH_batch(j, states, states, private_state->n_walks, private_state->function_version);
+    for (k = 0; k < private_state->n_walks; k++)
+        copy_st(private_state->walks[k].current_state, states[k]);
+    private_state->number_steps_collect += private_state->n_walks;
 }
 
 bool DistinguishedSIDH(private_state_t *private_state)
 { // Determine if it is a distinguished point
-    uint32_t val;
+    uint64_t val;
     
+    PROFILE_BEGIN(PROFILE_DISTINGUISHED);
     // Divide distinguishedness over interval to avoid bad cases
-    val = ((uint32_t*)(private_state->current.current_state))[0] >> MEMORY_LOG_SIZE;
-    val += private_state->function_version * insts_constants.DIST_BOUND;
-    val &= ((1 << (insts_constants.NBITS_STATE - MEMORY_LOG_SIZE)) - 1);
+    val = (uint64_t)private_state->current.current_state[0] >> private_state->MEMORY_LOG_SIZE;
+    val += (uint64_t)private_state->function_version * private_state->DIST_BOUND;
+    val &= (((uint64_t)1 << (insts_constants.NBITS_STATE - private_state->MEMORY_LOG_SIZE)) - 1);
+    PROFILE_END(PROFILE_DISTINGUISHED);
+
+    return (val <= private_state->DIST_BOUND);
+}
+
+
+// Stages of a random function step on a single state, for the benchmarks (tests/bench_vOW.c)
+
+static const CurveAndPointsSIDH *curve_of_state(const st_t s, const f2elm_t64 **dbl_table)
+{ // Curve and doubling table of the isogeny computed from s, as in UpdateStSIDH()
+    CurveAndPointsSIDH* ES = (CurveAndPointsSIDH*)&insts_constants.ES;
+    CurveAndPointsSIDH* EE = (CurveAndPointsSIDH*)&insts_constants.EE;
+    unsigned int index;
+
+    if (GetC_SIDH(s) == 0) {
+        index = (s[0] >> 1) & 1;
+        *dbl_table = &dbl_table_es[2*(insts_constants.NBITS_STATE+1)*index];
+        return &ES[index];
+    }
+    *dbl_table = dbl_table_ee;
+    return EE;
+}
+
+void KernelPointSIDH(point_proj_t R, const st_t s)
+{ // Kernel point of the isogeny computed from s (LadderThreePtSIDH())
+    const f2elm_t64 *dbl_table;
+    const CurveAndPointsSIDH *E = curve_of_state(s, &dbl_table);
+
+    LadderThreePtSIDH(R, *E, dbl_table, GetC_SIDH(s), (const unsigned char *)s);
+}
+
+void CodomainSIDH(f2elm_t jinv, point_proj_t R, const st_t s)
+{ // j-invariant of the codomain of the isogeny with kernel point R computed from s (TraverseTree()). R is overwritten
+    point_proj_t A24, unused1, unused2, unused3;
+    const f2elm_t64 *dbl_table;
+    const CurveAndPointsSIDH *E = curve_of_state(s, &dbl_table);
+
+    fp2copy(E->a24, A24->X);
+    fpcopy((digit_t *)Montgomery_one, (digit_t *)A24->Z);
+    fpzero((digit_t *)(A24->Z)[1]);
+    TraverseTree(jinv, R, A24->X, A24->Z, insts_constants.STRAT, insts_constants.e/2 - 1, false, unused1, unused2, unused3);
+}
 
-    return (val <= insts_constants.DIST_BOUND);
+void GetIsogenySIDH(f2elm_t jinv, const st_t s)
+{ // j-invariant of the curve reached from s, before hashing (GetIsogeny())
+    const f2elm_t64 *dbl_table;
+    const CurveAndPointsSIDH *E = curve_of_state(s, &dbl_table);
+
+    GetIsogeny(jinv, *E, dbl_table, GetC_SIDH(s), (const unsigned char *)s);
+}
+
+void StepSIDH(unsigned char jinvariant[FP2_ENCODED_BYTES], st_t r, const st_t s, uint32_t function_version)
+{ // Random function step from s to r (UpdateStSIDH())
+    UpdateStSIDH(jinvariant, r, s, function_version);
 }
 
 
 // Functions for backtracking
+// With LOCATE_THREADS = 2, a walker locates collisions with a nested team of two helper threads: the two trails are walked in 
+// lockstep one on each thread, and the walks from trail checkpoints, which are independent, are shared between them
 
-bool BacktrackSIDH(trip_t *c0, trip_t *c1, private_state_t *private_state)
-{ // Backtracking
-    unsigned char jinv0[FP2_ENCODED_BYTES], jinv1[FP2_ENCODED_BYTES];
+#if defined(_OPENMP)
+#define HELPER_ID       omp_get_thread_num()
+#define HELPER_COUNT    omp_get_num_threads()
+#else
+#define HELPER_ID       0
+#define HELPER_COUNT    1
+#endif
+
+static void WalkTrailsSIDH(st_t r[2], const uint32_t steps[2], private_state_t *private_state)
+{ // Walks both states of r the given numbers of steps
+    uint32_t function_version = private_state->function_version;
+
+#pragma omp parallel num_threads(2) if (private_state->LOCATE_THREADS > 1 && steps[0] != 0 && steps[1] != 0)
+    {
+        unsigned char jinv[FP2_ENCODED_BYTES];
+
+        for (int k = HELPER_ID; k < 2; k += HELPER_COUNT) {
+            for (uint32_t i = 0; i < steps[k]; i++)
+                UpdateStSIDH(jinv, r[k], r[k], function_version);
+        }
+        if (HELPER_ID != 0)
+            PROFILE_FLUSH();  // The walker's thread flushes its counters when it stops
+    }
+    private_state->number_steps_locate += steps[0] + steps[1];
+}
+
+static uint32_t TrailStartSIDH(st_t r, const st_t initial_state, const trail_t *trail, uint32_t steps, const private_state_t *private_state)
+{ // Sets r to the last checkpoint of a trail before the given number of steps (or its initial state) and returns the steps left
+    uint32_t i = steps / private_state->TRAIL_INTERVAL;
+
+    if (i > trail->count)
+        i = trail->count;
+    copy_st(r, (i == 0) ? initial_state : trail->points[i - 1]);
+    return steps - i*private_state->TRAIL_INTERVAL;
+}
+
+static bool RestartTrailsSIDH(st_t c[2], uint32_t *steps, const st_t initial0, uint32_t L0, const trail_t *trail0, const st_t initial1, uint32_t L1, 
+                              const trail_t *trail1, private_state_t *private_state)
+{ // Finds the last checkpoint of the longer trail (L0 >= L1 steps) before it merges with the other one, by bisection (by 
+  // trisection on two helper threads), and sets c to the states of both trails there and *steps to the steps left to the 
+  // distinguished point. Returns false (Robin Hood) if the other trail starts on the longer one
+    uint32_t L = L0 - L1, interval = private_state->TRAIL_INTERVAL, n[2], probe[2], count = 0, lo, hi, last, k;
+    st_t s[2];
+
+    // Checkpoints lo+1, ..., hi-1 of the longer trail lie after step L and before the distinguished point
+    lo = L / interval;
+    last = (L0 - 1) / interval;
+    hi = ((trail0->count < last) ? trail0->count : last) + 1;
+
+    // Once merged, the trails stay merged: compare them at the same number of steps to the distinguished point.
+    // Catch up the longer trail to the start of the other one, along with a first probe on two helper threads
+    n[0] = TrailStartSIDH(s[0], initial0, trail0, L, private_state);
+    n[1] = 0;
+    if (private_state->LOCATE_THREADS > 1 && hi > lo + 1) {
+        probe[0] = (lo + hi) / 2;
+        n[1] = TrailStartSIDH(s[1], initial1, trail1, probe[0]*interval - L, private_state);
+        count = 1;
+    }
+    WalkTrailsSIDH(s, n, private_state);
+    if (is_equal_st(s[0], initial1))
+        return false;
+    copy_st(c[0], s[0]);
+    copy_st(c[1], initial1);
+    if (count != 0)
+        copy_st(s[0], s[1]);
+    *steps = L1;
+
+    while (true) {
+        // The probes are in increasing order
+        for (k = count; k > 0 && is_equal_st(trail0->points[probe[k - 1] - 1], s[k - 1]); k--)
+            hi = probe[k - 1];
+        if (k > 0) {
+            lo = probe[k - 1];
+            copy_st(c[0], trail0->points[lo - 1]);
+            copy_st(c[1], s[k - 1]);
+            *steps = L0 - lo*interval;
+        }
+        if (hi <= lo + 1)
+            return true;
+
+        count = (hi - lo - 1 < private_state->LOCATE_THREADS) ? hi - lo - 1 : private_state->LOCATE_THREADS;
+        for (k = 0; k < 2; k++) {
+            n[k] = 0;
+            if (k < count) {
+                probe[k] = lo + (k + 1)*(hi - lo)/(count + 1);
+                n[k] = TrailStartSIDH(s[k], initial1, trail1, probe[k]*interval - L, private_state);
+            }
+        }
+        WalkTrailsSIDH(s, n, private_state);
+    }
+}
+
+static bool LockstepSIDH(st_t c[2], unsigned char jinvs[2][FP2_ENCODED_BYTES], uint32_t steps, private_state_t *private_state)
+{ // Walks both trails in lockstep for at most the given number of steps, until their j-invariants match. Returns false if they 
+  // do not; otherwise c holds the states that collide and jinvs their j-invariants
+    uint32_t i;
+    st_t c_[2];
+
+#if defined(_OPENMP)
+    if (private_state->LOCATE_THREADS > 1) {
+        // One trail on each helper thread. The j-invariants of consecutive steps go to alternate buffers, so that a thread 
+        // can start the next step while the other one still compares them
+        unsigned char j[2][2][FP2_ENCODED_BYTES];
+        uint32_t function_version = private_state->function_version, found = steps;
+
+#pragma omp parallel num_threads(2)
+        {
+            uint32_t t;
+
+            for (t = 0; t < steps; t++) {
+                for (int k = HELPER_ID; k < 2; k += HELPER_COUNT)
+                    UpdateStSIDH(j[t & 1][k], c_[k], c[k], function_version);
+#pragma omp barrier
+                if (IsEqualJinvSIDH(j[t & 1][0], j[t & 1][1]))
+                    break;
+                for (int k = HELPER_ID; k < 2; k += HELPER_COUNT)
+                    copy_st(c[k], c_[k]);
+            }
+            if (HELPER_ID == 0)
+                found = t;
+            else
+                PROFILE_FLUSH();
+        }
+        if (found == steps) {
+            private_state->number_steps_locate += 2*steps;
+            return false;
+        }
+        memcpy(jinvs, j[found & 1], sizeof(j[0]));
+        private_state->number_steps_locate += 2*(found + 1);
+        return true;
+    }
+#endif
+    // Both trails on the walker's thread, sharing the j-invariant inversion
+    for (i = 0; i < steps; i++) {
+        UpdateStSIDH_batch(jinvs, c_, c, 2, private_state->function_version);
+        private_state->number_steps_locate += 2;
+
+        if (IsEqualJinvSIDH(jinvs[0], jinvs[1]))
+            return true;
+        copy_st(c[0], c_[0]);
+        copy_st(c[1], c_[1]);
+    }
+    return false;
+}
+
+bool BacktrackSIDH(trip_t *c0, trip_t *c1, const trail_t *trail0, const trail_t *trail1, private_state_t *private_state)
+{ // Backtracking. If the trail checkpoints of both triples are given, the trails are walked from the last checkpoint before they 
+  // merge instead of from their initial states
+    unsigned char jinv0[FP2_ENCODED_BYTES], jinvs[2][FP2_ENCODED_BYTES];
+    const trail_t *trail;
     f2elm_t jinv;
-    st_t c0_, c1_;
-    uint32_t L, i;
+    st_t c[2];
+    uint32_t L, L0 = c0->current_steps, L1 = c1->current_steps, i, steps = c1->current_steps;
 
     // Make c0 have the largest number of steps
     if (c0->current_steps < c1->current_steps) {
         SwapStSIDH(c0->initial_state, c1->initial_state);
         L = c1->current_steps - c0->current_steps;
+        L0 = c1->current_steps;
+        L1 = c0->current_steps;
+        trail = trail0;
+        trail0 = trail1;
+        trail1 = trail;
     } else {
         L = c0->current_steps - c1->current_steps;
     }
 
-    // Catch up the trails
-    for (i = 0; i < L; i++) {
-        UpdateStSIDH(jinv0, c0->initial_state, c0->initial_state, private_state->function_version);
-        private_state->number_steps_locate += 1;
+    if (trail0 != NULL && trail1 != NULL && private_state->TRAIL_INTERVAL != 0) {
+        if (!RestartTrailsSIDH(c, &steps, c0->initial_state, L0, trail0, c1->initial_state, L1, trail1, private_state))
+            return false;  // Robin Hood
+    } else {
+        // Catch up the trails
+        for (i = 0; i < L; i++) {
+            UpdateStSIDH(jinv0, c0->initial_state, c0->initial_state, private_state->function_version);
+            private_state->number_steps_locate += 1;
+        }
+
+        if (is_equal_st(c0->initial_state, c1->initial_state))
+            return false;  // Robin Hood
+
+        copy_st(c[0], c0->initial_state);
+        copy_st(c[1], c1->initial_state);
+    }
+
+    if (!LockstepSIDH(c, jinvs, steps + 1, private_state))
+        return false;  // Should never reach here
+
+    // Record collision
+    private_state->collisions += 1;
+    copy_st(private_state->collision[0], c[0]);
+    copy_st(private_state->collision[1], c[1]);
+
+    if (GetC_SIDH(c[0]) == GetC_SIDH(c[1])) {
+        return false;
+    } else {
+        fp2_decode(jinvs[0], jinv);
+        return fp2_is_equal(jinv, (felm_t*)insts_constants.jinv);  // Return true if this is the golden collision
     }
+}
 
-    if (is_equal_st(c0->initial_state, c1->initial_state))
-        return false;  // Robin Hood
 
-    for (i = 0; i < c1->current_steps + 1; i++) {
-        UpdateStSIDH(jinv0, c0_, c0->initial_state, private_state->function_version);
-        private_state->number_steps_locate += 1;
-        UpdateStSIDH(jinv1, c1_, c1->initial_state, private_state->function_version);
-        private_state->number_steps_locate += 1;
+// Functions for instance files
 
-        if (IsEqualJinvSIDH(jinv0, jinv1)) {
-            // Record collision
-            private_state->collisions += 1;
+bool check_strategy(const unsigned int *strat, const unsigned int lenstrat)
+{ // Checks that strat is a valid strategy for a chain of lenstrat 4-isogenies, i.e., that TraverseTree() only multiplies
+  // the kernel points down to points of order 4 and keeps at most MAX_INT_POINTS_ALICE of them
+    unsigned int row, m, ii = 0, index = 0, npts = 0, pts_index[MAX_INT_POINTS_ALICE];
 
-            if (GetC_SIDH(c0->initial_state) == GetC_SIDH(c1->initial_state)) {
+    if (lenstrat == 0 || lenstrat > LENSTRAT+1)
+        return false;
+    for (row = 1; row < lenstrat; row++) {
+        while (index < lenstrat - row) {
+            if (npts == MAX_INT_POINTS_ALICE || ii == LENSTRAT)
                 return false;
-            } else {
-                fp2_decode(jinv0, jinv);
-                return fp2_is_equal(jinv, (felm_t*)insts_constants.jinv);  // Return true if this is the golden collision
+            pts_index[npts++] = index;
+            m = strat[ii++];
+            if (m == 0 || m > lenstrat - row - index)
+                return false;
+            index += m;
+        }
+        if (npts == 0)
+            return false;
+        index = pts_index[--npts];
+    }
+    return true;
+}
+
+static bool check_instance(const instance_t *inst)
+{ // Checks that an instance fits the state encoding and the strategy length supported by this binary
+    return (inst->e >= 6 && inst->e % 2 == 0 && inst->e/2 - 2 <= LENSTRAT && inst->NBITS_STATE == inst->e - 1 &&
+            inst->NBITS_STATE < RADIX && inst->NWORDS_STATE == 1 && inst->NBYTES_STATE == (inst->NBITS_STATE + 7)/8 &&
+            inst->NBITS_OVERFLOW == inst->NBITS_STATE - 8*(inst->NBYTES_STATE - 1) && inst->MAX_FUNCTION_VERSIONS > 0 &&
+            memchr(inst->MODULUS, 0, sizeof(inst->MODULUS)) != NULL && check_strategy(inst->STRAT, inst->e/2 - 1));
+}
+
+bool save_instance(const char *path, const instance_t *inst, const f2elm_t64 *table_es, const f2elm_t64 *table_ee)
+{ // Writes an instance file for load_instance(), with the doubling tables of the two starting curves and of the ending curve
+    instance_file_t header;
+    uint32_t rows;
+    FILE *file;
+    bool ok;
+
+    if (!check_instance(inst))
+        return false;
+    rows = 2*(inst->NBITS_STATE + 1);
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, INSTANCE_MAGIC, sizeof(header.magic));
+    header.format = INSTANCE_FORMAT;
+    header.nwords_field = NWORDS64_FIELD;
+    header.lenstrat = LENSTRAT;
+    header.instance_size = sizeof(instance_t);
+    header.table_rows = rows;
+
+    file = fopen(path, "wb");
+    if (file == NULL)
+        return false;
+    ok = (fwrite(&header, sizeof(header), 1, file) == 1 && fwrite(inst, sizeof(instance_t), 1, file) == 1 &&
+          fwrite(table_es, sizeof(f2elm_t64), 2*rows, file) == 2*rows && fwrite(table_ee, sizeof(f2elm_t64), rows, file) == rows);
+    return (fclose(file) == 0 && ok);
+}
+
+#if !defined(HRDW) && (OS_TARGET == OS_LINUX)
+
+bool load_instance(const char *path)
+{ // Maps an instance file written by gen_instance_XXX and makes it the current instance, in place of the built-in one.
+  // Returns false if the file cannot be read or was written for another prime or platform. The file stays mapped until exit.
+  // Not thread-safe: to be called before the attack starts.
+    const instance_file_t *header;
+    const instance_t *inst;
+    struct stat st;
+    void *p;
+    int fd;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return false;
+    if (fstat(fd, &st) != 0 || (uint64_t)st.st_size < sizeof(instance_file_t) + sizeof(instance_t)) {
+        close(fd);
+        return false;
+    }
+    p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED)
+        return false;
+
+    header = (const instance_file_t *)p;
+    inst = (const instance_t *)(header + 1);
+    if (memcmp(header->magic, INSTANCE_MAGIC, sizeof(header->magic)) != 0 || header->format != INSTANCE_FORMAT ||
+        header->nwords_field != NWORDS64_FIELD || header->lenstrat != LENSTRAT || header->instance_size != sizeof(instance_t) ||
+        (uint64_t)st.st_size != sizeof(instance_file_t) + sizeof(instance_t) + 3*(uint64_t)header->table_rows*sizeof(f2elm_t64) ||
+        !check_instance(inst) || header->table_rows != 2*(inst->NBITS_STATE + 1) ||
+        strncmp(inst->MODULUS, insts_constants.MODULUS, sizeof(inst->MODULUS)) != 0) {
+        munmap(p, (size_t)st.st_size);
+        return false;
+    }
+
+    memcpy(&insts_constants, inst, sizeof(instance_t));
+    dbl_table_es = (const f2elm_t64 *)(inst + 1);
+    dbl_table_ee = dbl_table_es + 2*header->table_rows;
+    return true;
+}
+
+#endif
+
+bool IsGoldenPairSIDH(const st_t s0, const st_t s1)
+{ // Checks that the walks from states s0 (on a starting curve) and s1 (on the ending curve) both reach the golden j-invariant
+    unsigned char jinvariant[FP2_ENCODED_BYTES];
+    f2elm_t jinv;
+    st_t r;
+
+    if (GetC_SIDH(s0) != 0 || GetC_SIDH(s1) != 1)
+        return false;
+    UpdateStSIDH(jinvariant, r, s0, 1);
+    fp2_decode(jinvariant, jinv);
+    if (!fp2_is_equal(jinv, (felm_t*)insts_constants.jinv))
+        return false;
+    UpdateStSIDH(jinvariant, r, s1, 1);
+    fp2_decode(jinvariant, jinv);
+    return fp2_is_equal(jinv, (felm_t*)insts_constants.jinv);
+}
+
+
+// Functions for isogeny strategies
+// TraverseTree() does m multiplications by 4 for each entry m of the strategy and, on each row of the tree, evaluates the 
+// new 4-isogeny at all the saved points. The best strategy depends on the ratio of both costs, which differs between the 
+// scalar, lane-parallel and hardware-accelerated paths, so the costs are fitted to timings of whole random function steps.
+
+#define STRATEGY_RUNS    5          // Timings per measurement, of which the median is kept
+
+static int64_t read_cycles(void)
+{ // Access system counter for benchmarking, as cpucycles() in the tests
+#if (OS_TARGET == OS_WIN) && (TARGET == TARGET_AMD64 || TARGET == TARGET_x86)
+    return __rdtsc();
+#elif (OS_TARGET == OS_LINUX) && (TARGET == TARGET_AMD64 || TARGET == TARGET_x86)
+    unsigned int hi, lo;
+
+    __asm volatile ("rdtsc\n\t" : "=a" (lo), "=d"(hi));
+    return ((int64_t)lo) | (((int64_t)hi) << 32);
+#elif (OS_TARGET == OS_LINUX) && (TARGET == TARGET_ARM64)
+    struct timespec time;
+
+    clock_gettime(CLOCK_REALTIME, &time);
+    return (int64_t)(time.tv_sec*1e9 + time.tv_nsec);
+#else
+    return 0;
+#endif
+}
+
+void strategy_counts(const unsigned int *strat, const unsigned int lenstrat, unsigned int *mults, unsigned int *evals)
+{ // Counts the multiplications by 4 and the 4-isogeny evaluations done by TraverseTree() with a valid strategy
+    unsigned int row, ii = 0, index = 0, npts = 0, pts_index[MAX_INT_POINTS_ALICE];
+
+    *mults = 0;
+    *evals = 0;
+    for (row = 1; row < lenstrat; row++) {
+        while (index < lenstrat - row) {
+            pts_index[npts++] = index;
+            *mults += strat[ii];
+            index += strat[ii++];
+        }
+        *evals += npts;
+        index = pts_index[--npts];
+    }
+}
+
+static void split_strategy(unsigned int *strat, unsigned int *ii, unsigned int split[][MAX_INT_POINTS_ALICE+1], unsigned int n, unsigned int slots)
+{ // Writes the strategy chosen for a subtree of n leaves with the given free slots: [m] + S(n-m) + S(m)
+    unsigned int m;
+
+    if (n < 2)
+        return;
+    m = split[n][slots];
+    strat[(*ii)++] = m;
+    split_strategy(strat, ii, split, n - m, slots - 1);
+    split_strategy(strat, ii, split, m, slots);
+}
+
+double optimal_strategy(unsigned int *strat, const unsigned int lenstrat, const isogeny_costs_t *costs)
+{ // Computes the strategy for lenstrat 4-isogenies that minimizes dbl4*mults + eval4*evals while keeping at most
+  // MAX_INT_POINTS_ALICE saved points. Returns its modelled cost (without costs->other), or -1 if lenstrat is not supported
+    double cost[LENSTRAT+2][MAX_INT_POINTS_ALICE+1], c;
+    unsigned int split[LENSTRAT+2][MAX_INT_POINTS_ALICE+1], n, m, s, ii = 0;
+
+    if (lenstrat == 0 || lenstrat > LENSTRAT+1)
+        return -1;
+    for (n = 1; n <= lenstrat; n++) {
+        for (s = 0; s <= MAX_INT_POINTS_ALICE; s++) {
+            cost[n][s] = (n == 1) ? 0 : HUGE_VAL;
+            split[n][s] = 0;
+            // The saved point takes a slot while the left subtree is traversed, and is the root of the right one
+            for (m = 1; m < n && s > 0; m++) {
+                c = cost[n - m][s - 1] + cost[m][s] + m*costs->dbl4 + (n - m)*costs->eval4;
+                if (c < cost[n][s]) {
+                    cost[n][s] = c;
+                    split[n][s] = m;
+                }
             }
-        } else {
-            copy_st(c0->initial_state, c0_);
-            copy_st(c1->initial_state, c1_);
         }
     }
-    // Should never reach here
-    return false;
+    if (cost[lenstrat][MAX_INT_POINTS_ALICE] == HUGE_VAL)
+        return -1;
+    split_strategy(strat, &ii, split, lenstrat, MAX_INT_POINTS_ALICE);
+    return cost[lenstrat][MAX_INT_POINTS_ALICE];
+}
+
+double measure_step_cycles(const unsigned int n_walks, const unsigned int steps)
+{ // Median cycles per random function step of n_walks walks advanced in lockstep, with the current strategy
+    unsigned char j[MAX_WALKS][FP2_ENCODED_BYTES];
+    st_t states[MAX_WALKS];
+    double runs[STRATEGY_RUNS], t;
+    prng_state_t prng;
+    int64_t cycles;
+    unsigned int i, k, r;
+
+    if (n_walks == 0 || n_walks > MAX_WALKS || steps == 0)
+        return 0;
+    init_prng(&prng, (unsigned long)insts_constants.PRNG_SEED);
+    memset(states, 0, sizeof(states));
+    for (k = 0; k < n_walks; k++) {
+        sample_prng(&prng, (unsigned char*)states[k], (unsigned long)insts_constants.NBYTES_STATE);
+        fix_overflow(states[k]);
+    }
+    UpdateStSIDH_batch(j, states, states, n_walks, 1);  // Warm up
+
+    for (r = 0; r < STRATEGY_RUNS; r++) {
+        cycles = read_cycles();
+        for (i = 0; i < steps; i++)
+            UpdateStSIDH_batch(j, states, states, n_walks, 1);
+        t = (double)(read_cycles() - cycles) / ((double)steps * n_walks);
+        // Insertion sort
+        for (i = r; i > 0 && runs[i - 1] > t; i--)
+            runs[i] = runs[i - 1];
+        runs[i] = t;
+    }
+    return runs[STRATEGY_RUNS/2];
+}
+
+bool strategy_preserves_function(const unsigned int *strat, const unsigned int samples)
+{ // Checks that strat gives the same j-invariants as the strategy of the instance on samples states, cycling through both 
+  // starting curves and the other side. A strategy only changes the cost of a step if all kernel points have full order, 
+  // which instance data do not guarantee (e.g., ES[1] of P434)
+    unsigned int saved[LENSTRAT], lenstrat = insts_constants.e/2 - 1, i;
+    f2elm_t j0, j1;
+    prng_state_t prng;
+    st_t s;
+    bool same = true;
+
+    memcpy(saved, insts_constants.STRAT, sizeof(saved));
+    init_prng(&prng, (unsigned long)insts_constants.PRNG_SEED);
+    memset(s, 0, sizeof(s));
+    for (i = 0; i < samples && same; i++) {
+        sample_prng(&prng, (unsigned char*)s, (unsigned long)insts_constants.NBYTES_STATE);
+        fix_overflow(s);
+        s[0] = (s[0] & ~(digit_t)3) | (digit_t)(i & 3);  // c = 0 with both starting curves, and c = 1
+        GetIsogenySIDH(j0, s);
+        memcpy(insts_constants.STRAT, strat, (lenstrat - 1)*sizeof(unsigned int));
+        GetIsogenySIDH(j1, s);
+        memcpy(insts_constants.STRAT, saved, sizeof(saved));
+        same = fp2_is_equal(j0, j1);
+    }
+    return same;
+}
+
+static double det3(double a[3][3])
+{
+    return a[0][0]*(a[1][1]*a[2][2] - a[1][2]*a[2][1]) - a[0][1]*(a[1][0]*a[2][2] - a[1][2]*a[2][0]) + a[0][2]*(a[1][0]*a[2][1] - a[1][1]*a[2][0]);
+}
+
+bool measure_isogeny_costs(isogeny_costs_t *costs, const unsigned int n_walks, const unsigned int steps)
+{ // Fits the costs of the strategy model by least squares to the cycles per step of n_walks lockstep walks, timed with 
+  // strategies ranging from evaluation-heavy to multiplication-heavy. Returns false if the timings do not determine 
+  // positive costs, e.g., if the tree is too small to have distinct strategies. The strategy of the instance is kept
+    static const double ratios[] = {1./16, 1./4, 1., 4., 16.};
+    unsigned int saved[LENSTRAT], lenstrat = insts_constants.e/2 - 1, i, j, k, mults, evals;
+    isogeny_costs_t model = {1., 1., 0.};
+    double A[3][3] = {{0}}, b[3] = {0}, M[3][3], v[3], x[3], det, t;
+
+    memcpy(saved, insts_constants.STRAT, sizeof(saved));
+    measure_step_cycles(n_walks, steps);  // Warm up caches and clock frequency
+    for (i = 0; i < sizeof(ratios)/sizeof(ratios[0]); i++) {
+        model.eval4 = ratios[i];
+        if (optimal_strategy(insts_constants.STRAT, lenstrat, &model) < 0)
+            break;
+        strategy_counts(insts_constants.STRAT, lenstrat, &mults, &evals);
+        t = measure_step_cycles(n_walks, steps);
+        v[0] = mults;
+        v[1] = evals;
+        v[2] = 1;
+        for (j = 0; j < 3; j++) {
+            for (k = 0; k < 3; k++)
+                A[j][k] += v[j]*v[k];
+            b[j] += v[j]*t;
+        }
+    }
+    memcpy(insts_constants.STRAT, saved, sizeof(saved));
+
+    // Normal equations, by Cramer's rule. A has integer entries, so it is singular if |det| < 1
+    det = det3(A);
+    if (fabs(det) < 0.5)
+        return false;
+    for (i = 0; i < 3; i++) {
+        memcpy(M, A, sizeof(M));
+        for (j = 0; j < 3; j++)
+            M[j][i] = b[j];
+        x[i] = det3(M) / det;
+    }
+    costs->dbl4 = x[0];
+    costs->eval4 = x[1];
+    costs->other = x[2];
+    return (costs->dbl4 > 0 && costs->eval4 > 0);
+}
+
+bool read_isogeny_costs(const char *path, isogeny_costs_t *costs)
+{ // Reads the costs of the strategy model from a text file with lines "dbl4 N", "eval4 N" and, optionally, "other N", 
+  // in cycles per walk. Lines starting with '#' are comments. costs->other is set to -1 if not given
+    char line[256], name[16];
+    double value;
+    bool ok = true;
+    FILE *file;
+
+    file = fopen(path, "r");
+    if (file == NULL)
+        return false;
+    costs->dbl4 = 0;
+    costs->eval4 = 0;
+    costs->other = -1;
+    while (fgets(line, sizeof(line), file) != NULL) {
+        if (sscanf(line, " %15s", name) != 1 || name[0] == '#')
+            continue;
+        if (sscanf(line, " %15s %lf", name, &value) != 2)
+            ok = false;
+        else if (strcmp(name, "dbl4") == 0)
+            costs->dbl4 = value;
+        else if (strcmp(name, "eval4") == 0)
+            costs->eval4 = value;
+        else if (strcmp(name, "other") == 0)
+            costs->other = value;
+        else
+            ok = false;
+    }
+    fclose(file);
+    return (ok && costs->dbl4 > 0 && costs->eval4 > 0);
 }
@@ -12,14 +12,11 @@ instance_t insts_constants = {
      .BETA = 10.,
      .GAMMA = 10.,
      .PRNG_SEED = 1337,
-     .NBITS_STATE = 15,    // log(S) = e-1, it should hold NBITS_STATE > MEMORY_LOG_SIZE
+     .NBITS_STATE = 15,    // log(S) = e-1, it should hold NBITS_STATE > log(w)
      .NBYTES_STATE = 2,
      .NWORDS_STATE = 1,    // Assuming 64-bit words
      .NBITS_OVERFLOW = 7,
-     .MAX_STEPS = 36,      // ceil(GAMMA / THETA), where THETA = 2.25 * sqrt(w / S)
-     .MAX_DIST = 5120,     // BETA * w;
      .MAX_FUNCTION_VERSIONS = 100000,
-     .DIST_BOUND = 18,     // Floor(THETA * 2^(e-1 - log(w)))
      .STRAT = {3, 2, 1, 1, 1, 1},
      .jinv = {0xB12094B4902203E9, 0x0, 0xD4A5907EE6A3B76E, 0x3},
      .ES = {
@@ -98,28 +95,101 @@ const f2elm_t64 DBL_TABLE_EE[2*(NBITS_STATE+1)] = { // A point per row represent
 };
 
 #elif defined(p_36_22)
-instance_t insts_stats = {
+instance_t insts_constants = {
      .MODULUS = "p_36_22",
      .e = 18,
      .ALPHA = 2.25,
      .BETA = 10.,
      .GAMMA = 10.,
      .PRNG_SEED = 1337,
-     .delta = 16,
-     .jinv = {0x746F73A9CFAA13E5, 0xC55, 0x7A1E90E1166968FA, 0x124},
-     .E = {
-         {
-             .a24 = {0xD1707E4C49EAFA66, 0x90C, 0x0, 0x0},
-             .xp = {0x682B62853F71D736, 0x4EA, 0x0, 0x0},
-             .xq = {0x9D038855DB13E7EC, 0xB15, 0x0, 0x0},
-             .xpq = {0x47F5F56308F748CF, 0x48A, 0x629A10A84F171B70, 0xDD8},
-         },
-         {
-             .a24 = {0x278AB12BB23B5554, 0x59B, 0xA2C752E877CD7B91, 0x72F},
-             .xp = {0xAECDC850C7C72C1C, 0xE23, 0xFC28CEDB420B686E, 0x25},
-             .xq = {0x8A2CDD104BA6C91D, 0x42A, 0xBD769AC24549DFB3, 0xC90},
-             .xpq = {0xC67C1B31A4C13D83, 0xDB6, 0xF73D3573EFEBD873, 0x7BD},
-         }}};
+     .NBITS_STATE = 17,  // log(S) = e-1
+     .NBYTES_STATE = 3,
+     .NWORDS_STATE = 1,  // Assuming 64-bit words
+     .NBITS_OVERFLOW = 1,
+     .MAX_FUNCTION_VERSIONS = 100000,
+     .STRAT = {4, 2, 1, 1, 2, 1, 1},
+     .jinv = { 0xef8ddfd88cdf3048, 0x0000000000000601, 0xbf08bce9e9f38e0d, 0x0000000000001636 },
+     .ES = {
+           {
+           .a24 = { 0xd1707e4c49eafa66, 0x000000000000090c, 0x0000000000000000, 0x0000000000000000 },
+           .xp = { 0x7fd89e592d8059bf, 0x0000000000000c71, 0x34bc92d25e1b1bd8, 0x0000000000000841 },
+           .xq = { 0xfb151cdc708a3516, 0x00000000000007e3, 0x66418f3b815dea0c, 0x0000000000000471 },
+           .xpq = { 0x90b67ef3a8bc4169, 0x0000000000000445, 0xb448273795f5c20b, 0x0000000000000b3d },
+           },
+           {
+           .a24 = { 0xd1707e4c49eafa66, 0x000000000000090c, 0x0000000000000000, 0x0000000000000000 },
+           .xp = { 0xc8c5f027a19969f3, 0x00000000000001c2, 0x5de16e37ec18b69e, 0x000000000000028c },
+           .xq = { 0xfb151cdc708a3516, 0x00000000000007e3, 0x66418f3b815dea0c, 0x0000000000000471 },
+           .xpq = { 0x9f37ce8344d532e3, 0x000000000000019a, 0x37570baea7f5142c, 0x0000000000000c76 },
+           }},
+     .EE = {
+           .a24 = { 0x812347c8eb428514, 0x00000000000009ca, 0x2288d2d022861685, 0x00000000000008e2 },
+           .xp = { 0xfb331e2179311765, 0x0000000000000494, 0x88478decd6777274, 0x0000000000000069 },
+           .xq = { 0x8daf761dc4da24c3, 0x0000000000000759, 0xd728f2c43d9d850b, 0x00000000000001b2 },
+           .xpq = { 0x7e8ba9f38103d5bf, 0x000000000000057d, 0xf8c6737e9c9e3d57, 0x0000000000000a80 },
+           }};
+
+#define NBITS_STATE  17
+const f2elm_t64 DBL_TABLE_ES[2*2*(NBITS_STATE+1)] = { // A point per row represented in (X:Z) coordinates
+{ 0xFB151CDC708A3516, 0x00000000000007E3, 0x66418F3B815DEA0C, 0x0000000000000471 }, { 0x68B83F2624F57D33, 0x0000000000000486, 0x0000000000000000, 0x0000000000000000 },
+{ 0xEF86B57FE7D7F64B, 0x00000000000006E2, 0x9E6FFB1FEBC804EF, 0x0000000000000998 }, { 0x25A1A60AADA3A21E, 0x0000000000000A5A, 0x6C4AF6D5BC403644, 0x0000000000000603 },
+{ 0xBFF679CB013A4838, 0x0000000000000DC9, 0xDF99A8B79547EB36, 0x0000000000000D08 }, { 0x35035AF2601DD755, 0x0000000000000CD0, 0xC113D51E1DA14E4D, 0x0000000000000BFC },
+{ 0xDE7BB7BE8233B31B, 0x000000000000067C, 0xD5DB99BC8097D02C, 0x00000000000007A6 }, { 0x1C4EAD535D0FC33B, 0x000000000000026A, 0x1DE372729D4FABE3, 0x0000000000000BDC },
+{ 0xC4CDD5AD444F977B, 0x000000000000028B, 0xC3BAB5E95DA49417, 0x00000000000004AD }, { 0xC74DEAAF4DC6198D, 0x000000000000052E, 0x7600925E02822397, 0x0000000000000DCA },
+{ 0x569128BD825B1958, 0x000000000000003F, 0xD168C2F5328B633C, 0x000000000000073C }, { 0xB9EC53CFB382AF5F, 0x0000000000000066, 0x3A757772A883D0D0, 0x0000000000000C12 },
+{ 0x70DF6DABAB98EDB2, 0x0000000000000B6C, 0x6157E88F911DAA04, 0x0000000000000CF7 }, { 0xD6F20935E8AB7630, 0x000000000000010E, 0xED183F344D482ACA, 0x000000000000066C },
+{ 0xFB00C232F2654911, 0x0000000000000D27, 0xEABF4F902567B181, 0x000000000000030E }, { 0x2DE00F57C510073A, 0x0000000000000560, 0xD4DC0AD5E6CCA283, 0x0000000000000BA6 },
+{ 0x1D229052271DCFCD, 0x0000000000000D53, 0x00B04FA5FD721095, 0x0000000000000368 }, { 0x6BC16D1E57927DBC, 0x00000000000009A0, 0x98E3C446714451D3, 0x000000000000004E },
+{ 0xCE5F9CC911F80B44, 0x0000000000000C5E, 0x3D0428ADB313CD25, 0x0000000000000C14 }, { 0xD4C7151D3FCC7D21, 0x0000000000000896, 0x880D6211D572DEB7, 0x00000000000003AE },
+{ 0xAC6EAEDBDD734EA0, 0x000000000000095D, 0x48E8BEF4C97043D9, 0x0000000000000434 }, { 0x91CFA8C8C1F36785, 0x0000000000000D31, 0x4FDD0B04311701AC, 0x00000000000008CB },
+{ 0xCA3B7A7BD3C7A111, 0x0000000000000BC4, 0x45307FFA9F1210EE, 0x0000000000000B1C }, { 0x0D59114DCABB415F, 0x0000000000000B40, 0xE1FA692F4B78C926, 0x0000000000000100 },
+{ 0x7AFCBC8659FF693D, 0x000000000000060E, 0x7598E2208E804C0C, 0x0000000000000C7C }, { 0xB48D53D1DFF93F3D, 0x00000000000005F4, 0x0F93F06100DF2E18, 0x000000000000003B },
+{ 0xB8D6C18A8F6277BC, 0x0000000000000803, 0x6BEB9A96516AF3A7, 0x00000000000007C8 }, { 0x47478F4EA254C28C, 0x000000000000027F, 0xFA479C53D60DA8B5, 0x0000000000000AB5 },
+{ 0x4CC1F71FCF9CED7F, 0x000000000000083A, 0x47B0E0DCC93DDCEC, 0x00000000000002CD }, { 0x4CC1F71FCF9CED7F, 0x000000000000083A, 0x47B0E0DCC93DDCEC, 0x00000000000002CD },
+{ 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 }, { 0xE9654678C79400C3, 0x0000000000000C24, 0xB61ACAB78F30C549, 0x000000000000086E },
+{ 0xCA688E98B3A9700C, 0x0000000000000351, 0x3739BBD2816FBCFA, 0x0000000000000775 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0xEB9565F88F44B9BD, 0x00000000000003D8, 0x1888476216508386, 0x0000000000000B50 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+
+{ 0xFB151CDC708A3516, 0x00000000000007E3, 0x66418F3B815DEA0C, 0x0000000000000471 }, { 0x68B83F2624F57D33, 0x0000000000000486, 0x0000000000000000, 0x0000000000000000 },
+{ 0xEF86B57FE7D7F64B, 0x00000000000006E2, 0x9E6FFB1FEBC804EF, 0x0000000000000998 }, { 0x25A1A60AADA3A21E, 0x0000000000000A5A, 0x6C4AF6D5BC403644, 0x0000000000000603 },
+{ 0xBFF679CB013A4838, 0x0000000000000DC9, 0xDF99A8B79547EB36, 0x0000000000000D08 }, { 0x35035AF2601DD755, 0x0000000000000CD0, 0xC113D51E1DA14E4D, 0x0000000000000BFC },
+{ 0xDE7BB7BE8233B31B, 0x000000000000067C, 0xD5DB99BC8097D02C, 0x00000000000007A6 }, { 0x1C4EAD535D0FC33B, 0x000000000000026A, 0x1DE372729D4FABE3, 0x0000000000000BDC },
+{ 0xC4CDD5AD444F977B, 0x000000000000028B, 0xC3BAB5E95DA49417, 0x00000000000004AD }, { 0xC74DEAAF4DC6198D, 0x000000000000052E, 0x7600925E02822397, 0x0000000000000DCA },
+{ 0x569128BD825B1958, 0x000000000000003F, 0xD168C2F5328B633C, 0x000000000000073C }, { 0xB9EC53CFB382AF5F, 0x0000000000000066, 0x3A757772A883D0D0, 0x0000000000000C12 },
+{ 0x70DF6DABAB98EDB2, 0x0000000000000B6C, 0x6157E88F911DAA04, 0x0000000000000CF7 }, { 0xD6F20935E8AB7630, 0x000000000000010E, 0xED183F344D482ACA, 0x000000000000066C },
+{ 0xFB00C232F2654911, 0x0000000000000D27, 0xEABF4F902567B181, 0x000000000000030E }, { 0x2DE00F57C510073A, 0x0000000000000560, 0xD4DC0AD5E6CCA283, 0x0000000000000BA6 },
+{ 0x1D229052271DCFCD, 0x0000000000000D53, 0x00B04FA5FD721095, 0x0000000000000368 }, { 0x6BC16D1E57927DBC, 0x00000000000009A0, 0x98E3C446714451D3, 0x000000000000004E },
+{ 0xCE5F9CC911F80B44, 0x0000000000000C5E, 0x3D0428ADB313CD25, 0x0000000000000C14 }, { 0xD4C7151D3FCC7D21, 0x0000000000000896, 0x880D6211D572DEB7, 0x00000000000003AE },
+{ 0xAC6EAEDBDD734EA0, 0x000000000000095D, 0x48E8BEF4C97043D9, 0x0000000000000434 }, { 0x91CFA8C8C1F36785, 0x0000000000000D31, 0x4FDD0B04311701AC, 0x00000000000008CB },
+{ 0xCA3B7A7BD3C7A111, 0x0000000000000BC4, 0x45307FFA9F1210EE, 0x0000000000000B1C }, { 0x0D59114DCABB415F, 0x0000000000000B40, 0xE1FA692F4B78C926, 0x0000000000000100 },
+{ 0x7AFCBC8659FF693D, 0x000000000000060E, 0x7598E2208E804C0C, 0x0000000000000C7C }, { 0xB48D53D1DFF93F3D, 0x00000000000005F4, 0x0F93F06100DF2E18, 0x000000000000003B },
+{ 0xB8D6C18A8F6277BC, 0x0000000000000803, 0x6BEB9A96516AF3A7, 0x00000000000007C8 }, { 0x47478F4EA254C28C, 0x000000000000027F, 0xFA479C53D60DA8B5, 0x0000000000000AB5 },
+{ 0x4CC1F71FCF9CED7F, 0x000000000000083A, 0x47B0E0DCC93DDCEC, 0x00000000000002CD }, { 0x4CC1F71FCF9CED7F, 0x000000000000083A, 0x47B0E0DCC93DDCEC, 0x00000000000002CD },
+{ 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 }, { 0xE9654678C79400C3, 0x0000000000000C24, 0xB61ACAB78F30C549, 0x000000000000086E },
+{ 0xCA688E98B3A9700C, 0x0000000000000351, 0x3739BBD2816FBCFA, 0x0000000000000775 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0xEB9565F88F44B9BD, 0x00000000000003D8, 0x1888476216508386, 0x0000000000000B50 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+};
+
+const f2elm_t64 DBL_TABLE_EE[2*(NBITS_STATE+1)] = { // A point per row represented in (X:Z) coordinates
+{ 0x8DAF761DC4DA24C3, 0x0000000000000759, 0xD728F2C43D9D850B, 0x00000000000001B2 }, { 0x68B83F2624F57D33, 0x0000000000000486, 0x0000000000000000, 0x0000000000000000 },
+{ 0xBD71FF1F560BB4A4, 0x000000000000048C, 0xDBB81F86D96315A0, 0x000000000000082E }, { 0x8D777590CBA75D0C, 0x00000000000005B4, 0xD0E0221ADCEEFCA1, 0x000000000000098F },
+{ 0xF15EBEB346AF00E3, 0x0000000000000DB0, 0x5CAAD1BA5D493E03, 0x0000000000000CCA }, { 0x3BC2C0FBAA31F3F8, 0x000000000000072D, 0x440BE64E837A6606, 0x00000000000007F3 },
+{ 0xA7550C13AEEF1868, 0x0000000000000DAC, 0xFFCEC3F02852359B, 0x0000000000000C05 }, { 0xCD50B2B11C3E9703, 0x00000000000008D5, 0xC6E73CBAFEEC94E3, 0x000000000000049B },
+{ 0xE0216C60264C3AAD, 0x000000000000065E, 0x10DA2A35A3F73418, 0x0000000000000E12 }, { 0xFB2C5AAD40D48607, 0x000000000000052B, 0xB00C04C0DBC822AD, 0x00000000000004D5 },
+{ 0xC86C0282EBF1816E, 0x0000000000000713, 0x6B02C5C991628DB5, 0x0000000000000C91 }, { 0xC27924E4E5BAABB9, 0x0000000000000435, 0xCD1891A1F7DB2312, 0x00000000000006AF },
+{ 0x39AA062706CAB97A, 0x0000000000000778, 0x9F7B011CFCE4B694, 0x0000000000000A38 }, { 0x9D03B33D4C680644, 0x0000000000000D14, 0x5F5DA844BEE357B4, 0x0000000000000B24 },
+{ 0x85A1A24C89752548, 0x0000000000000AE9, 0x0847AB40D4F05253, 0x0000000000000027 }, { 0xD8C2B3B9D56F8DDE, 0x000000000000088B, 0x86C9AEB53F0CA76A, 0x0000000000000C07 },
+{ 0xDDA97712356B45A0, 0x00000000000006A0, 0xE5C65F7F4E4B79F0, 0x0000000000000BA6 }, { 0xAB1E85191C17E630, 0x0000000000000A20, 0xE5B25B016785488E, 0x00000000000004D0 },
+{ 0x5FBEEB2112B6CAAC, 0x00000000000007E1, 0xC2B603D8C6986ED2, 0x0000000000000C61 }, { 0x8F4B7D5456F589AC, 0x00000000000001BB, 0x74FE2EF98D091D22, 0x00000000000003D9 },
+{ 0xE2C64E799D3560BB, 0x0000000000000461, 0x63D02BF44AF2FD80, 0x0000000000000860 }, { 0x718EB26107491ED2, 0x0000000000000CD8, 0xDC05BE8EDBFC8B93, 0x0000000000000477 },
+{ 0xCC0F005B09A7C853, 0x000000000000026A, 0xEE411F4AC490B15E, 0x00000000000002F6 }, { 0xFF11C5B93CE12A98, 0x00000000000004CE, 0xB6AF0CEFFC9293AA, 0x0000000000000331 },
+{ 0x488CB5CDD65BB398, 0x0000000000000A78, 0x588B7CEBD68F3508, 0x00000000000000F7 }, { 0x2DB72B0A4406E7C6, 0x0000000000000246, 0xACF1A71F13147430, 0x0000000000000BFE },
+{ 0x9FD7EE897BC2E86A, 0x0000000000000846, 0x6E527A81D4645BA1, 0x0000000000000017 }, { 0x56B62D4896EA9517, 0x00000000000001E8, 0x743152C58FBA793A, 0x0000000000000224 },
+{ 0x47D0D6D2E060DEED, 0x000000000000003F, 0xE263BF75337E7F2B, 0x000000000000017E }, { 0x47D0D6D2E060DEED, 0x000000000000003F, 0xE263BF75337E7F2B, 0x000000000000017E },
+{ 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 }, { 0x92650974671B8B1C, 0x0000000000000052, 0xE10C2F7C828DE905, 0x000000000000020D },
+{ 0xFC9FE6FA9E55F1A1, 0x0000000000000D7E, 0x6AEBC73C8C49B434, 0x00000000000006D1 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0x37BFBC0AAC49CA08, 0x0000000000000621, 0x1512B3E768222A6A, 0x0000000000000001 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+};
 #else
     #error "Selected P128 prime is not supported... "
 #endif
@@ -133,14 +203,11 @@ instance_t insts_constants = {
      .BETA = 10.,
      .GAMMA = 20.,
      .PRNG_SEED = 1337,
-     .NBITS_STATE = 19,    // log(S) = e-1, it should hold NBITS_STATE > MEMORY_LOG_SIZE
+     .NBITS_STATE = 19,    // log(S) = e-1, it should hold NBITS_STATE > log(w)
      .NBYTES_STATE = 3,
      .NWORDS_STATE = 1,    // Assuming 64-bit words
      .NBITS_OVERFLOW = 3,
-     .MAX_STEPS = 202,     // ceil(GAMMA / THETA), where THETA = 2.25 * sqrt(w / S)
-     .MAX_DIST = 10240,    // BETA * w;
      .MAX_FUNCTION_VERSIONS = 100000,
-     .DIST_BOUND = 50,     // Floor(THETA * 2^(e-1 - log(w)))
      .STRAT = {4, 2, 1, 1, 1, 2, 1, 1},
         .jinv = { 0xB8D5636F59F87BFA, 0xDC09D929795E4C5D, 0x95C6C7DFA2CBA665, 0x2C16F3A36D33AD28, 0xC8710F5CECFBE735, 0x00FA18952E4885E7, 
                   0x5854C8F67347A874, 0xC606D980BD107B0F, 0xD56322F8C990030A, 0x6563EFD1EFBDCC02, 0x59FCBB041C8447AD, 0x01182CE3831C5304 },
@@ -258,10 +325,7 @@ instance_t insts_constants = {
      .NBYTES_STATE = 3,
      .NWORDS_STATE = 1,  // Assuming 64-bit words
      .NBITS_OVERFLOW = 3,
-     .MAX_STEPS = 202,   // ceil(GAMMA / THETA), where THETA = 2.25 * sqrt(w / S)
-     .MAX_DIST = 10240,  // BETA * w;
      .MAX_FUNCTION_VERSIONS = 100000,
-     .DIST_BOUND = 50,   // Floor(THETA * 2^(e-1 - log(w)));
      .STRAT = {4, 2, 1, 1, 1, 2, 1, 1},
      .jinv = { 0xB3615B60239B60AE, 0xD810908B5792BD90, 0x2956DC681E074961, 0x5AEDBDC0E9DF1FA4, 0x9C88E9B42FB9CF85, 0xA0307915481A4AF2, 0x0000419E4947A299, 
                0x866D6D2CDC302AB2, 0x0F57D4F6971341C2, 0x9E3A07D84DB077C7, 0x5FB74938CB8AE25D, 0x8C1EFD76ECFC9399, 0x8F801F4C004DB5A3, 0x00004294646E7ADF },
@@ -354,4 +418,579 @@ const f2elm_t64 DBL_TABLE_EE[2*(NBITS_STATE+1)] = { // A point per row represent
 { 0x4536E7C91A04B1EC, 0xA9A9D2AE7FF2622E, 0xC9EFDFE02D2DC89C, 0x13155D534C452BAB, 0x812C802E5DA33CCD, 0x4BAE9239E8C74DB2, 0x1D6058E3E82BB, 0x984381D80DD4D503, 0xE4D0601BA6019D2A, 0xF0C0F7FFA3EB8CF5, 0xBD0FA6A51728D46E, 0xA64E6C7EB76B709F, 0x583AC770DD73C367, 0x2119194DF62E0 }, { 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0 },
 };
 
+#elif defined(P503)
+
+instance_t insts_constants = {
+     .MODULUS = "p_250_159",
+     .e = 20,
+     .ALPHA = 2.25,
+     .BETA = 10.,
+     .GAMMA = 20.,
+     .PRNG_SEED = 1337,
+     .NBITS_STATE = 19,  // log(S) = e-1
+     .NBYTES_STATE = 3,
+     .NWORDS_STATE = 1,  // Assuming 64-bit words
+     .NBITS_OVERFLOW = 3,
+     .MAX_FUNCTION_VERSIONS = 100000,
+     .STRAT = {4, 2, 1, 1, 1, 2, 1, 1},
+     .jinv = { 0x85be35b750d8284d, 0xd47ef34a7d6a62d0, 0xd8ca65659a936f6f, 0x2ec4c85c2f7173fa, 0x7f0b063c88641ae4, 0xa01645c84d30ffec, 0xc607086ebd0b635b, 0x0018bd7dcd3f19b5, 
+              0x870c93aebe59e95f, 0x2e7663101727e3a4, 0x576fa0e2f0bba328, 0x4cd0ce732f905c19, 0xfc07946a148a03bc, 0xaf7ab35e2d301cda, 0xb51fdc10ca68dd30, 0x006f33add87a06bb },
+     .ES = {
+           {
+           .a24 = { 0x00000000000007f3, 0x0000000000000000, 0x0000000000000000, 0xbc00000000000000, 0xb48dd9032babbdc8, 0x87354452517ee94b, 0xb55528d05aecddb4, 0x000d90684a9d9488, 
+                   0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+           .xp = { 0xca85d9a77b96bd03, 0xdf6a1c363ee02a01, 0xf855908ba925d594, 0x6571f9d0e705c863, 0x63699c2a25af7447, 0x3c634c0c5feac747, 0x1c9a3435948d8987, 0x001f6ab7b89c6de6, 
+                  0xc9a5362aba308896, 0xc748f08887b4dfb1, 0x647072aeb8eef038, 0xd27f447b8a9099f1, 0xf54851f06b94bb9c, 0x4963b7d02de36b17, 0x4ca28109c9d7e67f, 0x00189ab9c1c682c8 },
+           .xq = { 0x97688a9bb9a890d2, 0xb4a1c52131ea4380, 0xce7110d442c1f1b2, 0xf4a6417cbaa89b15, 0xc2e64b8b8554fd63, 0xd2bb6f0d27a51279, 0x90f5a39bf7252afb, 0x0023912d87d2060d, 
+                  0x4192cb5805485346, 0xf0435b1bcc93d024, 0xbf30de0fc3cc3ced, 0x6a5db6b24bff11eb, 0x8795120d3569defc, 0xbf3785758e5d71de, 0x5ae0196dce90e9c9, 0x002d8f3115637a1c },
+           .xpq = { 0xd4a138ab8ede2b21, 0x2d5388922cdf511b, 0xa54bf048a6b06f3c, 0xa7bb933c12bef416, 0xdbd46d4bd55668e0, 0x443fdd5ad1762b6f, 0xe1294ea7895d27d4, 0x000432620535dabe, 
+                   0xf6300be8f7154013, 0x36eaab03fa0dbe45, 0x10dd5a0216bf3ab3, 0x9fbcaf88e9aa8c0c, 0xef5b6ca69df1851e, 0x2bcab701ce90450b, 0x1bfeccfe39d49d4a, 0x001e77b0f02f3012 },
+           },
+           {
+           .a24 = { 0x00000000000007f3, 0x0000000000000000, 0x0000000000000000, 0xbc00000000000000, 0xb48dd9032babbdc8, 0x87354452517ee94b, 0xb55528d05aecddb4, 0x000d90684a9d9488, 
+                   0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+           .xp = { 0x571f4b05eeedbdbd, 0x10124c163c5cde94, 0xf958e340e876a2be, 0x7d25fb83ec5b18b7, 0xe89e3c42b5dd06df, 0x426f6939f376e2a4, 0xa75c0cacc1c496da, 0x0013f712dcebf533, 
+                  0x324ef37fa0f6aede, 0xdc72c42356da09fc, 0x9c1ccf8789b9c3be, 0x2013686a64dbf9d6, 0xf8836a92801eb0a2, 0x9a76740a391510f0, 0xf0c6f52820213b6c, 0x000b64435ad25c23 },
+           .xq = { 0x97688a9bb9a890d2, 0xb4a1c52131ea4380, 0xce7110d442c1f1b2, 0xf4a6417cbaa89b15, 0xc2e64b8b8554fd63, 0xd2bb6f0d27a51279, 0x90f5a39bf7252afb, 0x0023912d87d2060d, 
+                  0x4192cb5805485346, 0xf0435b1bcc93d024, 0xbf30de0fc3cc3ced, 0x6a5db6b24bff11eb, 0x8795120d3569defc, 0xbf3785758e5d71de, 0x5ae0196dce90e9c9, 0x002d8f3115637a1c },
+           .xpq = { 0xaf03a00a04774d61, 0x174f4ca4c27362cf, 0xb6c6fd58fa736dbc, 0x8252b469f2720af7, 0x228377cfd92f875a, 0x4ae889550a9572ad, 0x194497bb279e0063, 0x002f407ffe7eec27, 
+                   0x1bede9ae4449cb2f, 0xdc425bdafe26d690, 0xe0c4cf03ac475f88, 0xe94760aa973f10ae, 0xd5e4c35aa132c1c6, 0x89240e368f9b9369, 0x8144d88cd3259c33, 0x001cf357b95fd4c9 },
+           }},
+     .EE = {
+           .a24 = { 0x28e7ea846d7fbfab, 0x37436d18bff3a140, 0xcc8125138bf5e27d, 0x4d7cdce9c39dd306, 0x2170a9d1845cf4f6, 0x54110e20e1f4be03, 0x799b79c1324aa4fc, 0x0035235fea5886f9, 
+                   0x4c7c6759e1073a9f, 0x003bb57d74c32ee7, 0x8400fe3abc14b7ff, 0x85478f853f5de393, 0xaccbbf6340d2ecbd, 0x7efdc2dc09c4aaa1, 0x524ea018d644995c, 0x003ab5abfad33856 },
+           .xp = { 0xe4d5ff96e64de734, 0x6d8a60c97d1b9d96, 0x83b4c1676dee7f40, 0x1a3a91fbc964da98, 0xef3947b3f510e467, 0x7dc94fc274ec958a, 0x1e30cd0d1f7fdb28, 0x001d503abbf88136, 
+                  0x85c93ff772e803e0, 0x99016882c3af6373, 0x7dbe73dbe62c5fd6, 0x1e932b90aa76b182, 0x00a29f88609dd34e, 0x8fe1930f340c0c47, 0x03720384934e58ad, 0x0034134716721b23 },
+           .xq = { 0x4b2932f59ba8f0d7, 0xf3cf903de037e9de, 0x9fd2bb677b8f20d0, 0xc87bd021e4788b66, 0xcebb19755e386ef3, 0x8f4c2ff476c61b3d, 0x6ae81661ac020e06, 0x00176165a21573cc, 
+                  0x962ad2b9a44048b0, 0xa1884f74c3f15bb4, 0xd2bd3ef00319b1cd, 0x99a864436fe6840a, 0x8463d358d6cf40d5, 0xb855746b9dc6b16b, 0x8d9fc8bc93235c9c, 0x003523f5a4d3a185 },
+           .xpq = { 0x4f8e081a66381895, 0x4d90ea76d2240e69, 0xaaea75f6a603655f, 0x3392ff54918544d8, 0xf8aeaa6bb01fb52f, 0xd3b375fa2434aedc, 0x8fd780322fcaa479, 0x002c7078b74ab6b0, 
+                   0xea7b67139a5d88eb, 0x26bef7b14226bd8e, 0x671a07cadb9c37f9, 0x08f4bec5199a2d3a, 0x045013246e998730, 0xc7826ff8f6cc3b60, 0xf53ee6b033a39592, 0x00316678e077a66b },
+           }};
+#define NBITS_STATE  19
+const f2elm_t64 DBL_TABLE_ES[2*2*(NBITS_STATE+1)] = { // A point per row represented in (X:Z) coordinates
+{ 0x97688A9BB9A890D2, 0xB4A1C52131EA4380, 0xCE7110D442C1F1B2, 0xF4A6417CBAA89B15, 0xC2E64B8B8554FD63, 0xD2BB6F0D27A51279, 0x90F5A39BF7252AFB, 0x0023912D87D2060D, 0x4192CB5805485346, 0xF0435B1BCC93D024, 0xBF30DE0FC3CC3CED, 0x6A5DB6B24BFF11EB, 0x8795120D3569DEFC, 0xBF3785758E5D71DE, 0x5AE0196DCE90E9C9, 0x002D8F3115637A1C }, { 0x00000000000003F9, 0x0000000000000000, 0x0000000000000000, 0xB400000000000000, 0x63CB1A6EA6DED2B4, 0x51689D8D667EB37D, 0x8ACD77C71AB24142, 0x0026FBAEC60F5953, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0x366EAB9AECC997D7, 0x5B9F03E9DE455AE8, 0x4631FF725196842A, 0xF98E9256EFE7CBB0, 0x8E0534F887F6A6C9, 0x6E747C5D726134A3, 0x2F22CD6A2C8D6F11, 0x0039F04100FFE4E5, 0xC380BE8A4ABAC853, 0xA233DB4AAC5AC7FD, 0x31B37CA27DF5111A, 0x067FAE957E17C6EB, 0xD4B2947D7AD205B8, 0xA7100DC556A0C48C, 0x6D9DBFE8364C77BE, 0x003395CC4DF50FAD }, { 0x3D5F2324735E5C62, 0x1589412E7442FE92, 0x89BB1A229A4C5AD8, 0x7604AA78518B7265, 0x4F45B9B8F0538558, 0x5AF72A891E4AA617, 0x613A6C63056973FF, 0x001B7B0ACF94A0BE, 0x09F6045B1EC26B72, 0xC73538739A8F591F, 0x22B2E7FE947A177A, 0x6CAAF564B88EA78D, 0xBF18F9974C036B43, 0x187C4365A211EA67, 0xDADAD81D89B70121, 0x00077219F6E9E382 },
+{ 0xD580F4C7D59F0C45, 0x3BF20CEC3AB7CCCB, 0xD4B168BA7344C7DE, 0x30C7C202100129D2, 0x38A46B035E606FFC, 0xD342B33CACD5382C, 0xB6C7CE65964C6FA6, 0x00026635ECA3E4DD, 0x7CAF5BDD4ABEF74B, 0x7538F3C46EEF569D, 0xE752E468E97B4A9C, 0x3EEB906AE03F90E0, 0x7AA50D1C50D7CFCC, 0xF753412D7D11FD5A, 0x0ECF99F4F67FDB9D, 0x0028934DBACD598B }, { 0xA31ACACE9F9A06FE, 0xEBE1FB62BE9E3C2C, 0x10508DDE071032BA, 0x8A6FDEC24DEDFF5A, 0x42F7B47B5500C1A0, 0x7D056F98B2C86754, 0x743EA8966F90391D, 0x002246F3BDE1A7D7, 0x900F5D7A5129A2FB, 0x7EB505B099B613B8, 0x38EDB584EC7491F6, 0x39889DEECCBDB9FE, 0x56C66EE8E26970AB, 0xE88A825F18EDB82D, 0x74691EF0ECDF8C81, 0x003C9362971E78BB },
+{ 0xA53003638344FB5B, 0x720160BE2D5C8AD8, 0x9468119A411D7E0A, 0x9875CC3A64DDDF2D, 0xCB420CA2242D0246, 0xC5C96007B396A499, 0xD3F7F825D4CD3781, 0x00002C7B3E3BCE28, 0x274A43F8A0210C41, 0xA7BC9E838F2C5C98, 0xF923053D83F3E9BE, 0xCCA85D19350A030B, 0xC8F89BD5E7B52A0B, 0x93DD10213A692948, 0x638A2E0F65144EFA, 0x00020C9020D61BFF }, { 0xAD03A37B9669A260, 0x8849577BF5D29181, 0x7A0E593B5F938F6B, 0x11CB4475E21B9CD9, 0xE3B4AF06196C175B, 0x35B461DDD0840AE2, 0x7E098C3F2DA15673, 0x0020339A0A9F931E, 0x30EB80BEBE02904F, 0xA1117396010B8E45, 0xE4C105DDE56ACA2F, 0x12A94D2E9C0BFE16, 0x88C8D00190AF8E82, 0x9D01AEF474125122, 0x8974FDAB4897E29B, 0x003F6C049C40F2C8 },
+{ 0xE347B50F2C39B376, 0x8F15B67A44FBB176, 0xB41AF009CD1B316F, 0x3DDB302EF429246B, 0xC6B925E13791B6D6, 0x71C23F146CAB70F7, 0xE9FACE0587256B39, 0x0038B2B5C10C6C3A, 0xCCF92DF51A636FB3, 0x74F166621F9C9A67, 0x6FD3727ADF5880A2, 0x9861642635C26DB9, 0x282B2A174979B074, 0xA6E060E28B1BF8B1, 0x0BF845CCE5C5C82B, 0x0011D51DBCACEBCC }, { 0x50A466E5909DA19E, 0x21DDE3ECE9A45DED, 0x708D8297EB62931B, 0xD05CCF1E98B4C390, 0x4D13947F152AF195, 0xD1DD51563EF62D4C, 0x49AF3B276870B697, 0x001662F54C4ABD8A, 0xF4D128E214BE1CEA, 0xC38EB35580D46314, 0xFEF569FDB66E93C9, 0x7086F6C8CCEDBBCF, 0xA3B3ECB9BE65BACD, 0xC79CE5CA83BC337F, 0x5011A3223F854E19, 0x001E7DDC1E2F6961 },
+{ 0xFC82E242F5C3DDD1, 0x8D73A35F6C6DAB28, 0xF0D064C32E1E1003, 0x608C3DECE4A1943B, 0xD5C23B286415800D, 0xD12D95237D57D78F, 0x0148DD1D7E586462, 0x001297804D31547C, 0x2D7290F91DEEDD2F, 0xEE2A148933C204E2, 0xA787BAE44E75C3A4, 0xAF1BDFD3974D1A71, 0x59413EE92D6EA285, 0x069D8245FE0FF88B, 0xB760D50189B13A86, 0x00067894A2297BF1 }, { 0x7596218715BC38D5, 0xD6965F71A9CB9A2F, 0xD0C82AE99EFAA8EE, 0x1B0638667900CBB6, 0x39E56EDE5A6BCD8C, 0xAE0BEA1A5A8A7370, 0x32A765253B7A82A8, 0x001BC81C6E9CA9A1, 0x71E20F483B00A97B, 0xE9A8509D2216647D, 0x6B9C16EBEE41DC95, 0x185B39BBF317B464, 0x0A29E23877EB912E, 0x73A2E293A9DCD205, 0xD86DE9D177975D8E, 0x003BBEB791652D8C },
+{ 0xBA486B4C496BAF4C, 0x8081118BFB2948F5, 0x04C44EDF5026B1AB, 0x8E70D59D1E27889C, 0x89CF18014A2AA07D, 0x99408758E820F468, 0xB2B1470C01764DEF, 0x003731EE58E8AB8C, 0x34B86E2C4B8EAED6, 0x2C4F8C14D0E37E1B, 0x193E1F1BECC25898, 0xA336711F66FB64B3, 0x8B2206F231B7C839, 0xFB031A7E0B33AB2F, 0xD42D11E1652380DD, 0x000A50406EB412F4 }, { 0x97781DCBE05ADB67, 0x0EF3B90D9CA031C5, 0xEE3BE29E756AE7A9, 0x550B1629CE412973, 0x09DE9B64595E6F54, 0xD3C5F7205008AC47, 0x9940D7FB97915CA4, 0x0000628ED920527A, 0x1A648DAB4EACC89A, 0x2B05A60606F302EE, 0x7DC09F49BE3E56C0, 0x3EB2055B5D91D2FF, 0xBF514DDD5E09A425, 0x60E6420C3D965BDD, 0x7388FFD92B997EB1, 0x001E74D129EC2D60 },
+{ 0x746AA2618B1C2D8A, 0xB50EFA4F700BB7AA, 0x3F56CE1C4E376F7C, 0x525E8408E0FF9D14, 0x78FB78B5F0C3A00D, 0x5AFA470989FF114D, 0xC359181079A221B0, 0x00287CA6CC55DC08, 0xDD3010E29D9019A1, 0x5AB656EE000F3355, 0x6B2AAAFFD9A11B88, 0x70E1D970915B64CE, 0xA4A002846EF0B480, 0x299C7096FC3295CD, 0xAA1203D1344EB504, 0x001B90AC5954A6F1 }, { 0x3B7F8C7CE2865493, 0x4E51A6984C5F7D74, 0xF286714E9ABC272C, 0xDFDB33ADECA4D4E0, 0x6FA2D748DE5B76B8, 0x1E390C9E710DC2FB, 0x6569D6B9A29FD8C6, 0x003CA2E3F8D625B1, 0x4804CBF4E65A05B5, 0xBB518FB03FB30C6B, 0x012A1768060F3063, 0x03890022B82CE605, 0x6DAD696F184D5F4B, 0x275EA0C55D1194A9, 0xA824A3B90DACCBD2, 0x0026D3D24B2CC2EE },
+{ 0x9E9049B05C042311, 0xDA0BBA68D39C129B, 0x6E90BC0D76ADD4A0, 0xBA5225DD901F2610, 0xA574B057D22271C8, 0xB647376B482DEB4A, 0xD11882CECB38EFCD, 0x000FF5F23CF0DE7F, 0x663EAF19888193FF, 0x26AE964DBD17602E, 0x34E1D005DCD25D1B, 0x47680963B6F10829, 0x50393860CA18E8F2, 0x66E00864EA42D774, 0x61EE7458A3528495, 0x00393632584A5C98 }, { 0x8A78365048108D2B, 0x764271E87C0B096F, 0x58FE8D3B89334815, 0x65ABBDF1E24F6FC4, 0x731FDA3E9871B667, 0xE5DC35473AF3E175, 0x08690FFA61FF7D98, 0x002BFFE955D29425, 0x849A89E4FCEF06C7, 0x3E7B7124E1580992, 0xE3462506EBD06F1F, 0x207A90CF1F6555D5, 0x73037032FD9E8CF7, 0xF5FDB57C81F50705, 0xA388360F5982E85F, 0x002C025720432944 },
+{ 0x5EF2F3F5310BE2D9, 0x13EA62FBE07CBA03, 0xA3351F3ABA9E700B, 0xCC9A01D768EF63E5, 0x0E819FF9FB8BFA4F, 0xDBBA961554A85042, 0x167074544686A168, 0x000AA0BBF9F8CB6A, 0x3EAB034BF36D5155, 0xD9F97F0AD8248013, 0x53EE56F5D7EC3CD7, 0x7AACCB2DA634AEBA, 0x20196AB5240D1D15, 0x51B64BF3F6316A8C, 0x7203ACC12C7D946A, 0x0037EF1A713A4AFA }, { 0x6693D071E469EC36, 0xF9330A1A3EF46D56, 0x795EAD1789AB4017, 0x052AD10041BFFDA5, 0x3A3907F5E76CBE6A, 0x22748ECF971204E4, 0x7CF5BC7DDC88C0EE, 0x001CF3A04AC8E9B3, 0x5C86233FE4E0A29C, 0x1D3E46C34CEC9DB8, 0xCB273C70AEA3ACE4, 0x469D7BB69E5A77B6, 0x12F9DEF5A75189E4, 0x1DFA712A2E81EA19, 0xEAE4A6D93C5A5C34, 0x000DE791B0D1F69B },
+{ 0x0F8BE88D0344387B, 0xD3927707072F7335, 0x59AE60B8EA501C49, 0x46806D303CC55AAF, 0xBB232DABCB371597, 0xB52F3CC0EEC170B6, 0x6DFB5F0A3946D661, 0x002005FF0F665A8D, 0x0E208C3BF7D2CD0C, 0x60E1111A1F935F9C, 0x554B43C21A387724, 0x5421422ADA49E873, 0xC0D54C0D89894118, 0x6E1EB14CE01DD27F, 0x59ADA646A065A4D7, 0x0021AF88013725CF }, { 0x963BE04B7915C28F, 0x144C6D0BBFCDB7DA, 0x261CDDAEE6CD2ACE, 0x659DEAB33617318D, 0x8D0F69102A6F4E9D, 0x0E40500AEA44E101, 0x1A8D82E92CA69866, 0x000CDE486C1A7E19, 0x993FD47993D39CB1, 0x93B797D71B96CFD1, 0xDFFB07C948660590, 0x4D934F08828E673A, 0x4871EF68A3417467, 0xE03B650CB8C2D39C, 0xAB2BAFEA05876EF3, 0x001A362083206891 },
+{ 0x47D6EE7C82ED2CC5, 0x95F07CD4FA537D61, 0xCE5994B9A6939FBE, 0x3F67D51942A15F3F, 0xFF2BFA68D506CF58, 0x3E8171F1DB2DB085, 0xBBF8A0F72892C73C, 0x000A15A828EE2B4E, 0xD9D57AF27E5A117B, 0x3FC70A2E94ECBB0E, 0xE6C5478DA904A255, 0x4747522B3794FFF4, 0x1D9E009514000C48, 0x4E24B4DA32DD8D7D, 0x2BABFE23577B28B4, 0x0019DD45D2156AE1 }, { 0xAAEC016B400CC0AB, 0x13CE964EF60005D8, 0x88493659149CBEFF, 0x2E6FDD72518D3761, 0x2F673C961EABA97D, 0xFEE794480B09978E, 0x01CC9C75E99799CC, 0x00028265349C7951, 0x177B9770E74E4FE4, 0x46602E5BFE8D32C7, 0xA0F7050770DBF96B, 0x5935D6365A12E5AE, 0x84144B34AC9B7D10, 0x17B7EE9A5A5F9F50, 0x03380E189268ABD0, 0x0033C2899C89AB83 },
+{ 0xAF87D319BAA37BB9, 0x619468C057EF831A, 0x94A1988E66B3D6D8, 0xFEAD9F0D82CF6DB4, 0xDC423D1F014DB0BD, 0xF14D15736DC8BF7E, 0x0CF7F950C9DBCBB6, 0x00155D4693F396C8, 0x39F99ABD2A06A4A6, 0x7CAB959B2AD0BDAE, 0x0273F6363DC280A4, 0x59BBACFBD26EAAA3, 0x97197266CF42AAEE, 0x54D6CE5AA9B092FA, 0x8D385E04BF0FDBAC, 0x003A6D030BDED7C2 }, { 0x0F468FD55A84B02E, 0x01B6B0FA69ACDD16, 0x63C38896DB88EB6F, 0x80E3DBBBE10A273B, 0x974A83429462C79E, 0x4406238040C23183, 0xB316F5AB7F24CCF9, 0x001C72600CC81007, 0x471649EC24D04D66, 0x7E7FAFF4AD0D6F47, 0xCF365E3565C6B31D, 0xDAA6DED2D440CAA7, 0xEBF10193E15D39A1, 0x91B5A383D6C6910F, 0xDA020EE145DC9BC1, 0x0004A849C6FF52DC },
+{ 0xF28A04FDFC728A78, 0x8ACDD563E02C6DB1, 0xC101D6754A5C0244, 0x6858D51DD117FBB1, 0x7C2318E6A4183C8F, 0x0ED359F4DA7D3287, 0x1A5FBE2A0CB6E338, 0x00368551CCDC8959, 0x250E4E6881E95C00, 0x107785486F3492F0, 0x2DA106E4DFBE1B36, 0x3EE5A171270D487D, 0xCBD2EA462DF395A0, 0xD18FC587F297AA45, 0x4017D06394513652, 0x002BC51C6802501D }, { 0x1FB5F16A944AF55D, 0x3BA96DCFC14F7EDF, 0x6D3CA8645DDB30FC, 0x5B1B9CD3E037D38B, 0x55171434F18FA640, 0x0F41361BF226290F, 0x720AB28543B18FDC, 0x00053ABD6E9F82A4, 0x27EFD64C9609D1A6, 0xC5C389FCF208E03E, 0x4C857DF21F772F19, 0x3FEA7DDD46EBE8F3, 0x62F46174157843DE, 0x2B53638F512B2E76, 0xBC6FD147C78D4662, 0x003E141A507C9088 },
+{ 0x6926F4BA0AD2551B, 0x4CFC6C584A3EED51, 0x45BBE6FE3E2F1C5B, 0x6C581B5768D961D3, 0x73DC91794ADB167F, 0xA9C85D95F127A27D, 0xB99090E79C604B04, 0x000F25B3DCF95F22, 0x01418D9FBD5BFD70, 0x658E6D516AEB1437, 0x57EF09B035CE4B2B, 0x148A56040B7737A5, 0x2DEE754E7B732FF5, 0xDB9CCB11FAF14F50, 0x6CB1F5C4CD352A3B, 0x0015802C2C05F490 }, { 0x74D1A366D807895D, 0xC874E763E800CE39, 0xD73260BCEC3D7488, 0xBA56E475C90F600C, 0x7EF56DD430AF59A6, 0x1308DB9C19CCF2A7, 0x333E4BAB421B3FDC, 0x001BCFD4FAC64CA2, 0xF56635306F106A80, 0x1612F7B77B550B7C, 0xC95D0D45B7B4D3C9, 0x53AFDDA9B79CF655, 0xC4DF35EAC65ECB8D, 0xA7E3661AAFF5B9C9, 0xD511BE2BBFA42D34, 0x00201E285BF6D944 },
+{ 0x8B49140216315690, 0x32C8AFCB9C9A3443, 0x6A587706A1F67663, 0xDAEAEFF878564447, 0xF6B2502EC1465B36, 0x9B6F9994CAC81E11, 0x5F61F748F46F8806, 0x0034BE2EE3F387C1, 0x38CF461D23A007EC, 0x95FF663D10E04ADA, 0x84231B55F51531C1, 0xF24FBA3898402121, 0x57B6F0928EBDD809, 0xF3A1A655CEA17531, 0x356A3C879E6B0D34, 0x00381CB2D155D266 }, { 0xF20535EB18193CAB, 0xDD4439AA91BCCFAA, 0x2281F23DD2F74E92, 0xC7DF282BD99DBE20, 0x8F4CBAAC80FCF026, 0x4D536FDF9507E7C7, 0x8F58987BF468492B, 0x000BD6718BF93790, 0x212CD190611C81B2, 0x0EDBFDE565426F3E, 0x74B63DEA3F803585, 0x4A282F1BDBF8004B, 0x3D47F1F8A40BA5E1, 0x5483B6E68F9373DE, 0xA57D5D4FC6F50C20, 0x0004E754F8D5622B },
+{ 0xAAF1F8767E13E9B0, 0xA177241055ACC548, 0x31F1655CC860CB41, 0xF96CD67F85C4BBC9, 0x18470FA59CBE54B0, 0x1C5216011631DA5F, 0x38125825CFF9BFD4, 0x0000E61A540F3B9E, 0x9774119D49C3454E, 0x58F9CBE5D3B1B847, 0x1FCD43CEFC72DC6F, 0x8ABCC610CC6CA0B7, 0xA3CE3C718815E3E7, 0x7EEC4A5D2C756735, 0x75E5F9A2A6647745, 0x0039E70C76C5A752 }, { 0x550E078981EC164F, 0x5E88DBEFAA533AB7, 0xCE0E9AA3379F34BE, 0xB29329807A3B4436, 0xFAC14C34855392EF, 0xFF49E0C7654CA34F, 0x28336E980A7DE4FB, 0x003F80DAED71E280, 0x688BEE62B63CBAB1, 0xA706341A2C4E47B8, 0xE032BC31038D2390, 0x214339EF33935F48, 0x6F3A1F6899FC03B9, 0x9CAFAC6B4F091679, 0xEA5FCD1B34132D8A, 0x00067FE8CABB76CB },
+{ 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 }, { 0x8C7F99923FAC50F7, 0x145DEBCB0C6313E1, 0xD12DF39C72CFEF11, 0x894E577802CC8965, 0xBC740A561F40E7A8, 0x23FBAB2B89EF9E34, 0xE7001FD498A2965B, 0x001DCF71AC418266, 0x7A862A6674DF9E09, 0xE2C6F2CF85B9C023, 0xFFE721BA7BC2F10C, 0xB1F8FA55FEFF9145, 0x6FC139CD41F1CDCC, 0x151BE7E32AF41214, 0x2B2B833290A4056C, 0x0027F62EB18D157F },
+{ 0x10A1C2B3FDB12824, 0x193EE4D556579C2E, 0xE9809691B8FB9887, 0xF270DD2B2A46770F, 0x3CF7702F2C086258, 0x032A3F1985586595, 0xC16140E6408334FE, 0x0002E0410E9C75B8, 0xB48225BBE420521A, 0xD47C7D0C39B309F7, 0x1BD2A7D09927BB79, 0x74E6C68F34FF7703, 0x4AD7936FBBD1AA9C, 0xD0B6AEDBE5ABB099, 0xEF0561F35992CE0B, 0x002B406589696193 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0xD738B0A216214995, 0x6E726396B824F9A6, 0xB7CD1D6CDA24BF90, 0xEAC1A6B3F7EEFD18, 0xAC3FD9CFA65E6E87, 0x50AAB97D23D64B25, 0x1105AAAC26E4E2D9, 0x002BC01634FD8245, 0x4E82ED2476E83268, 0xCF1E64B65D7FA766, 0xA696A3A0D012979C, 0xE94A739A39F5B638, 0xE65C93CF37F38E63, 0xE234FFE111463A68, 0x33EB58967C8B98BC, 0x0036469B2059DA88 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+
+{ 0x97688A9BB9A890D2, 0xB4A1C52131EA4380, 0xCE7110D442C1F1B2, 0xF4A6417CBAA89B15, 0xC2E64B8B8554FD63, 0xD2BB6F0D27A51279, 0x90F5A39BF7252AFB, 0x0023912D87D2060D, 0x4192CB5805485346, 0xF0435B1BCC93D024, 0xBF30DE0FC3CC3CED, 0x6A5DB6B24BFF11EB, 0x8795120D3569DEFC, 0xBF3785758E5D71DE, 0x5AE0196DCE90E9C9, 0x002D8F3115637A1C }, { 0x00000000000003F9, 0x0000000000000000, 0x0000000000000000, 0xB400000000000000, 0x63CB1A6EA6DED2B4, 0x51689D8D667EB37D, 0x8ACD77C71AB24142, 0x0026FBAEC60F5953, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0x366EAB9AECC997D7, 0x5B9F03E9DE455AE8, 0x4631FF725196842A, 0xF98E9256EFE7CBB0, 0x8E0534F887F6A6C9, 0x6E747C5D726134A3, 0x2F22CD6A2C8D6F11, 0x0039F04100FFE4E5, 0xC380BE8A4ABAC853, 0xA233DB4AAC5AC7FD, 0x31B37CA27DF5111A, 0x067FAE957E17C6EB, 0xD4B2947D7AD205B8, 0xA7100DC556A0C48C, 0x6D9DBFE8364C77BE, 0x003395CC4DF50FAD }, { 0x3D5F2324735E5C62, 0x1589412E7442FE92, 0x89BB1A229A4C5AD8, 0x7604AA78518B7265, 0x4F45B9B8F0538558, 0x5AF72A891E4AA617, 0x613A6C63056973FF, 0x001B7B0ACF94A0BE, 0x09F6045B1EC26B72, 0xC73538739A8F591F, 0x22B2E7FE947A177A, 0x6CAAF564B88EA78D, 0xBF18F9974C036B43, 0x187C4365A211EA67, 0xDADAD81D89B70121, 0x00077219F6E9E382 },
+{ 0xD580F4C7D59F0C45, 0x3BF20CEC3AB7CCCB, 0xD4B168BA7344C7DE, 0x30C7C202100129D2, 0x38A46B035E606FFC, 0xD342B33CACD5382C, 0xB6C7CE65964C6FA6, 0x00026635ECA3E4DD, 0x7CAF5BDD4ABEF74B, 0x7538F3C46EEF569D, 0xE752E468E97B4A9C, 0x3EEB906AE03F90E0, 0x7AA50D1C50D7CFCC, 0xF753412D7D11FD5A, 0x0ECF99F4F67FDB9D, 0x0028934DBACD598B }, { 0xA31ACACE9F9A06FE, 0xEBE1FB62BE9E3C2C, 0x10508DDE071032BA, 0x8A6FDEC24DEDFF5A, 0x42F7B47B5500C1A0, 0x7D056F98B2C86754, 0x743EA8966F90391D, 0x002246F3BDE1A7D7, 0x900F5D7A5129A2FB, 0x7EB505B099B613B8, 0x38EDB584EC7491F6, 0x39889DEECCBDB9FE, 0x56C66EE8E26970AB, 0xE88A825F18EDB82D, 0x74691EF0ECDF8C81, 0x003C9362971E78BB },
+{ 0xA53003638344FB5B, 0x720160BE2D5C8AD8, 0x9468119A411D7E0A, 0x9875CC3A64DDDF2D, 0xCB420CA2242D0246, 0xC5C96007B396A499, 0xD3F7F825D4CD3781, 0x00002C7B3E3BCE28, 0x274A43F8A0210C41, 0xA7BC9E838F2C5C98, 0xF923053D83F3E9BE, 0xCCA85D19350A030B, 0xC8F89BD5E7B52A0B, 0x93DD10213A692948, 0x638A2E0F65144EFA, 0x00020C9020D61BFF }, { 0xAD03A37B9669A260, 0x8849577BF5D29181, 0x7A0E593B5F938F6B, 0x11CB4475E21B9CD9, 0xE3B4AF06196C175B, 0x35B461DDD0840AE2, 0x7E098C3F2DA15673, 0x0020339A0A9F931E, 0x30EB80BEBE02904F, 0xA1117396010B8E45, 0xE4C105DDE56ACA2F, 0x12A94D2E9C0BFE16, 0x88C8D00190AF8E82, 0x9D01AEF474125122, 0x8974FDAB4897E29B, 0x003F6C049C40F2C8 },
+{ 0xE347B50F2C39B376, 0x8F15B67A44FBB176, 0xB41AF009CD1B316F, 0x3DDB302EF429246B, 0xC6B925E13791B6D6, 0x71C23F146CAB70F7, 0xE9FACE0587256B39, 0x0038B2B5C10C6C3A, 0xCCF92DF51A636FB3, 0x74F166621F9C9A67, 0x6FD3727ADF5880A2, 0x9861642635C26DB9, 0x282B2A174979B074, 0xA6E060E28B1BF8B1, 0x0BF845CCE5C5C82B, 0x0011D51DBCACEBCC }, { 0x50A466E5909DA19E, 0x21DDE3ECE9A45DED, 0x708D8297EB62931B, 0xD05CCF1E98B4C390, 0x4D13947F152AF195, 0xD1DD51563EF62D4C, 0x49AF3B276870B697, 0x001662F54C4ABD8A, 0xF4D128E214BE1CEA, 0xC38EB35580D46314, 0xFEF569FDB66E93C9, 0x7086F6C8CCEDBBCF, 0xA3B3ECB9BE65BACD, 0xC79CE5CA83BC337F, 0x5011A3223F854E19, 0x001E7DDC1E2F6961 },
+{ 0xFC82E242F5C3DDD1, 0x8D73A35F6C6DAB28, 0xF0D064C32E1E1003, 0x608C3DECE4A1943B, 0xD5C23B286415800D, 0xD12D95237D57D78F, 0x0148DD1D7E586462, 0x001297804D31547C, 0x2D7290F91DEEDD2F, 0xEE2A148933C204E2, 0xA787BAE44E75C3A4, 0xAF1BDFD3974D1A71, 0x59413EE92D6EA285, 0x069D8245FE0FF88B, 0xB760D50189B13A86, 0x00067894A2297BF1 }, { 0x7596218715BC38D5, 0xD6965F71A9CB9A2F, 0xD0C82AE99EFAA8EE, 0x1B0638667900CBB6, 0x39E56EDE5A6BCD8C, 0xAE0BEA1A5A8A7370, 0x32A765253B7A82A8, 0x001BC81C6E9CA9A1, 0x71E20F483B00A97B, 0xE9A8509D2216647D, 0x6B9C16EBEE41DC95, 0x185B39BBF317B464, 0x0A29E23877EB912E, 0x73A2E293A9DCD205, 0xD86DE9D177975D8E, 0x003BBEB791652D8C },
+{ 0xBA486B4C496BAF4C, 0x8081118BFB2948F5, 0x04C44EDF5026B1AB, 0x8E70D59D1E27889C, 0x89CF18014A2AA07D, 0x99408758E820F468, 0xB2B1470C01764DEF, 0x003731EE58E8AB8C, 0x34B86E2C4B8EAED6, 0x2C4F8C14D0E37E1B, 0x193E1F1BECC25898, 0xA336711F66FB64B3, 0x8B2206F231B7C839, 0xFB031A7E0B33AB2F, 0xD42D11E1652380DD, 0x000A50406EB412F4 }, { 0x97781DCBE05ADB67, 0x0EF3B90D9CA031C5, 0xEE3BE29E756AE7A9, 0x550B1629CE412973, 0x09DE9B64595E6F54, 0xD3C5F7205008AC47, 0x9940D7FB97915CA4, 0x0000628ED920527A, 0x1A648DAB4EACC89A, 0x2B05A60606F302EE, 0x7DC09F49BE3E56C0, 0x3EB2055B5D91D2FF, 0xBF514DDD5E09A425, 0x60E6420C3D965BDD, 0x7388FFD92B997EB1, 0x001E74D129EC2D60 },
+{ 0x746AA2618B1C2D8A, 0xB50EFA4F700BB7AA, 0x3F56CE1C4E376F7C, 0x525E8408E0FF9D14, 0x78FB78B5F0C3A00D, 0x5AFA470989FF114D, 0xC359181079A221B0, 0x00287CA6CC55DC08, 0xDD3010E29D9019A1, 0x5AB656EE000F3355, 0x6B2AAAFFD9A11B88, 0x70E1D970915B64CE, 0xA4A002846EF0B480, 0x299C7096FC3295CD, 0xAA1203D1344EB504, 0x001B90AC5954A6F1 }, { 0x3B7F8C7CE2865493, 0x4E51A6984C5F7D74, 0xF286714E9ABC272C, 0xDFDB33ADECA4D4E0, 0x6FA2D748DE5B76B8, 0x1E390C9E710DC2FB, 0x6569D6B9A29FD8C6, 0x003CA2E3F8D625B1, 0x4804CBF4E65A05B5, 0xBB518FB03FB30C6B, 0x012A1768060F3063, 0x03890022B82CE605, 0x6DAD696F184D5F4B, 0x275EA0C55D1194A9, 0xA824A3B90DACCBD2, 0x0026D3D24B2CC2EE },
+{ 0x9E9049B05C042311, 0xDA0BBA68D39C129B, 0x6E90BC0D76ADD4A0, 0xBA5225DD901F2610, 0xA574B057D22271C8, 0xB647376B482DEB4A, 0xD11882CECB38EFCD, 0x000FF5F23CF0DE7F, 0x663EAF19888193FF, 0x26AE964DBD17602E, 0x34E1D005DCD25D1B, 0x47680963B6F10829, 0x50393860CA18E8F2, 0x66E00864EA42D774, 0x61EE7458A3528495, 0x00393632584A5C98 }, { 0x8A78365048108D2B, 0x764271E87C0B096F, 0x58FE8D3B89334815, 0x65ABBDF1E24F6FC4, 0x731FDA3E9871B667, 0xE5DC35473AF3E175, 0x08690FFA61FF7D98, 0x002BFFE955D29425, 0x849A89E4FCEF06C7, 0x3E7B7124E1580992, 0xE3462506EBD06F1F, 0x207A90CF1F6555D5, 0x73037032FD9E8CF7, 0xF5FDB57C81F50705, 0xA388360F5982E85F, 0x002C025720432944 },
+{ 0x5EF2F3F5310BE2D9, 0x13EA62FBE07CBA03, 0xA3351F3ABA9E700B, 0xCC9A01D768EF63E5, 0x0E819FF9FB8BFA4F, 0xDBBA961554A85042, 0x167074544686A168, 0x000AA0BBF9F8CB6A, 0x3EAB034BF36D5155, 0xD9F97F0AD8248013, 0x53EE56F5D7EC3CD7, 0x7AACCB2DA634AEBA, 0x20196AB5240D1D15, 0x51B64BF3F6316A8C, 0x7203ACC12C7D946A, 0x0037EF1A713A4AFA }, { 0x6693D071E469EC36, 0xF9330A1A3EF46D56, 0x795EAD1789AB4017, 0x052AD10041BFFDA5, 0x3A3907F5E76CBE6A, 0x22748ECF971204E4, 0x7CF5BC7DDC88C0EE, 0x001CF3A04AC8E9B3, 0x5C86233FE4E0A29C, 0x1D3E46C34CEC9DB8, 0xCB273C70AEA3ACE4, 0x469D7BB69E5A77B6, 0x12F9DEF5A75189E4, 0x1DFA712A2E81EA19, 0xEAE4A6D93C5A5C34, 0x000DE791B0D1F69B },
+{ 0x0F8BE88D0344387B, 0xD3927707072F7335, 0x59AE60B8EA501C49, 0x46806D303CC55AAF, 0xBB232DABCB371597, 0xB52F3CC0EEC170B6, 0x6DFB5F0A3946D661, 0x002005FF0F665A8D, 0x0E208C3BF7D2CD0C, 0x60E1111A1F935F9C, 0x554B43C21A387724, 0x5421422ADA49E873, 0xC0D54C0D89894118, 0x6E1EB14CE01DD27F, 0x59ADA646A065A4D7, 0x0021AF88013725CF }, { 0x963BE04B7915C28F, 0x144C6D0BBFCDB7DA, 0x261CDDAEE6CD2ACE, 0x659DEAB33617318D, 0x8D0F69102A6F4E9D, 0x0E40500AEA44E101, 0x1A8D82E92CA69866, 0x000CDE486C1A7E19, 0x993FD47993D39CB1, 0x93B797D71B96CFD1, 0xDFFB07C948660590, 0x4D934F08828E673A, 0x4871EF68A3417467, 0xE03B650CB8C2D39C, 0xAB2BAFEA05876EF3, 0x001A362083206891 },
+{ 0x47D6EE7C82ED2CC5, 0x95F07CD4FA537D61, 0xCE5994B9A6939FBE, 0x3F67D51942A15F3F, 0xFF2BFA68D506CF58, 0x3E8171F1DB2DB085, 0xBBF8A0F72892C73C, 0x000A15A828EE2B4E, 0xD9D57AF27E5A117B, 0x3FC70A2E94ECBB0E, 0xE6C5478DA904A255, 0x4747522B3794FFF4, 0x1D9E009514000C48, 0x4E24B4DA32DD8D7D, 0x2BABFE23577B28B4, 0x0019DD45D2156AE1 }, { 0xAAEC016B400CC0AB, 0x13CE964EF60005D8, 0x88493659149CBEFF, 0x2E6FDD72518D3761, 0x2F673C961EABA97D, 0xFEE794480B09978E, 0x01CC9C75E99799CC, 0x00028265349C7951, 0x177B9770E74E4FE4, 0x46602E5BFE8D32C7, 0xA0F7050770DBF96B, 0x5935D6365A12E5AE, 0x84144B34AC9B7D10, 0x17B7EE9A5A5F9F50, 0x03380E189268ABD0, 0x0033C2899C89AB83 },
+{ 0xAF87D319BAA37BB9, 0x619468C057EF831A, 0x94A1988E66B3D6D8, 0xFEAD9F0D82CF6DB4, 0xDC423D1F014DB0BD, 0xF14D15736DC8BF7E, 0x0CF7F950C9DBCBB6, 0x00155D4693F396C8, 0x39F99ABD2A06A4A6, 0x7CAB959B2AD0BDAE, 0x0273F6363DC280A4, 0x59BBACFBD26EAAA3, 0x97197266CF42AAEE, 0x54D6CE5AA9B092FA, 0x8D385E04BF0FDBAC, 0x003A6D030BDED7C2 }, { 0x0F468FD55A84B02E, 0x01B6B0FA69ACDD16, 0x63C38896DB88EB6F, 0x80E3DBBBE10A273B, 0x974A83429462C79E, 0x4406238040C23183, 0xB316F5AB7F24CCF9, 0x001C72600CC81007, 0x471649EC24D04D66, 0x7E7FAFF4AD0D6F47, 0xCF365E3565C6B31D, 0xDAA6DED2D440CAA7, 0xEBF10193E15D39A1, 0x91B5A383D6C6910F, 0xDA020EE145DC9BC1, 0x0004A849C6FF52DC },
+{ 0xF28A04FDFC728A78, 0x8ACDD563E02C6DB1, 0xC101D6754A5C0244, 0x6858D51DD117FBB1, 0x7C2318E6A4183C8F, 0x0ED359F4DA7D3287, 0x1A5FBE2A0CB6E338, 0x00368551CCDC8959, 0x250E4E6881E95C00, 0x107785486F3492F0, 0x2DA106E4DFBE1B36, 0x3EE5A171270D487D, 0xCBD2EA462DF395A0, 0xD18FC587F297AA45, 0x4017D06394513652, 0x002BC51C6802501D }, { 0x1FB5F16A944AF55D, 0x3BA96DCFC14F7EDF, 0x6D3CA8645DDB30FC, 0x5B1B9CD3E037D38B, 0x55171434F18FA640, 0x0F41361BF226290F, 0x720AB28543B18FDC, 0x00053ABD6E9F82A4, 0x27EFD64C9609D1A6, 0xC5C389FCF208E03E, 0x4C857DF21F772F19, 0x3FEA7DDD46EBE8F3, 0x62F46174157843DE, 0x2B53638F512B2E76, 0xBC6FD147C78D4662, 0x003E141A507C9088 },
+{ 0x6926F4BA0AD2551B, 0x4CFC6C584A3EED51, 0x45BBE6FE3E2F1C5B, 0x6C581B5768D961D3, 0x73DC91794ADB167F, 0xA9C85D95F127A27D, 0xB99090E79C604B04, 0x000F25B3DCF95F22, 0x01418D9FBD5BFD70, 0x658E6D516AEB1437, 0x57EF09B035CE4B2B, 0x148A56040B7737A5, 0x2DEE754E7B732FF5, 0xDB9CCB11FAF14F50, 0x6CB1F5C4CD352A3B, 0x0015802C2C05F490 }, { 0x74D1A366D807895D, 0xC874E763E800CE39, 0xD73260BCEC3D7488, 0xBA56E475C90F600C, 0x7EF56DD430AF59A6, 0x1308DB9C19CCF2A7, 0x333E4BAB421B3FDC, 0x001BCFD4FAC64CA2, 0xF56635306F106A80, 0x1612F7B77B550B7C, 0xC95D0D45B7B4D3C9, 0x53AFDDA9B79CF655, 0xC4DF35EAC65ECB8D, 0xA7E3661AAFF5B9C9, 0xD511BE2BBFA42D34, 0x00201E285BF6D944 },
+{ 0x8B49140216315690, 0x32C8AFCB9C9A3443, 0x6A587706A1F67663, 0xDAEAEFF878564447, 0xF6B2502EC1465B36, 0x9B6F9994CAC81E11, 0x5F61F748F46F8806, 0x0034BE2EE3F387C1, 0x38CF461D23A007EC, 0x95FF663D10E04ADA, 0x84231B55F51531C1, 0xF24FBA3898402121, 0x57B6F0928EBDD809, 0xF3A1A655CEA17531, 0x356A3C879E6B0D34, 0x00381CB2D155D266 }, { 0xF20535EB18193CAB, 0xDD4439AA91BCCFAA, 0x2281F23DD2F74E92, 0xC7DF282BD99DBE20, 0x8F4CBAAC80FCF026, 0x4D536FDF9507E7C7, 0x8F58987BF468492B, 0x000BD6718BF93790, 0x212CD190611C81B2, 0x0EDBFDE565426F3E, 0x74B63DEA3F803585, 0x4A282F1BDBF8004B, 0x3D47F1F8A40BA5E1, 0x5483B6E68F9373DE, 0xA57D5D4FC6F50C20, 0x0004E754F8D5622B },
+{ 0xAAF1F8767E13E9B0, 0xA177241055ACC548, 0x31F1655CC860CB41, 0xF96CD67F85C4BBC9, 0x18470FA59CBE54B0, 0x1C5216011631DA5F, 0x38125825CFF9BFD4, 0x0000E61A540F3B9E, 0x9774119D49C3454E, 0x58F9CBE5D3B1B847, 0x1FCD43CEFC72DC6F, 0x8ABCC610CC6CA0B7, 0xA3CE3C718815E3E7, 0x7EEC4A5D2C756735, 0x75E5F9A2A6647745, 0x0039E70C76C5A752 }, { 0x550E078981EC164F, 0x5E88DBEFAA533AB7, 0xCE0E9AA3379F34BE, 0xB29329807A3B4436, 0xFAC14C34855392EF, 0xFF49E0C7654CA34F, 0x28336E980A7DE4FB, 0x003F80DAED71E280, 0x688BEE62B63CBAB1, 0xA706341A2C4E47B8, 0xE032BC31038D2390, 0x214339EF33935F48, 0x6F3A1F6899FC03B9, 0x9CAFAC6B4F091679, 0xEA5FCD1B34132D8A, 0x00067FE8CABB76CB },
+{ 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 }, { 0x8C7F99923FAC50F7, 0x145DEBCB0C6313E1, 0xD12DF39C72CFEF11, 0x894E577802CC8965, 0xBC740A561F40E7A8, 0x23FBAB2B89EF9E34, 0xE7001FD498A2965B, 0x001DCF71AC418266, 0x7A862A6674DF9E09, 0xE2C6F2CF85B9C023, 0xFFE721BA7BC2F10C, 0xB1F8FA55FEFF9145, 0x6FC139CD41F1CDCC, 0x151BE7E32AF41214, 0x2B2B833290A4056C, 0x0027F62EB18D157F },
+{ 0x10A1C2B3FDB12824, 0x193EE4D556579C2E, 0xE9809691B8FB9887, 0xF270DD2B2A46770F, 0x3CF7702F2C086258, 0x032A3F1985586595, 0xC16140E6408334FE, 0x0002E0410E9C75B8, 0xB48225BBE420521A, 0xD47C7D0C39B309F7, 0x1BD2A7D09927BB79, 0x74E6C68F34FF7703, 0x4AD7936FBBD1AA9C, 0xD0B6AEDBE5ABB099, 0xEF0561F35992CE0B, 0x002B406589696193 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0xD738B0A216214995, 0x6E726396B824F9A6, 0xB7CD1D6CDA24BF90, 0xEAC1A6B3F7EEFD18, 0xAC3FD9CFA65E6E87, 0x50AAB97D23D64B25, 0x1105AAAC26E4E2D9, 0x002BC01634FD8245, 0x4E82ED2476E83268, 0xCF1E64B65D7FA766, 0xA696A3A0D012979C, 0xE94A739A39F5B638, 0xE65C93CF37F38E63, 0xE234FFE111463A68, 0x33EB58967C8B98BC, 0x0036469B2059DA88 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+};
+const f2elm_t64 DBL_TABLE_EE[2*(NBITS_STATE+1)] = { // A point per row represented in (X:Z) coordinates
+{ 0x4B2932F59BA8F0D7, 0xF3CF903DE037E9DE, 0x9FD2BB677B8F20D0, 0xC87BD021E4788B66, 0xCEBB19755E386EF3, 0x8F4C2FF476C61B3D, 0x6AE81661AC020E06, 0x00176165A21573CC, 0x962AD2B9A44048B0, 0xA1884F74C3F15BB4, 0xD2BD3EF00319B1CD, 0x99A864436FE6840A, 0x8463D358D6CF40D5, 0xB855746B9DC6B16B, 0x8D9FC8BC93235C9C, 0x003523F5A4D3A185 }, { 0x00000000000003F9, 0x0000000000000000, 0x0000000000000000, 0xB400000000000000, 0x63CB1A6EA6DED2B4, 0x51689D8D667EB37D, 0x8ACD77C71AB24142, 0x0026FBAEC60F5953, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0xEA3CA40A31D1A306, 0x9EB70375B99F817C, 0x55224C7393CD23AC, 0xE5C34A8AB138B862, 0x6848C92344B0D7BB, 0xE5707A3B3B24B858, 0xA131DF2898F28CD7, 0x00061AA677F8F00C, 0x6A3536FDEED0C241, 0x01A69696A3A479D8, 0x02783118AC68DC9E, 0x6F9128BE5850ACB4, 0xD067FAB162C176B8, 0x0B060D00F330DE9F, 0x607EC212AD778884, 0x0022FD962E5A6107 }, { 0x8424D7934AA5964C, 0x017AA3DFACDA081C, 0x07EC0C80BD5F25C7, 0x061BA9B79622A99B, 0x16A93365E3278BE7, 0x82E7DD1CFC3965F9, 0x8FFC12388C3F34EB, 0x003E903E64987FA1, 0x93299F4355F63C8E, 0xF72A17B0BCF50576, 0x322BBB9A5AA4D451, 0x7A8FA259D67D1330, 0x7CEF5E5BC04AF494, 0x016C8F50FFCF7056, 0x570DE53597815255, 0x002370A51E551A01 },
+{ 0x1457D85E80D85763, 0xE94C3D0D7BE1AFDF, 0x372DDDEF428F94CB, 0x9DF033CA5DCDD6C4, 0xB13DDA7E4AC61A39, 0x7D0E0C2CD5C7109C, 0xBF4E96EDD34BE1A8, 0x003F72E39A33ECE6, 0x9A3023A0FABB6275, 0xEDE3AC79B9B0150F, 0x8B46D5176A543A70, 0xE1187C68D6453754, 0x49C81D88582DC948, 0xA8A186AEE8075277, 0xB456F85EE6E761CD, 0x0014809F2940F950 }, { 0xD06C38B4060D7AE1, 0x0A588EB38D93484D, 0x76764C55541FF92F, 0xA50E42F964358712, 0x2B1FA8CA2987EE22, 0xA28EFC0E8E1EAC9D, 0xA7C43CB04CCD5AF3, 0x002DA12023C583A3, 0xE5737C3C70ABD85E, 0x07AC7F28F09D259B, 0x6D4B7065384E7828, 0xBB2B8870FAC0210C, 0x870E50DD49F37D14, 0x6AC638F286C0BD8E, 0xC8D7900258DDF9E4, 0x0036E1638A179EF8 },
+{ 0xCDDDD59C69682D91, 0x5911079213CC8331, 0x8AE000237746D3EB, 0xDD36E345315C51A5, 0x4BA6F148271E43DC, 0xF0816533DCD23595, 0xB543CE961E37014E, 0x00396D2A9EB62639, 0x992CAF8F38ABE5B6, 0x78A34760E94588E0, 0x4E07C67890B96F03, 0x52B43E3B5C8E2813, 0x7AADCCF7CE7CF33C, 0x9C59F4F9846152E4, 0x66B3B5C3A822AC31, 0x00181AC3F7A47DF4 }, { 0x3F850D00EFEFC4D5, 0xCB1AA7B21AFEDB79, 0x8E5ECAFA5C95D816, 0x8181D7152DE70411, 0xD0490563C6EBC773, 0xBF7F368396FE56FB, 0xD95419C03F34185C, 0x0009A0DFD6D05115, 0x5559241AFF3240DB, 0x2791DBA4F8E82A69, 0x37D22E0241856D3A, 0x1DEAB6ABBA3EBBB4, 0x13946B25B6166226, 0x545D4732FA9694AE, 0x29D162078671E781, 0x003896AAA7261FB0 },
+{ 0xF4963E83C70E8E93, 0x857F68BC5B26374D, 0x161F7994C76FB28D, 0x57D5F81734D62FAE, 0x08580C5ADF99684B, 0xF4D71F6E1FF3D42C, 0x52DFD4D1C1784454, 0x000D49BD976B4DB1, 0xA95DC87152AA3909, 0x0714A602993579C2, 0x77E9083B69949649, 0x66B40EB581F70A36, 0x956340B6BD9FA0FE, 0x2AEFB4A6DD32DA22, 0xCD3A9528DF4425B5, 0x000FEC89D27C7730 }, { 0xD0075DAE2E0F8FC8, 0xACBDD622C1A4AF27, 0xCB1BE4902086598C, 0x0D661AC01DE1F1B3, 0xD5B45BA3E5F14572, 0xA718DB56AF21838E, 0x73E1A2CB71B57BCB, 0x001C3119C47F0B51, 0xF988A95D43D57455, 0xEF6576F22F42D293, 0x7716CC5E73F3E16B, 0x4EBFAFC24DDC3406, 0xC4E9E26F4BAA539D, 0xC03E05D32506959E, 0x1CB1DEFF67781EA1, 0x001DDEF116F28134 },
+{ 0x614C0A3A0133B4E1, 0x0AF4483608A02E91, 0x0025FC23003BBCE9, 0x2A6BEAE709EC1BC8, 0xA7E72CA57E7032FB, 0x93D4048990B3C0DB, 0x6FF7C553C2CA7566, 0x00360DE7092954BC, 0xB8D468B783829EE0, 0x281B67C5DDCA4156, 0x5CB5D68B3A746626, 0xED862691D19D5E5B, 0xAD31BF8427FE1072, 0x678C8FDAC524481D, 0x3B368FCFB39C60AC, 0x003FF9D88E6C3FCA }, { 0x37C18A54CF6D2091, 0xF9833C64E62CC4CB, 0xEF408EDB47B62D1A, 0xAFB4CE6E8BA62167, 0xB2009394B32B3FC7, 0x7251AFA6B6475DE8, 0xB92258D6085BEF4F, 0x0036B9846DBFCE59, 0xA3BFC427EA46DB0C, 0x8C1C791111316B0D, 0x6E423E23426D5885, 0xF32F97C9BF169737, 0xCACAE2F592A0A38C, 0x6C1603D6E7CE59BE, 0x2829E9A745CF0473, 0x0019CEAB8278FAFD },
+{ 0x7DAAA499F5EDBAD4, 0x28B96BEB701619D3, 0x2833645F1E128C1B, 0x22B2321A0A9A8453, 0x8A50B3D24FEB57C0, 0xF235E349EE49175F, 0xDB02807435D62EC1, 0x0008F4400AFAC780, 0xE532F98566D82F27, 0x2558B060BC250915, 0x325FB71EA0894ECE, 0x0FC08565EE73F786, 0x96D0B60132780903, 0xB9A470447BD28E61, 0xAA347B00FC63CCA8, 0x000D3DF2778C06D5 }, { 0x061DDD1D511AB39B, 0x2D9A2A7A146E8D25, 0xB61058B8F855AE37, 0x10DFF0BEF589B953, 0xBFE1AF66E7EBB725, 0xA1E1D2C0AB542AD9, 0xAEC60C6D0A523AF2, 0x000C292A1E79D01F, 0xE2A7833D31BAC1C5, 0x7A37EC8EAEA76972, 0x9E0507FCB9DF8743, 0xB59E19096F592B8C, 0xAD869F10B7AD74EA, 0xF5E5D992A85846E5, 0x51AAC04D90EA76B5, 0x0011F8D9A3508190 },
+{ 0x03FB2AF4400EDDA1, 0x2D15EC507F584485, 0xBB5D574184D3E7DD, 0x5694F880198722AF, 0xF7F1C37F27E5A026, 0x09C4F7F183D648EE, 0xFA18DB99C07A8745, 0x0034BAF258334830, 0xDA9A2082E07932A2, 0xC03D531EAD96F39D, 0xBDEB4D75B389ECBF, 0x137ECD7AEA1C3D99, 0x909B82555D721A2F, 0x36042624B675F382, 0x06E31183234C74BF, 0x003EC0675F080D8C }, { 0x13172F0574560D0F, 0x47730107C2869CC2, 0x66065C7F373143FA, 0x1BA1C0E71FB47AF9, 0x22146744648A3500, 0xF6252775FBD3B4CE, 0x145C9501A9A06F32, 0x000781A5928A4F47, 0xD4A678B9A3321B4B, 0x4EC06BFAB808E0A8, 0x01635CE7B38E4CA4, 0xD043F5F8E8641C99, 0x67180C3F12E0C141, 0x6B951301CF9655B6, 0xFEC2427737A4FBD5, 0x003041896CED1DFA },
+{ 0xC823A8E6F63267C1, 0x429ABC90DC5CD823, 0xD81B49E2F1944FCD, 0xED6317AAEEAC93C1, 0x7CD8AB0010FDCE41, 0x23334E93FDD21064, 0x68834A7DF060E21C, 0x0035BEB676B7F514, 0x9B20B8BB3D1F367F, 0x3E465CAC0F57DB08, 0x536E7F888203A722, 0x7AAAD8DC4451B263, 0x2967F9927D0593AC, 0x65F6B42C8FA07ACF, 0xA64DB719684DAF07, 0x002E714111523C05 }, { 0xC85179CD097F2C95, 0x91147D84BF6C09C4, 0x1D397C0C8309BE50, 0x9B8C96DB80EB28BF, 0x6D35A4B19171856C, 0xEBC76F8EBE874A2A, 0xF02111E956E0C616, 0x003AD54D60208300, 0x8867978E5214B179, 0xB4C78303A8093980, 0xED9FCA5CEE9165BC, 0xFAF0862DC15DC0FE, 0x927530D38BA107B0, 0xF528A746C2EFFC78, 0x0FAF69FFAAD9884D, 0x00258B7C255805EA },
+{ 0xA2F04E0678937806, 0x38A5FD2EE430A5FB, 0xC319C4F3B0DEBBA8, 0xFCF78264E7F97B56, 0xC09449DB08CA2316, 0xB16877B3C2B89D3F, 0x2101F463E51CAB74, 0x00173FE2CD8547F2, 0x1236FBD206156572, 0x4384356A9B664057, 0xB0B5B8374AD437BE, 0x76291D5EE3E12209, 0xB1A59C1DEE422A56, 0xD9B0604CB0497998, 0xE4BFF23D62B29FBB, 0x001671A36C8A5197 }, { 0xDD17090F72471C90, 0x00F0EE800CC287CC, 0x0F474D44D8CE861F, 0xEB310287B512236C, 0xDE5419DA3F1AF52F, 0xC08E8C15B8B1C0FF, 0xE9CB56CF0CFFE6AD, 0x002B8098AEC8F022, 0x3753D1F9759C046D, 0x8674C5D26465734C, 0x4CD7CB033EE744F2, 0xA6218D9894030534, 0xB782A91EEA8FAA3B, 0xD04C3DB326E6122F, 0x54B2C927B0AAB69E, 0x0001D24625279589 },
+{ 0xE6ED7D9E038B2219, 0x1B09BF028CCE8C2B, 0x25350E56F5D1811D, 0x4E7FCCA717280B62, 0x0AABA1029F5E95F6, 0xD614EBD8D45C52C3, 0xC757E25295CFAEB3, 0x001576027D1F3ABE, 0x028D0FD68611488E, 0x696FBABEC7441397, 0xA52CE3601F8706AE, 0x0EE2C6F6EA67649C, 0xD8A34DDE746FE059, 0x4B7E8167C4643168, 0x33D9D6A18DF9C77E, 0x0000CA1601AD8038 }, { 0x5EDEB268C4F6C4A4, 0xBB94DD740669219C, 0x268AEC71CEE92BCC, 0x03DE98591B82E808, 0xA06B51F8E509C87C, 0x0A45DB68CDB2259F, 0x260022AE37F54C52, 0x00182BAE490026B3, 0x7AF49165A645627B, 0x6485DAD26CC9D1A2, 0xF391250CCD4BA49D, 0xEF3D0711A868EABA, 0x62C090AA490FC97F, 0xA0FFC4CF5B60D5C8, 0x87CC6656E34B00BF, 0x000A7DE9454FC228 },
+{ 0x0B788094BBCF7767, 0x433C089C8C0EB1DD, 0xADEEE0B38750FBE6, 0x9A0737EE59BCA3AF, 0xE163AB72F3AE02A4, 0x0C0AB0DD1A55D1DB, 0x590ED6CCF7F2A950, 0x0019A459DB300B73, 0xB387EB774B8161E3, 0xC3153EE96453A729, 0x1A5F113F83C688A9, 0xD35DF3DA50AA87BC, 0xA26ADD168BEB00F0, 0xD801E59E5583AF1F, 0x5E9AD0FF670FE7C7, 0x0030B6EEF0C546BE }, { 0x00BAF4EC3C748D10, 0xBABD0EA7CB32CFD5, 0x1E6AA04EF2C2F83B, 0x0B2922B24D5E1D43, 0x12DA7F7BCA2AB3AD, 0xA784AD812B97B9B6, 0xA701E1F40F3AFE3C, 0x000E0ED3C3EA244B, 0xFDFBB0E5EFAEAD2F, 0x26B8BD7451E97DCB, 0x42ED971DF73D57FA, 0xFE51BCB4A754951A, 0x259DE8542A4FAD2E, 0x1D7FD84076F20917, 0x719AB2CD2FBC5830, 0x001A5E8794E2FF65 },
+{ 0x2FC1CF9CC790216D, 0x250A5E10EA9AA502, 0x2A402AE014B641D0, 0x2ACC010213946851, 0x5A35392DD332AA01, 0x1EA6F74A53CC8E88, 0x5121B12AC37D68B7, 0x0038FC3B6372E62B, 0x7AD9CC25FE7BD4A3, 0x921CB8886BB2DF04, 0x3D21B1811FF6C57C, 0x91D300C3254AD2F2, 0xB0EFB4D90686DDF6, 0xEA1989EE00F6683F, 0x714ADE6A6852B466, 0x002B347DC59C531E }, { 0x8E261218DFEC94F3, 0x56278E0174CF0144, 0x7149028D0C0569F0, 0x74BCC1086B159980, 0xD0B0D9114F6F9485, 0x3CD8DAA7116F9063, 0x5A4252D2B5C4B7C2, 0x003FF90C5E094DB9, 0xC4A11CB012BE5432, 0x294B142FEF45A151, 0xBC964A6F3E63202E, 0x04C547EE43EFEDBD, 0x75AC36B3C7E9DF7D, 0x5FF7AD89D581A905, 0xC9D6F6CA8D2C6FA0, 0x000A9740D35476EA },
+{ 0x7DC60EB22EB33385, 0x338567E820DD911D, 0x8713B7E888F9BA79, 0x64561046E917FDEA, 0x327EF0C9F10B72BE, 0x9397EEB9280DB749, 0xACAB6769BECCBD19, 0x0026C60C0B95BE6A, 0x100F7A5A875E758B, 0xD2CF917BCC3B3C9B, 0x4D03CD01B21B8D25, 0xCBC7A66A0FD3AC11, 0xBEC5C77193B0C44F, 0xD8089E55BF55F3C2, 0xC38CDF186AF0B302, 0x004061731AFF5248 }, { 0x7A512BF28F76D02A, 0xE917AA1E9E6D4E9E, 0xE034B8ACFCA6523F, 0xCCFAC4C9DF6BE67F, 0xD563326925A932B6, 0xFB239B693EB1C01E, 0xB488E0B5179048E1, 0x00276DFE6307A9BB, 0xA8D902D440D1513B, 0x4F0B8DC5E02C2B29, 0x2D24EC898D2844C1, 0xC3DD8B0115C43412, 0x619B149EF68BC586, 0xD0B6FCD3D577B634, 0xC7C178A5CAF78AF5, 0x000FBF867C18B4CB },
+{ 0x4F87417B8ED851CB, 0xBCAB80DEAAD074B5, 0x06E25D3EA6FE3FA0, 0x84E64638C1C79B47, 0x3B7928135BE1CCD3, 0xE95AE2F930499DBE, 0xD9B3B3767D25535C, 0x0037AD7275258260, 0xD9DB566E42F74CFD, 0x4693673FDDADBBB8, 0x4D8A6F5A44A9669B, 0x091864DD82C71BC8, 0x6CEA06A77593CB7E, 0x797D5B3231384A9A, 0xE0078869D366B6C0, 0x00160C6AD41071AF }, { 0x119DD88D9CC07EA7, 0x1E74A46DE0601A3A, 0x51A1B9923E9DF8F1, 0x86551AE9B3E6AEDD, 0x7AB28F8D6565D87D, 0x3DDA68365F7C1FD4, 0x3D506E9ACF5C1AAD, 0x000ECCD2244F5C1E, 0x248F3DFFB5C127A2, 0x4B7041C0A0E24F8D, 0xA862E71A2A507C2B, 0x3B1DCD089CAF14DE, 0xAA333CD070FE0ACA, 0x1629BA1A981F9A03, 0xBE4842D01E3EEFFB, 0x0036C46999068010 },
+{ 0x35495F39762C12C4, 0x4A0C397E57281DF5, 0x7DFE497356DD858B, 0x15AAE81EF87174FF, 0xC67F124E87EC3F2B, 0x44AA3A25FDA611D1, 0x60AEA9CA761EECA8, 0x0015E48783C79E04, 0x45551435D1546335, 0xC98D84635088B150, 0x2B877A24BDA4A15C, 0x40E9FF6964D20855, 0x5DD109F8C66BCD58, 0x2D1AAD7CB2620E77, 0x8C44997C4C2D5018, 0x00308DED856193AE }, { 0xC91E9761C71DEE6A, 0xA0A605B479AE7D00, 0x1FE9A959E7FAC1FC, 0x82D4912695341204, 0x2CCD74C79A45AF68, 0xC878A7692173D842, 0x867D3E5D996F10A0, 0x002E34827B8142D4, 0xAFEF8F2B2F747C6C, 0xB62B39C3BC934F45, 0x6C891D662CCE5932, 0x5B9B3B43AE13D84E, 0xC894994C123AAE67, 0x546FABAF1B85821D, 0x0265A90A5C9D06F3, 0x0001F34AAFC2266E },
+{ 0xF234EDE56EAA284E, 0x69F1C2F17C5110E0, 0x2258C768BFF36925, 0xC6CFC7CEF10A3E9E, 0x760AD9FC09F9F9EC, 0x704896B5271FDBC5, 0xDEAC1374590411EE, 0x0019C2344FD52E48, 0x5998B1AC12A0B0E1, 0x41B7BB1ED2817D09, 0xC4901F9503BCFC52, 0x80BF2EDDB30AF74C, 0x5A2DC710931F789E, 0xCF0AB86F9094D0E3, 0x087D609A855C1FC5, 0x00198673D7FB14D3 }, { 0x0DCB121A9155D7B1, 0x960E3D0E83AEEF1F, 0xDDA73897400C96DA, 0xE53038310EF5C161, 0x9CFD81DE1817EDB3, 0xAB536013545EA1E9, 0x8199B349817392E1, 0x0026A4C0F1ABEFD5, 0xA6674E53ED5F4F1E, 0xBE4844E12D7E82F6, 0x3B6FE06AFC4303AD, 0x2B40D1224CF508B3, 0xB8DA94C98EF26F02, 0x4C913E58EAE9ACCB, 0x57C86623551B850A, 0x0026E0816986094B },
+{ 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 }, { 0x0B512AC04C92AEFB, 0x52DD5B3E2C021B83, 0x567B31CF61F84CA2, 0x927F4712A4BC89AC, 0xDF81CE8BF0F33152, 0x1A939451799FD270, 0xD85E7E6E4AF9BF82, 0x00109CC3D42DEDB5, 0xB397DE1AEC2DDEF0, 0x3E541447A9D8E317, 0xD858C45D82FED29B, 0xEEAE2A82EEEB2845, 0xC6A626F5FA2EB961, 0xA5DEEF64A8D44F1B, 0xFCCA6EF0C7E1BEE9, 0x00019FC873F7760B },
+{ 0x0908EBF4726DA35C, 0x98F1390595119EDD, 0x8F36744E6835660D, 0xB2F44F2916CC25C7, 0xC6A77B9379D87540, 0x4D8F99D68D3062FC, 0xDB6C69E8F2463D10, 0x002E4A8265F6651B, 0x9F6A22B3AC433AA4, 0x48C93F1E290AE04A, 0x5F97EA4E5C2D44CD, 0xCFB7B2F179AD9340, 0xE8F61A7DC16B0AA3, 0x1A5A017D38F2B441, 0x37DF08AF1F3FF12F, 0x000A7C674D872336 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0x2D1AC917E87D9DCF, 0x2D0B4CF65165A8F6, 0x8BEF578C0C0C94EC, 0xB1818528809CCC39, 0x4965EBF34E62967D, 0x79A03B3A648CA266, 0x514F86788D09CBCD, 0x000DCF02F43554A4, 0x9A48F80AB1202BAB, 0x466F56F1BB9499DE, 0xF6908ADB64FF54AB, 0x233E28C698548DBA, 0xDB7847C8490DFD32, 0xB46398439096D232, 0xCA17D5944EA81D40, 0x0034A305F96E113C }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+};
+
+#elif defined(P546)
+
+instance_t insts_constants = {
+     .MODULUS = "p_273_172",
+     .e = 20,
+     .ALPHA = 2.25,
+     .BETA = 10.,
+     .GAMMA = 20.,
+     .PRNG_SEED = 1337,
+     .NBITS_STATE = 19,  // log(S) = e-1
+     .NBYTES_STATE = 3,
+     .NWORDS_STATE = 1,  // Assuming 64-bit words
+     .NBITS_OVERFLOW = 3,
+     .MAX_FUNCTION_VERSIONS = 100000,
+     .STRAT = {4, 2, 1, 1, 1, 2, 1, 1},
+     .jinv = { 0x2645368e9fd585f2, 0x2069ea4045b73197, 0x8b527c30636d77e5, 0x4947cb54dd15f8cc, 0x994aa0c90e0a44d7, 0xf0e1a2b63586c07b, 0xe58a38ee24f5d06f, 0x92a83e215b5c4dba, 0x00000002cca40305, 
+              0xea53e894bba7eb8f, 0x3bb7ae0e0762eed5, 0xd08a8008001bf713, 0x81382107712e4604, 0x68f039ec3cb5106d, 0x1c988ed55c6b7265, 0x557969a9465e899e, 0x5b0a763bf29e84da, 0x000000049484d4d0 },
+     .ES = {
+           {
+           .a24 = { 0x00000000a7517042, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x573da053b5bc0000, 0xffa68069485e229b, 0x633fb8663d224bea, 0xe26c3de78a933914, 0x000000027276d5ef, 
+                   0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+           .xp = { 0xcd1e898e3047a19a, 0x641498b461de6de2, 0x8ce5801ac1287ba2, 0xe808feca4fde5812, 0x1b71e8704c4a0611, 0x0290c4c17eedbe63, 0x808b5eb9778f0aa9, 0xa18f8b2613988018, 0x00000001f9f26309, 
+                  0xcd9f4f20f5eb2bec, 0xd2f27a6c546ffba8, 0x303fb6a04f054b3d, 0xcc8b76b94b5d7c76, 0x8efb5981cc7a65aa, 0x127beafb35057344, 0x21351dcce201dd5f, 0xcfdcc6fe78ffb2f5, 0x000000013a93f76f },
+           .xq = { 0x268b9505ad0b4e7a, 0x3db3e4b09ac344cc, 0xd45ba27bdc03387b, 0xfe98a3982b2201f2, 0xba10373e737c3ebc, 0x54c1b1f6dace3e20, 0xc87851805e9696ee, 0xb264451ec81fd332, 0x00000002ae205ff2, 
+                  0x3e96bcbb9f44ed7a, 0x922fe2bea8f2e986, 0x6bae02b2dc290a1e, 0xd23071f9d8990714, 0xb8fbcdd367a6c1d5, 0x85e1dce0258c3476, 0x99f219c3a25910fa, 0xb7d748c0abf5ab2c, 0x00000002b4ac6ecf },
+           .xpq = { 0x87ec4823aaa4cfaa, 0x3b57a70ec3f1babb, 0x0939662afd693b68, 0x909573645dcda29e, 0x1acd53668fda5ddd, 0x73cf5d1200108b09, 0x0da75a5bc209eaf1, 0x955500ee4cd72b89, 0x00000000b1ace417, 
+                   0x175b6ce403cff1b6, 0x60d9689c3d9a5c47, 0xfa2aaae1d3dfc2dd, 0x38620ae8d4635c36, 0xf8bf8f73a726361c, 0x0d804398e33bf609, 0x3a60d57d8986920a, 0xdf9aa56c42e41579, 0x000000030cbcafb7 },
+           },
+           {
+           .a24 = { 0x00000000a7517042, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x573da053b5bc0000, 0xffa68069485e229b, 0x633fb8663d224bea, 0xe26c3de78a933914, 0x000000027276d5ef, 
+                   0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+           .xp = { 0x30aa909c42e2210f, 0x7b257b5f47ff3480, 0x461362be32bce265, 0x47a8bb41f42ee595, 0xd5cfaff8ba2437b0, 0xd50f7da1268417b1, 0xb6f0a28168234443, 0x8055dedb0e7abd12, 0x000000029ede5f39, 
+                  0xbc82df8b55dc3bb1, 0x01ee2b9dfceadf2b, 0x80597dae0b2c13a4, 0x087ff9f311c97cf3, 0xd7125ab03cf81671, 0x5f6b543015237f57, 0x010948e1ec4eafd9, 0x6bbd3be09e40de40, 0x00000002c6e987a2 },
+           .xq = { 0x268b9505ad0b4e7a, 0x3db3e4b09ac344cc, 0xd45ba27bdc03387b, 0xfe98a3982b2201f2, 0xba10373e737c3ebc, 0x54c1b1f6dace3e20, 0xc87851805e9696ee, 0xb264451ec81fd332, 0x00000002ae205ff2, 
+                  0x3e96bcbb9f44ed7a, 0x922fe2bea8f2e986, 0x6bae02b2dc290a1e, 0xd23071f9d8990714, 0xb8fbcdd367a6c1d5, 0x85e1dce0258c3476, 0x99f219c3a25910fa, 0xb7d748c0abf5ab2c, 0x00000002b4ac6ecf },
+           .xpq = { 0x9bad7546d4aa3e22, 0xe5c9d0b3f0f653d3, 0xbe98ef665b891b74, 0xbb099d4fd8335bdc, 0x6338a2dce4aa7c67, 0xf571864ec18d94db, 0x1116b972ecc40f01, 0x4641a92bf6e21b86, 0x00000002aadc6adf, 
+                   0xbb75ea9fc670119f, 0xb881459e2c92d920, 0xe4c4450d89621e98, 0x2db4e15dd4a6b163, 0xf41ffd8d5819f3b9, 0x52612ecfabb49cfa, 0xc8edcc2dcaea2862, 0x7925635b2b9af9c2, 0x000000000792763d },
+           }},
+     .EE = {
+           .a24 = { 0xae3b513fae093fa8, 0x5d60a81c589713b2, 0xe767281026043e8b, 0xb1353eecc9b6e0b7, 0x301db0825083f3d4, 0x3c1deae6e868a965, 0xf2ea539e0fca1b50, 0x057eb92c91d70ce9, 0x000000008e899937, 
+                   0xa92c067906ba389f, 0x7ac377c00cdc9a9a, 0xe94651accac444a2, 0xce2f1dd310e0adf3, 0xcc9898aa1d92c447, 0x92f0535c76f878fc, 0x91ef3c3ce7d882f7, 0x6ee7298a2e1cf71f, 0x00000002f3ea64c0 },
+           .xp = { 0x8678bc3f65f02f46, 0xe3c761ed0cd0473c, 0xc129ef16675d6493, 0x881c3588f1e18336, 0x14d5b37e5e804bfc, 0x387ed62759597b92, 0x15b4dd0afa65f353, 0x3eb7c7bc85568c95, 0x000000004d3f1557, 
+                  0x6d5a8d46498d3a21, 0xb4dd0ce0f75fa3a1, 0x4acf3489e237eab2, 0xd674aee01fa58369, 0xcac821808f4e200a, 0x0292741d90603425, 0x4089d8a3aeca0648, 0x1480c9a1d5648a26, 0x00000001c7f452c2 },
+           .xq = { 0x7d9e156fedb50fd5, 0x8f07edba3209ec45, 0xe525ea3cf7c6ddef, 0x920414ced857ccf9, 0xeed5a72fc135adeb, 0x772b375295ab887d, 0x7e4de808530c1136, 0xc6a9ec8820ca9433, 0x000000011b38a79b, 
+                  0x3fa591695e1d934c, 0x65c47c6cb80ea16a, 0x2f35f72770c53f6e, 0x91af350595ca3554, 0xe20660be8496e5bd, 0xbb6532999d8984da, 0xc83d4b4a03b9f803, 0x7d1bf354759f6c82, 0x00000001f8220542 },
+           .xpq = { 0xddb30157f996323e, 0xf9d6dfeb041f5849, 0x52aa164dd7b4bb6a, 0x28649f7116d3ed0b, 0xf5e4eb9525f12376, 0xa798d1dd116c932b, 0xeb7bf7ab394074be, 0x5502c234ecc85039, 0x000000014d7e71b9, 
+                   0xd159254d19ea8dac, 0x1f6f65d09323b9ed, 0x674fdc01c6adfac6, 0x89cab60d36fbd2d5, 0x9c95b4674c0f9a5c, 0x6919cabf40fe5bc6, 0x69f316ac4b2d4d6b, 0xf8cdfd9e00c67236, 0x000000027656ba72 },
+           }};
+#define NBITS_STATE  19
+const f2elm_t64 DBL_TABLE_ES[2*2*(NBITS_STATE+1)] = { // A point per row represented in (X:Z) coordinates
+{ 0x268B9505AD0B4E7A, 0x3DB3E4B09AC344CC, 0xD45BA27BDC03387B, 0xFE98A3982B2201F2, 0xBA10373E737C3EBC, 0x54C1B1F6DACE3E20, 0xC87851805E9696EE, 0xB264451EC81FD332, 0x00000002AE205FF2, 0x3E96BCBB9F44ED7A, 0x922FE2BEA8F2E986, 0x6BAE02B2DC290A1E, 0xD23071F9D8990714, 0xB8FBCDD367A6C1D5, 0x85E1DCE0258C3476, 0x99F219C3A25910FA, 0xB7D748C0ABF5AB2C, 0x00000002B4AC6ECF }, { 0x0000000053A8B821, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0xAB9ED029DADE0000, 0x7FD34034A42F114D, 0x319FDC331E9125F5, 0xF1361EF3C5499C8A, 0x00000001393B6AF7, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0x43B3C77F86B88EB8, 0x828EC685D0BF8247, 0xA0676EA84C2AB43F, 0x02B24773C0A3E51B, 0x5AF8DC599B50C2BA, 0xA02EE6BBC58172BA, 0xDD467931B91A7098, 0xC6932A788DC370A8, 0x000000023C9A06F5, 0xDEEC77DF59C5A7B5, 0x33F855EC2464F1CB, 0x24FD97C6E29A29BE, 0xA89CE0C48CA74241, 0x01A0A187E51217A7, 0xAD61B7645DCA1952, 0x4E77A235A815C09E, 0x34836C1C76A7E915, 0x00000001515A396A }, { 0x9FF11D770F26505D, 0x5FB049D492B9565B, 0x351123BB8FDD79AB, 0xA000CAF362538AA8, 0xA7968349C1D5D69A, 0xFBA90D720DEB6592, 0x7F8858ED34C4B379, 0xC645570CF81FF20D, 0x00000002880B7101, 0x4719E05D49A37923, 0x41F754E34FD996FD, 0x97EF4C3990F849B0, 0xC3B2A1764BC433A4, 0x9CACBE9CCA9C3B45, 0xEF6686B4CBC073E5, 0xC1E7D0E8C0EF1EA1, 0xE03ED030F28D758B, 0x000000009E5660A6 },
+{ 0x6B8DAFDC8A9CEC6E, 0x59BA7972E926939E, 0x0D882426724D0F58, 0xB2E1FFFF56E717AD, 0xC6DE4AAF3BC17EAA, 0x07B788A2E716E743, 0x5A6921882DF2EE66, 0x1CFCCAFCD95FD8F5, 0x00000002E8778337, 0x77C76C0AF37B97C5, 0x0279C17761EE51AE, 0x83620754BD96CBE4, 0x1E0FE55C45072CB9, 0x893210AC9621B541, 0xDA87024E1F09DE89, 0x72D490F4BD28D877, 0xEDF873BD4B32714F, 0x00000000724C643D }, { 0xDC5E617B0ED8D854, 0x42F8195A882695B1, 0xFBAB7765D32823AD, 0x7631B4044717D7C2, 0xF23FAE838FB4FF76, 0xAA47E36EAD322811, 0x8CF22B5646BD375B, 0x3AC55AD28A1700CA, 0x000000001680AEEE, 0x7EFF397C8B3AFBFE, 0x5C66652789D85210, 0xDE11B056F81C533E, 0x06E90FD82D77BD13, 0x3476724140CF1287, 0x365F27DD8CEE2337, 0xAA58DF115D6D5A12, 0xA483B92ECA563E11, 0x00000002CE0E604B },
+{ 0x1CFC2B685CEB1938, 0x818CC56F50B95334, 0x8C2B46018232977A, 0xF2FCDB75298A98C1, 0x13D645C5F39FA804, 0xA027E2C483AA2A4B, 0x67B802C097188873, 0xDA635A232D3C813D, 0x00000000D7E8ACB1, 0x5D75A4DD15E0171D, 0x185712F987EF928A, 0xBA43167B0116E486, 0xA2C6DDC45A7AF67D, 0x78F9E6E072E750BF, 0x611EA598106EFB51, 0x485972C590EA0590, 0xD31C92045BBE2A13, 0x00000001E59C9E28 }, { 0x330463ABCC5FF748, 0x6E6EA454AAB688BE, 0x20AAF6DA712460D6, 0x74CE44D644D3C064, 0x9CB03344D5B16433, 0x8C34BE1ED2D1728C, 0x7052FB52961D4792, 0xBD51D8B38A428389, 0x00000000EFA4E28B, 0xDE1FC3B3C5F80B58, 0x39F7CFAAB1D77CF8, 0x7234B2E2AC060431, 0xA350E016B21BFA2D, 0x807ADCA1F2E991A2, 0xFFAAC72C46FABC5B, 0xB33FEFC9F69D6B6F, 0x110E08F21A524B09, 0x00000002B4583ACD },
+{ 0x7B59FCDB933348D0, 0x4E03F3AC54F5B304, 0x7BE7B78C54C122B9, 0xB17F09140DABCCA1, 0xBEC32C56B1A1C294, 0xB317F8F89E77683F, 0x9B4D5E6E17879E96, 0x5904C5513E37EAC5, 0x0000000087D72B78, 0x2FCA73E949AD6B58, 0x47A37529BDD43DF6, 0xCA7351F56526E01B, 0xD1CF91CA9055C0A6, 0xB5DD4797B69A92EE, 0xDB90A4E2A7C860AB, 0x3089B3B589BACD86, 0x62E89BF06E53D74A, 0x000000008FA4AF46 }, { 0x1898E4BAD8FA0430, 0xB3889F1B82F678E9, 0x40A674876C3E7333, 0x3D6D95835EF51EEF, 0x09825A4BB1AAE8BB, 0x112219C3348DA05E, 0x0022A16E2F24F4C4, 0xFF68CDF2D6D95ECF, 0x00000000D61597B9, 0x414D82151049C8F7, 0x86E44E890BCD2999, 0xFF582290EA8F6BBB, 0x1AA01345D11AFBA6, 0xA51024AD1EA86DFB, 0x1B0F2C6E9B8B460F, 0xFFB89E5EB5B77E4C, 0xB8558C732F1C45C1, 0x0000000198E44760 },
+{ 0xCACC54B574FAA8E3, 0xD7475616AC320701, 0x8AD6922663E7790F, 0x68349C967CA53FD8, 0x3FDE81D4303BFA90, 0x06DE1DA715A8CDD1, 0x1155FA7316871F24, 0x22E9B1F481EF661E, 0x00000000F88220E5, 0x02AB278E59CC6994, 0x0208EAE90A6AAF5C, 0xF5D102CE88B15802, 0x02E79AEA65D40B57, 0xA4A77D1D710141A8, 0x1802F92E2BB733B6, 0x9835E16FBC75E419, 0x86A7089765D38A85, 0x000000027B78AF0F }, { 0x482C5B82A467340C, 0x1DE9D6596645D0C4, 0x80A4F7057FF0D163, 0xE69CF619F73C095E, 0xA67B0A91ECDD2BAA, 0xC593229F93B7CE27, 0x24BA224CCF4A9FFD, 0xFAA73F01AADEF474, 0x000000025B4B1318, 0x3668215E1FD517BA, 0x6BD1B14022DD84A7, 0x56FC22CB20E0CD8D, 0xC9974C3A74C0FF65, 0x66A1B4085E23692D, 0x99714EAAAF96835F, 0x258742274A16F060, 0x66068687E1E489DA, 0x00000002E991F66F },
+{ 0xBBFB057CA85DC612, 0xC7D3380E278B8D55, 0x1BB3D8C0EEBCF3BE, 0xFD6DD1E963BF717E, 0xAFE8FEEE6114B979, 0xE36B7F308116B44C, 0x35369B0253C92963, 0xF54CF08FF07D3725, 0x0000000061B361F8, 0x66CB25C850B58364, 0x34F157B5B2A7BBDF, 0x9D6C0E748C72B816, 0x9CA6A083D171F71D, 0x7F188E1162DEF02F, 0xA1CFAA11DF566F72, 0x9B5F4CB8700D7D10, 0x3558291C7E1BD51E, 0x0000000016038D1A }, { 0xC4AAEECFB8E1BC2C, 0xFDAD486C2B91E689, 0x6555C2A08CBA60DB, 0x6C268DCBB54C5ADD, 0xB1ECC1874201CF55, 0x4B0C914AF4BCA021, 0x05323CFB304580C1, 0xB962FA44A3EF65E2, 0x000000006E80155F, 0xB8C6FB39BB46D4D9, 0x58C77F90B6B1AE00, 0x8FB7820AABC486D2, 0x55538225C417250A, 0xCB407D58F85CB098, 0x51B8B7E3EA6ACA18, 0x535CBA4F7D4F3442, 0xF1E5362A4E5DA29A, 0x00000001FD0B7C4E },
+{ 0xC9E650D3CE617AFE, 0xAD61272DFB12FADB, 0xB5D1A0EC157C21A0, 0x0318F16CE1AFE40D, 0x7BDA44116FF77D1A, 0x22E6A530FF72D8B7, 0x500CFB9B2B2449EC, 0x0B9ECE2678D1A2A2, 0x00000001D997E991, 0x2885E14023E0BB6F, 0xD8BE424F67A7E754, 0xA047C2957CB9556B, 0x99CE2A00A69E4F4F, 0x1EC00C69B8ABAC78, 0xEDCD4674435E1FB0, 0xAE5334FA2F7A51FE, 0x23454FF6004FFD1E, 0x00000001DDCF9E4F }, { 0x8AFA62448D821ADA, 0x316D73D71B73025B, 0xB761B446ADB0F06E, 0x617BC66A1EDC2356, 0xA3AC2CBACC938622, 0xBA34492E630318BD, 0x6B219023F0F2E85E, 0xF5EE9B22E91FA6BA, 0x000000000C988CA9, 0xE98090DE3B20AFBA, 0xE843DE2194D1563D, 0x8EFD25C50B621E23, 0x7C38EBA575CCE5E0, 0xD2143B9F8E92FC4E, 0xC3C5F3C50BD4CA80, 0x9DE9B022531DD649, 0x2FE4DF101A2CB4EA, 0x000000003033E8BB },
+{ 0x60246BCD440CA644, 0x7A347E819B401A6A, 0x1A39562F55E28A03, 0xFD66D0893C3E2E20, 0x487E958C64E29DCD, 0x3B28BABC2D438206, 0x3DCF433C99171FC0, 0x3C8759D8152D2F77, 0x0000000148EF9F7A, 0xCEFB246146FDE8EF, 0x70F2373C0B308941, 0xE40169BD489C0460, 0xBB7E366F166058E5, 0x1D277C355E0856DF, 0xFF8958B6A7A4989C, 0xD5C099C7D0767960, 0x1E24A387A74FC381, 0x00000002D7B477DE }, { 0x1F6E6C4BBED435C3, 0xF470328BFCF52AFD, 0x3DA0459C0A0C9CB4, 0x3172B92D8F97DB63, 0x73F33AA21BF0641C, 0x66F6C10F5CE4CA69, 0xC91F4665EFB5586E, 0xC23FF3C633FEEA19, 0x00000002F0D9AFA0, 0x265071D1AE52FA2D, 0xE7EB0346B910B69A, 0xF69CEAC5C437CE1E, 0x8A4FFA723869AD20, 0xB722DD8A19F8F48A, 0x45CB2316527A0C9C, 0x1DCE2D1B8782302A, 0x38AF94D76C44FA21, 0x0000000188A606BB },
+{ 0xC0BCADD81DAEBF8B, 0xD3253455A77E17AF, 0x9D8B13A222BD89F9, 0xCBE6E432C8EC74F1, 0x0AB11A35C2D95CD3, 0xF4AADD0761AEBF7D, 0x87800B9AA0E73D48, 0xFD05926C670D1D64, 0x0000000220080F45, 0xD9BA07F6D57600A6, 0x5D06FC3790143FA0, 0xB03B8A47719B8CDA, 0x34457F2B17433E9F, 0xF21825598BCD9A35, 0xAD77BD205EFBF635, 0xCA2DEC60EE80D016, 0xD0AC1510523F01A8, 0x00000001D21B1F05 }, { 0x8D438DAF6A17E8DC, 0xF759BF7865C872AC, 0xFE430A0B8D1AB2A9, 0x836A47E3EF0982F6, 0x3416F6371A689AD2, 0x2C8BE969CE37E67E, 0x262E7B971D00D0B6, 0x1C1BD0F95A8AF109, 0x00000000B760470B, 0x3F60C729994F92FB, 0xDB0B63E0CCE05A14, 0xB05600BBEF12A6D1, 0x414EB49F30A0DD32, 0x7BA7CDB6E63B3862, 0xE79F38CAFA1257A2, 0x01920703BA372A73, 0x68A6B4DAF72EAD2A, 0x00000000A7AAA261 },
+{ 0x5EF631B908D9288D, 0x22AC85460CF14FA6, 0xF7C9875D94B1123F, 0x32F02296699A4016, 0x4F6DC698704E5629, 0xFC184038DC37DBA6, 0x824CF2A455BB44AC, 0xB29FA2673B3DAF09, 0x000000016F9928CC, 0xDEACC8AFADF0CC3E, 0x6549C9CFAF8574FF, 0x2289D4F44E97CA30, 0x5EC032B3E6D43550, 0x26A43989C0F9CD07, 0x6CCE2517FF297F7B, 0xF2041DE7110734BC, 0xFDEE82A42D4240DB, 0x00000000364F332C }, { 0x8ABE4396786315BD, 0x20B3570035FAB83F, 0xC0C72FF0E5E6D001, 0xDF4A85B9ED0B0071, 0x77C3F62ADF69D4FF, 0x7ACDBA7FDC5A7B68, 0x89C6631075E0E057, 0x285DDC5AFC2A89C6, 0x0000000008B56104, 0xC1D530CE6DF5FE1E, 0x0D98B34EA9DEBA66, 0x59AD50E4831D9C67, 0x0AEC9FD547688BDD, 0xAC02331AAA52220E, 0xDA3BF4B8043BEEC0, 0xBCB55E6EFD0560F1, 0x017ECF9DFD99ACD8, 0x000000011BA0B87D },
+{ 0x60A2EC4BF9BF58E1, 0x365E34CE00978E41, 0x588FA49CBE179622, 0x91954980A54ED8C2, 0x84635208D7A716C6, 0xC310599B14C736D9, 0xA4DB1683AD72B119, 0x2BD371958999BFD2, 0x00000001C50EAB46, 0x055AE2A6E8C3C563, 0x30F1415F277B46A5, 0xB7FFD46F1E7EBD63, 0xF27FDAAD874AF799, 0xCED730FCADCAF8C9, 0xDD35E0662BAD44F1, 0x33E300AB16D954E9, 0x387851296797961A, 0x000000028C263EFD }, { 0xBA15B1AF15713483, 0xE4C3535FA3B92FF8, 0xF84266DD730075CE, 0x1B302B778BD4FCEB, 0x1245CEA99B8FC762, 0x1269C74F411DCD04, 0x527EDB3108BD9BAD, 0x9A33EC6255D2B9B0, 0x00000001E4552C71, 0xF8F1D58334AD2847, 0xB805C6C272E278D2, 0xC16B2C95711563CE, 0x04F071E547BC6FB0, 0xE4D86E4F27733983, 0x0D6E1913345CCC2A, 0xCD1FD6EBAA2B48BD, 0xA81978AFF6645EE1, 0x00000001CFCF00C3 },
+{ 0x1230FBDEAB2B2EB3, 0x8BAEE153A83378A7, 0xEB7B34749697A26B, 0x4FC2EAF779AAD171, 0xE19AC6E41D413552, 0xF116F9F53E69743E, 0x693306102C42FC66, 0xC043F0E2230A537A, 0x000000015B9D1215, 0xD9A4857128FCAC8F, 0x21A124F0403BA244, 0x726EDABA80D2FA8D, 0xEEE7F9C23E479EF7, 0x6DBBBB9FF6840F31, 0x277FA42143204CA4, 0x2B9E7339888D0910, 0xA256D05895D2E99C, 0x00000002B15668E3 }, { 0x6BD2EBED9E363573, 0x4D5E074C096C1EDF, 0x6208DDE4CF33A3C5, 0xA16A189237C3BFE2, 0x17EEFCE6EBB3D4DD, 0x5483B01F98285CF2, 0xA328279F88310ED8, 0x690090913ABD1AE7, 0x00000000112D2804, 0xB36F01B540ADAC75, 0xF956E2086EC083C8, 0x9B6062EBA62DFAE1, 0x15E24EF45228022C, 0xCB7342B26B23AC24, 0xE6EEFA5A507AC0DC, 0x32E5904E2122B09E, 0x652419CF7953CC27, 0x00000000271D746E },
+{ 0x0C64303F585514E3, 0xC6737BDB447C9005, 0x3EA95A608EAB7FEC, 0x664C201880D346F3, 0xD13254A33B023746, 0xB7482566E2D2319D, 0xA60C612A49FF8099, 0xAF021E10E042A5E4, 0x000000012018E8D8, 0x74FC6E930AAD3B81, 0xF70C2ED29497C607, 0xEC8FE61B6EC5E334, 0x78171B02430A2267, 0xDABEF11817AC933C, 0x8109D803FBAA9B14, 0x78F957DA50D39D16, 0xA62CDCC08E3E6184, 0x0000000028142741 }, { 0x9D7C0C68420667C1, 0x68E29662C1400E15, 0xA7851E9315AD7D4A, 0xF1DA12E4C4955232, 0x5C43F4DF99925685, 0x791F834E8B94B4C6, 0x066A0745B3387208, 0x3F15F3EA1413D529, 0x000000000A02CD2D, 0x9F70C56C11ABFFC3, 0xFC130AE9DE66CCB1, 0x57E587AB4922D0A0, 0x3911349CA3FDB31B, 0xE32A688EFDEADF29, 0x9B2E1FF8013AE4B0, 0x805725B5634C423B, 0xB9EB31535A2FC321, 0x000000027505293D },
+{ 0x0F857E386F199473, 0x3759A4C8E1DE67A9, 0xFB82678183B063A6, 0x1295F81EBD7D55E5, 0x193DF02457BB1185, 0x770E06010CC121CE, 0x8AFAAF4FDDCBF894, 0xB37D6B6BE028516F, 0x0000000075B8796E, 0x3592CE603DE139A7, 0x07360B4CA21D9EAB, 0x36E213F6DB64A7CC, 0x095D4F2BA6FDD07E, 0xA52689797B206A7C, 0x38A21FDBD3ED0727, 0xDE53D9E85F5462D6, 0xAF5644A2A845EBDB, 0x0000000178594A33 }, { 0x7DEAC678DE567EB1, 0x72412216279AB5A6, 0x5473D987CEB4B90D, 0xDE0BE87862F23082, 0x04470A7C99524A85, 0x0450AA3BD884C8A9, 0x2DBA77FBFFC1DAAA, 0x8EC179569F9F7FA6, 0x0000000161E8F213, 0xF9E5BEB1B713253D, 0x378C0CA53ABBDA01, 0xB999AE4D1312062D, 0x9EDC2E5677960D4D, 0x767554B6B02316B2, 0x30FDFCDDDE472B14, 0x864EE116B9270976, 0x70038F879346719B, 0x00000000DC48DE2E },
+{ 0x30735FFB320990DA, 0x0A0F66F2B2D6A8CC, 0x0ADF91C050556CC1, 0xC5236037833509D2, 0xBC370896F73DB279, 0xD1422822E62BF9BB, 0xC5B1DCD77DCC85DB, 0xA27CC2768F44CCB7, 0x0000000264D1CD7B, 0x894483F0797C1834, 0x91EABC0DF05EA552, 0x1B2F66D72945313C, 0x8EDCB9C2387895EB, 0xDEC7AF526B8986FA, 0x41606CF4EE639294, 0x96986505BBE8BDB9, 0xB8A2F95339E4DD74, 0x000000018E569560 }, { 0x8EA9AA0F4D18C08B, 0x0AF03BCF5333AE86, 0x4C1471968D0E6569, 0xA5978B7EB5BFF970, 0x405772FB7A9F8894, 0xDB25B050633A6D15, 0x305CABC3CF4C712E, 0x411829FEA3660F2E, 0x000000002C8153B2, 0xAC83809E3274200E, 0xB49C61485003524D, 0x4325A0FAECC93199, 0x2DBA2DD5FB38FD2F, 0xD70100D90577EF8F, 0xBC9D183A78087564, 0x7A9D05A4B5E459C8, 0x65F7053E2E77C1D4, 0x00000002F3E585E3 },
+{ 0xFD89A6F32B504CF1, 0xCEBA305C485ABBEA, 0x0F8BECC1CB285D4D, 0xD778266CCA4AFFA1, 0x0A31A7A939D617D3, 0x1F3A2209BA15F29E, 0x86FFDD51E77A0276, 0x18CFEAE75B43E23A, 0x00000000C082DA69, 0x6A05D5CA4B9D4DBD, 0x34D776C424C3A04E, 0x05C1E2F5E307917C, 0x630A92656FAE61FD, 0xA5186D16234CEA17, 0x76524690FAB6504B, 0x648DF72089D28592, 0x87461BB31ED1F998, 0x000000020271A309 }, { 0xFD89A6F32B504CF1, 0xCEBA305C485ABBEA, 0x0F8BECC1CB285D4D, 0xD778266CCA4AFFA1, 0x0A31A7A939D617D3, 0x1F3A2209BA15F29E, 0x86FFDD51E77A0276, 0x18CFEAE75B43E23A, 0x00000000C082DA69, 0x6A05D5CA4B9D4DBD, 0x34D776C424C3A04E, 0x05C1E2F5E307917C, 0x630A92656FAE61FD, 0xA5186D16234CEA17, 0x76524690FAB6504B, 0x648DF72089D28592, 0x87461BB31ED1F998, 0x000000020271A309 },
+{ 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 }, { 0x59D92A0EC11FABB2, 0xAEFD3DF1D9A8BAFF, 0xFC0EC9B2420CBC7A, 0x06CFF2F2714B3201, 0x821047F878B7AA87, 0xFF6B0DF9672DB76D, 0x9818232CBBAA56EC, 0xE6053ED205681388, 0x00000002753859F0, 0xBACB03447344962D, 0x49F0BD93C67E0FC7, 0x01A4D62D72C9F92A, 0x611BB61624FADCFB, 0x1AB4B30E2EA98EA3, 0x8FE7895A869DB4CF, 0x089AB3C6C0DBF427, 0x2A108DCE036EFD94, 0x00000001D2DE42D2 },
+{ 0x5DF3FDCAA5F0BB25, 0xE64F5C158D638FDA, 0xF417F9CED55E8898, 0x0AE9324E737818AC, 0x7A11E5C8610BAEBA, 0x469D46C9644C5990, 0x1C80AF0653D9C7D3, 0x42C117B15D0B5AD3, 0x00000001B3C7CACE, 0x5167ABC0B6BBC2D6, 0x287F9F9D20BF5384, 0x52DBE8C57190EA49, 0xAF50FFF793CF8A52, 0xC45B0EFA33A90B63, 0x953C0CC834476051, 0x98E5699F18FAA7AA, 0x82AD238244A775A4, 0x000000028B68CD08 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0x7670850424E9A1C6, 0x4EEAF4AD80F7468C, 0x4C496B766FDCE559, 0x3082C8D96584ADE9, 0xBD1B6BB753177FBD, 0xA2F90672E7DE591C, 0x240EC2E774E3C466, 0xBBDEECF0F95BEEB0, 0x00000000C1DB12FE, 0x199741B94913444F, 0xCC8D73781DF331A5, 0xB59131FAB4C855A0, 0x712037A61EA4EE02, 0x911CF2F9B89F2E8B, 0x29D39B2C9CEB3F5C, 0x20C188A5C49E66E6, 0xD385B3E53039762A, 0x0000000206659D99 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+
+{ 0x268B9505AD0B4E7A, 0x3DB3E4B09AC344CC, 0xD45BA27BDC03387B, 0xFE98A3982B2201F2, 0xBA10373E737C3EBC, 0x54C1B1F6DACE3E20, 0xC87851805E9696EE, 0xB264451EC81FD332, 0x00000002AE205FF2, 0x3E96BCBB9F44ED7A, 0x922FE2BEA8F2E986, 0x6BAE02B2DC290A1E, 0xD23071F9D8990714, 0xB8FBCDD367A6C1D5, 0x85E1DCE0258C3476, 0x99F219C3A25910FA, 0xB7D748C0ABF5AB2C, 0x00000002B4AC6ECF }, { 0x0000000053A8B821, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0xAB9ED029DADE0000, 0x7FD34034A42F114D, 0x319FDC331E9125F5, 0xF1361EF3C5499C8A, 0x00000001393B6AF7, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0x43B3C77F86B88EB8, 0x828EC685D0BF8247, 0xA0676EA84C2AB43F, 0x02B24773C0A3E51B, 0x5AF8DC599B50C2BA, 0xA02EE6BBC58172BA, 0xDD467931B91A7098, 0xC6932A788DC370A8, 0x000000023C9A06F5, 0xDEEC77DF59C5A7B5, 0x33F855EC2464F1CB, 0x24FD97C6E29A29BE, 0xA89CE0C48CA74241, 0x01A0A187E51217A7, 0xAD61B7645DCA1952, 0x4E77A235A815C09E, 0x34836C1C76A7E915, 0x00000001515A396A }, { 0x9FF11D770F26505D, 0x5FB049D492B9565B, 0x351123BB8FDD79AB, 0xA000CAF362538AA8, 0xA7968349C1D5D69A, 0xFBA90D720DEB6592, 0x7F8858ED34C4B379, 0xC645570CF81FF20D, 0x00000002880B7101, 0x4719E05D49A37923, 0x41F754E34FD996FD, 0x97EF4C3990F849B0, 0xC3B2A1764BC433A4, 0x9CACBE9CCA9C3B45, 0xEF6686B4CBC073E5, 0xC1E7D0E8C0EF1EA1, 0xE03ED030F28D758B, 0x000000009E5660A6 },
+{ 0x6B8DAFDC8A9CEC6E, 0x59BA7972E926939E, 0x0D882426724D0F58, 0xB2E1FFFF56E717AD, 0xC6DE4AAF3BC17EAA, 0x07B788A2E716E743, 0x5A6921882DF2EE66, 0x1CFCCAFCD95FD8F5, 0x00000002E8778337, 0x77C76C0AF37B97C5, 0x0279C17761EE51AE, 0x83620754BD96CBE4, 0x1E0FE55C45072CB9, 0x893210AC9621B541, 0xDA87024E1F09DE89, 0x72D490F4BD28D877, 0xEDF873BD4B32714F, 0x00000000724C643D }, { 0xDC5E617B0ED8D854, 0x42F8195A882695B1, 0xFBAB7765D32823AD, 0x7631B4044717D7C2, 0xF23FAE838FB4FF76, 0xAA47E36EAD322811, 0x8CF22B5646BD375B, 0x3AC55AD28A1700CA, 0x000000001680AEEE, 0x7EFF397C8B3AFBFE, 0x5C66652789D85210, 0xDE11B056F81C533E, 0x06E90FD82D77BD13, 0x3476724140CF1287, 0x365F27DD8CEE2337, 0xAA58DF115D6D5A12, 0xA483B92ECA563E11, 0x00000002CE0E604B },
+{ 0x1CFC2B685CEB1938, 0x818CC56F50B95334, 0x8C2B46018232977A, 0xF2FCDB75298A98C1, 0x13D645C5F39FA804, 0xA027E2C483AA2A4B, 0x67B802C097188873, 0xDA635A232D3C813D, 0x00000000D7E8ACB1, 0x5D75A4DD15E0171D, 0x185712F987EF928A, 0xBA43167B0116E486, 0xA2C6DDC45A7AF67D, 0x78F9E6E072E750BF, 0x611EA598106EFB51, 0x485972C590EA0590, 0xD31C92045BBE2A13, 0x00000001E59C9E28 }, { 0x330463ABCC5FF748, 0x6E6EA454AAB688BE, 0x20AAF6DA712460D6, 0x74CE44D644D3C064, 0x9CB03344D5B16433, 0x8C34BE1ED2D1728C, 0x7052FB52961D4792, 0xBD51D8B38A428389, 0x00000000EFA4E28B, 0xDE1FC3B3C5F80B58, 0x39F7CFAAB1D77CF8, 0x7234B2E2AC060431, 0xA350E016B21BFA2D, 0x807ADCA1F2E991A2, 0xFFAAC72C46FABC5B, 0xB33FEFC9F69D6B6F, 0x110E08F21A524B09, 0x00000002B4583ACD },
+{ 0x7B59FCDB933348D0, 0x4E03F3AC54F5B304, 0x7BE7B78C54C122B9, 0xB17F09140DABCCA1, 0xBEC32C56B1A1C294, 0xB317F8F89E77683F, 0x9B4D5E6E17879E96, 0x5904C5513E37EAC5, 0x0000000087D72B78, 0x2FCA73E949AD6B58, 0x47A37529BDD43DF6, 0xCA7351F56526E01B, 0xD1CF91CA9055C0A6, 0xB5DD4797B69A92EE, 0xDB90A4E2A7C860AB, 0x3089B3B589BACD86, 0x62E89BF06E53D74A, 0x000000008FA4AF46 }, { 0x1898E4BAD8FA0430, 0xB3889F1B82F678E9, 0x40A674876C3E7333, 0x3D6D95835EF51EEF, 0x09825A4BB1AAE8BB, 0x112219C3348DA05E, 0x0022A16E2F24F4C4, 0xFF68CDF2D6D95ECF, 0x00000000D61597B9, 0x414D82151049C8F7, 0x86E44E890BCD2999, 0xFF582290EA8F6BBB, 0x1AA01345D11AFBA6, 0xA51024AD1EA86DFB, 0x1B0F2C6E9B8B460F, 0xFFB89E5EB5B77E4C, 0xB8558C732F1C45C1, 0x0000000198E44760 },
+{ 0xCACC54B574FAA8E3, 0xD7475616AC320701, 0x8AD6922663E7790F, 0x68349C967CA53FD8, 0x3FDE81D4303BFA90, 0x06DE1DA715A8CDD1, 0x1155FA7316871F24, 0x22E9B1F481EF661E, 0x00000000F88220E5, 0x02AB278E59CC6994, 0x0208EAE90A6AAF5C, 0xF5D102CE88B15802, 0x02E79AEA65D40B57, 0xA4A77D1D710141A8, 0x1802F92E2BB733B6, 0x9835E16FBC75E419, 0x86A7089765D38A85, 0x000000027B78AF0F }, { 0x482C5B82A467340C, 0x1DE9D6596645D0C4, 0x80A4F7057FF0D163, 0xE69CF619F73C095E, 0xA67B0A91ECDD2BAA, 0xC593229F93B7CE27, 0x24BA224CCF4A9FFD, 0xFAA73F01AADEF474, 0x000000025B4B1318, 0x3668215E1FD517BA, 0x6BD1B14022DD84A7, 0x56FC22CB20E0CD8D, 0xC9974C3A74C0FF65, 0x66A1B4085E23692D, 0x99714EAAAF96835F, 0x258742274A16F060, 0x66068687E1E489DA, 0x00000002E991F66F },
+{ 0xBBFB057CA85DC612, 0xC7D3380E278B8D55, 0x1BB3D8C0EEBCF3BE, 0xFD6DD1E963BF717E, 0xAFE8FEEE6114B979, 0xE36B7F308116B44C, 0x35369B0253C92963, 0xF54CF08FF07D3725, 0x0000000061B361F8, 0x66CB25C850B58364, 0x34F157B5B2A7BBDF, 0x9D6C0E748C72B816, 0x9CA6A083D171F71D, 0x7F188E1162DEF02F, 0xA1CFAA11DF566F72, 0x9B5F4CB8700D7D10, 0x3558291C7E1BD51E, 0x0000000016038D1A }, { 0xC4AAEECFB8E1BC2C, 0xFDAD486C2B91E689, 0x6555C2A08CBA60DB, 0x6C268DCBB54C5ADD, 0xB1ECC1874201CF55, 0x4B0C914AF4BCA021, 0x05323CFB304580C1, 0xB962FA44A3EF65E2, 0x000000006E80155F, 0xB8C6FB39BB46D4D9, 0x58C77F90B6B1AE00, 0x8FB7820AABC486D2, 0x55538225C417250A, 0xCB407D58F85CB098, 0x51B8B7E3EA6ACA18, 0x535CBA4F7D4F3442, 0xF1E5362A4E5DA29A, 0x00000001FD0B7C4E },
+{ 0xC9E650D3CE617AFE, 0xAD61272DFB12FADB, 0xB5D1A0EC157C21A0, 0x0318F16CE1AFE40D, 0x7BDA44116FF77D1A, 0x22E6A530FF72D8B7, 0x500CFB9B2B2449EC, 0x0B9ECE2678D1A2A2, 0x00000001D997E991, 0x2885E14023E0BB6F, 0xD8BE424F67A7E754, 0xA047C2957CB9556B, 0x99CE2A00A69E4F4F, 0x1EC00C69B8ABAC78, 0xEDCD4674435E1FB0, 0xAE5334FA2F7A51FE, 0x23454FF6004FFD1E, 0x00000001DDCF9E4F }, { 0x8AFA62448D821ADA, 0x316D73D71B73025B, 0xB761B446ADB0F06E, 0x617BC66A1EDC2356, 0xA3AC2CBACC938622, 0xBA34492E630318BD, 0x6B219023F0F2E85E, 0xF5EE9B22E91FA6BA, 0x000000000C988CA9, 0xE98090DE3B20AFBA, 0xE843DE2194D1563D, 0x8EFD25C50B621E23, 0x7C38EBA575CCE5E0, 0xD2143B9F8E92FC4E, 0xC3C5F3C50BD4CA80, 0x9DE9B022531DD649, 0x2FE4DF101A2CB4EA, 0x000000003033E8BB },
+{ 0x60246BCD440CA644, 0x7A347E819B401A6A, 0x1A39562F55E28A03, 0xFD66D0893C3E2E20, 0x487E958C64E29DCD, 0x3B28BABC2D438206, 0x3DCF433C99171FC0, 0x3C8759D8152D2F77, 0x0000000148EF9F7A, 0xCEFB246146FDE8EF, 0x70F2373C0B308941, 0xE40169BD489C0460, 0xBB7E366F166058E5, 0x1D277C355E0856DF, 0xFF8958B6A7A4989C, 0xD5C099C7D0767960, 0x1E24A387A74FC381, 0x00000002D7B477DE }, { 0x1F6E6C4BBED435C3, 0xF470328BFCF52AFD, 0x3DA0459C0A0C9CB4, 0x3172B92D8F97DB63, 0x73F33AA21BF0641C, 0x66F6C10F5CE4CA69, 0xC91F4665EFB5586E, 0xC23FF3C633FEEA19, 0x00000002F0D9AFA0, 0x265071D1AE52FA2D, 0xE7EB0346B910B69A, 0xF69CEAC5C437CE1E, 0x8A4FFA723869AD20, 0xB722DD8A19F8F48A, 0x45CB2316527A0C9C, 0x1DCE2D1B8782302A, 0x38AF94D76C44FA21, 0x0000000188A606BB },
+{ 0xC0BCADD81DAEBF8B, 0xD3253455A77E17AF, 0x9D8B13A222BD89F9, 0xCBE6E432C8EC74F1, 0x0AB11A35C2D95CD3, 0xF4AADD0761AEBF7D, 0x87800B9AA0E73D48, 0xFD05926C670D1D64, 0x0000000220080F45, 0xD9BA07F6D57600A6, 0x5D06FC3790143FA0, 0xB03B8A47719B8CDA, 0x34457F2B17433E9F, 0xF21825598BCD9A35, 0xAD77BD205EFBF635, 0xCA2DEC60EE80D016, 0xD0AC1510523F01A8, 0x00000001D21B1F05 }, { 0x8D438DAF6A17E8DC, 0xF759BF7865C872AC, 0xFE430A0B8D1AB2A9, 0x836A47E3EF0982F6, 0x3416F6371A689AD2, 0x2C8BE969CE37E67E, 0x262E7B971D00D0B6, 0x1C1BD0F95A8AF109, 0x00000000B760470B, 0x3F60C729994F92FB, 0xDB0B63E0CCE05A14, 0xB05600BBEF12A6D1, 0x414EB49F30A0DD32, 0x7BA7CDB6E63B3862, 0xE79F38CAFA1257A2, 0x01920703BA372A73, 0x68A6B4DAF72EAD2A, 0x00000000A7AAA261 },
+{ 0x5EF631B908D9288D, 0x22AC85460CF14FA6, 0xF7C9875D94B1123F, 0x32F02296699A4016, 0x4F6DC698704E5629, 0xFC184038DC37DBA6, 0x824CF2A455BB44AC, 0xB29FA2673B3DAF09, 0x000000016F9928CC, 0xDEACC8AFADF0CC3E, 0x6549C9CFAF8574FF, 0x2289D4F44E97CA30, 0x5EC032B3E6D43550, 0x26A43989C0F9CD07, 0x6CCE2517FF297F7B, 0xF2041DE7110734BC, 0xFDEE82A42D4240DB, 0x00000000364F332C }, { 0x8ABE4396786315BD, 0x20B3570035FAB83F, 0xC0C72FF0E5E6D001, 0xDF4A85B9ED0B0071, 0x77C3F62ADF69D4FF, 0x7ACDBA7FDC5A7B68, 0x89C6631075E0E057, 0x285DDC5AFC2A89C6, 0x0000000008B56104, 0xC1D530CE6DF5FE1E, 0x0D98B34EA9DEBA66, 0x59AD50E4831D9C67, 0x0AEC9FD547688BDD, 0xAC02331AAA52220E, 0xDA3BF4B8043BEEC0, 0xBCB55E6EFD0560F1, 0x017ECF9DFD99ACD8, 0x000000011BA0B87D },
+{ 0x60A2EC4BF9BF58E1, 0x365E34CE00978E41, 0x588FA49CBE179622, 0x91954980A54ED8C2, 0x84635208D7A716C6, 0xC310599B14C736D9, 0xA4DB1683AD72B119, 0x2BD371958999BFD2, 0x00000001C50EAB46, 0x055AE2A6E8C3C563, 0x30F1415F277B46A5, 0xB7FFD46F1E7EBD63, 0xF27FDAAD874AF799, 0xCED730FCADCAF8C9, 0xDD35E0662BAD44F1, 0x33E300AB16D954E9, 0x387851296797961A, 0x000000028C263EFD }, { 0xBA15B1AF15713483, 0xE4C3535FA3B92FF8, 0xF84266DD730075CE, 0x1B302B778BD4FCEB, 0x1245CEA99B8FC762, 0x1269C74F411DCD04, 0x527EDB3108BD9BAD, 0x9A33EC6255D2B9B0, 0x00000001E4552C71, 0xF8F1D58334AD2847, 0xB805C6C272E278D2, 0xC16B2C95711563CE, 0x04F071E547BC6FB0, 0xE4D86E4F27733983, 0x0D6E1913345CCC2A, 0xCD1FD6EBAA2B48BD, 0xA81978AFF6645EE1, 0x00000001CFCF00C3 },
+{ 0x1230FBDEAB2B2EB3, 0x8BAEE153A83378A7, 0xEB7B34749697A26B, 0x4FC2EAF779AAD171, 0xE19AC6E41D413552, 0xF116F9F53E69743E, 0x693306102C42FC66, 0xC043F0E2230A537A, 0x000000015B9D1215, 0xD9A4857128FCAC8F, 0x21A124F0403BA244, 0x726EDABA80D2FA8D, 0xEEE7F9C23E479EF7, 0x6DBBBB9FF6840F31, 0x277FA42143204CA4, 0x2B9E7339888D0910, 0xA256D05895D2E99C, 0x00000002B15668E3 }, { 0x6BD2EBED9E363573, 0x4D5E074C096C1EDF, 0x6208DDE4CF33A3C5, 0xA16A189237C3BFE2, 0x17EEFCE6EBB3D4DD, 0x5483B01F98285CF2, 0xA328279F88310ED8, 0x690090913ABD1AE7, 0x00000000112D2804, 0xB36F01B540ADAC75, 0xF956E2086EC083C8, 0x9B6062EBA62DFAE1, 0x15E24EF45228022C, 0xCB7342B26B23AC24, 0xE6EEFA5A507AC0DC, 0x32E5904E2122B09E, 0x652419CF7953CC27, 0x00000000271D746E },
+{ 0x0C64303F585514E3, 0xC6737BDB447C9005, 0x3EA95A608EAB7FEC, 0x664C201880D346F3, 0xD13254A33B023746, 0xB7482566E2D2319D, 0xA60C612A49FF8099, 0xAF021E10E042A5E4, 0x000000012018E8D8, 0x74FC6E930AAD3B81, 0xF70C2ED29497C607, 0xEC8FE61B6EC5E334, 0x78171B02430A2267, 0xDABEF11817AC933C, 0x8109D803FBAA9B14, 0x78F957DA50D39D16, 0xA62CDCC08E3E6184, 0x0000000028142741 }, { 0x9D7C0C68420667C1, 0x68E29662C1400E15, 0xA7851E9315AD7D4A, 0xF1DA12E4C4955232, 0x5C43F4DF99925685, 0x791F834E8B94B4C6, 0x066A0745B3387208, 0x3F15F3EA1413D529, 0x000000000A02CD2D, 0x9F70C56C11ABFFC3, 0xFC130AE9DE66CCB1, 0x57E587AB4922D0A0, 0x3911349CA3FDB31B, 0xE32A688EFDEADF29, 0x9B2E1FF8013AE4B0, 0x805725B5634C423B, 0xB9EB31535A2FC321, 0x000000027505293D },
+{ 0x0F857E386F199473, 0x3759A4C8E1DE67A9, 0xFB82678183B063A6, 0x1295F81EBD7D55E5, 0x193DF02457BB1185, 0x770E06010CC121CE, 0x8AFAAF4FDDCBF894, 0xB37D6B6BE028516F, 0x0000000075B8796E, 0x3592CE603DE139A7, 0x07360B4CA21D9EAB, 0x36E213F6DB64A7CC, 0x095D4F2BA6FDD07E, 0xA52689797B206A7C, 0x38A21FDBD3ED0727, 0xDE53D9E85F5462D6, 0xAF5644A2A845EBDB, 0x0000000178594A33 }, { 0x7DEAC678DE567EB1, 0x72412216279AB5A6, 0x5473D987CEB4B90D, 0xDE0BE87862F23082, 0x04470A7C99524A85, 0x0450AA3BD884C8A9, 0x2DBA77FBFFC1DAAA, 0x8EC179569F9F7FA6, 0x0000000161E8F213, 0xF9E5BEB1B713253D, 0x378C0CA53ABBDA01, 0xB999AE4D1312062D, 0x9EDC2E5677960D4D, 0x767554B6B02316B2, 0x30FDFCDDDE472B14, 0x864EE116B9270976, 0x70038F879346719B, 0x00000000DC48DE2E },
+{ 0x30735FFB320990DA, 0x0A0F66F2B2D6A8CC, 0x0ADF91C050556CC1, 0xC5236037833509D2, 0xBC370896F73DB279, 0xD1422822E62BF9BB, 0xC5B1DCD77DCC85DB, 0xA27CC2768F44CCB7, 0x0000000264D1CD7B, 0x894483F0797C1834, 0x91EABC0DF05EA552, 0x1B2F66D72945313C, 0x8EDCB9C2387895EB, 0xDEC7AF526B8986FA, 0x41606CF4EE639294, 0x96986505BBE8BDB9, 0xB8A2F95339E4DD74, 0x000000018E569560 }, { 0x8EA9AA0F4D18C08B, 0x0AF03BCF5333AE86, 0x4C1471968D0E6569, 0xA5978B7EB5BFF970, 0x405772FB7A9F8894, 0xDB25B050633A6D15, 0x305CABC3CF4C712E, 0x411829FEA3660F2E, 0x000000002C8153B2, 0xAC83809E3274200E, 0xB49C61485003524D, 0x4325A0FAECC93199, 0x2DBA2DD5FB38FD2F, 0xD70100D90577EF8F, 0xBC9D183A78087564, 0x7A9D05A4B5E459C8, 0x65F7053E2E77C1D4, 0x00000002F3E585E3 },
+{ 0xFD89A6F32B504CF1, 0xCEBA305C485ABBEA, 0x0F8BECC1CB285D4D, 0xD778266CCA4AFFA1, 0x0A31A7A939D617D3, 0x1F3A2209BA15F29E, 0x86FFDD51E77A0276, 0x18CFEAE75B43E23A, 0x00000000C082DA69, 0x6A05D5CA4B9D4DBD, 0x34D776C424C3A04E, 0x05C1E2F5E307917C, 0x630A92656FAE61FD, 0xA5186D16234CEA17, 0x76524690FAB6504B, 0x648DF72089D28592, 0x87461BB31ED1F998, 0x000000020271A309 }, { 0xFD89A6F32B504CF1, 0xCEBA305C485ABBEA, 0x0F8BECC1CB285D4D, 0xD778266CCA4AFFA1, 0x0A31A7A939D617D3, 0x1F3A2209BA15F29E, 0x86FFDD51E77A0276, 0x18CFEAE75B43E23A, 0x00000000C082DA69, 0x6A05D5CA4B9D4DBD, 0x34D776C424C3A04E, 0x05C1E2F5E307917C, 0x630A92656FAE61FD, 0xA5186D16234CEA17, 0x76524690FAB6504B, 0x648DF72089D28592, 0x87461BB31ED1F998, 0x000000020271A309 },
+{ 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 }, { 0x59D92A0EC11FABB2, 0xAEFD3DF1D9A8BAFF, 0xFC0EC9B2420CBC7A, 0x06CFF2F2714B3201, 0x821047F878B7AA87, 0xFF6B0DF9672DB76D, 0x9818232CBBAA56EC, 0xE6053ED205681388, 0x00000002753859F0, 0xBACB03447344962D, 0x49F0BD93C67E0FC7, 0x01A4D62D72C9F92A, 0x611BB61624FADCFB, 0x1AB4B30E2EA98EA3, 0x8FE7895A869DB4CF, 0x089AB3C6C0DBF427, 0x2A108DCE036EFD94, 0x00000001D2DE42D2 },
+{ 0x5DF3FDCAA5F0BB25, 0xE64F5C158D638FDA, 0xF417F9CED55E8898, 0x0AE9324E737818AC, 0x7A11E5C8610BAEBA, 0x469D46C9644C5990, 0x1C80AF0653D9C7D3, 0x42C117B15D0B5AD3, 0x00000001B3C7CACE, 0x5167ABC0B6BBC2D6, 0x287F9F9D20BF5384, 0x52DBE8C57190EA49, 0xAF50FFF793CF8A52, 0xC45B0EFA33A90B63, 0x953C0CC834476051, 0x98E5699F18FAA7AA, 0x82AD238244A775A4, 0x000000028B68CD08 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0x7670850424E9A1C6, 0x4EEAF4AD80F7468C, 0x4C496B766FDCE559, 0x3082C8D96584ADE9, 0xBD1B6BB753177FBD, 0xA2F90672E7DE591C, 0x240EC2E774E3C466, 0xBBDEECF0F95BEEB0, 0x00000000C1DB12FE, 0x199741B94913444F, 0xCC8D73781DF331A5, 0xB59131FAB4C855A0, 0x712037A61EA4EE02, 0x911CF2F9B89F2E8B, 0x29D39B2C9CEB3F5C, 0x20C188A5C49E66E6, 0xD385B3E53039762A, 0x0000000206659D99 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+};
+const f2elm_t64 DBL_TABLE_EE[2*(NBITS_STATE+1)] = { // A point per row represented in (X:Z) coordinates
+{ 0x7D9E156FEDB50FD5, 0x8F07EDBA3209EC45, 0xE525EA3CF7C6DDEF, 0x920414CED857CCF9, 0xEED5A72FC135ADEB, 0x772B375295AB887D, 0x7E4DE808530C1136, 0xC6A9EC8820CA9433, 0x000000011B38A79B, 0x3FA591695E1D934C, 0x65C47C6CB80EA16A, 0x2F35F72770C53F6E, 0x91AF350595CA3554, 0xE20660BE8496E5BD, 0xBB6532999D8984DA, 0xC83D4B4A03B9F803, 0x7D1BF354759F6C82, 0x00000001F8220542 }, { 0x0000000053A8B821, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0xAB9ED029DADE0000, 0x7FD34034A42F114D, 0x319FDC331E9125F5, 0xF1361EF3C5499C8A, 0x00000001393B6AF7, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0x30C9064795513C1F, 0x6D7044AB7D260819, 0x6C946333BF5FEC22, 0x3741A0C25106A5D9, 0x35B93FEF02CB3389, 0xD11774A22B26BFC4, 0x5150EE48E944B5E4, 0xD90B446BA75B1305, 0x000000012F523A40, 0x89F8E475CC4C6114, 0x88C720401F2F6C24, 0x4CC9B50C4345F98B, 0xD217A6511E862D77, 0xB3E5AF45F54B9DFC, 0x13384B42A363B9FE, 0xB8099B2F498155EB, 0x035AF9E2176F7AF3, 0x0000000150FA2377 }, { 0x938A28EB09B6EBB4, 0xCC1FF851D1CECBD8, 0x098114F2607A029E, 0x5646234E40790013, 0xFAA63100BEA6DC82, 0x7CA424B01CBD2493, 0x8A3090E67CEF1564, 0x889DF69E88177594, 0x00000003015B9BA5, 0x66BB35064EFA5281, 0x3D771D2A701D190C, 0x8ECFD2076C6A2169, 0x50B150BC33946A5F, 0x81509628BB3E69B1, 0xA7EAEC603FD3710D, 0xF245888E8885D936, 0x6AB278124606A80B, 0x00000001652B0C44 },
+{ 0x2C7E236558F615B3, 0x5B78FC958C46BFFB, 0xCEEBF6FA466208D5, 0x4AC3108D9A8EB110, 0x7C7F4E4123AC4334, 0x727C45D17FF29955, 0x19B276971C37460B, 0xC50ACDC3AE227469, 0x000000014E01343A, 0xE372934E02126B8D, 0xBBB8B0F91C669C15, 0xE1C45F2218EB7618, 0xEAFB866F2EE2856E, 0x892B08A49B930D85, 0x9CE23F1194170A18, 0x333E7A5CE911A5E2, 0xA2ECC795C93CAC91, 0x00000001D1778C2B }, { 0x03EB6CDF4E7427F4, 0xE66626D88C23D5EB, 0x86A0822BFB7C77F4, 0x951F88D1C6FE69E9, 0x8838A1A243B6FA66, 0xB7E11E0818EF6253, 0xA2F6A25B46141404, 0xD62D349D416A7783, 0x00000002408A62FA, 0xB65F639394F479A5, 0x4BCE2887D4EBFB3B, 0x36B2B84967AC5CC8, 0x52A2486F5B0E3749, 0x27ABC19EAD22673F, 0xD65EB361709F27B0, 0xFF2ACD31F9F2013D, 0xB3BF1CBF4833DA8C, 0x00000003052FEC5D },
+{ 0x4BDB7D69A932E941, 0xF1B55AC63C9A0869, 0x4302B7E116D00259, 0x262598BDFB665637, 0xF426B2A67C681DB9, 0x6B05AF83AB10E89A, 0xFC4996A937520D96, 0xDCF23452B078C3A3, 0x000000017B5E636A, 0x68FF5A081CF5F7BD, 0x7F3F36885941B227, 0x04E39F30EDA98E1E, 0x4C65A3B22EB6B5A3, 0xE282BD35DB44E7AF, 0x038B2D9186CFA593, 0x1596DAC5804612DB, 0x5E19857617E4F094, 0x00000001CA9992B5 }, { 0x69848DF0A9A66219, 0xE8088385E4A52D67, 0xEFFAE6B4AB41F670, 0x0829D16C7C06225D, 0xCE95FDF0FEE91E43, 0x679C45231C2ACD8D, 0xE1F446AA53060151, 0x87574204A5449E72, 0x00000002D74E8B87, 0x0D177329077E7D09, 0x4D9A914CCEDCA63B, 0x1F7DB362F6F2D704, 0x2345F6CF1BE7B941, 0xA97015815B412F36, 0x0C48AD28912E54E1, 0xDAD7B69982EBB9C1, 0x8AA8E323806CB234, 0x000000030254FD90 },
+{ 0x07DF4E8033903F4F, 0xF0071C81EA335321, 0x0117543EF0917E62, 0x212FC911B285E3B2, 0x342C158A0DCFD073, 0xC8A1F80A311CCEE0, 0x8A4A92BDC3DC9FB7, 0xBEE825992D024600, 0x00000000F86C8FAB, 0x1D0A8D1CA40A2D6B, 0x00C173302966F54A, 0xBCF426316FBEB230, 0x07460516E3896B51, 0x4297533A471D52BB, 0x78FD594CD69279B5, 0x86BA1B2D99645E5E, 0x5F9138F94A8B9E96, 0x000000016E519045 }, { 0x59B3F8E571AEC210, 0x363454B1EFA4D06C, 0x577678D2C87A2B58, 0x85FCA160CB2BC2C7, 0xAAFCD440C5E14D37, 0xB9F42290B61F8A0B, 0x1FD7FBDE2887D343, 0x29D6DE3C045B8702, 0x000000015302EE2F, 0xB685B8E8DE1358E7, 0x01D23A8AFFC0D82B, 0x69C9D01EE9E4E0F2, 0xBF0EBE3060D92CA1, 0x2C3D2F853474133C, 0x4EFB7669D835ED6C, 0x00CDF5FF820EF54B, 0x50766825E91658B2, 0x00000001A4A273F5 },
+{ 0x00969781EA4AE5A7, 0x243BA3603CACB419, 0x5C32620D668367D3, 0x2E693F7B2F71074B, 0xB4A4C529A242D366, 0xA5FB5B6C5FF1571D, 0x18CAFDD37B216326, 0xDD9ADFAECCB44884, 0x00000002E83458A8, 0x76043ED829E63F9A, 0xEA9ED1CC5EA60669, 0xAB87DD3F686ABA40, 0x649C7A6338C76C55, 0x0ED03B9E0C416B26, 0xB730707AD86A74EA, 0x52A58515D8057065, 0x38A4D9EA3DBF7435, 0x00000002E755E64C }, { 0x629092A55FD6E0EC, 0x6C39638B48B315E7, 0xC17DA5D406A59C7E, 0xA4A8F7EEB521A66A, 0x7E955ECB1A8CD27F, 0x9BF5D8F8F44B497E, 0x62E900F90B146B49, 0xB8ECB2E939CDF5B5, 0x000000024281F3B6, 0x17D34F2D7AFD09A6, 0xC464BD41A97EEF58, 0xFAD69E997C14ECDA, 0x6AEE871B8092666B, 0x6761B64149114545, 0x0477EFF352347F64, 0x1819FE8C47173FD5, 0x58489E9B0467D606, 0x000000005D06C05D },
+{ 0x716A3580BC06D2C4, 0x5841E3575CED1910, 0x71CB8CF7FAD3A350, 0x8CC3438837F0828A, 0x2E8C8A7F8BF2F30B, 0xDB77201E0C2A51DF, 0xA7622D00133965F4, 0xD08B6CCC2A75EE3D, 0x0000000249380FD7, 0xE7457484F3C75F9C, 0x9F38E58686694B69, 0x7D3238E9E379CC9B, 0xC8ABB83793597C90, 0x31AA507BC8715573, 0x8E24A8A93DA47919, 0x5F2A0E0A626A23B3, 0xB4A98C05E7876899, 0x00000000E7820E0C }, { 0x6328C16E2B3F0F82, 0x4E0B2E08D0A8EE9E, 0x9F6C3A2A643619A1, 0x7F6EE8293918216F, 0x1D8BD613010EFD70, 0x5BAE95F0ADB12E34, 0x65C3B1C9796C04CA, 0x15945DE09D2AAC73, 0x000000022B873150, 0x87579669EC177F2E, 0xB3056E5F7E4F3F67, 0xA9121C2706DB944A, 0xA2EFDC22A53396BF, 0xA126EBB16C7C277E, 0x079EE2D6B61945F5, 0xFB0DF6DA22FC8A55, 0xBD16216799BC0B12, 0x00000002540B2EFF },
+{ 0x711237B6E4E2BB2C, 0x93C2BC74206697D1, 0xF717CD286D9AE23A, 0x20A4AC81C09C13C5, 0x0FF0D7FC90AA651F, 0x2FB54C939FD87DCF, 0x736FC10554A00DBD, 0x65B4EAC8C6684080, 0x000000026E4CDCF0, 0xAA61C5E45FF933BC, 0x3328276B0F198C97, 0x879BF8CD2B6E3CF1, 0x07EDF2E0F3E393C1, 0x6C6DC7992E3AB9F2, 0x4E27C055330BF2D2, 0x266D0F185DABB671, 0x182DF50A8D182538, 0x00000000C9A51BAF }, { 0xD6970D8910B44420, 0x78E5E925F4DD29E0, 0xFC4AACB89F271B5A, 0xEC7AA311DB688959, 0xD604F706DE1202A9, 0x85442B8A1616436B, 0x40004FA587D83F10, 0x676EBAADD773CAF0, 0x00000000C97AC08C, 0xD0747DCA43AD8A07, 0x6C2D221B559C9492, 0x4E45E9F8E570DBB9, 0x439E4B1DA97197AA, 0x7CA3D7E040945DB4, 0xA567BC03A9434949, 0xB8BDAB55E21FB697, 0xD3ACF79D7A9BE04B, 0x0000000308C4DA52 },
+{ 0xF8726AF06CC6C5C2, 0x4F622E16F1108422, 0x31429B206FD28452, 0xA11E9C0826B96C2A, 0x82269554E504E461, 0xA317C229260BF51D, 0x940CFC686165321D, 0x0C2F82C61DA77492, 0x0000000287504873, 0x33F46C16A7219A93, 0xBDEEC7625245B932, 0x447CF62A1B579772, 0x4F83FC3270D1C46A, 0x0F2E35E403D92949, 0x51E529A2B3ED1E43, 0x9D9BFA3D3C30C547, 0x955F23B8C15A7438, 0x000000030564833C }, { 0xB55AB50702024692, 0x60FAC5435F2E150E, 0xB51DFA631407EE20, 0x6054C92C0F70B0CE, 0x8845E62ACFB1268E, 0x08B4083184F1A8A5, 0x89761D445B6E8D29, 0x3576AB8865E32424, 0x000000003D205BA9, 0x2D45F4526ED63357, 0x591C6B20AD00F104, 0xCC6E5EB78009A514, 0x91884D5E48081BDE, 0x2415191C8E022A31, 0x2293F2FDC6F963F3, 0x6B512223B0EF4F0C, 0xC1CDC3A891A0544F, 0x00000000BF59F817 },
+{ 0x9EDB931976AEE022, 0xBFEE7DC889D1F528, 0x9F398DAF9A8233DC, 0xFBEEDCBBDB7949C9, 0x95D711CFA608F808, 0x3AEA94761EC4CCA7, 0x9F8DAAD78A20C648, 0x3BB357CEABFBD88F, 0x000000030CAB0D05, 0x33CEDDE798EF93C0, 0xBBD4103FC465E5E7, 0xAB061E9177A8B146, 0x60A6EAD3DAC97345, 0x0C3AD220718ABAD2, 0x4864B3B241922A9B, 0x1615D460A7EA7E3B, 0x86475001C649D524, 0x0000000157FB0937 }, { 0x1F459DD4C548CB51, 0x7BCD28E60F71A681, 0xF66325FFE5E40CA1, 0x5205A4560DFB6C60, 0x52AB0F694FB374CB, 0xF099C334DBE170F4, 0x0F08A0F430B7CB5A, 0x50A3FB8158F363A1, 0x00000002DA2A26EE, 0x44F5F73FA25141E2, 0xA0EF4E0845773960, 0x942F294858DC4712, 0x2F9E02B302430D60, 0x727D91FA58F26036, 0x59F2927A555595ED, 0xB213648CA6AA913A, 0x080A5A3A0BD70C36, 0x000000019B8CA5A4 },
+{ 0x577F677DA962244B, 0x4EFCC19953F3D2B9, 0xC6807C9146076A1C, 0xE5D9D6FE4626733F, 0x88005136B85B103C, 0x4E5403D212836683, 0x9A71A2C5F6310359, 0x0C16E950E9391940, 0x000000013E2C73B0, 0xF8684877A4175CEE, 0x5437179A897F6326, 0xE0CFBD8C752395A3, 0x86DE401715BF4E67, 0x1488382C4C66269C, 0xD24F8C94A23CF43C, 0x5256119C36EBD0C2, 0x82CF6BADEEC1F8D4, 0x000000029E14E984 }, { 0xA5B343B6E6305BA3, 0xE473591A928DCD5C, 0x42E6F4166DFB7A68, 0xB219BC361BCF2F1B, 0x3E8D0801894BCA74, 0xFF41FDB06FCE9BA2, 0x280015A9335F22E2, 0xF7FB278B7F3C4FC2, 0x0000000168EAB66A, 0xF840FEF31263C62C, 0x384BB6E4419435CF, 0x2471FC57D5E943CF, 0x211C7A0DD42CC8DB, 0x2437A36246AC4F93, 0x34293220D0378AE3, 0xDC6F65603E8A7C84, 0xA3C4059B0E6A5BA7, 0x0000000078ABE87E },
+{ 0x1B469AF11D01F8B1, 0x3F8874806B2AC53F, 0x654D04C080E3A73E, 0xD52CCC28E536E576, 0xD4B0B03C29A953FA, 0xC9D6422C938D2728, 0x36923ADCEFB0DC02, 0x30845690C7A958B8, 0x0000000224F75EAF, 0x050EAED3612C888F, 0x5A37123A962809F9, 0x63B2C7EFCCA5E7E3, 0x1835881E5D4E2186, 0xC31A2434FA047C9C, 0x8106B9038A2172ED, 0x37EFD9B318941A64, 0xE8DC4D2604A522B4, 0x00000002E93F7D03 }, { 0x301F3238DD67FC90, 0xBBB70FE5D8B406D4, 0x38011406E6D07BDB, 0x22B781C8DE34062E, 0xE0F7935D1D51799A, 0xBB14336610708408, 0x9D8D86559AC04810, 0xC4973FC9E5B26EA1, 0x00000000624171ED, 0x8640F59221D9C31B, 0x563B3A9B38A67CB3, 0x7D87412B2F771FFA, 0x284D4A56D39E345E, 0x536E95286D542E74, 0x23430EFC53CCB662, 0x772B1B65BED73CE4, 0x3BCFF71DF09C6C3E, 0x00000000FF0E5A9F },
+{ 0xC83E9442B8BDC73E, 0x7632172874554CE8, 0xB45088EB06383A17, 0x284927D09A046C15, 0xBA655F7EFAD81A56, 0x6A1335447874E8C3, 0x94F03231BB46BB4E, 0xDFDB70AF021A3600, 0x000000008927EDA6, 0x5F7893794F6D0838, 0xBE62CDFB50D2883C, 0x41AAB8DF84FB7EE7, 0x3304C8A634D74BD4, 0xB87C997C00A4DC49, 0xC901A61FE406D502, 0x5C60E993A6885C85, 0xDB73DA1343119F65, 0x00000002A9D6D4FE }, { 0xC9A4621913AF9662, 0x9C4295C4791CF174, 0x3C2D0738CF6C00FB, 0x613D25F8ECBC19E2, 0x6DA612184BA61E4F, 0x534EFEC8838C5B02, 0x3A2B94FA6D17D6BE, 0x84F13EC11BCFC8AE, 0x00000002FB17B35D, 0x3600FB0672025A99, 0x97607C94EF3B1CEA, 0x28B59CBD352B86C3, 0x23471892FCBA1338, 0x426D4394F18AD07E, 0x0250CA714B20FCD0, 0x7648CC60DE340FD7, 0xAC2A43A9F0BF9EEB, 0x00000001508B8C61 },
+{ 0xBE94B38AEB3592BE, 0x31F64D60C3C2AE36, 0x1A3210A1030EC54C, 0x13294E7108E0CCA1, 0xADC5E126F4EA27A9, 0x4BE4D236C6DCD8AE, 0x5E4100E80C5079D3, 0x5EDCC05817915595, 0x000000023D947C0C, 0x5A23C0BF3152CB7C, 0xA0464273DE2E00B7, 0xBCB7A00AEC16DF4C, 0x2D7584C7303F12EE, 0xDACA08D79C4AEB2B, 0xE523FA3FA8AB3D96, 0xC4A30242D2B3160F, 0x81623308E83427D9, 0x00000000333DC9F5 }, { 0x1E857BF31232F293, 0xC17A0B1EFCFCE8BA, 0x419460497B30D696, 0x9A9CFE3381877C5C, 0x730B182E15E5054B, 0x9025697DDC16D47E, 0xC50D00689FB89959, 0xA5AD7BD270794777, 0x000000016B04CEA4, 0xBFE26B58F864F23B, 0x3CA9ACB3E0602275, 0x288150E9B1061C58, 0xD9C5A060B98B5108, 0xB9518F708E06D309, 0xFCB0B9D12652E869, 0x25C9663B3EBA6173, 0x84559986A89D3049, 0x00000000BD4DA22C },
+{ 0xB3B68CE8CF09A95B, 0x2535F9A2BB741C05, 0xDE62229CCF8CFD3E, 0xAC53F806B6CCAC00, 0x341326B6589B35AE, 0x4899D7D350DEFE49, 0xA2132CE0E84764CC, 0xF3916B59C11E9D1A, 0x00000001E1F8D044, 0x87B5206EF60BC370, 0xC3F38D72765431B7, 0x08B2830330A02CF2, 0x59CB5F69F51171C9, 0x041AF027EA1D8943, 0xE987255622F75C16, 0xA311E65ABB3F7AC8, 0x562A9D2251E264DD, 0x0000000147C0E48D }, { 0x11CF5F0DBFBEB33D, 0x4D3AE628152F0511, 0x09024A2E35F57A70, 0x5EC2393993F9DDC0, 0xA2E002C901D1E809, 0x2D1E5310D1050E37, 0x7CC452B5EBE45833, 0xC251A511DD89ADA2, 0x000000016DF42F9A, 0x8C35F0F966D146E8, 0xD9D26E20316DFD9A, 0xAA78D8C6AB206517, 0x8C1BF1DF949E081C, 0x399EE2BFB701B20D, 0xA5FEBE8F30EDF2C8, 0xF76EEF26E12A0210, 0x314395DC9764FBE9, 0x000000018452A156 },
+{ 0x14E506B50211AA32, 0x540AA987099F9825, 0xFE5DA6A28955C4F7, 0x0576C7007E5F3AA6, 0x417698731BD2A78B, 0x733E35B40B565A18, 0xE26010D6CEFCAC4B, 0x3295AA796A4E5E1C, 0x000000018C41A47F, 0xA62518D39852EE5B, 0x5236A5A352FDB72F, 0x336ABA7A533B1932, 0xE5D6824427E8AAAB, 0x178D07DD22C031CE, 0x4EA1FCC328A0BCD5, 0x869A9C81B44BF23B, 0x9D3CDDAEF49ABCED, 0x00000000B250E55B }, { 0x5879AAA3658A1A80, 0x08E2C8AAE33A5729, 0x6DC722EAD63278A6, 0xE94C67179355BF18, 0xA05AE3A376656F62, 0xEE070BC2A9415DC7, 0x041A22BA9619FF39, 0x42C10BEC00BC8C9B, 0x000000009A9E9019, 0x58D992A29C7918B5, 0x20D11249962E26C8, 0xED85D6DE1A60F730, 0x79F60DFA4BD56715, 0xD04070B941DA564B, 0x85D8210F0AE4BB30, 0x86F35B14B9E7067F, 0x35C04869A4AE2587, 0x0000000052BCAA0E },
+{ 0x92E70E987150D698, 0xF1114D9BDD8FD412, 0x77A6A8A19CC79BB4, 0x516857FAB8EB1FA3, 0xCB3C3301337B4211, 0x646BAA4EF60EE224, 0x652CAF82E704A50D, 0xAD2701939ADC4380, 0x0000000126DD841A, 0x1C92FB92A93CDA2A, 0x188737B9EA9E0646, 0xFE8ED347A35EA52C, 0x8EC7BCB055AEF01D, 0x1741F3D1D10EDC75, 0x49751ABA008C8094, 0xEEC80AB3F944BA50, 0xAABE90A9599447C2, 0x000000008F115253 }, { 0x6D18F1678EAF2967, 0x0EEEB26422702BED, 0x8859575E6338644B, 0xAE97A8054714E05C, 0xF690C28F6566BDEE, 0x2D5E8B42AA722D2A, 0x5E7A97F0A5B60870, 0x912F82C5CA711BEB, 0x00000001E8813627, 0xE36D046D56C325D5, 0xE778C8461561F9B9, 0x01712CB85CA15AD3, 0x7138434FAA510FE2, 0xAA8B01BEC7D3238A, 0x48551AD79FF48EBB, 0xD4DF3CBF9375F32D, 0x9397F3B00BB917A8, 0x00000002804D67EE },
+{ 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 }, { 0x71DF02AACADBE62E, 0x051E400B966DFC35, 0x9C2B88C81D155EBE, 0x3C536B822641346F, 0xAB1C368DC2C99492, 0xA54F576219FFE73F, 0xF4C9A78BE3B5A319, 0xA069B35844334746, 0x0000000146334188, 0x9D1EAA2826B6BFDB, 0x17D918DB01DB99AB, 0x182640D68CA2C0FC, 0xF6FAD8C51F0AEF9A, 0x534BE8CC38D48781, 0x3B45814CF40651BD, 0xB9E2C9BE8BDECBC5, 0xBCABC9E0C655CC23, 0x000000004312B76D },
+{ 0xF26280E6435774F2, 0x79FBF01054B8046F, 0x911D94A553CADA78, 0xC569BD837C226DBF, 0x435A6AC1F86AFDDA, 0x4C625A4FC653991A, 0xD315456C05E58925, 0x086CBD11C1B55133, 0x0000000054E83AA3, 0x1E343962E2389DAB, 0x533EE5C542E5B581, 0x781A2E33436D6A7C, 0x6002F18EFCB5793B, 0xCF948BB41B24DE7A, 0x162BDE27E26DC7E6, 0xA391D12227F0E73D, 0x0A78330361D9C7D6, 0x00000000798C66A5 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0xEAFC95EA4B92FFDD, 0x23C1F56F20F712D1, 0xBD751FECE7BF748E, 0x88454ED2B8F7C762, 0x38D965322BA6D3A9, 0x06F899BFE3C14DAD, 0x82BC035B8D6743A9, 0xC459D1F9CA29A147, 0x000000021DD81244, 0x12DD79B1FBA7C6E6, 0x222BE39D9D2100A0, 0x5558DAF75959819A, 0x960E353075A36129, 0x414A1B13A8C3B9E7, 0xDE9DFD0705EAA8D6, 0x058CCE7AA190B0CB, 0xA9C96F01C67F8B5D, 0x00000001CFF942AB }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+};
+
+#elif defined(P610)
+
+instance_t insts_constants = {
+     .MODULUS = "p_305_192",
+     .e = 20,
+     .ALPHA = 2.25,
+     .BETA = 10.,
+     .GAMMA = 20.,
+     .PRNG_SEED = 1337,
+     .NBITS_STATE = 19,  // log(S) = e-1
+     .NBYTES_STATE = 3,
+     .NWORDS_STATE = 1,  // Assuming 64-bit words
+     .NBITS_OVERFLOW = 3,
+     .MAX_FUNCTION_VERSIONS = 100000,
+     .STRAT = {4, 2, 1, 1, 1, 2, 1, 1},
+     .jinv = { 0xfcefd68f2b14a5c2, 0xc09187c89aa553ee, 0x8feb02c76fe3a854, 0x84ed53033e30fb52, 0x5911b927b8b0f817, 0x34c98a1b91097ff1, 0x58ed44115a9d7b60, 0xb06eb862dcd00e0d, 0x7ccc189d5fd2afcd, 0x0000000120f832a7, 
+              0xf672b2a3e7979d97, 0x7067887b89aaf245, 0xc65a02b23ca3d2b0, 0x4309be0a8732f4a1, 0x2690f72bd5d16f79, 0xeeb9b1068dbce096, 0x5a56d8d4b69b2479, 0x41abc419541c45f3, 0xbb440d4f0ffe446a, 0x000000042b5a9ee4 },
+     .ES = {
+           {
+           .a24 = { 0x00000000ce1991cc, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x3468000000000000, 0x9b33857a50e2f47f, 0x149430734647a838, 0xa56c442ba0d5a3c4, 0x26d204dd0c595e7b, 0x000000021129d2c8, 
+                   0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+           .xp = { 0xf23db4031682cc3c, 0xd2c8f4578eca3358, 0x2ea33afc6da898c4, 0xf9309b749933e007, 0xa333f852c31b1f1c, 0x36024c1f66455373, 0xdff94fc4ab01e759, 0x535a8d0ad659bd1d, 0x608ef6be9861c117, 0x00000002699492c1, 
+                  0x041857bd29d67b9c, 0x005faf1ee074b963, 0xa74ae1e86777cdf0, 0x9b384072f5652f73, 0x7ad192e1ca3fdb13, 0xefc82d484c7c61ce, 0x6373e078df31184f, 0x6ceaf59f5221cdb8, 0x8ce2b0240c614100, 0x00000001208e7916 },
+           .xq = { 0xa2931083c97f641b, 0x325506923e8a8063, 0xf218ad60cae9e38d, 0xe6fbc221a42b520a, 0xfcdc7e8b967f7926, 0x396fd7370a7ec4e9, 0x2cdfca384b01d7f6, 0x777a3b784c50d41f, 0xfd781b6384a83df2, 0x000000018302c728, 
+                  0x0203e4e6bfc93d15, 0x81da76d1c1de18c1, 0x5261d8ab2e4c2b88, 0x890818c0e4055ec1, 0x7653957a3a04a857, 0xb2d8dda4943eb038, 0xac8151932eb3c018, 0x0c5eb56d13468e7f, 0x6c8aaf1e9e507b24, 0x000000015b64b33f },
+           .xpq = { 0xcd8ffa3eefb9f088, 0x57a506ea89ddc9e6, 0xcc3ab48e8f2cc370, 0x8905e61df91adfb3, 0x8ae572ca375b3da7, 0xa6ac98de1390983d, 0xcb6e771fac8b3ad4, 0x8849e23e91382351, 0xbb5b6920f5d16700, 0x00000001f9d15bc9, 
+                   0x6adb968ad7113c69, 0x1105e82f663368f9, 0x4733a64cf5aba851, 0xb29ced9f8a8793b8, 0x84d9ae4956ebbe80, 0xe282f8b9680d4844, 0xcb06880e6dfeca78, 0x6b66f538766692fe, 0xd927c3f6de4a1693, 0x00000001bc9b3bab },
+           },
+           {
+           .a24 = { 0x00000000ce1991cc, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x3468000000000000, 0x9b33857a50e2f47f, 0x149430734647a838, 0xa56c442ba0d5a3c4, 0x26d204dd0c595e7b, 0x000000021129d2c8, 
+                   0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+           .xp = { 0x3de61d77c741a6f9, 0x99e87a522e59523d, 0xbee4268acbbc6623, 0x74f12074badcae25, 0x1addc2f56ea5a075, 0x20f4f2aafb34df54, 0x09320a3c8c515fcf, 0xc2716ee67fec92b8, 0xe54719c72ab9e87b, 0x000000020734f52b, 
+                  0xc904d35c168876e3, 0x185b58510fa12f14, 0x0c79a3e7ed223b67, 0xb2c7c5b73822a012, 0x44e5f0e92cdca95d, 0x4e28a1464eb784e0, 0x9beb729ac098b47a, 0xcc4a9f4bebba8410, 0xd7d784010835111b, 0x0000000162d0b63b },
+           .xq = { 0xa2931083c97f641b, 0x325506923e8a8063, 0xf218ad60cae9e38d, 0xe6fbc221a42b520a, 0xfcdc7e8b967f7926, 0x396fd7370a7ec4e9, 0x2cdfca384b01d7f6, 0x777a3b784c50d41f, 0xfd781b6384a83df2, 0x000000018302c728, 
+                  0x0203e4e6bfc93d15, 0x81da76d1c1de18c1, 0x5261d8ab2e4c2b88, 0x890818c0e4055ec1, 0x7653957a3a04a857, 0xb2d8dda4943eb038, 0xac8151932eb3c018, 0x0c5eb56d13468e7f, 0x6c8aaf1e9e507b24, 0x000000015b64b33f },
+           .xpq = { 0xf039e5d4ba37a1c9, 0xdc33bbcd9739d7c1, 0x7a27fe47c769233d, 0x97ed114122eae50c, 0x48d9646601d3b6e0, 0x43d153e6094ee8f5, 0x9472d34b337186d2, 0x04812a89538a7b46, 0x0c404aafd742e118, 0x00000000f61ffba7, 
+                   0xc5b7d2d1430dd45a, 0x7acac0444e003793, 0x78638a640314e735, 0x951b3938d1cded8c, 0xeb176a2b695005a3, 0x3ab1352fbbbc42bd, 0xad0bfd3cdd9e320d, 0xfdfaacf3630b5f3c, 0xdbfabc3f988b775d, 0x000000019e51b7a1 },
+           }},
+     .EE = {
+           .a24 = { 0x41cfef6af7b4cdc2, 0xfb25d16c7b6b0789, 0x6733771a48f88cd1, 0xbf08b10a8dbfea21, 0xf53f8105f2642f98, 0x30cb181f85444343, 0x97916e5ae34a7d36, 0xe3d1ec62f04b3576, 0x12b50fc9f43c2657, 0x00000001cc789b6c, 
+                   0x46ce926c754b6fe9, 0x598f7297bf60c42f, 0x7a99e99677c24428, 0xd63a8b042a494117, 0xd11eb4e0eee077f2, 0x66b7a6479752247c, 0x334e9087813f176f, 0x89d1d60a8caa3ef7, 0xea31bfa91e5a83b2, 0x00000001771e0f1f },
+           .xp = { 0x8ea8b8b1396eb76d, 0x9745aca7ad190e1b, 0x62a8a4a680db55fb, 0x412c4129ae1e9d0f, 0x7ab19fcd8d23ba1b, 0x4f6c2135d59c4cba, 0xe4b645762df2fd2f, 0x120a400d312d83fd, 0x52ba615e722eaf3e, 0x000000024432c190, 
+                  0x197364932c850a46, 0x81ee9746d5dec784, 0x77556812133c0116, 0x8d64d0eb0fd90690, 0x2997620feb5cd759, 0xb7507022eec0b4ff, 0x06a772e6f414a355, 0xe5c4775e13149bdc, 0xd161b4ecd847dc3f, 0x000000013b2a0eeb },
+           .xq = { 0x093f65665406305a, 0x340fe212268c5a63, 0xec994d5de8ff1c82, 0xf5c20ca43fe1b2b2, 0x42158517211ae4f3, 0x457c9525953768ee, 0x2e814cfab09658dd, 0x1190c3b3ecb648cd, 0x710059b1d0a9d3db, 0x0000000124d12ce6, 
+                  0xf41d26294028f2d6, 0x02f6a98e65ca017c, 0x77c4af44d8498913, 0x2154484a24a8cf67, 0x29fa4aa27a866e04, 0x686af92c971317df, 0x28e686b3a086f7b7, 0x3be6d82a0872769e, 0xea56cf93696ea141, 0x0000000192b76918 },
+           .xpq = { 0xe6cda2b5880e0bf1, 0x1a8b15a69b99180e, 0x0bd2f2babbb0f1ca, 0x1e765e9182bb8505, 0xc2cfd17e8cb6ac1b, 0x19e927f058d885dc, 0x28a757c2c249f359, 0xee4c857b5bcc5513, 0x8650274842140269, 0x00000001f037cc71, 
+                   0xd6e0d95860a09384, 0xf5cade999dce1927, 0xf62839d669f9a0b6, 0xb2a58b61578a6cc9, 0x0d383a8a028b96ae, 0x9349db4ba63830dd, 0x1437f5f455db7fb1, 0x0f49e5918ee24ca7, 0xce3dc7885df6c297, 0x0000000241f170c9 },
+           }};
+#define NBITS_STATE  19
+const f2elm_t64 DBL_TABLE_ES[2*2*(NBITS_STATE+1)] = { // A point per row represented in (X:Z) coordinates
+{ 0xA2931083C97F641B, 0x325506923E8A8063, 0xF218AD60CAE9E38D, 0xE6FBC221A42B520A, 0xFCDC7E8B967F7926, 0x396FD7370A7EC4E9, 0x2CDFCA384B01D7F6, 0x777A3B784C50D41F, 0xFD781B6384A83DF2, 0x000000018302C728, 0x0203E4E6BFC93D15, 0x81DA76D1C1DE18C1, 0x5261D8AB2E4C2B88, 0x890818C0E4055EC1, 0x7653957A3A04A857, 0xB2D8DDA4943EB038, 0xAC8151932EB3C018, 0x0C5EB56D13468E7F, 0x6C8AAF1E9E507B24, 0x000000015B64B33F }, { 0x00000000670CC8E6, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x9A34000000000000, 0x4D99C2BD28717A3F, 0x0A4A1839A323D41C, 0xD2B62215D06AD1E2, 0x1369026E862CAF3D, 0x000000010894E964, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0xB3B2D2126FADDAFA, 0x9B05B184B92057D8, 0xAFAF0B2D3706A992, 0xA5BDA8ABAF096C20, 0x67FFE13642D82B20, 0xD3F155B1ADC786ED, 0xDB3186FEBE78AC8F, 0x278AB91E9A5DB0AF, 0xA3E974BA85A655A0, 0x00000001036C0336, 0x07B38DBED21ADF43, 0x11E2C89949835DF7, 0x950EB1CBD14DC676, 0xCE557944512D40B1, 0xD19984E298BA575A, 0x1DBD64373A0774A7, 0x0C77F7FC5E90FFC3, 0xA98427B640E4B679, 0x0C386ABF01662370, 0x00000000C59F54C5 }, { 0x9B3E517E312F3E44, 0x1694C12ED9BB16C2, 0xA35EB954C88F9775, 0x7C32B42146BCA4B2, 0x2CFA8A67249FF297, 0x81F8661A1ED9C2B9, 0x1803AD7D24559B1D, 0xD60D07618D54ED16, 0xF2DEDA1DB49F9FD9, 0x00000000C09A5072, 0x97DF4C571B70A6EA, 0x75F0717AE14E9B40, 0xA1D39F941EDF68FB, 0x60C16294E66A6A68, 0x3C956E6A8A53631D, 0x94164CBA5D4D8DDF, 0xBB36621903763A9B, 0x880962AB0CAD913E, 0x1C85B6369E39F162, 0x00000001E09A6283 },
+{ 0x1FCC282E5C3BD633, 0x5ADD3819D5811E31, 0xAD6817694F3F7D08, 0x5B8C78C846DA4988, 0x4A712773E01D65EE, 0x1B1A8DF094F523C1, 0x66BE276AC3690A78, 0xA540C778C86240FD, 0x5085C0D2DC036755, 0x00000001328C6069, 0x7B8E5A10BD2B2318, 0xB1636F60CC79601B, 0xF3A9E07CA8F6DD94, 0x7CF5677E749997C9, 0xC8E8BBB8486D0102, 0xDEC95CB1F53BBCDD, 0xCD8CF64CB86B92C6, 0xC12C6D874FE3A129, 0xA265EACA68D1E3F5, 0x000000017B6C9D35 }, { 0xBEA779D483A955EC, 0x537AD2406348A023, 0xA6DF8D22585E3859, 0x1BDA97296B732B32, 0x7F675411FF3C481E, 0xE71B2F18ABFFE904, 0x874F9475DD1BDC97, 0xD53894139A0DD4C2, 0x0F2C72D76C38BBBC, 0x0000000106A91457, 0xEA25682838575ED9, 0x00E775A911A20995, 0x8D2C8B38303C0BF0, 0x5B79A3E4689D1DB6, 0x3ACD9527519C400B, 0xE932ED66167A987C, 0x69876F5EFB104D3E, 0xC9EB5FDA7D22FE93, 0x08CBBA5D703CC2CE, 0x000000010072E7E6 },
+{ 0xCCFC594063139897, 0x68496B5D7C160818, 0x02F9630387D921B4, 0xE611CB16105E14A5, 0x235F79235F2DF8A1, 0xD9C3AD1C8D84A0D0, 0xFBD9A41B8CCE9A2E, 0x108DECC332FBE5EE, 0x140BFCEFDF72BBE0, 0x00000000BCE4F7D8, 0x57A7A2F5D1E1234F, 0xC7EBCE652337972C, 0x0E173623D5A45FC2, 0xD2E5D45536BB8A27, 0xFAC34DF815CA039F, 0x65ED490DEC2A66FB, 0x4DE797DE32AB0BD6, 0x8927C719DA7DF17A, 0xFF1508921B92E74D, 0x00000001A1FE3C4F }, { 0xF3F94D669C60517F, 0x296F9EF43924A63B, 0x3CC0080A83A2BE54, 0x0DF1C8C9B8F49DBC, 0x6507FBA67D276941, 0x666DF7A311A213F1, 0x9EF8020548B82926, 0x97FAB9C60C2EC214, 0x26EB3319DA288BF6, 0x000000015CAD548C, 0x1851045E357A26BC, 0x8ADAE42AECEDAA03, 0xF22667960909E616, 0x3E515E2EC504CEDA, 0xD50A59B99D306E80, 0x92B45FC6797BC65E, 0xE1246E40979E2D07, 0xCB14CC551F96042E, 0x88D195E11C87E5CA, 0x0000000272937A48 },
+{ 0x48461E90FA569FED, 0x82AB7F5C6FE27054, 0x29CE4A87D0E59889, 0x04B1AD6B9E911244, 0xEDCC31E93264BD50, 0xA8D162798B8D5F69, 0x99171C40C585522F, 0x22A80E7A12E43143, 0x33BE3812424B0F1E, 0x000000013BD45D3D, 0xF20AF3D54F33493F, 0x8AD308C5E988EF94, 0x92726EAD6820EB08, 0x5A7BB3A250647AAE, 0x1D45EC6F966C9182, 0x6EBD5F4FCAEC5065, 0xD4728F62E91EEB00, 0xDFB95AB10BE82C9A, 0xEC7D6CF6C01DCEBB, 0x00000001CAC32574 }, { 0xC4CACDC553AE4274, 0x226C08A0D91BE518, 0xD9BD3932B8867927, 0x6F0F09A1BBB4F9B6, 0xCE2913EABF74D7F2, 0x87E9656D1503AD7F, 0xB6D0229DD6CF0A67, 0xB593B2E332E79334, 0x554BB6ACE92B29D6, 0x00000000AFFD53F9, 0x9BA3A830C33D159F, 0x996CC025C43DDADE, 0x1E686B7963972F60, 0x5103180A9DBC43EF, 0xD00085C8DFA322F1, 0x24CC956D52181EC1, 0x6A3CB1F3A9BE04CD, 0x5E3578B81CD08A91, 0x12A6D561F51828F4, 0x00000002236B900B },
+{ 0x56A53662015DFAC5, 0xC32E7F137CB16C61, 0xA0D01D4180FCD078, 0xD0335F819255CC7B, 0x536D4734722CF715, 0x30B836563B8190DE, 0xA5092DC6E3815079, 0x88C37F6FB27DA0A8, 0x623375ACA047FB8C, 0x00000001BE774D27, 0x67DB46E760CD5C8C, 0x70EAD2033470AD10, 0x362084860015537C, 0x502A9BE37A728298, 0xC5A435976EDA7719, 0xE713348320507EBA, 0xC30B88AE8DECD309, 0x3E8E037CDE828CDF, 0x334DFE85CA9F2CAC, 0x000000006B0085BE }, { 0x126BAE8742142194, 0x9264F42E6ADFC958, 0x06C01E87FB3BA988, 0xF5F1E0ECB2B51B89, 0x029CE3C889A48185, 0xF28FA4AD5082BCDC, 0x65E9D5FE5A41C8E1, 0xE433AF223AE9FA53, 0x39FAE0218ACF561B, 0x000000001D8BB267, 0xFD8C4F00FBAD1F68, 0x95C5AB3C3443FBD8, 0x6EC2BD2DF6884BD9, 0xF078B28245EC3F76, 0xCD23B74E675F93EC, 0x6B17892B0AEE75D8, 0x6B25C8834CF9D3B8, 0x2A54AD33AF76DC1A, 0x6BD2E520E31E9722, 0x000000003CBD0ED6 },
+{ 0xE11B0F60C9AAAEDD, 0xA5DC6E894A9EA1DD, 0x78F0FDBDE79F488B, 0x2EF483A77AE21F5A, 0xD55A1A815659F473, 0x59F3FFB7F6AE4495, 0x11A9EACD8B70CFEC, 0xECEDC4C22030A7CD, 0x2B765AA5A82C7019, 0x00000002074652B6, 0xE8D0A373FC0148DC, 0x4039FB533AAA2B06, 0xA1F30B1535893908, 0x2F8BADD8420FB756, 0x24A4B1EAF92C9E05, 0x5232683125B2A21B, 0x77067DFA11D85E63, 0x5CCBB993C7050DD9, 0x4BF254954162ADEC, 0x00000001A3213083 }, { 0x0D9D76F9C0146924, 0xAF39A8651B19DCAD, 0x8B77D949B93B8678, 0x5B83A1A30366CCD7, 0xB013B109DC1828F3, 0x0675840083D85AA6, 0x5D509B47C2DF577D, 0x47265E029BA47787, 0xD41B82E3B5BF9604, 0x0000000273C7A3A1, 0xAE454B7E8E0727B8, 0x1C8DC4F945D34CA9, 0x619B3D66C008FB7E, 0xEA04DC1F6BDADBA4, 0x4BE418CAC19FB655, 0x4229C9085F7BC216, 0xE155C8AA7FF88CDE, 0x889E3A91E85D5E45, 0xC7B529405C230CBD, 0x000000007FD85F7D },
+{ 0x244A233CD5FDB08D, 0x3AF765555CB37678, 0x0E4CB7C530B14651, 0x362F66FADAF06C29, 0x5B5A49DDF6E0D448, 0x48D41034AF55273D, 0xFE246A3972D97C49, 0xA136C1C58414BB4D, 0x38398D6BB10C782E, 0x000000000EC19E97, 0x66B1FA8B1B59830E, 0x56B62EFF925F53E7, 0x8A9C777BA8E49232, 0xBCE7E065E10E2761, 0xD6162C273C4C86C7, 0xB4F1154C37F3AB0A, 0x3F802B06D8DD8D3B, 0x95F4401E49DDD598, 0x2B2A95C6C0AB716B, 0x00000001B20E5A84 }, { 0xBE303CD931D1E4AC, 0x11C7C32B1D3EA79F, 0xBE0423FA17844246, 0x56B8BBB6FD9A68C7, 0xCAB2A36A031ED816, 0xEED297E7ACE4B13D, 0xF2E0F933EFA7C4EF, 0xA5FC6CCC5C9D7058, 0x3B0591FAB989EDF4, 0x000000000667F61C, 0xC8A99468449A845B, 0x5CA53B3ECDA74550, 0xEA36FB0DEAF36922, 0x4519D1ABBE9A01CD, 0xBC08F4B488D38603, 0xC7B1F55F78319010, 0xC3B66BE03F0E3A81, 0x5B1504871C9FC07D, 0xD7BC529D6677E56E, 0x00000000A6EE3B75 },
+{ 0xF57E2CE0F4578D9E, 0xF4A62A637D8D68D2, 0xDE71821147825784, 0xE320A7647A0DDD3A, 0xC6C2923FCC56DE7A, 0x381CB83A7870D9C1, 0xEFE3CB847711C14B, 0x9460AB5EFB8FFDDF, 0xC9CBF8A142368C05, 0x000000016CE0482A, 0xE1648B8D3BA8C4E0, 0x885BDDADAADBC1DB, 0x4E268AB08A0721CB, 0xB0AE72FF66B40382, 0x0D48F018EFF4513C, 0x6A827DC24134237C, 0x9E928E913A442157, 0x6045A5A9966C3681, 0xEFFD3F10A7718574, 0x0000000266F89E6B }, { 0x84B37834D53DBD10, 0x7485CD093F102C67, 0x653D3116A90E6942, 0x682DD2FF743FA78B, 0x0DE537BB2973C5C7, 0x1B8DD3B019D5AA1D, 0x15E930E29486932B, 0xF3CC6766050527C7, 0x1DBA50AC66D91CD4, 0x00000000F3E9B267, 0xF17977FEA1D05A3F, 0x030740ABE5EBDDD8, 0x7744683497A0F7D2, 0xB7524405EF888F17, 0x7C98AAD77C468986, 0xD994F977F0D1A079, 0xAF12D414EF41FC46, 0xED0BDF744DB27065, 0xDB178A65B38A7ED2, 0x0000000116547455 },
+{ 0x6E037B8BD64D9ACE, 0xEE3D346057DCE467, 0x05D9713B23983CAA, 0x2F0952BDFC3278F3, 0xF86D0D74A9B8E247, 0xF92B3A457421AE5E, 0x45435C442733D8E5, 0xC00054644B3215C6, 0x69229FA646E2549F, 0x000000020BF64B29, 0x0CB3514927D3A9D3, 0xC85CB348CCE14AE2, 0x093C8C8018A16271, 0x0467C6AC540935DD, 0x816DC518F9FBAE2D, 0x9FFF31D6FCF10057, 0x13E18D7475E560DF, 0xF0617F6ADC5EC28D, 0x8E4CA6D6F9004F60, 0x0000000028FD726E }, { 0xDFFCEBAE3A4661EF, 0xF9CDBC3A664DE52B, 0xACEDF85726F80738, 0x1A10ED78E25595EE, 0xAA47A06CE49681F0, 0x56C4B9DD52AA13DD, 0x99DE4859ED5BFF16, 0x49CDD0C255DEA63C, 0x667CC384A8003EA8, 0x00000001E27E626D, 0xCF2D558CC400092E, 0x98716558D5C239E1, 0xC5ED8270C6DAD29B, 0xD05B23449347FEFA, 0xA99F4C0FF34409AE, 0xE70C2D469A832C4C, 0x319B63765103460D, 0xF27B798DC5B10E80, 0x5BABC3251E2898CE, 0x0000000275A09054 },
+{ 0xDCE9796B2A662A28, 0x5A7B68DF9A688B32, 0x36FF247E7FFE83A3, 0x52155D27DE6C1C12, 0x5F11C0FF7C4A23FE, 0x4196ED8A1ADD6903, 0x33B81FB01235E698, 0x631D0F28C3A4EB2C, 0x1B72B82E10EF59F5, 0x0000000178028EF9, 0x53FC8675CF012F2B, 0x709AAEE4BC438340, 0xFDBF1D7923754DEB, 0x8CD55918A1001071, 0xA84412D423594A05, 0x674B8101B77BC563, 0x65B62BB2C6DD3A53, 0x50E0B9E85D7AF03F, 0x36ADD2050FFE20C1, 0x000000019A9EEE53 }, { 0xC01A03B0D693CE7A, 0xAB1D75F3F6538D23, 0x6B06F79AAB2CA1A9, 0xA6328DD3941BD9D7, 0xB074976B707E1B66, 0x3D15526E6D1661CB, 0x2E188C656175F9C1, 0x6D4B3C77673B3C3E, 0x7241620914D8C973, 0x0000000046D9F432, 0x3C652F4FF684C14A, 0x98631A0B7AEFA851, 0x8530BB783DCA858A, 0xE6A24D6FF9E50065, 0x12FA1F426E04C4D9, 0x5D2894A90D4A8BBB, 0x19BBEB6564721721, 0xA2C16D0CE266CA34, 0x35D0841CEB5222A5, 0x000000005C503B13 },
+{ 0x296FB6F33E05477C, 0x36CCB2130A838198, 0xB68E124C772B43D4, 0x560A498B531BA051, 0xFD1A114F24CDB7F5, 0x4379B915C1EA1C3D, 0xC4F053B6149CAAEB, 0xEC9ACAF4D2B291AD, 0x223294D22B238E0F, 0x0000000007FDBD41, 0x0BB9E64272C91A29, 0xDE8FEE2B8B976654, 0xF7FEA653391C129E, 0xFD3ADD75F487D034, 0x7AB099B11F5A9936, 0x4B7FFE548931BE9E, 0x9A873F6AD5DC18A1, 0x86C7989282704AE6, 0x785FB2B52EFD877D, 0x000000002BE65016 }, { 0x5C0DAC47CB15790F, 0xF39D56BFFA0A85A5, 0x568945AC1F83C44C, 0x196163685BC92B11, 0x1A47AE02206CF87E, 0x6E47CDD7867F3FF2, 0xE305FFAE6AE577E6, 0x8A3A001D6F06BCB0, 0x0C5C044FDEB7E978, 0x0000000020FB5132, 0xB986187A528E9535, 0x1B24613CCCC1AC23, 0x9C4B341A39BBE0B1, 0xD986BAA05A4AEEA1, 0x2101B4B50710DF39, 0x079DD1E38C0BDC25, 0xC41A4B8B57916362, 0x83980A6D50964417, 0x2E9BFEC6A1C70A26, 0x00000000B027197E },
+{ 0xA8AA90B1EB64256C, 0x19BD9D4FA86D3250, 0xA46CDD403522681B, 0xE6049AB5BB1B7388, 0x4052B87DEB466C10, 0x94BEDD4C27D48920, 0x38087A1020A70EDD, 0x9C95511C17D80015, 0xD128C88562661113, 0x000000019682AB39, 0x7ED1EC1F016FD601, 0x08DFE0F6ABFFA4ED, 0x09D27F9B85E1C86B, 0xFBFA81E843A78041, 0xAEE822291ED5CEF6, 0xC7E937036B2DDCDA, 0xC005E79557B1CDA3, 0x755C87747EBFAA3E, 0xBC76B5B74ACE7635, 0x000000009F927C82 }, { 0xB1770F3DA5A2D236, 0x02F34C860E184FB1, 0x2F46D21B884229F9, 0xFBDA943302276BD8, 0x1C18F4D98ED028C6, 0x35918EE4D50B58B7, 0x10BC86E7860A917E, 0xEAAD56C744644140, 0xC32F28956F5D037D, 0x000000014A32CE49, 0x1F5C8EDFC2EE2C94, 0xFDC57E9D0DE43399, 0x69322A5F74E03413, 0xCFDE8C5B0088F4FA, 0x81EE1E8AF3F26884, 0xAC8A3D93CAFD0054, 0x8F60F3C9102DAF8F, 0xD6895C5D8C2415F9, 0x3DE7C057674F9524, 0x000000008E538082 },
+{ 0xD72B9EBA852CD0AE, 0xDF31F014E3E55E81, 0x4048F0E478083EEE, 0x894E05514C38551A, 0x34656E4D72E4E007, 0xD3E0153E4AA5C3C0, 0xAE02D900F2B54F04, 0xE9C902032A58F895, 0xF696719DA9B22F64, 0x00000000CABBD697, 0xA25EDBA8F0DC259D, 0x65CB26D8BAF3C052, 0x60751BEF0BB8DB18, 0x3612F2A1483C46FF, 0xBCB3D3589AD30829, 0xCF0C2F0EBC8B1B4E, 0x054E29F7BBADC7F4, 0x9BF4F6FC0956C7AC, 0x67DBD2D6C9C044AA, 0x000000020067D322 }, { 0x37D209BBA8C2B3D6, 0x54F00217326E9CCA, 0x062C886D344CCBDE, 0x6D002E8CE1E73966, 0x33101380194F6D77, 0x11881EB1865C65AE, 0x6764A75E56559B67, 0xDA4C74CA0717280F, 0x2F27DCDA6B1925EA, 0x0000000133302621, 0x56774A78FB354BD2, 0xF8D7DCBEABB85A8B, 0x16F1C44A06F4110B, 0x02E52FD6290BEAD5, 0x5D9C4D0A7C1AAAC1, 0xD40D2E219AA839EE, 0x3F81D1ED5EBF0943, 0x14C6E6416AE853CE, 0xD43708AF6F4BC650, 0x000000025DB42ACE },
+{ 0xB5F4962933815052, 0xBDEF366CE003B457, 0xF3382C06ACA6B04A, 0xA20244B2A3E11B3F, 0x139F798922FC6299, 0x3DE7CDF34A42B749, 0x7C10B37E09F6EEDE, 0x904AD8F11ADF4599, 0x8D6B67FFF0D91570, 0x0000000223A95921, 0xFC026A39B191357F, 0xC4F09553027F230C, 0x1EAE13176BC5EB74, 0x56D9418385649BEF, 0x1EDD8DE58B130FA1, 0x76F0E6CFC9ECB224, 0xF2EC8A5E0C85A33E, 0x5073A0C0CFD9F7AB, 0xA3E7459C8F8AAFCF, 0x000000019D17E2B6 }, { 0xB138415981AC6C57, 0xB6A705B3A85D2962, 0x551DE0C363B0484C, 0xBFE411B57AE7B297, 0xB633E0440FB09A38, 0x4D32FC23A8160E12, 0x3CE3A3F85899BD3A, 0x668F5C7CA5BFBCD4, 0x34CC1FA3ABE49A64, 0x00000001F1B157EB, 0xF564DA384D652D45, 0xCFBCC46AF962AF1F, 0xF7C9D4B34591A366, 0x382A5C7AFAAF994A, 0x7869D04585A360A7, 0xA3D1D9CD16FE80DF, 0xBADC37DB888E5E9B, 0x298DA119627C46E3, 0x957C57E1A3675455, 0x00000000372839E0 },
+{ 0x81447DA075DD6A39, 0xD8C6BAE24EA1E2E4, 0xE4D82003753CB5DC, 0x9E39323B287AD7A0, 0x2C0599AA14782219, 0xECAC28EF7E86C088, 0x41FA3B0A180B5996, 0x15B68D555E530058, 0xD989E94F31E7BECB, 0x0000000123CEC95B, 0x3339F721D645BA98, 0x894863CE3A77C0AC, 0xF8CDCBE5A8E44807, 0xA269401F8A7C60D4, 0x5D3CF8EED22DF8BF, 0x9153B3C959FABDFC, 0xD87D1AC7CE3B2E7C, 0x828DD67CF87030FF, 0x0D20857BD572FE9C, 0x0000000164BF6AB1 }, { 0xB2AD787EEF161900, 0x1AB2688449749FF4, 0x00E171C88DB153B9, 0x789BB425BC3B39C3, 0xC02D956736AC8BB1, 0x5CF46B445E2B2D9C, 0x9B0BE15C086847D4, 0xEB3A55C46A6A3457, 0x2618E49BC35F3809, 0x0000000199A53423, 0xB7F59E6D76AE4D3B, 0xB151C14D48D9C241, 0x1E5EC9E64CFD2F96, 0x1D7DB279BD3828B2, 0x6B0EF1C4AF4180DA, 0x63D8E73308688853, 0x5A67B22190D16E13, 0x5D433D5C772CD19D, 0xD06679E096CFD249, 0x00000002090872B1 },
+{ 0xDB8D4B0ECFF7DA24, 0xB6BEAB26F18028FB, 0x7E917B248100F355, 0xC8A9168FF905BDF3, 0xE55AA070C9C2ED74, 0xFB08D3AD286B3422, 0xCD7549F9E6A0152F, 0xAE896273ED7ECA12, 0x053F4E63FD655956, 0x000000023B90F919, 0x99E69887AFD717D7, 0x71FFB61CC76C4083, 0xE7AD5304BCC8F2D4, 0xF1F3D053E58864DE, 0x58362770D2E94921, 0x06E2F88CC009C428, 0xBB2A2A07D392D285, 0xD16C2DB5A1C75A4D, 0xF6A16DA0A8C06553, 0x00000001960A290F }, { 0x2472B4F1300825DB, 0x494154D90E7FD704, 0x816E84DB7EFF0CAA, 0x3756E97006FA420C, 0x88A75F8F363D128B, 0xB66F7A3B81EF7C0B, 0xCD72754B1DEFE47B, 0x03CC508623455B17, 0x7C50C25E54827F36, 0x000000004065AE4F, 0x661967785028E828, 0x8E0049E33893BF7C, 0x1852ACFB43370D2B, 0x0E0C2FAC1A779B21, 0x15CBD88F2D16B6DE, 0xAA95555BEA50EC06, 0xDFBD953D30FD2726, 0xE0E985446EFCCADC, 0x8AEEA321A9277338, 0x00000000E5EC7E58 },
+{ 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 }, { 0x3F0E39512AE5B58A, 0x29D3DC577B20A10C, 0x875311B08C89F9DC, 0xAA49F42F5A7933A9, 0x178E4B0326D7B832, 0x285A977152561775, 0x2CFEC44F1CA5C209, 0xAB02EA1E63234982, 0xEA4B243089193DA4, 0x0000000271317373, 0xBB9B280114D1761E, 0xD82E5827008CB43F, 0x89BC6508093D8E21, 0x0A2ECD2193422171, 0xF96D5E4B019E6AE7, 0x20BCA648199362DE, 0x353713B9BA82DA83, 0xD2DC364122E519C9, 0x2B1D0098BADDA961, 0x00000001AC6BE3F3 },
+{ 0x9A82B75F5B8C95AE, 0x46858DE0F51410DB, 0x53874D585E7BE566, 0xE9D8F659AC7049FF, 0x5E830254DEEA7B27, 0xFEAA1CDC3CED5551, 0x48B7CB89AD0E0B67, 0x67B3E6A1B73248DD, 0x45A19085D24DE60E, 0x000000013B270256, 0x34125B312A909849, 0x1174DC80FFC50792, 0xD2B6DF974F9B0687, 0x6322FE97B1E6AB49, 0x598A6B9A7FFB4D1A, 0x5B346BADB2690CCE, 0x76804BE34CA05604, 0xC045D7EA51AAEC98, 0x0EB8F558A55AE5ED, 0x000000012395C2E5 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0xC26AD631504CEBCB, 0x152039FCC0E69EA9, 0x385E8F60C6DC1B34, 0x293E5D23BF1034C0, 0x6F029E3A0DE5A12D, 0x105E62AD362EBD7E, 0x1952D73B091E7EC8, 0x37860EFBD51311C0, 0xF32005CDE0F5992B, 0x000000005EEF0F2C, 0x64EB91CA748EB99D, 0x0C05398BE93FC411, 0x41D203BECFC68FF9, 0x0DA24985988DFF2F, 0x15BDEAC44181E1E9, 0x294765C3A8EA8439, 0x41100CB2FC28C61D, 0xF7E30667875F586E, 0x7657B569675A0879, 0x00000001095878A3 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+
+{ 0xA2931083C97F641B, 0x325506923E8A8063, 0xF218AD60CAE9E38D, 0xE6FBC221A42B520A, 0xFCDC7E8B967F7926, 0x396FD7370A7EC4E9, 0x2CDFCA384B01D7F6, 0x777A3B784C50D41F, 0xFD781B6384A83DF2, 0x000000018302C728, 0x0203E4E6BFC93D15, 0x81DA76D1C1DE18C1, 0x5261D8AB2E4C2B88, 0x890818C0E4055EC1, 0x7653957A3A04A857, 0xB2D8DDA4943EB038, 0xAC8151932EB3C018, 0x0C5EB56D13468E7F, 0x6C8AAF1E9E507B24, 0x000000015B64B33F }, { 0x00000000670CC8E6, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x9A34000000000000, 0x4D99C2BD28717A3F, 0x0A4A1839A323D41C, 0xD2B62215D06AD1E2, 0x1369026E862CAF3D, 0x000000010894E964, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0xB3B2D2126FADDAFA, 0x9B05B184B92057D8, 0xAFAF0B2D3706A992, 0xA5BDA8ABAF096C20, 0x67FFE13642D82B20, 0xD3F155B1ADC786ED, 0xDB3186FEBE78AC8F, 0x278AB91E9A5DB0AF, 0xA3E974BA85A655A0, 0x00000001036C0336, 0x07B38DBED21ADF43, 0x11E2C89949835DF7, 0x950EB1CBD14DC676, 0xCE557944512D40B1, 0xD19984E298BA575A, 0x1DBD64373A0774A7, 0x0C77F7FC5E90FFC3, 0xA98427B640E4B679, 0x0C386ABF01662370, 0x00000000C59F54C5 }, { 0x9B3E517E312F3E44, 0x1694C12ED9BB16C2, 0xA35EB954C88F9775, 0x7C32B42146BCA4B2, 0x2CFA8A67249FF297, 0x81F8661A1ED9C2B9, 0x1803AD7D24559B1D, 0xD60D07618D54ED16, 0xF2DEDA1DB49F9FD9, 0x00000000C09A5072, 0x97DF4C571B70A6EA, 0x75F0717AE14E9B40, 0xA1D39F941EDF68FB, 0x60C16294E66A6A68, 0x3C956E6A8A53631D, 0x94164CBA5D4D8DDF, 0xBB36621903763A9B, 0x880962AB0CAD913E, 0x1C85B6369E39F162, 0x00000001E09A6283 },
+{ 0x1FCC282E5C3BD633, 0x5ADD3819D5811E31, 0xAD6817694F3F7D08, 0x5B8C78C846DA4988, 0x4A712773E01D65EE, 0x1B1A8DF094F523C1, 0x66BE276AC3690A78, 0xA540C778C86240FD, 0x5085C0D2DC036755, 0x00000001328C6069, 0x7B8E5A10BD2B2318, 0xB1636F60CC79601B, 0xF3A9E07CA8F6DD94, 0x7CF5677E749997C9, 0xC8E8BBB8486D0102, 0xDEC95CB1F53BBCDD, 0xCD8CF64CB86B92C6, 0xC12C6D874FE3A129, 0xA265EACA68D1E3F5, 0x000000017B6C9D35 }, { 0xBEA779D483A955EC, 0x537AD2406348A023, 0xA6DF8D22585E3859, 0x1BDA97296B732B32, 0x7F675411FF3C481E, 0xE71B2F18ABFFE904, 0x874F9475DD1BDC97, 0xD53894139A0DD4C2, 0x0F2C72D76C38BBBC, 0x0000000106A91457, 0xEA25682838575ED9, 0x00E775A911A20995, 0x8D2C8B38303C0BF0, 0x5B79A3E4689D1DB6, 0x3ACD9527519C400B, 0xE932ED66167A987C, 0x69876F5EFB104D3E, 0xC9EB5FDA7D22FE93, 0x08CBBA5D703CC2CE, 0x000000010072E7E6 },
+{ 0xCCFC594063139897, 0x68496B5D7C160818, 0x02F9630387D921B4, 0xE611CB16105E14A5, 0x235F79235F2DF8A1, 0xD9C3AD1C8D84A0D0, 0xFBD9A41B8CCE9A2E, 0x108DECC332FBE5EE, 0x140BFCEFDF72BBE0, 0x00000000BCE4F7D8, 0x57A7A2F5D1E1234F, 0xC7EBCE652337972C, 0x0E173623D5A45FC2, 0xD2E5D45536BB8A27, 0xFAC34DF815CA039F, 0x65ED490DEC2A66FB, 0x4DE797DE32AB0BD6, 0x8927C719DA7DF17A, 0xFF1508921B92E74D, 0x00000001A1FE3C4F }, { 0xF3F94D669C60517F, 0x296F9EF43924A63B, 0x3CC0080A83A2BE54, 0x0DF1C8C9B8F49DBC, 0x6507FBA67D276941, 0x666DF7A311A213F1, 0x9EF8020548B82926, 0x97FAB9C60C2EC214, 0x26EB3319DA288BF6, 0x000000015CAD548C, 0x1851045E357A26BC, 0x8ADAE42AECEDAA03, 0xF22667960909E616, 0x3E515E2EC504CEDA, 0xD50A59B99D306E80, 0x92B45FC6797BC65E, 0xE1246E40979E2D07, 0xCB14CC551F96042E, 0x88D195E11C87E5CA, 0x0000000272937A48 },
+{ 0x48461E90FA569FED, 0x82AB7F5C6FE27054, 0x29CE4A87D0E59889, 0x04B1AD6B9E911244, 0xEDCC31E93264BD50, 0xA8D162798B8D5F69, 0x99171C40C585522F, 0x22A80E7A12E43143, 0x33BE3812424B0F1E, 0x000000013BD45D3D, 0xF20AF3D54F33493F, 0x8AD308C5E988EF94, 0x92726EAD6820EB08, 0x5A7BB3A250647AAE, 0x1D45EC6F966C9182, 0x6EBD5F4FCAEC5065, 0xD4728F62E91EEB00, 0xDFB95AB10BE82C9A, 0xEC7D6CF6C01DCEBB, 0x00000001CAC32574 }, { 0xC4CACDC553AE4274, 0x226C08A0D91BE518, 0xD9BD3932B8867927, 0x6F0F09A1BBB4F9B6, 0xCE2913EABF74D7F2, 0x87E9656D1503AD7F, 0xB6D0229DD6CF0A67, 0xB593B2E332E79334, 0x554BB6ACE92B29D6, 0x00000000AFFD53F9, 0x9BA3A830C33D159F, 0x996CC025C43DDADE, 0x1E686B7963972F60, 0x5103180A9DBC43EF, 0xD00085C8DFA322F1, 0x24CC956D52181EC1, 0x6A3CB1F3A9BE04CD, 0x5E3578B81CD08A91, 0x12A6D561F51828F4, 0x00000002236B900B },
+{ 0x56A53662015DFAC5, 0xC32E7F137CB16C61, 0xA0D01D4180FCD078, 0xD0335F819255CC7B, 0x536D4734722CF715, 0x30B836563B8190DE, 0xA5092DC6E3815079, 0x88C37F6FB27DA0A8, 0x623375ACA047FB8C, 0x00000001BE774D27, 0x67DB46E760CD5C8C, 0x70EAD2033470AD10, 0x362084860015537C, 0x502A9BE37A728298, 0xC5A435976EDA7719, 0xE713348320507EBA, 0xC30B88AE8DECD309, 0x3E8E037CDE828CDF, 0x334DFE85CA9F2CAC, 0x000000006B0085BE }, { 0x126BAE8742142194, 0x9264F42E6ADFC958, 0x06C01E87FB3BA988, 0xF5F1E0ECB2B51B89, 0x029CE3C889A48185, 0xF28FA4AD5082BCDC, 0x65E9D5FE5A41C8E1, 0xE433AF223AE9FA53, 0x39FAE0218ACF561B, 0x000000001D8BB267, 0xFD8C4F00FBAD1F68, 0x95C5AB3C3443FBD8, 0x6EC2BD2DF6884BD9, 0xF078B28245EC3F76, 0xCD23B74E675F93EC, 0x6B17892B0AEE75D8, 0x6B25C8834CF9D3B8, 0x2A54AD33AF76DC1A, 0x6BD2E520E31E9722, 0x000000003CBD0ED6 },
+{ 0xE11B0F60C9AAAEDD, 0xA5DC6E894A9EA1DD, 0x78F0FDBDE79F488B, 0x2EF483A77AE21F5A, 0xD55A1A815659F473, 0x59F3FFB7F6AE4495, 0x11A9EACD8B70CFEC, 0xECEDC4C22030A7CD, 0x2B765AA5A82C7019, 0x00000002074652B6, 0xE8D0A373FC0148DC, 0x4039FB533AAA2B06, 0xA1F30B1535893908, 0x2F8BADD8420FB756, 0x24A4B1EAF92C9E05, 0x5232683125B2A21B, 0x77067DFA11D85E63, 0x5CCBB993C7050DD9, 0x4BF254954162ADEC, 0x00000001A3213083 }, { 0x0D9D76F9C0146924, 0xAF39A8651B19DCAD, 0x8B77D949B93B8678, 0x5B83A1A30366CCD7, 0xB013B109DC1828F3, 0x0675840083D85AA6, 0x5D509B47C2DF577D, 0x47265E029BA47787, 0xD41B82E3B5BF9604, 0x0000000273C7A3A1, 0xAE454B7E8E0727B8, 0x1C8DC4F945D34CA9, 0x619B3D66C008FB7E, 0xEA04DC1F6BDADBA4, 0x4BE418CAC19FB655, 0x4229C9085F7BC216, 0xE155C8AA7FF88CDE, 0x889E3A91E85D5E45, 0xC7B529405C230CBD, 0x000000007FD85F7D },
+{ 0x244A233CD5FDB08D, 0x3AF765555CB37678, 0x0E4CB7C530B14651, 0x362F66FADAF06C29, 0x5B5A49DDF6E0D448, 0x48D41034AF55273D, 0xFE246A3972D97C49, 0xA136C1C58414BB4D, 0x38398D6BB10C782E, 0x000000000EC19E97, 0x66B1FA8B1B59830E, 0x56B62EFF925F53E7, 0x8A9C777BA8E49232, 0xBCE7E065E10E2761, 0xD6162C273C4C86C7, 0xB4F1154C37F3AB0A, 0x3F802B06D8DD8D3B, 0x95F4401E49DDD598, 0x2B2A95C6C0AB716B, 0x00000001B20E5A84 }, { 0xBE303CD931D1E4AC, 0x11C7C32B1D3EA79F, 0xBE0423FA17844246, 0x56B8BBB6FD9A68C7, 0xCAB2A36A031ED816, 0xEED297E7ACE4B13D, 0xF2E0F933EFA7C4EF, 0xA5FC6CCC5C9D7058, 0x3B0591FAB989EDF4, 0x000000000667F61C, 0xC8A99468449A845B, 0x5CA53B3ECDA74550, 0xEA36FB0DEAF36922, 0x4519D1ABBE9A01CD, 0xBC08F4B488D38603, 0xC7B1F55F78319010, 0xC3B66BE03F0E3A81, 0x5B1504871C9FC07D, 0xD7BC529D6677E56E, 0x00000000A6EE3B75 },
+{ 0xF57E2CE0F4578D9E, 0xF4A62A637D8D68D2, 0xDE71821147825784, 0xE320A7647A0DDD3A, 0xC6C2923FCC56DE7A, 0x381CB83A7870D9C1, 0xEFE3CB847711C14B, 0x9460AB5EFB8FFDDF, 0xC9CBF8A142368C05, 0x000000016CE0482A, 0xE1648B8D3BA8C4E0, 0x885BDDADAADBC1DB, 0x4E268AB08A0721CB, 0xB0AE72FF66B40382, 0x0D48F018EFF4513C, 0x6A827DC24134237C, 0x9E928E913A442157, 0x6045A5A9966C3681, 0xEFFD3F10A7718574, 0x0000000266F89E6B }, { 0x84B37834D53DBD10, 0x7485CD093F102C67, 0x653D3116A90E6942, 0x682DD2FF743FA78B, 0x0DE537BB2973C5C7, 0x1B8DD3B019D5AA1D, 0x15E930E29486932B, 0xF3CC6766050527C7, 0x1DBA50AC66D91CD4, 0x00000000F3E9B267, 0xF17977FEA1D05A3F, 0x030740ABE5EBDDD8, 0x7744683497A0F7D2, 0xB7524405EF888F17, 0x7C98AAD77C468986, 0xD994F977F0D1A079, 0xAF12D414EF41FC46, 0xED0BDF744DB27065, 0xDB178A65B38A7ED2, 0x0000000116547455 },
+{ 0x6E037B8BD64D9ACE, 0xEE3D346057DCE467, 0x05D9713B23983CAA, 0x2F0952BDFC3278F3, 0xF86D0D74A9B8E247, 0xF92B3A457421AE5E, 0x45435C442733D8E5, 0xC00054644B3215C6, 0x69229FA646E2549F, 0x000000020BF64B29, 0x0CB3514927D3A9D3, 0xC85CB348CCE14AE2, 0x093C8C8018A16271, 0x0467C6AC540935DD, 0x816DC518F9FBAE2D, 0x9FFF31D6FCF10057, 0x13E18D7475E560DF, 0xF0617F6ADC5EC28D, 0x8E4CA6D6F9004F60, 0x0000000028FD726E }, { 0xDFFCEBAE3A4661EF, 0xF9CDBC3A664DE52B, 0xACEDF85726F80738, 0x1A10ED78E25595EE, 0xAA47A06CE49681F0, 0x56C4B9DD52AA13DD, 0x99DE4859ED5BFF16, 0x49CDD0C255DEA63C, 0x667CC384A8003EA8, 0x00000001E27E626D, 0xCF2D558CC400092E, 0x98716558D5C239E1, 0xC5ED8270C6DAD29B, 0xD05B23449347FEFA, 0xA99F4C0FF34409AE, 0xE70C2D469A832C4C, 0x319B63765103460D, 0xF27B798DC5B10E80, 0x5BABC3251E2898CE, 0x0000000275A09054 },
+{ 0xDCE9796B2A662A28, 0x5A7B68DF9A688B32, 0x36FF247E7FFE83A3, 0x52155D27DE6C1C12, 0x5F11C0FF7C4A23FE, 0x4196ED8A1ADD6903, 0x33B81FB01235E698, 0x631D0F28C3A4EB2C, 0x1B72B82E10EF59F5, 0x0000000178028EF9, 0x53FC8675CF012F2B, 0x709AAEE4BC438340, 0xFDBF1D7923754DEB, 0x8CD55918A1001071, 0xA84412D423594A05, 0x674B8101B77BC563, 0x65B62BB2C6DD3A53, 0x50E0B9E85D7AF03F, 0x36ADD2050FFE20C1, 0x000000019A9EEE53 }, { 0xC01A03B0D693CE7A, 0xAB1D75F3F6538D23, 0x6B06F79AAB2CA1A9, 0xA6328DD3941BD9D7, 0xB074976B707E1B66, 0x3D15526E6D1661CB, 0x2E188C656175F9C1, 0x6D4B3C77673B3C3E, 0x7241620914D8C973, 0x0000000046D9F432, 0x3C652F4FF684C14A, 0x98631A0B7AEFA851, 0x8530BB783DCA858A, 0xE6A24D6FF9E50065, 0x12FA1F426E04C4D9, 0x5D2894A90D4A8BBB, 0x19BBEB6564721721, 0xA2C16D0CE266CA34, 0x35D0841CEB5222A5, 0x000000005C503B13 },
+{ 0x296FB6F33E05477C, 0x36CCB2130A838198, 0xB68E124C772B43D4, 0x560A498B531BA051, 0xFD1A114F24CDB7F5, 0x4379B915C1EA1C3D, 0xC4F053B6149CAAEB, 0xEC9ACAF4D2B291AD, 0x223294D22B238E0F, 0x0000000007FDBD41, 0x0BB9E64272C91A29, 0xDE8FEE2B8B976654, 0xF7FEA653391C129E, 0xFD3ADD75F487D034, 0x7AB099B11F5A9936, 0x4B7FFE548931BE9E, 0x9A873F6AD5DC18A1, 0x86C7989282704AE6, 0x785FB2B52EFD877D, 0x000000002BE65016 }, { 0x5C0DAC47CB15790F, 0xF39D56BFFA0A85A5, 0x568945AC1F83C44C, 0x196163685BC92B11, 0x1A47AE02206CF87E, 0x6E47CDD7867F3FF2, 0xE305FFAE6AE577E6, 0x8A3A001D6F06BCB0, 0x0C5C044FDEB7E978, 0x0000000020FB5132, 0xB986187A528E9535, 0x1B24613CCCC1AC23, 0x9C4B341A39BBE0B1, 0xD986BAA05A4AEEA1, 0x2101B4B50710DF39, 0x079DD1E38C0BDC25, 0xC41A4B8B57916362, 0x83980A6D50964417, 0x2E9BFEC6A1C70A26, 0x00000000B027197E },
+{ 0xA8AA90B1EB64256C, 0x19BD9D4FA86D3250, 0xA46CDD403522681B, 0xE6049AB5BB1B7388, 0x4052B87DEB466C10, 0x94BEDD4C27D48920, 0x38087A1020A70EDD, 0x9C95511C17D80015, 0xD128C88562661113, 0x000000019682AB39, 0x7ED1EC1F016FD601, 0x08DFE0F6ABFFA4ED, 0x09D27F9B85E1C86B, 0xFBFA81E843A78041, 0xAEE822291ED5CEF6, 0xC7E937036B2DDCDA, 0xC005E79557B1CDA3, 0x755C87747EBFAA3E, 0xBC76B5B74ACE7635, 0x000000009F927C82 }, { 0xB1770F3DA5A2D236, 0x02F34C860E184FB1, 0x2F46D21B884229F9, 0xFBDA943302276BD8, 0x1C18F4D98ED028C6, 0x35918EE4D50B58B7, 0x10BC86E7860A917E, 0xEAAD56C744644140, 0xC32F28956F5D037D, 0x000000014A32CE49, 0x1F5C8EDFC2EE2C94, 0xFDC57E9D0DE43399, 0x69322A5F74E03413, 0xCFDE8C5B0088F4FA, 0x81EE1E8AF3F26884, 0xAC8A3D93CAFD0054, 0x8F60F3C9102DAF8F, 0xD6895C5D8C2415F9, 0x3DE7C057674F9524, 0x000000008E538082 },
+{ 0xD72B9EBA852CD0AE, 0xDF31F014E3E55E81, 0x4048F0E478083EEE, 0x894E05514C38551A, 0x34656E4D72E4E007, 0xD3E0153E4AA5C3C0, 0xAE02D900F2B54F04, 0xE9C902032A58F895, 0xF696719DA9B22F64, 0x00000000CABBD697, 0xA25EDBA8F0DC259D, 0x65CB26D8BAF3C052, 0x60751BEF0BB8DB18, 0x3612F2A1483C46FF, 0xBCB3D3589AD30829, 0xCF0C2F0EBC8B1B4E, 0x054E29F7BBADC7F4, 0x9BF4F6FC0956C7AC, 0x67DBD2D6C9C044AA, 0x000000020067D322 }, { 0x37D209BBA8C2B3D6, 0x54F00217326E9CCA, 0x062C886D344CCBDE, 0x6D002E8CE1E73966, 0x33101380194F6D77, 0x11881EB1865C65AE, 0x6764A75E56559B67, 0xDA4C74CA0717280F, 0x2F27DCDA6B1925EA, 0x0000000133302621, 0x56774A78FB354BD2, 0xF8D7DCBEABB85A8B, 0x16F1C44A06F4110B, 0x02E52FD6290BEAD5, 0x5D9C4D0A7C1AAAC1, 0xD40D2E219AA839EE, 0x3F81D1ED5EBF0943, 0x14C6E6416AE853CE, 0xD43708AF6F4BC650, 0x000000025DB42ACE },
+{ 0xB5F4962933815052, 0xBDEF366CE003B457, 0xF3382C06ACA6B04A, 0xA20244B2A3E11B3F, 0x139F798922FC6299, 0x3DE7CDF34A42B749, 0x7C10B37E09F6EEDE, 0x904AD8F11ADF4599, 0x8D6B67FFF0D91570, 0x0000000223A95921, 0xFC026A39B191357F, 0xC4F09553027F230C, 0x1EAE13176BC5EB74, 0x56D9418385649BEF, 0x1EDD8DE58B130FA1, 0x76F0E6CFC9ECB224, 0xF2EC8A5E0C85A33E, 0x5073A0C0CFD9F7AB, 0xA3E7459C8F8AAFCF, 0x000000019D17E2B6 }, { 0xB138415981AC6C57, 0xB6A705B3A85D2962, 0x551DE0C363B0484C, 0xBFE411B57AE7B297, 0xB633E0440FB09A38, 0x4D32FC23A8160E12, 0x3CE3A3F85899BD3A, 0x668F5C7CA5BFBCD4, 0x34CC1FA3ABE49A64, 0x00000001F1B157EB, 0xF564DA384D652D45, 0xCFBCC46AF962AF1F, 0xF7C9D4B34591A366, 0x382A5C7AFAAF994A, 0x7869D04585A360A7, 0xA3D1D9CD16FE80DF, 0xBADC37DB888E5E9B, 0x298DA119627C46E3, 0x957C57E1A3675455, 0x00000000372839E0 },
+{ 0x81447DA075DD6A39, 0xD8C6BAE24EA1E2E4, 0xE4D82003753CB5DC, 0x9E39323B287AD7A0, 0x2C0599AA14782219, 0xECAC28EF7E86C088, 0x41FA3B0A180B5996, 0x15B68D555E530058, 0xD989E94F31E7BECB, 0x0000000123CEC95B, 0x3339F721D645BA98, 0x894863CE3A77C0AC, 0xF8CDCBE5A8E44807, 0xA269401F8A7C60D4, 0x5D3CF8EED22DF8BF, 0x9153B3C959FABDFC, 0xD87D1AC7CE3B2E7C, 0x828DD67CF87030FF, 0x0D20857BD572FE9C, 0x0000000164BF6AB1 }, { 0xB2AD787EEF161900, 0x1AB2688449749FF4, 0x00E171C88DB153B9, 0x789BB425BC3B39C3, 0xC02D956736AC8BB1, 0x5CF46B445E2B2D9C, 0x9B0BE15C086847D4, 0xEB3A55C46A6A3457, 0x2618E49BC35F3809, 0x0000000199A53423, 0xB7F59E6D76AE4D3B, 0xB151C14D48D9C241, 0x1E5EC9E64CFD2F96, 0x1D7DB279BD3828B2, 0x6B0EF1C4AF4180DA, 0x63D8E73308688853, 0x5A67B22190D16E13, 0x5D433D5C772CD19D, 0xD06679E096CFD249, 0x00000002090872B1 },
+{ 0xDB8D4B0ECFF7DA24, 0xB6BEAB26F18028FB, 0x7E917B248100F355, 0xC8A9168FF905BDF3, 0xE55AA070C9C2ED74, 0xFB08D3AD286B3422, 0xCD7549F9E6A0152F, 0xAE896273ED7ECA12, 0x053F4E63FD655956, 0x000000023B90F919, 0x99E69887AFD717D7, 0x71FFB61CC76C4083, 0xE7AD5304BCC8F2D4, 0xF1F3D053E58864DE, 0x58362770D2E94921, 0x06E2F88CC009C428, 0xBB2A2A07D392D285, 0xD16C2DB5A1C75A4D, 0xF6A16DA0A8C06553, 0x00000001960A290F }, { 0x2472B4F1300825DB, 0x494154D90E7FD704, 0x816E84DB7EFF0CAA, 0x3756E97006FA420C, 0x88A75F8F363D128B, 0xB66F7A3B81EF7C0B, 0xCD72754B1DEFE47B, 0x03CC508623455B17, 0x7C50C25E54827F36, 0x000000004065AE4F, 0x661967785028E828, 0x8E0049E33893BF7C, 0x1852ACFB43370D2B, 0x0E0C2FAC1A779B21, 0x15CBD88F2D16B6DE, 0xAA95555BEA50EC06, 0xDFBD953D30FD2726, 0xE0E985446EFCCADC, 0x8AEEA321A9277338, 0x00000000E5EC7E58 },
+{ 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 }, { 0x3F0E39512AE5B58A, 0x29D3DC577B20A10C, 0x875311B08C89F9DC, 0xAA49F42F5A7933A9, 0x178E4B0326D7B832, 0x285A977152561775, 0x2CFEC44F1CA5C209, 0xAB02EA1E63234982, 0xEA4B243089193DA4, 0x0000000271317373, 0xBB9B280114D1761E, 0xD82E5827008CB43F, 0x89BC6508093D8E21, 0x0A2ECD2193422171, 0xF96D5E4B019E6AE7, 0x20BCA648199362DE, 0x353713B9BA82DA83, 0xD2DC364122E519C9, 0x2B1D0098BADDA961, 0x00000001AC6BE3F3 },
+{ 0x9A82B75F5B8C95AE, 0x46858DE0F51410DB, 0x53874D585E7BE566, 0xE9D8F659AC7049FF, 0x5E830254DEEA7B27, 0xFEAA1CDC3CED5551, 0x48B7CB89AD0E0B67, 0x67B3E6A1B73248DD, 0x45A19085D24DE60E, 0x000000013B270256, 0x34125B312A909849, 0x1174DC80FFC50792, 0xD2B6DF974F9B0687, 0x6322FE97B1E6AB49, 0x598A6B9A7FFB4D1A, 0x5B346BADB2690CCE, 0x76804BE34CA05604, 0xC045D7EA51AAEC98, 0x0EB8F558A55AE5ED, 0x000000012395C2E5 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0xC26AD631504CEBCB, 0x152039FCC0E69EA9, 0x385E8F60C6DC1B34, 0x293E5D23BF1034C0, 0x6F029E3A0DE5A12D, 0x105E62AD362EBD7E, 0x1952D73B091E7EC8, 0x37860EFBD51311C0, 0xF32005CDE0F5992B, 0x000000005EEF0F2C, 0x64EB91CA748EB99D, 0x0C05398BE93FC411, 0x41D203BECFC68FF9, 0x0DA24985988DFF2F, 0x15BDEAC44181E1E9, 0x294765C3A8EA8439, 0x41100CB2FC28C61D, 0xF7E30667875F586E, 0x7657B569675A0879, 0x00000001095878A3 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+};
+const f2elm_t64 DBL_TABLE_EE[2*(NBITS_STATE+1)] = { // A point per row represented in (X:Z) coordinates
+{ 0x093F65665406305A, 0x340FE212268C5A63, 0xEC994D5DE8FF1C82, 0xF5C20CA43FE1B2B2, 0x42158517211AE4F3, 0x457C9525953768EE, 0x2E814CFAB09658DD, 0x1190C3B3ECB648CD, 0x710059B1D0A9D3DB, 0x0000000124D12CE6, 0xF41D26294028F2D6, 0x02F6A98E65CA017C, 0x77C4AF44D8498913, 0x2154484A24A8CF67, 0x29FA4AA27A866E04, 0x686AF92C971317DF, 0x28E686B3A086F7B7, 0x3BE6D82A0872769E, 0xEA56CF93696EA141, 0x0000000192B76918 }, { 0x00000000670CC8E6, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x9A34000000000000, 0x4D99C2BD28717A3F, 0x0A4A1839A323D41C, 0xD2B62215D06AD1E2, 0x1369026E862CAF3D, 0x000000010894E964, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0x80534163FBF35BCB, 0x3941AB0D99AE082B, 0x93D6654399E0760D, 0xD5703E661233AD27, 0x38EE086781650A8F, 0xA8CD39B3B2F9F75E, 0x321AC43A37C3259D, 0x4F004107B93F9E0C, 0xF595F91808CD93C4, 0x000000007624C689, 0xB2BE0BFE1C38A003, 0xBAF7DC6965507C44, 0xD1E8ED1C83321750, 0x3B6E6CE363E1A52E, 0xCA84DD3586265940, 0xF594AB910A825216, 0xD6B8B2404935865E, 0x9C4B0A90CC049E31, 0xA58E8D7A3FE0101F, 0x00000001B9A02ED8 }, { 0x134FFAA1AF1AE83B, 0x48FB68C129F8D6FD, 0x4A61DAC9B59E566A, 0xC9A0032ACE0FC339, 0xAF62C01869882C24, 0xF1BDDA9F7CAFC0A5, 0x13529AB4E6DB5FCE, 0x29E7850E8C559FA7, 0xD3E66CCA09C0F855, 0x0000000007437866, 0x205A857EE022A973, 0x5A0D9EA7BA2FDFC6, 0x6E055A312858E5A2, 0x6D6BFCF25796BAF9, 0xAFCB4D7FF65FCB84, 0xB0BC1C098E59B54A, 0x1C4AEFA0001DC781, 0x6359AF296BD3EF18, 0xDFF2F214ADA3641B, 0x000000008E3318A7 },
+{ 0xE7AA9DF785C57336, 0xEF1943D3A329611D, 0x8364F3FA19226C20, 0xBBA8BA23E99DD6DA, 0xD567BE27321A6BAE, 0x99C2A91C24F9BDBA, 0x83EF3D8F5BABF716, 0x4A11A3D6ABCA18AB, 0xD1AD80DAF0948AEB, 0x000000026BB3F794, 0x6E35D2CA6F0F38BD, 0xA4B999482935212D, 0x09C9A6211965CA08, 0xD8A3FF58D2264437, 0xC5B7C28142BB4C61, 0xEFD456009A55BA40, 0x224F4BF8887E142A, 0xDB4F3B941EAEACEC, 0x376BE6E2AF7679BF, 0x00000001D8F92841 }, { 0x72F7CB7992A6811A, 0x6DE1D904ACD3D477, 0xD586724058795EF1, 0x0518830328F5F3AC, 0x26EAEA73F1E60233, 0x839C6112B013E4E9, 0x7E2DB59BCA747580, 0x981FF43837BD7E54, 0xD96A7628446A6C4C, 0x00000001243CF412, 0xBB5BC8153ACA9697, 0xB385B71BC85CC297, 0x261C0DE325D9DFEB, 0x61AF1A535E386AD2, 0x612CBEBA2582DD5F, 0x18FAD820A0BE51F8, 0xC9CB55F3EC4F2733, 0x11B4135865651252, 0x5D6B5A9759306DE8, 0x0000000109A73304 },
+{ 0xE934E781B3DF598E, 0x283003A4A9701662, 0x1CA0450F2080301A, 0x0D0DFD97720D0478, 0xCEB841BF7FA1E104, 0x817A682AFF948365, 0xFDD4B88E5F449578, 0x503135BE309D74B2, 0x572D255A61817471, 0x0000000002959AA0, 0x5A87E7F096E56B3F, 0x8D42A806B484492D, 0x8984F48499FC1B5E, 0xEBF8928975F35140, 0x90C30FAF47CE083C, 0xA74B185FEE626173, 0xDDB1C688822EE779, 0x1CC58EA3F7BB0998, 0x4A84F2134472D840, 0x000000013BA39D2C }, { 0x1E6F4101966B8DD2, 0xA8ED7B1AF590EA37, 0xC80992BD2895CA1D, 0xE92CD2BCF4B37F86, 0x11BF5E9E9A900858, 0x0312E773B7C4F8A5, 0x15D130A01663DD69, 0xA4D301A3CAAC3FB1, 0x5DE8DC4E71DDD423, 0x000000003AEE6518, 0x0129F582D46746EA, 0x71AE6081C35C67D8, 0xC0339B6A7C7DA3B3, 0xE85D0011C03CD3C7, 0x4B8A692A3B2F7B41, 0x13830493E22A63A3, 0xA57516E2DA3DE064, 0x94DDB0BB1A74235D, 0xBAB43CD9440BF743, 0x000000000C53E9F7 },
+{ 0xE3A56BAEBC003203, 0x0685961AFBDAB341, 0xD47A310C27088102, 0xD76718FC0C4F6771, 0x42710CFE158829A0, 0x4C52DEC9158962F9, 0x900BCF2C9A212579, 0xF29F2616557D5197, 0x31AD5E18FAD608A7, 0x00000000220CE0FE, 0x530069DFB87C30CD, 0xD2CE709B58756501, 0xDE1EA47B77896432, 0x5B96CE7A8FAB2C39, 0x56E854C4959C4DB1, 0xC74298E7EE5D0E8C, 0x39B0F0E6C4DAFD4C, 0x5121E0067DBD78E4, 0xA97086F29530C1B7, 0x0000000045D0E5D2 }, { 0x440D5156DF205C7E, 0x142A8AC4B55871B8, 0x2599DF9B17F2BB4F, 0xB637CDDFE3918277, 0xCAD634DF883A27AE, 0x164F4A7A2F410755, 0x8CB1CAA6B22AFEC0, 0x28AA6E2421168894, 0xA086CE5DCC8D65C5, 0x000000021C774CE3, 0xB891FE313A21C4A2, 0x7449E13D50D6AA55, 0xFB6876FD3F8D075A, 0xA79941E3FD2A3CD1, 0x177087046453F462, 0x5B642545BD46EE67, 0xF1A994E76BAFFF14, 0x7D8077BCA80F628D, 0x35FBB2C85F998103, 0x000000026CD765CA },
+{ 0x26BE0C97F476049C, 0x70D03A05A18AE5C5, 0x610A8779C54EA9BF, 0x2C0784326EA8416C, 0x7EAAB58647FF489A, 0x03BB48594D5743EA, 0xF8AE512A31D2807F, 0x362A6F39C8F58145, 0xD9DBEADEE0DB5EF1, 0x000000009350FB55, 0x09585FD148C117ED, 0x11576CE0E8B69913, 0x52ADC6F285CC5A02, 0xA2882CCA8C5E5472, 0x02880C455ECA9632, 0xEE01859F359B4356, 0x3A5F17C676EADB40, 0xF67EB568B37EB99F, 0x1C8F81E3CE0A0568, 0x000000000643F784 }, { 0x68825960510A1361, 0xFE080FE1644921CF, 0x3AB716887FB2B5AE, 0xA58BD6F9BC714824, 0x1B12381D1A820239, 0x84813BA2479452B9, 0xFDD316FCA7AD790A, 0x76E87ED47685E6C9, 0x4E6FA6B480EE919A, 0x000000005605F63F, 0xF6EFE8A2EC52C2F3, 0xF801283B0D960EC6, 0x1B7054D206C2E212, 0x1317BB1F1CE0F7A8, 0x1F13E823726EEA20, 0x4BBA3D2F5A052EF4, 0xC1CAE46D5B8779F8, 0xFDE095EC75A19A67, 0x897A044F060837D7, 0x00000002194D95AC },
+{ 0x6E09194CA90E1438, 0x4E9C1AF518FBC7E9, 0xA1AFB4F81E416812, 0xB9FC890A4F4EA188, 0xB39679CB5D9AAB24, 0x8AC5CF1A12F70205, 0x30A0A64C837E3C5C, 0xE4112E545DC4C64E, 0x61A79B2BD009E366, 0x00000001EE47FB8E, 0xDA0AF0223449DEE0, 0x3F75D0D1FC42CEE2, 0xCE474E5C104B6E1F, 0xF57CEDE1456EF2D9, 0xAC8BCA8F75A5FF57, 0xE021912DEBD2E570, 0x07D55FE57F438C9E, 0x57D84D2513F1CC10, 0x6E911DF445044664, 0x0000000233F3A601 }, { 0x8B15AC736E61CDFC, 0xF076F88805A09535, 0xF8E99F5CF0CFBF63, 0x9BEEBCBDF301C6CF, 0x7F75CCD759776F74, 0x18A6C644EB681E08, 0xBBE4FA6CD3A6695F, 0xA7E99D54C628481A, 0xF75AC4A0EC287D2D, 0x000000014C21B91F, 0xC3F17B7F6DBE1261, 0x8C21BCDBB1976935, 0x0B189249DFE342EC, 0xF3037444ECFA46F7, 0x3DA900DBE0861D66, 0xF98A4050DCE6A9EC, 0xC9E1306A8397BE4B, 0xD4B523787EFFB979, 0xB6CFB223A324BC57, 0x00000001432B4457 },
+{ 0xEFDFABB4D462620F, 0xB4874975F0996DBD, 0x407289E30A8A176B, 0xF4132F62CD889F2E, 0x912FA82FA9D211D1, 0x4397BF110462A5B4, 0xD31EC6E113C7421C, 0x73A83948916933CF, 0x5AC3DA3F389E5DA2, 0x00000000DFE3F1D0, 0xDA227EA7AAD1A5CB, 0x261AAE2306CE0370, 0xAA29EFBF3504B54D, 0x30FE358D62ED66B4, 0x0D8125703DA9529A, 0x86198D7B680C3EB2, 0xFC52D555ED92141A, 0x74D3203E7CB9EEA5, 0x61B958339F953152, 0x00000001D22A3409 }, { 0x9AC9339F4D1FE386, 0x2622F2161CAB84DA, 0x5C5EBFF70B07B011, 0x2B6E8D20B533D38E, 0x7C24376F03042919, 0xD9E9C1BB18788846, 0xD71322DEA6DB12DE, 0x547CD3201EE20333, 0x52F0851C76421E04, 0x00000000122A6C4D, 0xC93D904D9AD38C1C, 0xDD5ECA99CC9D8F10, 0x6B1BBBDF977A1E0B, 0x7900438F7C196C16, 0xF9C6929355C5BAD8, 0x0FE7FB822ADF75BB, 0x1C509949F4ED5772, 0x106AB4E74BFA49B7, 0x5CC0E1038A9D7B03, 0x0000000212FDA5AB },
+{ 0x5E5DF573D3E9B6A7, 0x768248CC818B853A, 0x8880BAC1732A6D61, 0x8BE15E8EB7677F63, 0xBD8BA2CF423EF112, 0x998BEA20E4DC3D16, 0xB6E2DEB0AA1C379A, 0xA1E800F06BC05649, 0x67A40CFB1EBDA655, 0x000000012FCEF796, 0x32A632A70587640D, 0xDD1F640AAB40A115, 0x43B4DD4480F15B49, 0x716B7C5C8192BEE2, 0x8FF1080E34F53D6A, 0xF046A32DD73AF1D8, 0xCB4D9F71B7D53EFE, 0xBE9324BE70F381AE, 0x49F2006157C03E60, 0x00000001FFE0F78B }, { 0xD9CCE68476018313, 0x113BE550B366396C, 0x02E6468B3CA2EB2D, 0x4833E2C10A3F90AE, 0x10F843125A993DE7, 0xC97AF1D479E6A8E4, 0x95DF0773E7734B4F, 0xD57791C9B4A25646, 0x2B2027FEF322D8C0, 0x00000001F71B10C7, 0x8D3C3916F507AC18, 0x31BCF3E592617AB7, 0x55A3BD3500602B73, 0x04A21D12AAE02B1C, 0xDF6DE6CD593A98B3, 0xE52B43AB218BE96D, 0x72225CE1B4BBD71C, 0x1160B03233A3286F, 0x9469C9226F1A03DF, 0x00000001BB176F97 },
+{ 0x77EFB17DE8113239, 0x751B98EE33C075DF, 0x6081AE2B3431D686, 0xE1F8E1BF283CB157, 0xE9C72AEBEA593FB4, 0xE1A76249BEA96B3C, 0xAFABF8DC25FCC691, 0xA7193D50FBB43E9F, 0x56CFE453E96BB58D, 0x00000000E891530C, 0xE8B0AECC6ABA2D1C, 0x465E6F82BB543A8B, 0xF9583AB3E6253585, 0x5FB999778655B8CF, 0x1C65B736250481F3, 0xDED8C482CDE4D10F, 0xBA4F127A6B1E48B1, 0xC5E97DE2255FF597, 0xBA30E2648F919DB9, 0x00000001E8F911D1 }, { 0x06D299FAE4C64D6C, 0x9A83E985D04FFEC9, 0xF99D78DF7628C0E7, 0xFADFD12C83946004, 0x6035E6C2EBC1A8F9, 0x19A8D4F92D8D0937, 0xB939C195CDF5B981, 0x40042B84CCC2A701, 0x74C05B412291A036, 0x00000001D512A3C7, 0xD651D7F467BF79F5, 0x1BDCA6A4C999DB46, 0xD2A7C8B81EB631E0, 0xEF69C336D3D4A56B, 0x5F6FB410371F7557, 0x0CB11450964CAF55, 0x2FA5EF3A2B2E53E5, 0x3CB610FECE2A3AE7, 0x5C51FA5F11F9B8A3, 0x000000021393AF23 },
+{ 0x1842E07157D48EED, 0xB840FDB87611BFAA, 0x4B50861A43374B5C, 0xA5E5A4BCB986A2C4, 0x68003D6A9853F9A6, 0x1AA2C6E5B5094B8A, 0xBC97CDE1FF4819CD, 0x2F9D60028BF9D584, 0x71216EEBEF1BC01F, 0x00000001B90D6955, 0xB6CE4141B1795F4F, 0x5E975FA9135993F5, 0x48185878AAE937B1, 0x00D6762876631F91, 0x7293E8B29734C96F, 0xCEE76297A6247464, 0xABC4DAFEE787BE42, 0xC62D185A75328193, 0xCEA9C686DF4DAF1A, 0x000000004D6D08B7 }, { 0xEE4C46CC3C405122, 0x51CD805EC17B1DC3, 0x7804BE0F74CCF279, 0x93701D40F96EA12E, 0xFD63B4FF6C57A696, 0x327049CF4F514C02, 0x076BC2A91577DADF, 0x43806767DEA5897A, 0xFA61E0B937466F13, 0x0000000149769E18, 0x22271DB575D5BB38, 0x478225C70BD68C33, 0x03F0B9DF639694CC, 0x1287480F7EFD34FC, 0x428225C5A355C502, 0x979709F1A2E8F681, 0xCA4E5B1254B08307, 0x05E76EE21DD812FF, 0xE6F611A073F9C963, 0x00000001FBF1AC49 },
+{ 0x21E90C7D557DB68C, 0xA6DA4C2133578899, 0x065AF6A553DB19AF, 0x254AE865F4BE55BE, 0x6F5AE0483892BCF6, 0x9144B0FE6741B166, 0x189CB5BCCC46350C, 0x5E0D297535C6B744, 0x87B2BDC3E7DCEA82, 0x0000000173B8F8AA, 0xE9F868E11CFD9173, 0x5C5990AA231AF259, 0x11AACABB560C3887, 0xE5D15CBFCA818626, 0x974B68D4223D0309, 0x5869CF1D0B8BE20E, 0x6B8383428475363E, 0x638698ECDC26611E, 0x34F0543C9BA315E9, 0x0000000264BACCF2 }, { 0xFB479E857285EF71, 0xCD789AB0666C2D13, 0x53F482F1EC9B0225, 0x822E6B4E4FEE054A, 0xEEC3ACDD986B17C7, 0x6A3CC46107E466BA, 0xF7F295D839CE9AC8, 0x0C369183C336BDEB, 0xB0E5EE90D0FF7C18, 0x00000000F6CF3D9B, 0xB71CB91944CFFC55, 0x65B152A1C43A3A26, 0x7570581B92C24B1B, 0xA2884501238AE68E, 0x4A4EF0ACCFFB848B, 0x937DE10981C5A6B5, 0x00012C121284299D, 0x5271A3E716BBF2FE, 0xB00B61D1F86FCD35, 0x00000000F4419359 },
+{ 0x4FDCC61FC96CD63D, 0xB73DFFB3CAD6611F, 0x7E65394E4870329E, 0xF0B7E1A2507F6A9C, 0x0AB7FAF3E8A7F067, 0x5D9372CFE4EB05B5, 0x3062A5A0C5DC93C7, 0x293ACCCF2C32630F, 0x76774EBA667809CD, 0x0000000248A4ECB6, 0x30CD9B256FDCEC33, 0x04B1B520D9CDD970, 0xDE21E4E537B34534, 0x92CB9DF6D573A6F2, 0xF84891742758DCA4, 0x0EC686FA829C76E0, 0xECA2A095CC03ABA2, 0x196FC4225419EF16, 0x34594CCDFAF7C5C1, 0x00000000DD3FE2CE }, { 0x87F24F0EEB9F17E6, 0x5FE28907C3B13C3D, 0xBBD5719B58A04BEC, 0x4796F35DC275C241, 0xF5B08CC8BDF63CD2, 0x364FE58E214C5084, 0xBAEFDA00F37B4190, 0x0861AA61959694A3, 0xCC4FFB6E371E86A2, 0x00000001642CED99, 0x9D21B56C51267E47, 0x84E4EFC829B39FB5, 0x55690C3CFA5B39C0, 0x8B2088FBD2FC10D2, 0x15AAC203B70916E7, 0xED0EF85CFCE34F56, 0x4606D3681DACCC47, 0x279BDCB880B6B13F, 0xB37817112C953AE7, 0x000000004BAF5F11 },
+{ 0xED785A6138FF7AF3, 0xA89CD2BE2948BBC6, 0xEE4054AFC0138D1D, 0xB15F46534B98B0C8, 0xE54292FF743FE939, 0x7FF75FC11AC39D87, 0x004A8142F1162B2B, 0xD21DC3C47B864EFD, 0x6D72015143F6EA8E, 0x00000001B743861F, 0xA03BAEFAF78AE824, 0x63BE7EF84C31718D, 0x97095F4A4BEE2076, 0x62B1F5897B1FE9FB, 0xE7AD22F02C6955AC, 0xC3F19714FF39834D, 0x07DDF2B6A3B10ED0, 0x6F72295BD34BA64F, 0x3CA3B00351884688, 0x0000000167B646B8 }, { 0x9370890E18A511C5, 0xADDB9126317239EE, 0x4652DE608FBA23A0, 0xA0290196ED03C786, 0x191A67706A12ECD2, 0x7056B5C5E27CBCD3, 0xF8B9B2F54F0425A6, 0x9BC6F372EEC975BC, 0xC343F0FCC5B95761, 0x0000000227F6136E, 0x09ECFE92AC35A1F6, 0xE7728B8C6F929862, 0xE319392CABCF9024, 0x5218571727FB9EE3, 0x3B4B28DEDF69883A, 0xFB0581443F4BF047, 0x86011AF0F8542212, 0x625F8AF384A3D674, 0xFF66B05D8FEA509B, 0x00000000A927D3C7 },
+{ 0xB07F74EC0B6CB180, 0xFD82231DFDC91CD3, 0xA0238D43A5A2A3F0, 0xE9D5D1E3532CCAED, 0x8F69FCCC91C050B2, 0x075837F1F1746341, 0x92A66BF4803BCBBC, 0x30DFF7BAAA902E6D, 0xD0A298D08817651E, 0x000000007ACC14DC, 0xCACFB7C307E7F26A, 0xDB7668B851FF93B3, 0x1F6858AB67A0B71C, 0x86D769664DBC43D6, 0x2148086F0262FFF1, 0x3AD691788D12BAA5, 0x42709D71F4DC9C06, 0x47BA3F0365F1AE96, 0xF9C6800471B053A0, 0x000000004134EBCB }, { 0x9180C28ED6327829, 0x8E063E8BC1BE7D3F, 0xEDFC543761D4DA84, 0x1D3B67788AEB8609, 0x0A4E02B30784AAEC, 0x384E6C78FDB93F00, 0xB675E3C1754F31A8, 0x8DB66FDF788D002F, 0x3F58C6CDD3676743, 0x0000000006F37CCC, 0xC5918409AC8DC9F1, 0x1990D2C0D312420E, 0xAA06775453C4CE9A, 0x2471416928ABDF6C, 0xF5A23C18D7450C1B, 0xC40D27F5AA2E146C, 0xE47E163A5A80B610, 0xB58C095E6FD959A7, 0xFE25A5D7EBEE7DAF, 0x00000000BB92FB3E },
+{ 0x84D27BE67D1B0454, 0x8E204C878CFBFF8E, 0xEECE550031187873, 0x97BBC1FD6C6F3690, 0x3799476FF45FF1AA, 0x412E348379CB040F, 0x621E18B32A0A0D33, 0x830E419A08CAD5E6, 0x9CEAA71E2653FC1E, 0x000000014583DB25, 0x9901B3FCBA9D41E0, 0x927A828AC1DF70F8, 0x83C4D4903CE82833, 0x9157B6EC1AD25422, 0xB3C4C8EC07A6FDFE, 0x1B61F20D4B1C3658, 0xC7466335B9100616, 0x3B984EBC5322864A, 0xCA78EEE4D72BF543, 0x00000000A5BF7F7E }, { 0x8ACF625B38388FE2, 0x3C93FF2B61DE3C64, 0xF1D2053A2EE69431, 0x3505AF3039D5402F, 0x279CF2C013644E49, 0x528DF59E84493FFA, 0x15CFDEEE3C9669C1, 0x8B6511EB2AED1AEF, 0x00745A759CD039AF, 0x000000026CF37100, 0xD1EB0B9A8737DF4E, 0x143991862C44AF01, 0xF627A98463FB13D5, 0x4903FA5F256C5D35, 0x6C21086295E61AFE, 0x109FBBDB9CC60E83, 0xD8B92F3C3E09940A, 0xD51EF19DC8BBD8F3, 0xEEFB19A5A258CD45, 0x0000000131A4956C },
+{ 0x4195CAD7A945D7B3, 0x25B43C57C83FBE0A, 0xC68BCB949912E778, 0x1FDE2058D3CE49BE, 0xB146BF8DC17746D7, 0xE8D1317D6208A757, 0xD0BB1E2DF6F8CCC2, 0x2E2048FD52757E00, 0xBFAE7FB8ACFD461D, 0x0000000172949027, 0x4EE852E575E9159A, 0x6A5B48726E0D78E0, 0x43C64C47E68FB153, 0xB7E61E5AA982ADB0, 0xDCEA43AA923259DB, 0x749BF15A24A8583B, 0x8EF1E47913542F0A, 0xAF4ACCCC8293D53E, 0xB204D2B07D7867C0, 0x00000002154604DE }, { 0xBE6A352856BA284C, 0xDA4BC3A837C041F5, 0x3974346B66ED1887, 0xE021DFA72C31B641, 0xBCBB40723E88B928, 0xC8A71C6B485208D6, 0xCA2CA1170D972CE8, 0x843569FCBE4EA729, 0xC1E19109A4EA926F, 0x0000000109621740, 0xB117AD1A8A16EA65, 0x95A4B78D91F2871F, 0xBC39B3B819704EAC, 0x4819E1A5567D524F, 0x9117BC556DCDA624, 0x3CDC5C8E85B257F2, 0x0BF5DACBF13BCAA1, 0x030AE62D8E304FEC, 0xCF8B3E11D46F70CC, 0x0000000066B0A289 },
+{ 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 }, { 0xDABE2C003AB7AB31, 0xD3833384256B3482, 0xF3010542341C5157, 0xDE57576AAB2F718F, 0x4287206239DB7860, 0x1C104A4418339DCF, 0xFF88BC4BAC9A9D12, 0xF29332D8D510F5A0, 0x7D70D960BBF15B20, 0x0000000234C07876, 0x6611ECEF03359494, 0x22F9780ABA907B85, 0x29D264921946128C, 0x1FBAA2F382BD0309, 0x97E605F7A1870F29, 0xAC3F940D1BF26E6C, 0xA1341818338B9B78, 0x732BC3AE6E42E863, 0x77C35FB07EBCDCD2, 0x000000018A175DAE },
+{ 0x2566CE88FD642910, 0x323B2E4ABD18183D, 0x68105C575333444E, 0x1983438A39DBE499, 0x85B47AF62D0B02A6, 0xF3ED867482EEB7CC, 0x32785AF64CF052EA, 0x4513D46CABE697A3, 0xA9B4D8A623B452ED, 0x00000002471A2565, 0x9BE1AB9520B1C6D5, 0xA0B61D83178D5099, 0x38B008CA7EE443DB, 0x4BF814EBF614D780, 0xA7C0EA7AA776AE4F, 0xA7E10922DE025D5D, 0x78777F875B18BCFB, 0xFADB07BB82060DCE, 0x55C7BC0174E8DC17, 0x000000000DBD1BC6 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0x444FBF9529C30A72, 0x9DD8B6A9EA5E481B, 0x1DE01E151EBB3142, 0x95B1751084B15850, 0xFBA451DD7A2E3378, 0x114A8A899F21DA2C, 0x02FA3F12E691B7E9, 0xBA15A24B1AD6EED5, 0xBDA525FBD5D7EA1E, 0x0000000102E13A9C, 0x1CEB13D3209324B7, 0xC9F4AFFD4FE277D9, 0x4FE78310E2B58C2E, 0x758A297F5581D379, 0xEBD52BAA8201FC79, 0x8FB6DF51C43C5F85, 0xE63A95DA7DCD282B, 0xDC567C3130C498B0, 0xFF9595306838115C, 0x0000000061506BC8 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+};
+
+#elif defined(P697)
+
+instance_t insts_constants = {
+     .MODULUS = "p_356_215",
+     .e = 20,
+     .ALPHA = 2.25,
+     .BETA = 10.,
+     .GAMMA = 20.,
+     .PRNG_SEED = 1337,
+     .NBITS_STATE = 19,  // log(S) = e-1
+     .NBYTES_STATE = 3,
+     .NWORDS_STATE = 1,  // Assuming 64-bit words
+     .NBITS_OVERFLOW = 3,
+     .MAX_FUNCTION_VERSIONS = 100000,
+     .STRAT = {4, 2, 1, 1, 1, 2, 1, 1},
+     .jinv = { 0xe1587d4878b5375a, 0x8e0235b025c3dcf1, 0x09564fe4f91a6536, 0xd80e74327109e007, 0xd85e52ea3218eb6c, 0x8f094167f51f28c6, 0x881b96736e5f83cd, 0xc894e35a46d5c53e, 0x6a78912518658617, 0x9e2c5c1993e47a68, 0x0138054438488d59, 
+              0x0c2e161292a987c2, 0x5a5f6639154e4ad4, 0x18018ee17c131880, 0x1360564510fd95e7, 0xf732c0a49e424cc7, 0x90ea478e030bd441, 0x54a307f6b2f6ab27, 0x440e6784f56465af, 0x182fd8526cc77e63, 0xb92f283bc6c7131c, 0x0186bc0081f22af1 },
+     .ES = {
+           {
+           .a24 = { 0x000000000000012c, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x349cc1c000000000, 0x55efcce52534b97b, 0xde72bec5bc967b9e, 0xf4470fe7c72141d2, 0x776993845c55094b, 0x0180fa933101acb7, 
+                   0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+           .xp = { 0x997cef0dae153854, 0xc4af7d22ba3441b8, 0x36dd4b9a133ae50b, 0x5bfa8ab87df3ac0a, 0xc4d3bd9a3512af7b, 0xb064ac0c491d9e59, 0xc825fab09335458b, 0x03b4e457085033f7, 0x1686053f0c13db8d, 0xc5432ced5a531306, 0x01a1cdd6dc4d59e2, 
+                  0x0f962667eb5d7f83, 0xd97a61ae2f756751, 0x1d9240f105174f22, 0xc42d1394763e8d00, 0xe3b42377dec2af60, 0xc439bf1c0186afa1, 0x284d27e900ec8363, 0x39faf2ad08651357, 0x4a2f50e064fc03d2, 0x74ab7d8871288812, 0x01637c26ea5b7a11 },
+           .xq = { 0x8da9389ea77598d5, 0x5d9bec5f129415f5, 0x86df7b46289dac98, 0xe3490aabe3bc203a, 0x5ff366a7c36826e9, 0xb4e3d50930529fc4, 0x2c5ad7d30391d578, 0xe25c3d96c5d779cc, 0xe2949cb77baaa807, 0x7a15a74c3170245b, 0x01990784cf94e308, 
+                  0xe3284f64db87f2ec, 0xb032727cda501479, 0x4a70d666503c034e, 0xb4ae08834ed5a84c, 0x64dcd400a9354d4a, 0xc36f3b85d1a117de, 0x3b49db4584da8adb, 0x95f133c65588ea10, 0x2a1d5f703b1b4010, 0x1412e81735cc331d, 0x000d4caefb52feaf },
+           .xpq = { 0xd3234deef85e9f42, 0xffcb07b952e38309, 0x6f4b55b3e193dd24, 0x7a34fd1f4dcf0d4e, 0x81dad3329479019c, 0x393db77c749cb2a1, 0x0e8e82416d96a81e, 0xbc062e7ef0fb9f4b, 0xf6f4f49858ec063b, 0x1a4b279799054c25, 0x00bf9e02a74f9ced, 
+                   0x05f23823ab3f5d2a, 0xc7bfcca961941914, 0x2cebe5ceb850f5b3, 0x53b898af672b0b4a, 0xaa70bdc550546d6c, 0x3ebd72c7f8c08e8b, 0xe3a210e5998374b7, 0x26ca8ee81b843a7a, 0xa3d8e6e033b4faf5, 0x73af34edaf0c7709, 0x00066d2288d9e43d },
+           },
+           {
+           .a24 = { 0x000000000000012c, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x349cc1c000000000, 0x55efcce52534b97b, 0xde72bec5bc967b9e, 0xf4470fe7c72141d2, 0x776993845c55094b, 0x0180fa933101acb7, 
+                   0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+           .xp = { 0xe5e62fba82247514, 0xc2f2c74348307f2c, 0xf1c96c50d1d06b09, 0x791285869d446c83, 0x49ba0892264d26aa, 0xe4eb578a2c290bdf, 0x91313216a41c0884, 0xa347c44a18c4097d, 0xe52fa4211232b2f6, 0x8476ae990761d7b6, 0x0187afe579c4ac8a, 
+                  0xddca795a8ee590e6, 0xabbb70806e5339a6, 0xcfaf7bcac7dbcd92, 0x6ba2bf9b722839c7, 0xa4fd70527a5ab60d, 0x613aa06aa7e47a2e, 0xc571745316aea646, 0xeadf7ecb49f7d100, 0x6ad278b48b4d34c7, 0xe5b505c5e9cbc86c, 0x00cec35effa629bb },
+           .xq = { 0x8da9389ea77598d5, 0x5d9bec5f129415f5, 0x86df7b46289dac98, 0xe3490aabe3bc203a, 0x5ff366a7c36826e9, 0xb4e3d50930529fc4, 0x2c5ad7d30391d578, 0xe25c3d96c5d779cc, 0xe2949cb77baaa807, 0x7a15a74c3170245b, 0x01990784cf94e308, 
+                  0xe3284f64db87f2ec, 0xb032727cda501479, 0x4a70d666503c034e, 0xb4ae08834ed5a84c, 0x64dcd400a9354d4a, 0xc36f3b85d1a117de, 0x3b49db4584da8adb, 0x95f133c65588ea10, 0x2a1d5f703b1b4010, 0x1412e81735cc331d, 0x000d4caefb52feaf },
+           .xpq = { 0x722e8849804db5de, 0xbfbb6544797e0981, 0x5cc248c533e0dbac, 0xd1929445d68891ba, 0x85c196744bd42c31, 0xfd0af01a84c61579, 0x659acc048fb58372, 0x6da979c9df1cbd34, 0xd57bb98fed28672a, 0xa375528d42ab3e0e, 0x001747bb13fe1b07, 
+                   0xee8d864e2b2909d6, 0x2e278ba8f2130608, 0x03d8400cd0510a9e, 0xf8732a71d6855c59, 0xaaf3d876720fb3a7, 0xccb4e78728121569, 0xb0682ff8c5dfe837, 0xfbf7c4b2f94b9b06, 0xd1ef36d5ab1871da, 0x3ac561754fb0eef9, 0x00807d0bede77076 },
+           }},
+     .EE = {
+           .a24 = { 0xe343c7921f778e21, 0x2d20ca21785718c7, 0x754499b87883141d, 0x2d636a69fd55044c, 0xd3a2ce1f7fca8468, 0x957c35fd0ae68371, 0x5d2647b98dfd0c28, 0xc1d99300d9a819aa, 0xd64e7879ddf368ab, 0xe8ef510ea6cfa60b, 0x00ca31fc44b5f513, 
+                   0xc69a8094c646ab9c, 0x76e76e2670e90c02, 0x23e4d621e9e65f3d, 0xb1acfa2e66d9666c, 0xfe3c7a6d40fbb931, 0x4182d0acb1bb8a1f, 0x2ca9009d81994275, 0xf29986664dff9d42, 0xd2f3aef28ca6e1ca, 0x9e72d5e21639131a, 0x000fbbd90a19eaa3 },
+           .xp = { 0x6d9e79dfdb558b93, 0x2c9685446ab4a380, 0x056b4249a76982da, 0x0e2aaf27dc172ce8, 0xd08a9d38f15bc78b, 0x139e5099b4ff6366, 0x280039f5d1305638, 0xd78dfde60a11dfdc, 0x0babe599e5ed324d, 0x2da08389573ea938, 0x0172796efca6d305, 
+                  0x96c5adeb44cb9f30, 0xfe27b63acc77344f, 0x4a06f0086766e98f, 0xb03daa4105d75375, 0x742367477212f116, 0xb52d890fd7400f0b, 0x7cbb59665171790c, 0x04b5853e896e30c7, 0x6ee2512e2eee59c7, 0x0b4e2248dc9e6aab, 0x01251270927649f3 },
+           .xq = { 0x7070820eec1d65d5, 0x7bf8a17aee026167, 0x1d4869d6d9003f94, 0x2c382635a75a6889, 0x9627362dd3d835ec, 0x78bd21350c530f03, 0xe8ab14f068c62c5c, 0x1a4e85c9b88ef921, 0x70da3dc6831a1b10, 0x15612cadb31ac69e, 0x0039056956e2817f, 
+                  0xedd4690223b26841, 0x4985282d06841ac2, 0xbedee34951320609, 0x8f496fe24243d3c4, 0xcaa99e72dceb4294, 0xffac185c3644947e, 0x15af70faad1ef5a7, 0x488de2362e40fb40, 0x599f8ba0d5c8fd52, 0x183ad16f8fc67be4, 0x0072ac1a87fa280b },
+           .xpq = { 0xe5a11b12277026f5, 0x2c89f41dad19234a, 0x2c6d7be85bf3cd97, 0x6da9c5b52fb88222, 0x22e1af262cf826f7, 0xc4a7b759bc7e1928, 0x06ce5d2ceefd8e89, 0x3191bcefef375737, 0xc4f2338995b2271b, 0x555e4bf13e037969, 0x012271357dfca539, 
+                   0x558a4f7cd800952c, 0x7b85ae26aab9fbbd, 0x4a2107f2eb97b6d9, 0xcb17cbb4168b511f, 0xb0be0ec49cc34482, 0xd41e61f04da80fdc, 0x9570f633e14f4783, 0x6e5bf8f29bb00d25, 0x6e114070b6aa8413, 0x4201ba3323971a22, 0x0109ac57ad182327 },
+           }};
+#define NBITS_STATE  19
+const f2elm_t64 DBL_TABLE_ES[2*2*(NBITS_STATE+1)] = { // A point per row represented in (X:Z) coordinates
+{ 0x8DA9389EA77598D5, 0x5D9BEC5F129415F5, 0x86DF7B46289DAC98, 0xE3490AABE3BC203A, 0x5FF366A7C36826E9, 0xB4E3D50930529FC4, 0x2C5AD7D30391D578, 0xE25C3D96C5D779CC, 0xE2949CB77BAAA807, 0x7A15A74C3170245B, 0x01990784CF94E308, 0xE3284F64DB87F2EC, 0xB032727CDA501479, 0x4A70D666503C034E, 0xB4AE08834ED5A84C, 0x64DCD400A9354D4A, 0xC36F3B85D1A117DE, 0x3B49DB4584DA8ADB, 0x95F133C65588EA10, 0x2A1D5F703B1B4010, 0x1412E81735CC331D, 0x000D4CAEFB52FEAF }, { 0x0000000000000096, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x9A4E60E000000000, 0x2AF7E672929A5CBD, 0x6F395F62DE4B3DCF, 0xFA2387F3E390A0E9, 0xBBB4C9C22E2A84A5, 0x00C07D499880D65B, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0xB20CD0E9CE6DF1C2, 0xD4776554682384AA, 0xF3E90608803226CC, 0xA09CD07395A4A6A6, 0x9188E59356BB6EE8, 0x0AFB848DD92DFF0B, 0x9A1A3EA335F3E051, 0x440E7B0D91B4E25D, 0x0BC61B1A7F51D85D, 0x5B53615716B47E42, 0x012131A1571AA604, 0x119ECE9524486BEC, 0x47AF08FEE75D6164, 0x77D4F27B87C9C219, 0xB55D074EAA7BEEBA, 0xD6B8F766A9F7F7E8, 0x918E700CEEBEE6E6, 0xFA20291EA3F287FA, 0xBA98C6C73571E560, 0xF9EB481E6CB6D2AE, 0xF0A0DA09870C6582, 0x01930E2345DB99C0 }, { 0x13EA230B8399155E, 0x7F7BC55B50E4F0DE, 0x911DEFD0A00B2CC7, 0x240B5882CB1259BD, 0x05F9356EAFF98407, 0x0F52B21D8EF6BEEA, 0xCC1B3F876DB8F92F, 0x718D049222963754, 0xCDB7F100678B9F9C, 0x59699140308E4741, 0x00F05DBC6EF88E5B, 0x567725A388BDC6F9, 0x00704B24F98441F9, 0xAF1BDCD5EC16B3C8, 0xD3DC27CBD65F6B09, 0xA2820DE8CA0BB14C, 0xD01C086E7A9CEEB0, 0xE4FFDAFDAAEA66C4, 0x3DE4DEFE10F86764, 0x713A44A43CB9DE0C, 0xAC4C95A12B6B83BE, 0x01A91B4BF55D624C },
+{ 0x7D46A7CE14B06997, 0x8E38A54DC11AB3D4, 0x94DCB5D4482051C1, 0x55BAC63AECF80361, 0xD104BB1A51BC440C, 0xEB05063BE96102BC, 0xEEF2CD8389F275F5, 0x44050CCA82EFF58A, 0xB704DC142DFBFEC5, 0x394B0E8386089E80, 0x00AC6DC4A2E66303, 0x3FC21C5908D353C3, 0x9D2C493DFE2D2525, 0x3D45AED514C5DE31, 0x67AF39287DDC4F9B, 0x08C45465CD792C06, 0x1DEB64099DEAFBDB, 0xC70D25AB5EDE9654, 0x411E67529DB9F979, 0xE9AEBA26C975E147, 0x4BC8DADF5A996EFC, 0x00CC029E7F689F91 }, { 0x59C59A4AE95DC88F, 0x5C1087C7EAE4EF04, 0xDA948812DF3817A2, 0x2B1AC53F0D088D61, 0x0FAF9D0BBB0CA565, 0x3AFFF2D5060416A3, 0x83DD371FA687958B, 0xF94D1022173947B4, 0x64C182B94205A6D3, 0xD0825738B49EE5BD, 0x00901F411365D363, 0xB275219689CEC075, 0x6B96F7AC0536EDC5, 0x4C02FACA3992DE1D, 0xA39CB99E6ABCB88F, 0x97944F4AE0B820B7, 0xFF3B61294EBF94AD, 0xA1CBDCD4138C46A7, 0x0B651EF4D27DF05B, 0x2B69F3B4A160EE41, 0xA9B4949A36495EBE, 0x00B3629722DD240E },
+{ 0xDF66B0232EC75EF6, 0x04C56A519C0FEF88, 0x93129D231665E8B1, 0x69A3935D56B90494, 0x846811B66302DB09, 0x4B22A425B2CA68A8, 0x1517E034C1F3680B, 0x0EC80DA2047B3CF4, 0x31FF90A54E232D83, 0x0782C8A4462C59D4, 0x019D26A2AD0EDC8E, 0x73D241D270F40A38, 0xAD56751BBF2888CE, 0xCF8DB0D0FF3F596B, 0x0DBCB586AE48141A, 0x02B8D42B14241F10, 0x674F70D38EFB29AC, 0xB2AF568AA74685A8, 0x89AB79C016E20755, 0x83616FD1CF051D36, 0xE636A98F1A595A4E, 0x01A08DD1C9649ACD }, { 0xA89AC04208D67BEA, 0x3C094525907AE27B, 0xA4E50031DBF21B5C, 0xB5BACF9DDB1C6588, 0x1B234CEBD6071D39, 0x955F6B586EC61014, 0x6DD718D4E378D0B2, 0x4D3CFCD118185AE3, 0x3397411ACFED6BD2, 0xBF11F618E8B24671, 0x019A5EC1DC8C7EC4, 0xAB1E1F1B25F9E1B3, 0x3606057E485E41AE, 0xB37FB2C8FD941CC8, 0x279F3A03C1A85E49, 0x628D177005AD8E1F, 0xF4A2F50C9BFAAA61, 0x78984550DD4264F7, 0x04716975C48CA1C0, 0xD9B628BEDB7B71A8, 0x8D532EBBD89B7175, 0x00922DC2A51992FE },
+{ 0xAEE9284C42A1C6C6, 0x8874C079F86D224C, 0x39568DE0FB7A096A, 0xCCA5C2E3992CA4B3, 0xC1196DB075611B1D, 0xE4EB899069CBB4DA, 0x435D4CB1E8B223D7, 0x9CE756594DF9B785, 0x1652E2EF1EEAF33E, 0xCB9ADCB5317CC270, 0x011901B5A087C52E, 0xBC1F23A6ABC6C729, 0x0A0C598043E2CC4F, 0xAF5A1433CE70B692, 0x1F02FD378A021534, 0xE15CD13A7D600DFB, 0x5CEDCBCB4B41306D, 0x6C34783A4E4110D9, 0x1BFBCBA8F49CF8E5, 0xF04C1C302D23D133, 0xA8CAF0D199ED92C1, 0x00B8E249ACA661AB }, { 0x449E71B777597B92, 0x0001B9991CE7BD9C, 0x8077AF92F401BD74, 0x6B7DA94BAD50DEEB, 0x321843EC7DB6AFAE, 0x99FD2118D44E4F97, 0x6F969AA0FBB03AFF, 0x7670447A5B067467, 0xBA7CF0FBDC409830, 0x5FA578EB394A6E70, 0x00613CEBBEAE00E9, 0x0C491B02354FA8BC, 0x99A329B806DB68EE, 0x500C85434E48A6B5, 0x6F0EE17649E238E1, 0xAC410CFE17F5224E, 0xA038D231B05D1E21, 0x2A31D6E7E2252334, 0x417C9B3AFF81C45F, 0xBFC87645ADDCADD5, 0x9AFE4661DC769E9D, 0x017A1F66DDCC1E52 },
+{ 0xAB10DC20608A8792, 0x0346168F3E51C66C, 0xAA9D3C94C7BA97E0, 0x775AC27E61771730, 0xDB607DDEB56945B2, 0x07C6F534258093F9, 0xE163D63A8C594C5F, 0xB1B947102CB5E1FB, 0x6AB2107534106816, 0x05510B5C9A0A0ECD, 0x00D6753FF5D99308, 0xFA89E16443EA883E, 0x062A5F89A88E9790, 0x1577379792F8ECDF, 0x1EF9E115E548A03D, 0x5485934E433B155A, 0x6984658786778C91, 0xD27CB56C2F24F1E8, 0x5947DF3994A2E118, 0x58D9BB6A08B4CA74, 0xEB81B74BB7472CB5, 0x01A4D14A93BEEE6B }, { 0x8D480DC20C1872AD, 0xD77AAF699F452BFD, 0x5A3A03B4A6E83D22, 0x5B66FD686E360687, 0xBD1EA86B26BDDDC1, 0xBE412945D2AEBC95, 0x8AEBA75645E0C9B2, 0x5DA381EBE770AB00, 0x8EE8AF1C4B2FD8DA, 0x7391A0A20ED52B74, 0x010FB2C7E8296C2D, 0x74CE967670147A43, 0x6DB2B1E3540FF566, 0x77356CE490377E96, 0xE45ACAD54ACFF0F1, 0xD182624E013AAE05, 0xC171EEC6D7619FC0, 0xE88719C4A1CC2B36, 0x37DBCF10BF27EAE3, 0x0F853A091FDAF1D3, 0xA5C07B576718DDD6, 0x0168AB06037607B1 },
+{ 0xF0DAD1BEA123EE03, 0xDA853CA8B5750489, 0x2C7331DBE0641BBB, 0x23C5D1906E85D719, 0xB4FF66FE5B5C626A, 0x57A2AD76F65EE5AD, 0x8CB765D9B9F7DF2E, 0x0E2DBF0B3AAD130B, 0x62DD5AA11346580D, 0xD3B81D4EAD822EAA, 0x01807FC57206F261, 0x33E179F2F3EE856A, 0x4CF37373AFD401FD, 0xC1309469A2B3A96A, 0xB7B6CE08F7385C6E, 0x8A8AC72C218B167C, 0x9B21B3ACEEC6B475, 0x05FECFF1FA26FA89, 0x517F64C379128CEC, 0x2C3062CD45DA20F0, 0xCD3A118F5F978CE7, 0x0124340592EC4758 }, { 0xE1DF7124321D81E1, 0x70C7C6AC07926297, 0xA16A1A61C4980CBF, 0x161DD041188BD97F, 0x5E5AC994C19C1DD4, 0xBC6FCF049DBD64D1, 0x30E154B8777334BB, 0xBD88F197946F1FA4, 0x915261FDFAC98D1B, 0xE872147A6BBC9556, 0x0066F2DBE9186695, 0x3F6A2A3BDF3E5288, 0x50F924078E561CEB, 0x4CAA300CFAD035A7, 0x06A330B87B1539F6, 0x217FD5E67DEF2E22, 0x5935A56F1217E652, 0x46FEAFC72B8E067C, 0x9AB2EC3F8394B139, 0x95645E36AEBDAC1E, 0x5F05572FB3AB6401, 0x01303B3B2A170969 },
+{ 0x13DC41527EAC920F, 0x08B9F7EACA367617, 0x1674695A27A26163, 0x4E856FE01497F233, 0xAFFF7C701A947E55, 0xB100F77B7C548A04, 0x35199D636105F534, 0xBC0826EF0D724018, 0x649C667E74B6B7F4, 0x0F76E7DD554B7B05, 0x012B2FCD4E0939A7, 0x405C068CBE9C0E25, 0xB1E5A96888AE416B, 0x2760F15424147A7A, 0xDD6E214870CC9160, 0x9AD38703A0D039E0, 0x1C8D2DF80FD5BD83, 0xFFF863861647EB34, 0x6CD23240EBF3A022, 0x86FE9AE898CCB826, 0x6D20FC569245E839, 0x014F2F3BB2626988 }, { 0xC6E583574BBA5243, 0x2BCC7BC158E324A5, 0x08F0C79C133878E8, 0xA0AED9F0EEDF4E33, 0x24B07CC947D62A45, 0x595B38CD3E6B51A5, 0xEA0C3EDC98F6E144, 0x96C72526433F7E10, 0x93B975F166B22030, 0xF7C733C70914D033, 0x002704A853FB3B88, 0x5B1BFEA38EA23372, 0xC6E4DD9691DF6FD0, 0x058DA0234C43AC51, 0x92DD1F5A55EE3FFB, 0xE4066B2D9EC7537C, 0xA26D378E01090837, 0x4F84B2314102A881, 0xFEFD521DCCD941B8, 0xE7772B725DB3ACDE, 0x9F75B65333933D61, 0x00A273964B8EB618 },
+{ 0xC66DE175689243BB, 0xDA87B70255C8189A, 0xC67BD50EEF9CFE1E, 0x8532152730D94C84, 0x5D05C02B23B4D861, 0xEB7A7B706862F2AA, 0xB3F44AC4B23A9EEE, 0x9D6D3F53F656A9D6, 0xCA34CABE80E53D35, 0x36F773A518231996, 0x0123C8052D80CE2C, 0xD4662630342439CE, 0x99184D53ED3C410E, 0xBA3F31AA5F1A04E1, 0x60B8F2AF86784FE9, 0xC8F5DAD19E3998E5, 0x69CA7855C66D85A3, 0x26BEB604319B5950, 0x19AE6B2E0C6B3BD5, 0xC8C39F4DC1B340B7, 0xE822A69403B000E6, 0x00C067E26BAC881D }, { 0x2D8FA0F322BE0198, 0x8956135327A71566, 0xE34E6EA07B18906F, 0xDEADC3BD6DD624F7, 0x0006FE66BA4534CE, 0x3F37B9F603D4BC40, 0xD6B0A0E80961B27A, 0x437BA7EA3F7E16FE, 0x22E14605D4E5CFE6, 0x343522EE770993C6, 0x0108C5BD49BDB023, 0x5C6888B3D44FC22C, 0x5B9138CA2D77FCE7, 0x52F021F7A33E6604, 0x9CE12C9005EFE701, 0xBC72B825C1D6F9E7, 0xBC6144C844607078, 0x9D6B8AB87B46AC6E, 0x1B1547DF5631187B, 0xF7334D7C645AF4DC, 0x71CCA1DDF9387A6A, 0x01561E3190031929 },
+{ 0x14BC59D21431D5F4, 0x13C2C5904CE953DB, 0x9BBF20D5D3253529, 0x249799EEE79B8D5F, 0xA88792ED1C166054, 0xA4229FF717F5B2B6, 0xAAAFEB6F0C1DEEA3, 0x4D65DDBC2F71F2F9, 0x888AAEC025ED1D3B, 0x6526081620E7A698, 0x011DA03B9A1BC4F8, 0x00F3AFE0788FC8A6, 0x3915F9F33CF189CD, 0x09F4952B198E3E66, 0xF09248269873950C, 0x65CF4B5651C3ABF0, 0x98E4EC2B3331ABE9, 0x4C4ED65FBA165C45, 0xC2203DA4BE5A79AB, 0xDAE571DF72CE8A63, 0x5C51973CDA8995A0, 0x003049D986C215B5 }, { 0x48D028FA01C3A2A2, 0xDBB4A491D6406FF5, 0x758586E4F394DC0B, 0xDAA1A05AA1FDDB6C, 0xA02448D12E239CA2, 0xAC4402D01D01650D, 0xB5BBC61E159063A2, 0xF790F97D22DA2227, 0xC82254F8B725F5CD, 0x93E4D1B3E3E8D65B, 0x004B7AFFB1EB4FDD, 0x6BDE5D378787FBD0, 0x50AAF68DEA4236C5, 0x742BC705B2DDC195, 0x21BD8FA61827BE06, 0x66A403819E025D15, 0x7150CD569CCE4339, 0xD4C2E71A1FAAB67D, 0xF5C3C1A8A941BC03, 0x768FD62D01B1E05E, 0xEE2B85FD29F2E5D0, 0x012719176D9634AF },
+{ 0x1F49C52EDBF2EBF8, 0x3011096AFCCB9EF8, 0x50354B08A309A83B, 0x3221FE5A0D9ACA07, 0xE2647DE49B7AF40C, 0x7D9F03F50BF7DF47, 0x1F06473760F51933, 0xE906604EEB7F2773, 0x641ECCCF74DB1CDA, 0x3C561969CAED1A75, 0x00C3A5031ED2EB86, 0xCB5F8DD62FE97178, 0x05C4A0C45ABEC8E6, 0x7B3382587562A8A5, 0x0B0DAD1CB8A2710E, 0x9EB8DA994D0ABBFA, 0x647DE625902C38E2, 0x32823A8847EE149B, 0xDC508F9AAC177D34, 0xE77E6BD906EF4506, 0xE8609EAADA86BAE7, 0x013645E1F0675B4A }, { 0xDE8E62162FE714AF, 0x10567B6CB27CC3C4, 0xD682F2974202573A, 0xE7655CFD724F0121, 0x55AC27E97C661EBB, 0x08A815EB5812B7F4, 0x911AD7F9452195E2, 0xC6F0231EB0AB9B9B, 0xDE5155BEB79086B8, 0x855E5EC2B1DAE4D3, 0x005C3E542326DBB9, 0xF2E391CB83DBFD5B, 0x9F101A0FF2FBE454, 0xB0869F1189A88CF5, 0x16C525672D204497, 0x8C52259A1AE00335, 0xBD48C5F2D1098E60, 0x9036D971466D996A, 0x010CADCDC2731705, 0xC1CC4C6AD9FB2231, 0x746DED6E992DD62B, 0x008F226AC48D16D7 },
+{ 0xB9FE2EDB14B54824, 0xB11EE953E766F0AE, 0x3507F417C4BEEA7A, 0x3AAD942C0576147F, 0xDD3E396944DE36B5, 0x03579AB8F28529A8, 0xD7A2DC41DA6E06F1, 0x9ECE7D347B17EEBE, 0xFF8C881ED9EFC547, 0x981FCE7CA352148E, 0x01076456EEB11123, 0x328A1D63A9184886, 0x9C69EFFA1EE331F4, 0x08F05B3643725911, 0x0EBF60023C59214C, 0x21F89E16852137BF, 0xC8E9195E1365A660, 0x7815277D65E78440, 0x9C9B86F9D4160FE1, 0x7B16B1103DAE1F05, 0x65873C6502DAD8A1, 0x0192728A6F0D7FAF }, { 0x90028002127891CC, 0x626077B70EC4CE4D, 0x0777E0DF07D25224, 0x8973AE5DCEBC84CD, 0x136D66D6262D3EDF, 0xCDC43E471A0AB222, 0x8422BBE9971BCE88, 0xE6721980F485B8F4, 0x8AE67005DB967A7A, 0x62CCD891D27380AC, 0x00226136E17FFB56, 0x8DEB030D64D4AFBE, 0x6FD10165A2161C74, 0x62EE1E5392731B65, 0xD994E50BF863E7EC, 0x741D203EB9B674FF, 0xC695A8C6529E57F8, 0x89FE8CD044ED8C02, 0xD1B5253949CB19E1, 0xC391FEB21C5A2EAD, 0x65041F2FEE216878, 0x005FC98B03DD21CD },
+{ 0x7FDA259D671C088C, 0xDE13346EEDEAAD9A, 0x7CDE51D0C9E56853, 0xFADE6ED534D16482, 0x49C2022F0C25D634, 0x5F654AFE254B9C90, 0x3E1446842DB8D075, 0x2D101B1BBEE933A1, 0x4161921FF27A4446, 0xA59AC70888F89960, 0x008811B78CE2EBCF, 0xD35746026D9F5F37, 0xC73444287AC1DF6C, 0x623F81BE2A01ACB8, 0xB6328E92300A4580, 0x982541F4EAC7BB4B, 0x53E2B243422EC553, 0x642FEB6ABA2B0E4E, 0x45A30EB4A7E4AA67, 0xAB82ADAE1521CCCF, 0x1FB77B8A239986BB, 0x001FEF50BD595B88 }, { 0xF137808D81D08020, 0xF124ED8739C60349, 0x5225FBBD87D73858, 0x1F41FE6B87EFE1FE, 0x4554FA66C72C7863, 0xC14FB7682EEEDC98, 0x0F6AD53F48A570EC, 0xF32569D202C0D9B6, 0xE55D802F9E6365A3, 0xCF462D63521F99EB, 0x009864D96E583089, 0x06835B57FA257461, 0x8ED4EDD46A7C78F6, 0xB8FF532DB4903A30, 0x567577F8B0315142, 0x6458CAC3C6ECA980, 0x0A7ECEE5939DC224, 0x06BA2280D41C9A66, 0xB2D60BD80E06FD70, 0x3D96F2F94FEE20D9, 0x227689C3A0EB588D, 0x0042691568311C54 },
+{ 0x2D4055577B7B47A3, 0x83CEB68F25111C0B, 0x26BD849E6491B37E, 0x62E856EE434635BF, 0x6D2692C55EBD23AB, 0x22719866C701EFCB, 0x399480B10DFE23E6, 0x62D73B1707BD69A7, 0x1C334FE26B4FC2D1, 0xBB6EC67248176606, 0x0104BBC704B09ECC, 0xFCF36129C6A04B91, 0xCD47561DC2C10F92, 0x54975DF4AE9386B3, 0x0B8C49708D814EC0, 0xE20C753016FC06BC, 0xD6C58E10361C5C9A, 0xB64123554F803E53, 0xDBCE51EC28665CAC, 0x3D710393C0E8F445, 0x167FE607E9A54868, 0x0199730C2EC04052 }, { 0x1D340A1A11630791, 0xA9E90E43357EF785, 0x19CC1781D7A49157, 0x5B245A2BE34B8413, 0x2A4B827465E7219A, 0x684EA9484E128775, 0xEF0BE22054BC5A98, 0xD77D6CBCDF25FB6E, 0xCEBEFD17DFE33604, 0x698AE7A5650CA664, 0x0173E369F002E771, 0x1FD37015E992BE10, 0x635433C89913AEB8, 0x06809BF7C6C482E6, 0xDE20B64484C41DE8, 0x3CF3AA89284804C1, 0xBA6E47D82A99B234, 0x28F32F04EFB29797, 0xB02C734EF8C24AEB, 0x659E61AFA89158B8, 0xE4BDFB4013C7CA7C, 0x01273849398EB579 },
+{ 0x12E17BFB49E1713C, 0x465857F844E31324, 0x53051649E36AB001, 0xA6AD2C4650E990A1, 0x94B824D19A4CEE17, 0x0AB777EEA042941A, 0x369895E5106F6608, 0xB55B7D071B39AC8D, 0xEE123BC205D19574, 0x4A907258A9159697, 0x001FF9D369818CDB, 0xC37545AF291ACD17, 0x9F4E061A695E060C, 0x7C2F5E12D73F40B2, 0x3FD0579F74ADA25B, 0x46F2C6705177B0B2, 0x8441F324912C6D8F, 0x26B12CC72E0B5B25, 0x3CFCB784DD5B6A9D, 0xE38619B53566F511, 0x934D93C51A52E690, 0x012985CFBE3596C4 }, { 0x567DF8681B0F9017, 0xD07C8CB6AEE4DB37, 0xB0A968025EC43E06, 0x319A192F819CD82B, 0xE7D7892C6B8B6003, 0xD26A4321B121F174, 0x496C3EE3B2B19055, 0x646DA0D7A37FA149, 0x8E78BD36B2F8F452, 0x8FDB1B4DA24DE48D, 0x019ED666A273B86E, 0xCB8ADA3CC7CF97B5, 0xD0ACC435186A2DA6, 0xA9FB2B808E694963, 0xCE78250D5DB09FC3, 0x1B29D07FE3B427A6, 0x33194DDB9EFDCC22, 0xD3E36125CB5C0EFA, 0x173C340F57D6951E, 0xF10FE0874D70A587, 0x6E1B53C29BF9C22F, 0x015DE92BA76A2594 },
+{ 0x796C4EB4BFF13A34, 0x8E86EB964C815559, 0x436933416E8C60E5, 0xF60225D05A9CB2D5, 0x48C496839C48EFB0, 0x8C1041040CC34C55, 0xE7A75FC7F82B696D, 0xD2671578B3764671, 0x5705F8E9792B95C0, 0x05A2A5CA29318D84, 0x00F8B1FE08149AB9, 0x7F2D4D9C59618ED6, 0xD657A4A59D60FFB2, 0xBC4B2665788E66AB, 0x412F063BF0365538, 0xCA4C54B62A76C592, 0xA43B761F2DF0CC67, 0x34DDC678B08CC9E3, 0xB309BFF8F4E5E820, 0xA48DF33FD8369BCE, 0x3AB76D554AABE871, 0x00F474CD721DA80C }, { 0x50F0F333A03C35C6, 0xCEA97ED7056BB23F, 0x36704344CB41FE2E, 0x055E18E3649153EA, 0xDBC6912CB0191BB8, 0xD98908D5A5F00B6E, 0xC5C3C537824FE152, 0x3F014E2D811B0D46, 0xC98A9E1CA9220F61, 0x18E6DC6A1BAB7C0B, 0x0022F1A230664F61, 0xD051410992A9540B, 0x64D6CA9F5A7DE38B, 0x3AD643234D8E0537, 0xA0BD4D1629AA63B6, 0xBC5D345773543F21, 0x3771BDDEB94CA847, 0xACB1B165E37ED959, 0x04B3100AAE6EBF54, 0xA252CBD9C58E04BF, 0x50209EE83A77B733, 0x011CE90F07F7E77E },
+{ 0x130F0A288D3DDE64, 0xEC18095385E174BE, 0x6719C29E1974399E, 0xA19BE1FE0F609E11, 0x976DABE38B7A371A, 0x6D0D279647B80ED2, 0x8FE9FCC2B224B9D1, 0xF6907272A7322A5F, 0xF0ED0913FA0B0748, 0xA1D7B11487500492, 0x013C1CCE90AE512E, 0x33D4900CA2C60A75, 0x3B89641A1545522E, 0x6CEAD145437B5480, 0x2044168467B375DF, 0x0A9810352BAE4B0B, 0xDD1E102C640523BB, 0xA1DD7443F51A21F4, 0xAFF317918EE09BC4, 0xC60B0747276B183E, 0xC51809CA110BF384, 0x0162FB564D195414 }, { 0x130F0A288D3DDE64, 0xEC18095385E174BE, 0x6719C29E1974399E, 0xA19BE1FE0F609E11, 0x976DABE38B7A371A, 0x6D0D279647B80ED2, 0x8FE9FCC2B224B9D1, 0xF6907272A7322A5F, 0xF0ED0913FA0B0748, 0xA1D7B11487500492, 0x013C1CCE90AE512E, 0x33D4900CA2C60A75, 0x3B89641A1545522E, 0x6CEAD145437B5480, 0x2044168467B375DF, 0x0A9810352BAE4B0B, 0xDD1E102C640523BB, 0xA1DD7443F51A21F4, 0xAFF317918EE09BC4, 0xC60B0747276B183E, 0xC51809CA110BF384, 0x0162FB564D195414 },
+{ 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 }, { 0x1763E5A6167E80D5, 0x4D191239E02D5D08, 0x7DC17CDFEDB3A13B, 0xDEFC85D79D364765, 0x011283DD0C4F4754, 0xC2402201903E9198, 0xA1F3B1EEEB5C23BE, 0x83816FDEBDA5F47E, 0x28EA1F19C2FFE9FF, 0x2CBA3C2AB5A3328F, 0x00C17AB94B360B73, 0x119CD99FC1F0753F, 0xCFF5C209E920F062, 0x4A8883F98D203E87, 0xDF5D8242C3D53F26, 0x5D3AAEE906799789, 0x4F499EE00FCFDB3B, 0xBDD4EFE93A70D3E9, 0xA8F031813CED86EC, 0xAE2D584448F68D90, 0xB640EC40742D4DA9, 0x00A83F9B3A535012 },
+{ 0x1B90C63632B880D5, 0xE5F07A6A30ECCB3D, 0xD32199BE46C96D56, 0x2CBA5ADF984B60BF, 0x91F027807F518B81, 0x0C438819F93D331C, 0x9585DB866AB01C36, 0x2AB1981EBB48BE35, 0x0CF844CF92F8CD96, 0x961FDE7D72F501A2, 0x00E04DE20A69960D, 0x395A49E54CBF4ACB, 0xF7D979B86BFA558F, 0x52CE1EB4D46C59AF, 0xEF12A0FBB5987CF6, 0x371F4E3E7ACC30DB, 0xC33309C4060B7031, 0x95B189BB56783842, 0x76373B2475FE5088, 0x200F8E17A47588DF, 0x41870F53F48F3994, 0x00F9DED4D9139335 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0x201F01E60AEB7347, 0x4B2C320C830CB3B8, 0xF4DABD3359F2EF07, 0xB50DBFB865DC4EE1, 0x081C521649BFCB6B, 0x607456F7524D9263, 0x2952063FFCB42C95, 0x494325460DC77A8C, 0x1B3D13E9E6DEA4DC, 0xC18AFF210E1864D2, 0x01781467749C60CE, 0xF49FA0FAD4896D7A, 0x98D8695168AE54DC, 0x41D38AD728E6660A, 0xFA8C0309EC31AD94, 0xA5C39A5F01B14C17, 0x3C43BF851780F8E1, 0xD861C6DC978EB36F, 0xEE6967713E67A20B, 0xD25B408ECC16DCF2, 0x6D1C1E8154332FEA, 0x01A3BB2221BF091B }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+
+{ 0x8DA9389EA77598D5, 0x5D9BEC5F129415F5, 0x86DF7B46289DAC98, 0xE3490AABE3BC203A, 0x5FF366A7C36826E9, 0xB4E3D50930529FC4, 0x2C5AD7D30391D578, 0xE25C3D96C5D779CC, 0xE2949CB77BAAA807, 0x7A15A74C3170245B, 0x01990784CF94E308, 0xE3284F64DB87F2EC, 0xB032727CDA501479, 0x4A70D666503C034E, 0xB4AE08834ED5A84C, 0x64DCD400A9354D4A, 0xC36F3B85D1A117DE, 0x3B49DB4584DA8ADB, 0x95F133C65588EA10, 0x2A1D5F703B1B4010, 0x1412E81735CC331D, 0x000D4CAEFB52FEAF }, { 0x0000000000000096, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x9A4E60E000000000, 0x2AF7E672929A5CBD, 0x6F395F62DE4B3DCF, 0xFA2387F3E390A0E9, 0xBBB4C9C22E2A84A5, 0x00C07D499880D65B, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0xB20CD0E9CE6DF1C2, 0xD4776554682384AA, 0xF3E90608803226CC, 0xA09CD07395A4A6A6, 0x9188E59356BB6EE8, 0x0AFB848DD92DFF0B, 0x9A1A3EA335F3E051, 0x440E7B0D91B4E25D, 0x0BC61B1A7F51D85D, 0x5B53615716B47E42, 0x012131A1571AA604, 0x119ECE9524486BEC, 0x47AF08FEE75D6164, 0x77D4F27B87C9C219, 0xB55D074EAA7BEEBA, 0xD6B8F766A9F7F7E8, 0x918E700CEEBEE6E6, 0xFA20291EA3F287FA, 0xBA98C6C73571E560, 0xF9EB481E6CB6D2AE, 0xF0A0DA09870C6582, 0x01930E2345DB99C0 }, { 0x13EA230B8399155E, 0x7F7BC55B50E4F0DE, 0x911DEFD0A00B2CC7, 0x240B5882CB1259BD, 0x05F9356EAFF98407, 0x0F52B21D8EF6BEEA, 0xCC1B3F876DB8F92F, 0x718D049222963754, 0xCDB7F100678B9F9C, 0x59699140308E4741, 0x00F05DBC6EF88E5B, 0x567725A388BDC6F9, 0x00704B24F98441F9, 0xAF1BDCD5EC16B3C8, 0xD3DC27CBD65F6B09, 0xA2820DE8CA0BB14C, 0xD01C086E7A9CEEB0, 0xE4FFDAFDAAEA66C4, 0x3DE4DEFE10F86764, 0x713A44A43CB9DE0C, 0xAC4C95A12B6B83BE, 0x01A91B4BF55D624C },
+{ 0x7D46A7CE14B06997, 0x8E38A54DC11AB3D4, 0x94DCB5D4482051C1, 0x55BAC63AECF80361, 0xD104BB1A51BC440C, 0xEB05063BE96102BC, 0xEEF2CD8389F275F5, 0x44050CCA82EFF58A, 0xB704DC142DFBFEC5, 0x394B0E8386089E80, 0x00AC6DC4A2E66303, 0x3FC21C5908D353C3, 0x9D2C493DFE2D2525, 0x3D45AED514C5DE31, 0x67AF39287DDC4F9B, 0x08C45465CD792C06, 0x1DEB64099DEAFBDB, 0xC70D25AB5EDE9654, 0x411E67529DB9F979, 0xE9AEBA26C975E147, 0x4BC8DADF5A996EFC, 0x00CC029E7F689F91 }, { 0x59C59A4AE95DC88F, 0x5C1087C7EAE4EF04, 0xDA948812DF3817A2, 0x2B1AC53F0D088D61, 0x0FAF9D0BBB0CA565, 0x3AFFF2D5060416A3, 0x83DD371FA687958B, 0xF94D1022173947B4, 0x64C182B94205A6D3, 0xD0825738B49EE5BD, 0x00901F411365D363, 0xB275219689CEC075, 0x6B96F7AC0536EDC5, 0x4C02FACA3992DE1D, 0xA39CB99E6ABCB88F, 0x97944F4AE0B820B7, 0xFF3B61294EBF94AD, 0xA1CBDCD4138C46A7, 0x0B651EF4D27DF05B, 0x2B69F3B4A160EE41, 0xA9B4949A36495EBE, 0x00B3629722DD240E },
+{ 0xDF66B0232EC75EF6, 0x04C56A519C0FEF88, 0x93129D231665E8B1, 0x69A3935D56B90494, 0x846811B66302DB09, 0x4B22A425B2CA68A8, 0x1517E034C1F3680B, 0x0EC80DA2047B3CF4, 0x31FF90A54E232D83, 0x0782C8A4462C59D4, 0x019D26A2AD0EDC8E, 0x73D241D270F40A38, 0xAD56751BBF2888CE, 0xCF8DB0D0FF3F596B, 0x0DBCB586AE48141A, 0x02B8D42B14241F10, 0x674F70D38EFB29AC, 0xB2AF568AA74685A8, 0x89AB79C016E20755, 0x83616FD1CF051D36, 0xE636A98F1A595A4E, 0x01A08DD1C9649ACD }, { 0xA89AC04208D67BEA, 0x3C094525907AE27B, 0xA4E50031DBF21B5C, 0xB5BACF9DDB1C6588, 0x1B234CEBD6071D39, 0x955F6B586EC61014, 0x6DD718D4E378D0B2, 0x4D3CFCD118185AE3, 0x3397411ACFED6BD2, 0xBF11F618E8B24671, 0x019A5EC1DC8C7EC4, 0xAB1E1F1B25F9E1B3, 0x3606057E485E41AE, 0xB37FB2C8FD941CC8, 0x279F3A03C1A85E49, 0x628D177005AD8E1F, 0xF4A2F50C9BFAAA61, 0x78984550DD4264F7, 0x04716975C48CA1C0, 0xD9B628BEDB7B71A8, 0x8D532EBBD89B7175, 0x00922DC2A51992FE },
+{ 0xAEE9284C42A1C6C6, 0x8874C079F86D224C, 0x39568DE0FB7A096A, 0xCCA5C2E3992CA4B3, 0xC1196DB075611B1D, 0xE4EB899069CBB4DA, 0x435D4CB1E8B223D7, 0x9CE756594DF9B785, 0x1652E2EF1EEAF33E, 0xCB9ADCB5317CC270, 0x011901B5A087C52E, 0xBC1F23A6ABC6C729, 0x0A0C598043E2CC4F, 0xAF5A1433CE70B692, 0x1F02FD378A021534, 0xE15CD13A7D600DFB, 0x5CEDCBCB4B41306D, 0x6C34783A4E4110D9, 0x1BFBCBA8F49CF8E5, 0xF04C1C302D23D133, 0xA8CAF0D199ED92C1, 0x00B8E249ACA661AB }, { 0x449E71B777597B92, 0x0001B9991CE7BD9C, 0x8077AF92F401BD74, 0x6B7DA94BAD50DEEB, 0x321843EC7DB6AFAE, 0x99FD2118D44E4F97, 0x6F969AA0FBB03AFF, 0x7670447A5B067467, 0xBA7CF0FBDC409830, 0x5FA578EB394A6E70, 0x00613CEBBEAE00E9, 0x0C491B02354FA8BC, 0x99A329B806DB68EE, 0x500C85434E48A6B5, 0x6F0EE17649E238E1, 0xAC410CFE17F5224E, 0xA038D231B05D1E21, 0x2A31D6E7E2252334, 0x417C9B3AFF81C45F, 0xBFC87645ADDCADD5, 0x9AFE4661DC769E9D, 0x017A1F66DDCC1E52 },
+{ 0xAB10DC20608A8792, 0x0346168F3E51C66C, 0xAA9D3C94C7BA97E0, 0x775AC27E61771730, 0xDB607DDEB56945B2, 0x07C6F534258093F9, 0xE163D63A8C594C5F, 0xB1B947102CB5E1FB, 0x6AB2107534106816, 0x05510B5C9A0A0ECD, 0x00D6753FF5D99308, 0xFA89E16443EA883E, 0x062A5F89A88E9790, 0x1577379792F8ECDF, 0x1EF9E115E548A03D, 0x5485934E433B155A, 0x6984658786778C91, 0xD27CB56C2F24F1E8, 0x5947DF3994A2E118, 0x58D9BB6A08B4CA74, 0xEB81B74BB7472CB5, 0x01A4D14A93BEEE6B }, { 0x8D480DC20C1872AD, 0xD77AAF699F452BFD, 0x5A3A03B4A6E83D22, 0x5B66FD686E360687, 0xBD1EA86B26BDDDC1, 0xBE412945D2AEBC95, 0x8AEBA75645E0C9B2, 0x5DA381EBE770AB00, 0x8EE8AF1C4B2FD8DA, 0x7391A0A20ED52B74, 0x010FB2C7E8296C2D, 0x74CE967670147A43, 0x6DB2B1E3540FF566, 0x77356CE490377E96, 0xE45ACAD54ACFF0F1, 0xD182624E013AAE05, 0xC171EEC6D7619FC0, 0xE88719C4A1CC2B36, 0x37DBCF10BF27EAE3, 0x0F853A091FDAF1D3, 0xA5C07B576718DDD6, 0x0168AB06037607B1 },
+{ 0xF0DAD1BEA123EE03, 0xDA853CA8B5750489, 0x2C7331DBE0641BBB, 0x23C5D1906E85D719, 0xB4FF66FE5B5C626A, 0x57A2AD76F65EE5AD, 0x8CB765D9B9F7DF2E, 0x0E2DBF0B3AAD130B, 0x62DD5AA11346580D, 0xD3B81D4EAD822EAA, 0x01807FC57206F261, 0x33E179F2F3EE856A, 0x4CF37373AFD401FD, 0xC1309469A2B3A96A, 0xB7B6CE08F7385C6E, 0x8A8AC72C218B167C, 0x9B21B3ACEEC6B475, 0x05FECFF1FA26FA89, 0x517F64C379128CEC, 0x2C3062CD45DA20F0, 0xCD3A118F5F978CE7, 0x0124340592EC4758 }, { 0xE1DF7124321D81E1, 0x70C7C6AC07926297, 0xA16A1A61C4980CBF, 0x161DD041188BD97F, 0x5E5AC994C19C1DD4, 0xBC6FCF049DBD64D1, 0x30E154B8777334BB, 0xBD88F197946F1FA4, 0x915261FDFAC98D1B, 0xE872147A6BBC9556, 0x0066F2DBE9186695, 0x3F6A2A3BDF3E5288, 0x50F924078E561CEB, 0x4CAA300CFAD035A7, 0x06A330B87B1539F6, 0x217FD5E67DEF2E22, 0x5935A56F1217E652, 0x46FEAFC72B8E067C, 0x9AB2EC3F8394B139, 0x95645E36AEBDAC1E, 0x5F05572FB3AB6401, 0x01303B3B2A170969 },
+{ 0x13DC41527EAC920F, 0x08B9F7EACA367617, 0x1674695A27A26163, 0x4E856FE01497F233, 0xAFFF7C701A947E55, 0xB100F77B7C548A04, 0x35199D636105F534, 0xBC0826EF0D724018, 0x649C667E74B6B7F4, 0x0F76E7DD554B7B05, 0x012B2FCD4E0939A7, 0x405C068CBE9C0E25, 0xB1E5A96888AE416B, 0x2760F15424147A7A, 0xDD6E214870CC9160, 0x9AD38703A0D039E0, 0x1C8D2DF80FD5BD83, 0xFFF863861647EB34, 0x6CD23240EBF3A022, 0x86FE9AE898CCB826, 0x6D20FC569245E839, 0x014F2F3BB2626988 }, { 0xC6E583574BBA5243, 0x2BCC7BC158E324A5, 0x08F0C79C133878E8, 0xA0AED9F0EEDF4E33, 0x24B07CC947D62A45, 0x595B38CD3E6B51A5, 0xEA0C3EDC98F6E144, 0x96C72526433F7E10, 0x93B975F166B22030, 0xF7C733C70914D033, 0x002704A853FB3B88, 0x5B1BFEA38EA23372, 0xC6E4DD9691DF6FD0, 0x058DA0234C43AC51, 0x92DD1F5A55EE3FFB, 0xE4066B2D9EC7537C, 0xA26D378E01090837, 0x4F84B2314102A881, 0xFEFD521DCCD941B8, 0xE7772B725DB3ACDE, 0x9F75B65333933D61, 0x00A273964B8EB618 },
+{ 0xC66DE175689243BB, 0xDA87B70255C8189A, 0xC67BD50EEF9CFE1E, 0x8532152730D94C84, 0x5D05C02B23B4D861, 0xEB7A7B706862F2AA, 0xB3F44AC4B23A9EEE, 0x9D6D3F53F656A9D6, 0xCA34CABE80E53D35, 0x36F773A518231996, 0x0123C8052D80CE2C, 0xD4662630342439CE, 0x99184D53ED3C410E, 0xBA3F31AA5F1A04E1, 0x60B8F2AF86784FE9, 0xC8F5DAD19E3998E5, 0x69CA7855C66D85A3, 0x26BEB604319B5950, 0x19AE6B2E0C6B3BD5, 0xC8C39F4DC1B340B7, 0xE822A69403B000E6, 0x00C067E26BAC881D }, { 0x2D8FA0F322BE0198, 0x8956135327A71566, 0xE34E6EA07B18906F, 0xDEADC3BD6DD624F7, 0x0006FE66BA4534CE, 0x3F37B9F603D4BC40, 0xD6B0A0E80961B27A, 0x437BA7EA3F7E16FE, 0x22E14605D4E5CFE6, 0x343522EE770993C6, 0x0108C5BD49BDB023, 0x5C6888B3D44FC22C, 0x5B9138CA2D77FCE7, 0x52F021F7A33E6604, 0x9CE12C9005EFE701, 0xBC72B825C1D6F9E7, 0xBC6144C844607078, 0x9D6B8AB87B46AC6E, 0x1B1547DF5631187B, 0xF7334D7C645AF4DC, 0x71CCA1DDF9387A6A, 0x01561E3190031929 },
+{ 0x14BC59D21431D5F4, 0x13C2C5904CE953DB, 0x9BBF20D5D3253529, 0x249799EEE79B8D5F, 0xA88792ED1C166054, 0xA4229FF717F5B2B6, 0xAAAFEB6F0C1DEEA3, 0x4D65DDBC2F71F2F9, 0x888AAEC025ED1D3B, 0x6526081620E7A698, 0x011DA03B9A1BC4F8, 0x00F3AFE0788FC8A6, 0x3915F9F33CF189CD, 0x09F4952B198E3E66, 0xF09248269873950C, 0x65CF4B5651C3ABF0, 0x98E4EC2B3331ABE9, 0x4C4ED65FBA165C45, 0xC2203DA4BE5A79AB, 0xDAE571DF72CE8A63, 0x5C51973CDA8995A0, 0x003049D986C215B5 }, { 0x48D028FA01C3A2A2, 0xDBB4A491D6406FF5, 0x758586E4F394DC0B, 0xDAA1A05AA1FDDB6C, 0xA02448D12E239CA2, 0xAC4402D01D01650D, 0xB5BBC61E159063A2, 0xF790F97D22DA2227, 0xC82254F8B725F5CD, 0x93E4D1B3E3E8D65B, 0x004B7AFFB1EB4FDD, 0x6BDE5D378787FBD0, 0x50AAF68DEA4236C5, 0x742BC705B2DDC195, 0x21BD8FA61827BE06, 0x66A403819E025D15, 0x7150CD569CCE4339, 0xD4C2E71A1FAAB67D, 0xF5C3C1A8A941BC03, 0x768FD62D01B1E05E, 0xEE2B85FD29F2E5D0, 0x012719176D9634AF },
+{ 0x1F49C52EDBF2EBF8, 0x3011096AFCCB9EF8, 0x50354B08A309A83B, 0x3221FE5A0D9ACA07, 0xE2647DE49B7AF40C, 0x7D9F03F50BF7DF47, 0x1F06473760F51933, 0xE906604EEB7F2773, 0x641ECCCF74DB1CDA, 0x3C561969CAED1A75, 0x00C3A5031ED2EB86, 0xCB5F8DD62FE97178, 0x05C4A0C45ABEC8E6, 0x7B3382587562A8A5, 0x0B0DAD1CB8A2710E, 0x9EB8DA994D0ABBFA, 0x647DE625902C38E2, 0x32823A8847EE149B, 0xDC508F9AAC177D34, 0xE77E6BD906EF4506, 0xE8609EAADA86BAE7, 0x013645E1F0675B4A }, { 0xDE8E62162FE714AF, 0x10567B6CB27CC3C4, 0xD682F2974202573A, 0xE7655CFD724F0121, 0x55AC27E97C661EBB, 0x08A815EB5812B7F4, 0x911AD7F9452195E2, 0xC6F0231EB0AB9B9B, 0xDE5155BEB79086B8, 0x855E5EC2B1DAE4D3, 0x005C3E542326DBB9, 0xF2E391CB83DBFD5B, 0x9F101A0FF2FBE454, 0xB0869F1189A88CF5, 0x16C525672D204497, 0x8C52259A1AE00335, 0xBD48C5F2D1098E60, 0x9036D971466D996A, 0x010CADCDC2731705, 0xC1CC4C6AD9FB2231, 0x746DED6E992DD62B, 0x008F226AC48D16D7 },
+{ 0xB9FE2EDB14B54824, 0xB11EE953E766F0AE, 0x3507F417C4BEEA7A, 0x3AAD942C0576147F, 0xDD3E396944DE36B5, 0x03579AB8F28529A8, 0xD7A2DC41DA6E06F1, 0x9ECE7D347B17EEBE, 0xFF8C881ED9EFC547, 0x981FCE7CA352148E, 0x01076456EEB11123, 0x328A1D63A9184886, 0x9C69EFFA1EE331F4, 0x08F05B3643725911, 0x0EBF60023C59214C, 0x21F89E16852137BF, 0xC8E9195E1365A660, 0x7815277D65E78440, 0x9C9B86F9D4160FE1, 0x7B16B1103DAE1F05, 0x65873C6502DAD8A1, 0x0192728A6F0D7FAF }, { 0x90028002127891CC, 0x626077B70EC4CE4D, 0x0777E0DF07D25224, 0x8973AE5DCEBC84CD, 0x136D66D6262D3EDF, 0xCDC43E471A0AB222, 0x8422BBE9971BCE88, 0xE6721980F485B8F4, 0x8AE67005DB967A7A, 0x62CCD891D27380AC, 0x00226136E17FFB56, 0x8DEB030D64D4AFBE, 0x6FD10165A2161C74, 0x62EE1E5392731B65, 0xD994E50BF863E7EC, 0x741D203EB9B674FF, 0xC695A8C6529E57F8, 0x89FE8CD044ED8C02, 0xD1B5253949CB19E1, 0xC391FEB21C5A2EAD, 0x65041F2FEE216878, 0x005FC98B03DD21CD },
+{ 0x7FDA259D671C088C, 0xDE13346EEDEAAD9A, 0x7CDE51D0C9E56853, 0xFADE6ED534D16482, 0x49C2022F0C25D634, 0x5F654AFE254B9C90, 0x3E1446842DB8D075, 0x2D101B1BBEE933A1, 0x4161921FF27A4446, 0xA59AC70888F89960, 0x008811B78CE2EBCF, 0xD35746026D9F5F37, 0xC73444287AC1DF6C, 0x623F81BE2A01ACB8, 0xB6328E92300A4580, 0x982541F4EAC7BB4B, 0x53E2B243422EC553, 0x642FEB6ABA2B0E4E, 0x45A30EB4A7E4AA67, 0xAB82ADAE1521CCCF, 0x1FB77B8A239986BB, 0x001FEF50BD595B88 }, { 0xF137808D81D08020, 0xF124ED8739C60349, 0x5225FBBD87D73858, 0x1F41FE6B87EFE1FE, 0x4554FA66C72C7863, 0xC14FB7682EEEDC98, 0x0F6AD53F48A570EC, 0xF32569D202C0D9B6, 0xE55D802F9E6365A3, 0xCF462D63521F99EB, 0x009864D96E583089, 0x06835B57FA257461, 0x8ED4EDD46A7C78F6, 0xB8FF532DB4903A30, 0x567577F8B0315142, 0x6458CAC3C6ECA980, 0x0A7ECEE5939DC224, 0x06BA2280D41C9A66, 0xB2D60BD80E06FD70, 0x3D96F2F94FEE20D9, 0x227689C3A0EB588D, 0x0042691568311C54 },
+{ 0x2D4055577B7B47A3, 0x83CEB68F25111C0B, 0x26BD849E6491B37E, 0x62E856EE434635BF, 0x6D2692C55EBD23AB, 0x22719866C701EFCB, 0x399480B10DFE23E6, 0x62D73B1707BD69A7, 0x1C334FE26B4FC2D1, 0xBB6EC67248176606, 0x0104BBC704B09ECC, 0xFCF36129C6A04B91, 0xCD47561DC2C10F92, 0x54975DF4AE9386B3, 0x0B8C49708D814EC0, 0xE20C753016FC06BC, 0xD6C58E10361C5C9A, 0xB64123554F803E53, 0xDBCE51EC28665CAC, 0x3D710393C0E8F445, 0x167FE607E9A54868, 0x0199730C2EC04052 }, { 0x1D340A1A11630791, 0xA9E90E43357EF785, 0x19CC1781D7A49157, 0x5B245A2BE34B8413, 0x2A4B827465E7219A, 0x684EA9484E128775, 0xEF0BE22054BC5A98, 0xD77D6CBCDF25FB6E, 0xCEBEFD17DFE33604, 0x698AE7A5650CA664, 0x0173E369F002E771, 0x1FD37015E992BE10, 0x635433C89913AEB8, 0x06809BF7C6C482E6, 0xDE20B64484C41DE8, 0x3CF3AA89284804C1, 0xBA6E47D82A99B234, 0x28F32F04EFB29797, 0xB02C734EF8C24AEB, 0x659E61AFA89158B8, 0xE4BDFB4013C7CA7C, 0x01273849398EB579 },
+{ 0x12E17BFB49E1713C, 0x465857F844E31324, 0x53051649E36AB001, 0xA6AD2C4650E990A1, 0x94B824D19A4CEE17, 0x0AB777EEA042941A, 0x369895E5106F6608, 0xB55B7D071B39AC8D, 0xEE123BC205D19574, 0x4A907258A9159697, 0x001FF9D369818CDB, 0xC37545AF291ACD17, 0x9F4E061A695E060C, 0x7C2F5E12D73F40B2, 0x3FD0579F74ADA25B, 0x46F2C6705177B0B2, 0x8441F324912C6D8F, 0x26B12CC72E0B5B25, 0x3CFCB784DD5B6A9D, 0xE38619B53566F511, 0x934D93C51A52E690, 0x012985CFBE3596C4 }, { 0x567DF8681B0F9017, 0xD07C8CB6AEE4DB37, 0xB0A968025EC43E06, 0x319A192F819CD82B, 0xE7D7892C6B8B6003, 0xD26A4321B121F174, 0x496C3EE3B2B19055, 0x646DA0D7A37FA149, 0x8E78BD36B2F8F452, 0x8FDB1B4DA24DE48D, 0x019ED666A273B86E, 0xCB8ADA3CC7CF97B5, 0xD0ACC435186A2DA6, 0xA9FB2B808E694963, 0xCE78250D5DB09FC3, 0x1B29D07FE3B427A6, 0x33194DDB9EFDCC22, 0xD3E36125CB5C0EFA, 0x173C340F57D6951E, 0xF10FE0874D70A587, 0x6E1B53C29BF9C22F, 0x015DE92BA76A2594 },
+{ 0x796C4EB4BFF13A34, 0x8E86EB964C815559, 0x436933416E8C60E5, 0xF60225D05A9CB2D5, 0x48C496839C48EFB0, 0x8C1041040CC34C55, 0xE7A75FC7F82B696D, 0xD2671578B3764671, 0x5705F8E9792B95C0, 0x05A2A5CA29318D84, 0x00F8B1FE08149AB9, 0x7F2D4D9C59618ED6, 0xD657A4A59D60FFB2, 0xBC4B2665788E66AB, 0x412F063BF0365538, 0xCA4C54B62A76C592, 0xA43B761F2DF0CC67, 0x34DDC678B08CC9E3, 0xB309BFF8F4E5E820, 0xA48DF33FD8369BCE, 0x3AB76D554AABE871, 0x00F474CD721DA80C }, { 0x50F0F333A03C35C6, 0xCEA97ED7056BB23F, 0x36704344CB41FE2E, 0x055E18E3649153EA, 0xDBC6912CB0191BB8, 0xD98908D5A5F00B6E, 0xC5C3C537824FE152, 0x3F014E2D811B0D46, 0xC98A9E1CA9220F61, 0x18E6DC6A1BAB7C0B, 0x0022F1A230664F61, 0xD051410992A9540B, 0x64D6CA9F5A7DE38B, 0x3AD643234D8E0537, 0xA0BD4D1629AA63B6, 0xBC5D345773543F21, 0x3771BDDEB94CA847, 0xACB1B165E37ED959, 0x04B3100AAE6EBF54, 0xA252CBD9C58E04BF, 0x50209EE83A77B733, 0x011CE90F07F7E77E },
+{ 0x130F0A288D3DDE64, 0xEC18095385E174BE, 0x6719C29E1974399E, 0xA19BE1FE0F609E11, 0x976DABE38B7A371A, 0x6D0D279647B80ED2, 0x8FE9FCC2B224B9D1, 0xF6907272A7322A5F, 0xF0ED0913FA0B0748, 0xA1D7B11487500492, 0x013C1CCE90AE512E, 0x33D4900CA2C60A75, 0x3B89641A1545522E, 0x6CEAD145437B5480, 0x2044168467B375DF, 0x0A9810352BAE4B0B, 0xDD1E102C640523BB, 0xA1DD7443F51A21F4, 0xAFF317918EE09BC4, 0xC60B0747276B183E, 0xC51809CA110BF384, 0x0162FB564D195414 }, { 0x130F0A288D3DDE64, 0xEC18095385E174BE, 0x6719C29E1974399E, 0xA19BE1FE0F609E11, 0x976DABE38B7A371A, 0x6D0D279647B80ED2, 0x8FE9FCC2B224B9D1, 0xF6907272A7322A5F, 0xF0ED0913FA0B0748, 0xA1D7B11487500492, 0x013C1CCE90AE512E, 0x33D4900CA2C60A75, 0x3B89641A1545522E, 0x6CEAD145437B5480, 0x2044168467B375DF, 0x0A9810352BAE4B0B, 0xDD1E102C640523BB, 0xA1DD7443F51A21F4, 0xAFF317918EE09BC4, 0xC60B0747276B183E, 0xC51809CA110BF384, 0x0162FB564D195414 },
+{ 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 }, { 0x1763E5A6167E80D5, 0x4D191239E02D5D08, 0x7DC17CDFEDB3A13B, 0xDEFC85D79D364765, 0x011283DD0C4F4754, 0xC2402201903E9198, 0xA1F3B1EEEB5C23BE, 0x83816FDEBDA5F47E, 0x28EA1F19C2FFE9FF, 0x2CBA3C2AB5A3328F, 0x00C17AB94B360B73, 0x119CD99FC1F0753F, 0xCFF5C209E920F062, 0x4A8883F98D203E87, 0xDF5D8242C3D53F26, 0x5D3AAEE906799789, 0x4F499EE00FCFDB3B, 0xBDD4EFE93A70D3E9, 0xA8F031813CED86EC, 0xAE2D584448F68D90, 0xB640EC40742D4DA9, 0x00A83F9B3A535012 },
+{ 0x1B90C63632B880D5, 0xE5F07A6A30ECCB3D, 0xD32199BE46C96D56, 0x2CBA5ADF984B60BF, 0x91F027807F518B81, 0x0C438819F93D331C, 0x9585DB866AB01C36, 0x2AB1981EBB48BE35, 0x0CF844CF92F8CD96, 0x961FDE7D72F501A2, 0x00E04DE20A69960D, 0x395A49E54CBF4ACB, 0xF7D979B86BFA558F, 0x52CE1EB4D46C59AF, 0xEF12A0FBB5987CF6, 0x371F4E3E7ACC30DB, 0xC33309C4060B7031, 0x95B189BB56783842, 0x76373B2475FE5088, 0x200F8E17A47588DF, 0x41870F53F48F3994, 0x00F9DED4D9139335 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0x201F01E60AEB7347, 0x4B2C320C830CB3B8, 0xF4DABD3359F2EF07, 0xB50DBFB865DC4EE1, 0x081C521649BFCB6B, 0x607456F7524D9263, 0x2952063FFCB42C95, 0x494325460DC77A8C, 0x1B3D13E9E6DEA4DC, 0xC18AFF210E1864D2, 0x01781467749C60CE, 0xF49FA0FAD4896D7A, 0x98D8695168AE54DC, 0x41D38AD728E6660A, 0xFA8C0309EC31AD94, 0xA5C39A5F01B14C17, 0x3C43BF851780F8E1, 0xD861C6DC978EB36F, 0xEE6967713E67A20B, 0xD25B408ECC16DCF2, 0x6D1C1E8154332FEA, 0x01A3BB2221BF091B }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+};
+const f2elm_t64 DBL_TABLE_EE[2*(NBITS_STATE+1)] = { // A point per row represented in (X:Z) coordinates
+{ 0x7070820EEC1D65D5, 0x7BF8A17AEE026167, 0x1D4869D6D9003F94, 0x2C382635A75A6889, 0x9627362DD3D835EC, 0x78BD21350C530F03, 0xE8AB14F068C62C5C, 0x1A4E85C9B88EF921, 0x70DA3DC6831A1B10, 0x15612CADB31AC69E, 0x0039056956E2817F, 0xEDD4690223B26841, 0x4985282D06841AC2, 0xBEDEE34951320609, 0x8F496FE24243D3C4, 0xCAA99E72DCEB4294, 0xFFAC185C3644947E, 0x15AF70FAAD1EF5A7, 0x488DE2362E40FB40, 0x599F8BA0D5C8FD52, 0x183AD16F8FC67BE4, 0x0072AC1A87FA280B }, { 0x0000000000000096, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x9A4E60E000000000, 0x2AF7E672929A5CBD, 0x6F395F62DE4B3DCF, 0xFA2387F3E390A0E9, 0xBBB4C9C22E2A84A5, 0x00C07D499880D65B, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0x796EE433A7B8147E, 0xC412B87BDE0F2AF6, 0xC16ADD98F30D991E, 0x4655CF6518F48A6C, 0x087733A6CFF23F18, 0xA41441048BD3DDF6, 0x013336D17778633C, 0xC2743D7AE4C60ED4, 0xCD8EA4A2AAE39F35, 0x7D5EFB060346D24C, 0x014EA2214D9F919D, 0x84D4B1EAC7211418, 0xABB6A680FBD66D46, 0x040528805A7B330A, 0x0FE9346B0385E775, 0x6EB38651B0F85314, 0xA4890698A81DC5B4, 0xA02F20028ACDC177, 0x7F24FFB75E3A7B07, 0x3CEF900C11E144E5, 0x61C7D85C042A449D, 0x01660AC343F00468 }, { 0x59350CBD5B3BACC7, 0xE202598EC4A53F89, 0x9A55E5607AE6F145, 0xD126A18BC8237C61, 0x083BBA9FFBAB7F81, 0x17F3C801533D517B, 0xFD4E395E2B603B25, 0xFAA5545CBB684027, 0xF42855881C7EFFCD, 0x02659D65924F1DB6, 0x0177A1E1B46A2AB2, 0x3124327EA3C2E22E, 0xBC99FA5309873DFB, 0xC6D7BB8CBA7805D4, 0xA9F5AC68694D555E, 0xD885064D442DA963, 0xF68F4480C7BAFE70, 0xDDC2BF1428EA588C, 0x4945B960EDC2F144, 0x523C1E3DA339BB43, 0x7BA96CBE12767B5B, 0x012DEFB097A60C9F },
+{ 0x3E586B15C75A3EF1, 0xBFAB5B18523BE9E6, 0x0A3DEC5E231D1FA4, 0x049C25E0D10910AF, 0x7395F46E80BFFB29, 0x667CF638175DA508, 0x23456B097AB4FB1F, 0x74075468E57131EA, 0x4AAA1A25404C8D63, 0xBB98914288170D70, 0x01168E9BCF26C7F7, 0x1491ED79A2931CE2, 0x55E4953A7F7F72AD, 0xEA714E278B1124F6, 0x01A0204B5BD36816, 0xF172AF443F8CB63B, 0x4268BA6DB684DF80, 0xA3AD5FE508E60113, 0xC8C084FBBCF6E96F, 0xF449ADC53023A31A, 0xFF83D1E764573CEE, 0x007C453BFA288659 }, { 0xBC71362B88CD5BC4, 0xB7454D78DA08CD87, 0x224C48A166785D30, 0x8DDDF8DF7D3ADC1A, 0xE9E58496E0E0BD09, 0x9B17826CDD720363, 0x33FE097277E71ED7, 0xE8F24068CAC9FB8D, 0xB151EB3CD1D963CB, 0xFF8C412BDFF9B32C, 0x00E4E28695806AAE, 0x8679CB897F88AB74, 0x4C9CF5ACCD388FBD, 0xC22DEAB8151FCC7D, 0x8833E7BB86BA018B, 0xEAC33DD04C2781A5, 0xDA1A82295BB2A827, 0x0B0C5862F6FB572A, 0xC5B32A693885FD9F, 0x3A5372FDCC3E222D, 0x5E75067513D3F7B4, 0x015EEF7A654F495F },
+{ 0x5B5E42B73B8E6C79, 0x3C3413F66AD4BD83, 0xEDDD6237694E44C7, 0x5BB81662CC82DD79, 0x1D7DA85FA9ADA98F, 0x3C99F37FF6A15484, 0xDEF7DDE6558F71D1, 0x4E771318F8E572EF, 0xEEDE20AE51A94FBC, 0xEFB25861784440E6, 0x019094B7FDF3BE64, 0xFF70B8C17153898A, 0x28738F2A86789C0D, 0x38122AA1F9B5D3EF, 0xC9FF9CC112595618, 0x14E227470F8B89C0, 0x151D8F0BAA8E0878, 0xA5F8D7A595ED4CB7, 0xF74438B4A8282789, 0xF29948F71B1B17D9, 0x8EA1F64F0267896A, 0x00A8866E3CDE30AA }, { 0x8D5122C8B24EF8B4, 0xAAE1BCA669A5944C, 0x921EE80DF875A446, 0x3BE930A780C833F2, 0xA73E56305B768D65, 0x61267B0F2A0FE55B, 0x8F55362FBE8CD8F5, 0xCE353B1557D96ACC, 0xA3C51333F80568A6, 0xF238B503E2C5F5E9, 0x0146E64ED2CD44B2, 0xC9F178CE90D7B22B, 0x1362F71E41E5DE06, 0x8D23F6C9C12A4D3A, 0xE38CD4C364F34B32, 0x68411DB74E70E6D7, 0xDD723FD99FCFD76B, 0xB64E73FC3AC8BDC0, 0x942E51F8383CE9C2, 0x5D443C7C0F1EF67D, 0x1D30B83688A52CDF, 0x0071FB6D68E73032 },
+{ 0xB47F2736064408BF, 0x9901C2662D248331, 0xCA3CD5DD6CAA6A4A, 0xE477DB67D8B90144, 0xBA853744382FE875, 0xF19F16AF513A1AC5, 0xECE26844B5EFEDD6, 0x303547BE04A79F61, 0xEC6363B00F9CAA44, 0x93CCD444251C6F3E, 0x01A9E0C8E70AD34D, 0xA6CC308BE86B6D95, 0x2E4B872D9871929D, 0xD23E437002D93924, 0xC99EDDF5ED9F1221, 0x1ED8FBA57324310A, 0x033293D165372E38, 0x3D2F9C3BC7ED7904, 0xEDE8104D6D65A539, 0x7D96463244ECD87F, 0x251F13A22ECDD6E0, 0x013A4BA06E497785 }, { 0xFEB085155F68490C, 0x2781821B455EB86B, 0xB56ABB275EE4112C, 0xB23E783CF44CE7CA, 0xA53BEFBE048EAF58, 0x6A75D577F101DF89, 0xA55FE3514496701C, 0x3CA9D238210F0579, 0x51AD6775059DC982, 0xE90B07E9F223E597, 0x0187134D97A2415C, 0x52E1048C11589B6D, 0xF6788DEFED4438C6, 0x8266A9187A0EF3C9, 0x944151FE928DF50F, 0x9B56C2AD0BBBDD05, 0xAC0DBE29B136D2F2, 0x0D4FCA37DCF36185, 0x3720F362447B5E55, 0x392073CDB9747DB4, 0x8D2E294CCD409C5B, 0x00C0427E110D05F9 },
+{ 0x3DFFB4CBF31E570D, 0x8CED91F9C704A4B4, 0xDE938519DDA714CD, 0x7DD58AE300DBA7E7, 0xD0339BB16D8530C7, 0x583B78B92956FB10, 0xD122F367B614643A, 0xFA6CE71DACD87BFF, 0x226F32E5BC8B5D6C, 0xFC23D6D50C6A3571, 0x00B9153B7F27DA3D, 0x73EE55AB527A8418, 0xCB64E1FBF9A2FCB6, 0xF1D35205773AD6F2, 0x9062018D504B8CDA, 0xB4D34588DEA45B3C, 0x4BD8257D633F19F4, 0xDEA5364FC071C669, 0x21E51919633EB422, 0x23C206DF1B793A07, 0x9237DFAEA362B178, 0x000A2F2B13215F32 }, { 0xB9760C29CB480471, 0x09D2D26BD8592BB1, 0xA16AE9960570C8D2, 0xCD74DDD0F1591E0F, 0x03F9D8A63DA7217B, 0xCB0E9149E2E3EBFB, 0x51FB0E0ED5BA43AF, 0x6CB448FFB91FB45F, 0x29C2AC80BD6CA420, 0x9B4C7147188052C4, 0x002CA0F31E78C352, 0xB60AB3178EAB62E7, 0xF16FC1D3B27190CF, 0xF7913416CA118F34, 0xC2EFA43A111E38B3, 0x6574C55403C74F25, 0x3853EA3B15A28C89, 0x4CBCE61A45D75B0E, 0x955B5195D69A7016, 0xFDCF794F97946F67, 0x5531929E2FD61911, 0x003455CED536C3D5 },
+{ 0xB8094270D13CE884, 0x0E07D2379CE4DB17, 0x3E701D7C9FC7142E, 0x8CAB798E0CE3757E, 0x68A5B4BC04118A3D, 0x7DB8152CAB65EA67, 0x17FF16508DFDCFC1, 0x5C666B89C4240864, 0x1119FEE1C135EA50, 0xEB645043DE3F149F, 0x0009B86ED004345C, 0x2765C379D00B4DEC, 0x63D0437FEFAACA1A, 0x45ECFC27A091C557, 0xD7268E19EE70C736, 0x5EDA600DA8DE1B59, 0x3F0A683CB9EA4310, 0xE29819ED8B07D0F6, 0x0E8545C9B61880D0, 0x17A2F5DB6A465155, 0x52D247878114B97E, 0x0075930A30A5CC55 }, { 0xA9E5CD78B6CE08C7, 0x24FFC8926EC6F3AE, 0x70EC921B09774A12, 0x1C1FD217C9B16F3E, 0xD49DE95F69F57A54, 0x2AA814533714B6F4, 0xDD165350185ABA50, 0xDD16DA400F29E6F7, 0xA217522B5B7ED871, 0x3F1385FE8A120DEC, 0x0141731569AA7B22, 0x37AEEA214FE263E6, 0x0FD00FDE8F17F5B1, 0xAA5B64DC77D35243, 0xDC4B97BD6F43CAAF, 0x756FDCFF87FB26D3, 0x033F40BBDEDD3982, 0x5B8E164517AF5393, 0xFDD2B6F4D7671CBA, 0x14750960AD14A4BB, 0x55EC6320EAAB96E5, 0x0018B98AA897915E },
+{ 0x2793ACD0A9CCCD6B, 0xD54DF080050C9823, 0x851D4FFE257BFD2F, 0x1A6221970D423401, 0x94AF2C9CFA1661F9, 0xCEFEF265BD5FA098, 0x919C30868CE2EE1C, 0x5112E78B3805E2E9, 0x5B215F4CE58D6BB3, 0x5F5D9A160D8A7ED0, 0x00F0D469435CFC74, 0xA7EBD24A11DCBC28, 0xB59EF3C76BC9FC0D, 0x189547086157E97B, 0xCA365111AA81FF1E, 0x24F4D8F02AABFC93, 0x0E785F56465B52DE, 0x4FE2D320BCEF306B, 0xC09ED61D06C577E4, 0x1DAB2A8651EFD932, 0x4983E7A9A7521884, 0x001C8856F3B767A9 }, { 0xB46F9F3FE274F038, 0xF14A174CEC6C44C8, 0x85FF1202EAAACB9E, 0xDCCF6C93368F4400, 0xC20D1C707A922A0D, 0xA78CD6DE25B9439E, 0xA5B68D99478719CD, 0x36F9AE0AC313BC26, 0x25112E1EC014459F, 0x40B476670A8C4386, 0x018CC612A8EC4898, 0xBD3A3D70832135EF, 0x08D635ABDD253812, 0x794387AE2187D84F, 0xE7BA80B4FA43D8F4, 0xC8C2EB22BF932252, 0x2F98A9A05006A2A2, 0xF1F23B990B2C43C3, 0x20005C74E1AF2734, 0x17B00C67F9FB855C, 0x9C07EDF4C992EF3E, 0x00044025D3D0781B },
+{ 0xC864CD7360CF5BB1, 0xACA67DDDD1CCA8E3, 0xBC95195FE6A0CC61, 0xFFA544F7AB01A107, 0x0C320AAB9681AE62, 0xFD7FB3528F26DD44, 0xB62235856EB62645, 0xDA943DED7902DE9C, 0x09DFC765FFF486DC, 0xED4A8BD8B19B3455, 0x01992D0AB889FA21, 0x4D0162DE2F29658A, 0xA2B06DCBC69517D7, 0xCCD315A22151DD38, 0x99E230AFB4381C98, 0x37C9EFB7987A41A9, 0x0EF82610666CC0D0, 0xB50F0E3845B0430B, 0x4B6D0DCD6E93535E, 0x8407301E0EA28E99, 0x8EACBA0E1AA3E32B, 0x00694A9281B9EF23 }, { 0x51A8444BD6E7CB21, 0xFCE1EA19B467B558, 0x06EB701F60343871, 0x63FA69E68D4C5250, 0xE088425C69462DA4, 0x8A8270C72FC69A9B, 0x2DD1A1B5B50350BD, 0xDFD380C9C5F18874, 0xB88F9ABABFD75DC8, 0x469212979997F14C, 0x00F8B2577F289E3A, 0xAD211003BC27270D, 0x0B6E47C2484B41E6, 0xFB17EC8314AD73BB, 0xE9941A1769D6FDA6, 0xB16719F42A55D342, 0xE35044A4CC6D7D02, 0x8DF50F64C387FB50, 0xA8261752EC495205, 0x42D206C0EE76B204, 0xC50DEB5A318BAFE6, 0x005D274F8C25A8BC },
+{ 0x674467A6ADE9F527, 0x8C8E7250DB5FFD0C, 0x85E8F870BB949A02, 0xDB7FDB7A23490582, 0x1F7F7A53E6DD261E, 0x158CFB7E78BFCA87, 0x127FB38CA097C673, 0x575B2C523FD76ECD, 0xB41E190EEB535E43, 0xEDD259661E1B9D2F, 0x0070655B0A135E17, 0x7D36E988A3455490, 0x37A619C23987A7FD, 0x9EBA0EA4BECAE9D1, 0xBA4813A5846C438F, 0x6EA70022CA6E8767, 0x48290DB386AD673C, 0x1482F5AB53D17271, 0x20AC266FBAF4922A, 0x28BFA54A0A7C406F, 0xA689390C7B4AA166, 0x019CCA04920209F4 }, { 0x50CE810EBDA028D7, 0x143BD48094DBB643, 0xC95F10B4A12ADDB5, 0x71E095CC520F88D2, 0xDE118E812AF2A6B4, 0xA93BA29024DA37BA, 0x8615E7362E1592EE, 0x6D19C81710F3AFCF, 0xE095161B9D4B6FA2, 0xD326B316C516A338, 0x00DE4DEB2327616A, 0x46C11481D8ADCFC8, 0x78A65ABAE1BC23CF, 0x10BC6DC80A5CA3C2, 0x8DC619A6477E0943, 0xD21AEE681B421175, 0x58B98272B95E8692, 0xCAD5262E8148517F, 0xAD6D874A5FFB8980, 0x5F37039BC44CB2A7, 0x7E2A5FAFD207FA8C, 0x00E08BA533A1A8C9 },
+{ 0x92748F5536A8D37D, 0x095111D222DC4C2D, 0xA35EFD66FC9E21D4, 0x4E74BC29890CF608, 0xB2DB557EF9EC4D1C, 0x5F4F64B12459509C, 0xBA48FB45696627FA, 0x23BF2BB508C79FA3, 0x8E4A9F9AE7490C5F, 0xBB1585B9ECF35CE4, 0x00653184D4EC3D5B, 0x0DEDB1BA3BC3D991, 0xE1876ECAB6EC675B, 0x2A0BCF8146045194, 0x1A7976911E523EBD, 0xBDFD3A9ED8B82AD3, 0xE88F11883FD6047F, 0xCDE012D3325E8C1D, 0xA1C905348C9DEDD9, 0xA622608379374E3E, 0x0DC9DA4D998DB992, 0x01754DFCF6D04F26 }, { 0x09AEF2B958CEDFD6, 0xAE3E3808BF7EA042, 0xA4911599B0AEDDC6, 0x310B44506E74EC80, 0x963BB0431C644388, 0xDDAEF0E8DD697516, 0xCEB1331D5735C328, 0x9F58E7E25655D61C, 0x168BC0EF19022AC8, 0xD5246E8FFF3FCC2D, 0x0030CE0C26BE3FED, 0x3BAFA6E44FF1DF19, 0x61B0C236BB026C76, 0x8EB7DC58D44CA82E, 0x00D0FD8246335F17, 0x71A463D9DD4A09EA, 0x116160E5D4D0DE62, 0xB90449A7E528B7F4, 0x33FB73C8680298B7, 0x4E3D67E879D67495, 0x90BE3D02C9DBEE80, 0x00102A6F708C89FC },
+{ 0x0E21500F257E1355, 0x74E419CBC15BFD55, 0x162BF8E22DAB4F67, 0x501B1D1CE3043DE1, 0x9F052AF793530ADE, 0x9DF31E5A428FF2E0, 0x055321761A8EBC43, 0x95B88FC11A160D0E, 0xD455F73F62F9876C, 0xDAD1811B3C8D8104, 0x0126B5FCDA20938F, 0x99A7E4A2092D64B6, 0xEA3BF2214768C4ED, 0x774BA642A3F97159, 0x4A2C0F5F83AC81E5, 0xC261AEC18A0DF5ED, 0x9812769A3AC369A9, 0xF805AFA30C533068, 0xB0B7A2E5EC03964F, 0x782FAE993D97A602, 0x7DE64F602E7D22DB, 0x014ED7079AA7B3ED }, { 0x87020AD2015E5C81, 0xDD35BD240F732ECA, 0x990EB8E1955908B9, 0xB751444EEB1EFD83, 0x3AD1BB0D073090E0, 0x3B66D509CF13D3E4, 0x39816906B6D9AF6D, 0x30C960E9965C1663, 0xF4B1E17EF47E750E, 0x8903525FD93700BC, 0x0057A46116FDAD2D, 0xAA064C8B111BD90F, 0x27C130E055BB8DA6, 0xE352610114459FE1, 0x99D89FD7FCB55DBF, 0x0E92A70EEC6C452B, 0xE8FEC6B08A50C988, 0x789B2318A0AF9B82, 0x05ED6A345E5DF9E4, 0x97F6F11467164F93, 0x4B08D0E67FE0AE25, 0x00F01AF7ABAC16D3 },
+{ 0xF1852622354A7454, 0x9DF4112DCBC37CD5, 0xC3CDD46A4B430E12, 0xE18CD227CFB3CF39, 0xB0119D956F376F00, 0x8074EC4D9D13B570, 0x1062259153946F4A, 0xAB63368B90D226E7, 0x2973C5B49286F265, 0x33C69274C80DC8A3, 0x00BC644D00B17639, 0xDAFF81724A568ECE, 0x3212DC0C42DB0DF2, 0x82CE723CF3EF2433, 0x535B11AEC34A2C62, 0xFAE429D268461179, 0x798E7D3A4132477C, 0xBF672180775702BF, 0xEBD6D15D81CD2519, 0xB195385603D34208, 0x30A3E674EF16CC7E, 0x016C60770B8B2A2F }, { 0xAC5A1880071AF9C4, 0x3F7F2C9E1D437902, 0x9B56B19689C97FF4, 0xEE2D2791CFF72B66, 0xFE7B638D4379D82D, 0xC0DB61C0C24E0DA0, 0x16A9D3A8974B76AF, 0x4D648438E4FB50AD, 0xA9A20C40D0A2BADF, 0xBB8DD5F3D7FA8754, 0x01A5AB10C1C51764, 0xEFE58B113EA0CA09, 0x7460AB45023E91B9, 0xD587215CE2A81B17, 0xDF96F714163E5788, 0x11871CAF88DB9753, 0x2DC114E419B8FC25, 0x67A1153232FAD40A, 0x56AC17B9443BF7F1, 0xE64300FBC5357454, 0x9595DEC6975BD406, 0x019A4525A25D7B01 },
+{ 0x25F7A993A556956B, 0x6A178382B389904E, 0x2D9F54ECAFD6303B, 0xB07B44ECDB8CBE79, 0x0371789009BBC498, 0x7BB6A90B15056C3D, 0x36687F41D04A96ED, 0xB1C9E9CD62FE4918, 0xAA6E097227170692, 0xC4650CF0CCE7F6F7, 0x00F938EA20A90E26, 0x4341F1419C46A722, 0x49C6665FA58EC128, 0x1E2C54EE91A35C0A, 0x73FDB57D5335C852, 0xACF078AEEC3455E1, 0xD31596F637F92874, 0xA0167932CB79765F, 0x6C4E74F8F7B34519, 0x29B1820DF9C8E7A8, 0x947E80A5391C27B1, 0x0133867D0ED8EA4A }, { 0x8AF1C3B94B1833E3, 0xFA71BF6254FCE7B2, 0x5FAE830F65B06858, 0xAE91EE61CE315935, 0xFA4B676BAF41668D, 0xE3C0CEED786509A9, 0x819BAFF6DA2D2392, 0x3904BCC2544542FB, 0x5883E6526F71221D, 0xCFBCD86A1FDA9B7A, 0x0169E962D13A36F0, 0x09224AB41FCE8435, 0xB9069F3300C019F7, 0x89519B65C8C0353D, 0xDE5074E435E71979, 0x1E3796AB5101DCB9, 0x2547E642108390E4, 0x1DC8C27A65C6ECBA, 0x308E38493828B782, 0xF59156C6B2C359F4, 0x18887E2FA6B0265B, 0x005EB0CC58C32C4B },
+{ 0x96DE5E4B316B3A75, 0x42A1CB889D246446, 0xADFEB21021E2C05E, 0xFD11427C9CDC1212, 0x24B3E2F6908A12CC, 0xC16F95F236913C9D, 0x4E669571854662CA, 0x2C55331C312E9A94, 0x602AF7F77B85C24B, 0xD38363CE94993C35, 0x0180A7BBACC26351, 0xF509D22AE7B07465, 0xFFB5913788A7F0BB, 0x7162CDFA026F431E, 0x9BA0B54F32591A2C, 0x6EC31F346B5E37F0, 0xE728E4C0EA620ACF, 0xBED97CC0FC09B3DD, 0x4C9B0B38BAAF7D9A, 0xDB9C6B68919B6B63, 0xDF7B0F0528D2940A, 0x00413D6A1B4A5442 }, { 0x46201C85AF3941E8, 0xB3F4FFE7E1EECB7E, 0xD813967328776462, 0x6FC44D21D9A30273, 0x56F5C1703A582A75, 0xEAFEAA5255F6D767, 0x02DDB1584A7189DD, 0x8FBAAD2555770A5F, 0xE41EA5CB8A4D0A5A, 0x4544C6308BD0F267, 0x008ACBA0860C7C22, 0x5A9C266E9F36F14C, 0x435CCD8772E1A32E, 0x1F87239E3F8697D5, 0x940A550F116F933C, 0x44513AA34A82C00F, 0xDB6C4FA774D6D5B7, 0x8F468E5AF53954DD, 0x7665BECC838B49D8, 0x46EFD2ED508DE653, 0x83E490A4CB1B5035, 0x00DE38AF864FD9AC },
+{ 0x0F8BA2911102D859, 0x8982FE808CEE7F10, 0x451980334E36CEF4, 0x62B9D223073047BA, 0x0368D53F98928867, 0xB1EB9E598F3CA2D7, 0x45FC334345484B04, 0xDB9DFADED9FFE3D4, 0xBDC805023DFD4828, 0xB4F957E82AD7674D, 0x01352241D36EB8AD, 0x8E1A55B2276D7D1F, 0x75C0438F10E18AA8, 0x1D0892E8CAB8C0FB, 0x2E7030D7C51571BA, 0x9A4B0F9FD2F08BE1, 0x15ED49CC8FB3B0F9, 0xFA7D0113CF7E9168, 0x3C0D223746538F8C, 0x3FFF832A8673692B, 0x28C747DA2A6E1748, 0x0052BB32FEB1AF8F }, { 0xB5A8ECFE66B2E41E, 0xE37E48F1D5E0E976, 0x3DF263390081B8F9, 0x4684D38F7E5308E6, 0x13F0445570E94880, 0x0859259A22AF5B67, 0xD8134E2243C5CF8F, 0xC38ECDEFDF8B3B03, 0x84B5D59E264D5D15, 0x5FCD7BC7605CF444, 0x0184CE26DBE12FCC, 0xEAAD51AFBCFE2047, 0x7042E875E52D30B8, 0x5EB20A4BC22A69CA, 0x1337EA9AA955969C, 0x0C5EEF0A9C0B7732, 0x3B87144AC2766999, 0xADCBDBA0659AB7AA, 0x4D23D875CE419A16, 0x38265AE2CF8B1333, 0xBF5631413FF32357, 0x00A7EB5640BB0880 },
+{ 0x0CE20E53A7518BC2, 0x1DDB91034C2CB73C, 0x4921FC492030A7CD, 0xD1FBDECAB2B5C400, 0xEDC05B5A2D72DB54, 0x3A62B43AE714DF49, 0xB8AFE2430063C98D, 0x3F5D8BE8E6F357CE, 0xB35EE1A6A3BBDF5E, 0xE61877DB101BABBA, 0x00DC7327126F3422, 0x3A5D9DCFA8FC1968, 0x9B1F41228DDDE966, 0x2B6EBD56E039AC23, 0x0CDA00372ADC7B7E, 0x1D4B31F70B070A73, 0x242D05D253457BA7, 0x1B0135CD990A3DBC, 0x001FC89E0BF08243, 0xAE9A7AA20DBBFBBC, 0xE772AEC4B9981053, 0x008012265B334A75 }, { 0x0CE20E53A7518BC2, 0x1DDB91034C2CB73C, 0x4921FC492030A7CD, 0xD1FBDECAB2B5C400, 0xEDC05B5A2D72DB54, 0x3A62B43AE714DF49, 0xB8AFE2430063C98D, 0x3F5D8BE8E6F357CE, 0xB35EE1A6A3BBDF5E, 0xE61877DB101BABBA, 0x00DC7327126F3422, 0x3A5D9DCFA8FC1968, 0x9B1F41228DDDE966, 0x2B6EBD56E039AC23, 0x0CDA00372ADC7B7E, 0x1D4B31F70B070A73, 0x242D05D253457BA7, 0x1B0135CD990A3DBC, 0x001FC89E0BF08243, 0xAE9A7AA20DBBFBBC, 0xE772AEC4B9981053, 0x008012265B334A75 },
+{ 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 }, { 0x00B155E5DF7EBC33, 0x51FBAABE116BA526, 0x4782735195A04926, 0x1B67A59D123846CD, 0x9548E9A83B9A1A33, 0xBF07165A440C1EAE, 0xF18DD680E02AE7E0, 0x8C8ECE25B8F12C77, 0xF010E2E1B1FAF758, 0x44089C8AA16CE70B, 0x00EA1E0543938ACE, 0xA71BDA94E9FD9AD6, 0xF07ED11CD3B3DBFC, 0x9C09323E7E1A899B, 0x8A549FECB2F14286, 0x4B806E2BBF4382F4, 0x2C84D0DA02187756, 0x58A5273E64040B0D, 0x495695DBA6D8AF2D, 0x361FDFDC801782D3, 0xA151FB3C3F7C375D, 0x0086421FFB449EE7 },
+{ 0x556A47A9C51004EC, 0x5336419F19A3B4AE, 0x30D34197F89F63A4, 0xE5DE35290E039645, 0x0F67795F0B8877D5, 0xC916AAB35C306683, 0x4A5B6DBE753540BB, 0xDCD8D96BFFEB0682, 0x4946AD75F18F19B8, 0xD5FC06C0CD07AB76, 0x01194F22332E03CA, 0xD60BEA33CC839159, 0xB916F1ADF9B19748, 0x0C95B699EA4EAB38, 0xB06925C2291D7179, 0x065EF9316A3CAB75, 0x6D47C2695E76B1F6, 0xF6F4C8DE5E555F6C, 0xF8073CEFA1AD1264, 0x9723176F606B975A, 0x5793AAA4C2E97D2E, 0x014059E53771D2AB }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0xE3364153622CEFB6, 0x1740A8EA376A2CD9, 0x7032289DCB135B94, 0xB21E0C6B8608C4E0, 0xF0B6F258F941A7F3, 0x322BC6E16B72008B, 0xD85C5A0A1325CA15, 0xE4DFBF538BF3B2C1, 0xEF8226A019A801EE, 0xC1089F1C67D0CBE2, 0x017B3A1864E079B5, 0x3E6B185E5C6ED37B, 0x72526E38A5780AFB, 0x0C69C92925B2466A, 0x1033633758DE1D17, 0xAEC3B8EAB0D9B10B, 0xED8E0AC2821237FE, 0x839E63E9C8AB3A08, 0xB3E236FC9E7A5A01, 0xFA83DDD3AD1C93F5, 0x61D67E3961026CE0, 0x003CB83A55C89BB8 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+};
+
+#elif defined(P751)
+
+instance_t insts_constants = {
+     .MODULUS = "p_372_239",
+     .e = 20,
+     .ALPHA = 2.25,
+     .BETA = 10.,
+     .GAMMA = 20.,
+     .PRNG_SEED = 1337,
+     .NBITS_STATE = 19,  // log(S) = e-1
+     .NBYTES_STATE = 3,
+     .NWORDS_STATE = 1,  // Assuming 64-bit words
+     .NBITS_OVERFLOW = 3,
+     .MAX_FUNCTION_VERSIONS = 100000,
+     .STRAT = {4, 2, 1, 1, 1, 2, 1, 1},
+     .jinv = { 0xa33cafb53090b825, 0x2f405d4aa05dd0a1, 0x48d05ed6ccdaa483, 0x6a244971dbd7944f, 0x0d4de222a3f5fa50, 0x96e288759a810c75, 0x4a5633ebccbded85, 0x1bece4ef058d7bc1, 0x10ec7565b252a655, 0xe07f7282f663386c, 0x90c2d7775cf3a244, 0x00006b7f21ab51e2, 
+              0x42050ed848974858, 0x09c10907af29594c, 0x1c04000971472f53, 0x16e0b2255b7b7f5d, 0x2b8b35c239674521, 0xdee9f2bb88ee7a83, 0x542d342b827bf1be, 0xfb3cae53dc453ff8, 0x897d44f77c47dd64, 0xe642d183e39c95be, 0x61e10544115f83f5, 0x000023f8e532c4d9 },
+     .ES = {
+           {
+           .a24 = { 0x000000000004935a, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0620000000000000, 0xaa4f63c86eb8d8cd, 0xd2ef2f7e7e9e49a0, 0x913b6f6558b89c5c, 0x99496873a40ed2ad, 0x21ef24d8ea258fd2, 0x00005ab64979cbc4, 
+                   0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+           .xp = { 0xc23996e961f16ba1, 0x76445ced6d118fa7, 0xa8b495a71adf357c, 0x81868ca349af0526, 0xc2a407c368750e09, 0x0528c4c74a976512, 0x53270f9baa7dbe9d, 0xdd45f2e6626f67a6, 0x1a67f026d43f1871, 0xb736a4799d806285, 0xa81dc437845c4b1c, 0x0000574bda915730, 
+                  0x01a686879fc74b98, 0xe5f24eb7a472fbdb, 0x50e6224e0a80e7ec, 0x20c00041968b0075, 0xbe989fdde160787a, 0x44517776cabee8f4, 0xe53c548566ac6628, 0x8ae50776f7d340a7, 0xd255f6c02f493b29, 0xf15d028385ad69b1, 0xa7e88f94610f5490, 0x00005283a63fe3de },
+           .xq = { 0xd2b427bae26be178, 0x8f5c7147ddf2bd0c, 0xa964b691cf532ace, 0xd85f1b1078129b5e, 0x8b77ccf071b2e995, 0xaba814ab8e416ef7, 0xcfde5511a3f7c2cb, 0x565ac5c73022f4dc, 0x2f35404edb5535d3, 0x3114704b2692a366, 0x085371bb480cf829, 0x0000422406fe59a3, 
+                  0x1b92c95e57769fac, 0xb2161eb482109bf0, 0xe58b986fc12ec192, 0xbfb8c62df34d290a, 0xe1cd5a22ae3e0b09, 0x0448792d318d3258, 0xa7f60f0d77caf73c, 0xe931c2e7079df68d, 0xc5201d2ec0dcbae0, 0xb0c1afaec060d728, 0x2acf15fef35c348e, 0x000024be0195047c },
+           .xpq = { 0xd8faa6bb71727788, 0x868b93470ac0e2a2, 0x7280e5846ba98659, 0x4687e35209164e5b, 0x2fa181038af5c68f, 0xd01643ddf4d6dc89, 0xd5c989a5166a384c, 0x3af0b211f1eac742, 0x3e8a24ac4ef804bc, 0x2b1028603e9f7669, 0x6f6dc092fad13294, 0x00002303bf2b078d, 
+                   0xbde07f1e729fbc88, 0x1797cee2c1821758, 0x40e59f91c7add512, 0x0e193b91e84671a5, 0xe6c5501a80f69ca8, 0x9b0036f8dae465b4, 0x31da1eab980fbf87, 0x7149e3894dea81ef, 0x13afd8c2078688ef, 0x0278467e58314d2b, 0x8f8eac8c660b4386, 0x00000bfc89a28a3d },
+           },
+           {
+           .a24 = { 0x000000000004935a, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0620000000000000, 0xaa4f63c86eb8d8cd, 0xd2ef2f7e7e9e49a0, 0x913b6f6558b89c5c, 0x99496873a40ed2ad, 0x21ef24d8ea258fd2, 0x00005ab64979cbc4, 
+                   0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+           .xp = { 0x226143000f794b54, 0x431bbce75a19ce15, 0x588d81767fce09c2, 0xdd53b7aa50a7fc34, 0x4d71a35fd5a9878a, 0x78731d8040055dc0, 0x742f1e8defd2549d, 0xbe170c2095395f55, 0x585b8854223a7487, 0xce13b837734d307f, 0x3ce273770fb026fe, 0x0000688e159fd51d, 
+                  0x2298f8a77ce359e4, 0xdef8e965be19f2fc, 0xeb752fdac94d4a8d, 0xf5cfd476da37e68d, 0x39e5dba2a72803a1, 0x2f987e5c16ca6c18, 0x9f58f72013e3252f, 0xfaaba0f77403eb72, 0x6e01a547fb6e54d9, 0xf108d8298aab6311, 0x990bf012d253c6d5, 0x0000383ac0f7e785 },
+           .xq = { 0xd2b427bae26be178, 0x8f5c7147ddf2bd0c, 0xa964b691cf532ace, 0xd85f1b1078129b5e, 0x8b77ccf071b2e995, 0xaba814ab8e416ef7, 0xcfde5511a3f7c2cb, 0x565ac5c73022f4dc, 0x2f35404edb5535d3, 0x3114704b2692a366, 0x085371bb480cf829, 0x0000422406fe59a3, 
+                  0x1b92c95e57769fac, 0xb2161eb482109bf0, 0xe58b986fc12ec192, 0xbfb8c62df34d290a, 0xe1cd5a22ae3e0b09, 0x0448792d318d3258, 0xa7f60f0d77caf73c, 0xe931c2e7079df68d, 0xc5201d2ec0dcbae0, 0xb0c1afaec060d728, 0x2acf15fef35c348e, 0x000024be0195047c },
+           .xpq = { 0xca8394931912e7a7, 0x8d2c75056e44460e, 0xd9ba27278b7dfd3d, 0xb0386e00a1708795, 0xacc07eaf88a9b4a6, 0x98927cde7f1e614d, 0xb58894a4da7bdd38, 0x26d3e877f3c0c74e, 0x091517ea3caad5e9, 0x9fa50b1ab2015aa0, 0xd93195538bdcb5e2, 0x0000589db9909068, 
+                   0x755615ec7d40f8cd, 0x6b07023e19d94041, 0xa2942d06b0da3f0b, 0x731623a13fdd3102, 0x56690cada8c54486, 0x079c5cb35b9818f8, 0x91ef6792e61d0c08, 0xf25bf4bb6686beee, 0x308a048874b94999, 0xfb4d2758cdc9b824, 0x180c098e9ec0fa34, 0x00005fdd53aad1e8 },
+           }},
+     .EE = {
+           .a24 = { 0xee331d7906cd475a, 0xd8ab7397596654ff, 0xa0ebde2b656cb036, 0xd1be36fa557a7a8f, 0x9b9cefebef27ccc7, 0xfef8884e10ea1d2d, 0x3865c5871e0b5699, 0x71ea4bb23e0ba30f, 0x2ea8dc4924ee3222, 0x22f35d89fd88c645, 0x865ce95e4dbb8ae0, 0x000030fa1fd52759, 
+                   0xe08cbeeb067b4daa, 0x6e24d69a15000586, 0xb35f15b37dc19775, 0x9da25fe3bd767deb, 0x762c16e95c6479d0, 0xe036b6c89e63dced, 0x54ce9447666865a6, 0x3e7dc3392ecc5966, 0x069d47b699b090e6, 0x44128a61da68117a, 0x277bc52039d2c1fe, 0x000063792e3b7d17 },
+           .xp = { 0x452e58418b5f448d, 0x7a0f16bb436e640d, 0xc158858244b3f887, 0x0db4f5ec68a66837, 0xc70eca7172341970, 0xdc68218a21136cec, 0xec49c6e86726d934, 0x6802f1deca6455b6, 0x920b1638cf1be29b, 0xbb5affb2d889c6cf, 0xca3fdc11dc1baf98, 0x0000300b4b2213a9, 
+                  0x417781a41e353ed0, 0x2cae6163d5d511cd, 0x0b63369b130eb7e3, 0xabee70c8aa0d4ef7, 0x2816cbb7095e2b18, 0x42e03f974e29aafc, 0x2211b026a69c831c, 0x3649d99aa697b7c9, 0xe03157dac4c944fc, 0x7ffa387e967dc641, 0x9a5e4970b2e00f73, 0x00002f675783b8cc },
+           .xq = { 0x43340df4bee17709, 0x6e9eacf34dd8ddf6, 0xa0f2bb8f94e1db29, 0x87a3f5fc49be608c, 0x3d85a394045f5f4d, 0xd3d19b1d5c39ef0c, 0x7f4d9d60e99bc919, 0x8058c1ad2945f024, 0xbea761b4a22debef, 0x564f81971478071f, 0x699eb13fec1bfcb4, 0x0000271fa0f3a7b3, 
+                  0x4819e751210446bf, 0x30ac7caf4697a600, 0x2cf06e69bd1163c2, 0x9dabc80f02d063ab, 0xf393811c0ff67b4c, 0x401004a23b08043a, 0x4f3b2c8e6240c51b, 0xf5368d093fb18de8, 0x5361c56c105ea392, 0xfed8abac75eec8d6, 0x6a34971d3b3a15c3, 0x00001b37ed6b42fc },
+           .xpq = { 0x2999156901f773bc, 0x8aa91015e6fc6220, 0xa5e9cc73815e526e, 0xc2ba8508b34b8876, 0xbaef0a0493ed88e9, 0x427b166ed07a702c, 0xc2a814217617ea8e, 0x88746b7b4192470f, 0x27f3acbabfd03325, 0x36ec7c78acb08fd9, 0x11f167c2f54aa8d2, 0x000059f37f93c7aa, 
+                   0xc66c7bd52d22f7dd, 0x51ce8498b510ab6b, 0xa1c6793d8b5ede75, 0xd334e00531f5b7ef, 0x2956647d9ce7e152, 0xc2ec9b6ba441dbe1, 0x86c4d5293ce65da1, 0x7b92b9ca6761d97b, 0x498f883c2c6f46b3, 0x4068ac70dcc17104, 0x05f030b8c782fb62, 0x000042d868f2b81d },
+           }};
+#define NBITS_STATE  19
+const f2elm_t64 DBL_TABLE_ES[2*2*(NBITS_STATE+1)] = { // A point per row represented in (X:Z) coordinates
+{ 0xD2B427BAE26BE178, 0x8F5C7147DDF2BD0C, 0xA964B691CF532ACE, 0xD85F1B1078129B5E, 0x8B77CCF071B2E995, 0xABA814AB8E416EF7, 0xCFDE5511A3F7C2CB, 0x565AC5C73022F4DC, 0x2F35404EDB5535D3, 0x3114704B2692A366, 0x085371BB480CF829, 0x0000422406FE59A3, 0x1B92C95E57769FAC, 0xB2161EB482109BF0, 0xE58B986FC12EC192, 0xBFB8C62DF34D290A, 0xE1CD5A22AE3E0B09, 0x0448792D318D3258, 0xA7F60F0D77CAF73C, 0xE931C2E7079DF68D, 0xC5201D2EC0DCBAE0, 0xB0C1AFAEC060D728, 0x2ACF15FEF35C348E, 0x000024BE0195047C }, { 0x00000000000249AD, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x8310000000000000, 0x5527B1E4375C6C66, 0x697797BF3F4F24D0, 0xC89DB7B2AC5C4E2E, 0x4CA4B439D2076956, 0x10F7926C7512C7E9, 0x00002D5B24BCE5E2, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0x490AF62E40F4AA30, 0x915288F3832C03F0, 0x82EBAC035490A817, 0xB8632B3D61549008, 0x513188BB8608946A, 0x6D2ECFB3A3FC588B, 0x8DB7852A542FA13E, 0x2A27BAE0C7C7A4BA, 0x68654A21ED548140, 0xD8FCA89FB9C11A38, 0x8C01D8C1CA8DC6C1, 0x0000257A4B4719E3, 0x865B95A9643C2FB6, 0x08E98987DEA60167, 0xBAD1CEBF2031F25C, 0xE7C70229443D4F6B, 0x182A60C21A636D26, 0x63B59C634A00E7B3, 0xE09EC801DCBD0EBD, 0x4861DFE03B7031B3, 0x07890063A1465280, 0x9E961327F4B0A31C, 0x6AABAFFFD6372D0B, 0x000061D8BFE13102 }, { 0x894B8BC219333A12, 0x50869ADFE00B8C22, 0xE11FCA9E068F8297, 0xEE13524E24CC4CA7, 0x14B225DA2AFD2AE5, 0xCC36717ABBD69B83, 0xCCB90042DD64CDB2, 0xC033135F0DF8A665, 0x305C416E15411C3E, 0x8F397E7297770BAB, 0x3C6400062F65EF24, 0x0000018200DD358D, 0x6A86CBEC63F26DA9, 0xF7C23606E6EEF89D, 0x908A8A4C8D85BD9E, 0xD9B730C9C2B2C97C, 0x7197E3A3891438ED, 0x22EAB898032A5788, 0xB26C92DDD12411E6, 0x66389E04D5A8609D, 0xB1738415B1A45BEF, 0x4891EE683259D050, 0xFD27ED862970354D, 0x00001C30D8568043 },
+{ 0x3995FF0C4E2AD610, 0xB84A2C54E548AFAF, 0xF5A5C1E12F172303, 0x9FB714E1D8F3736E, 0xC495E05F6A9BDE21, 0xF8508069F2046D74, 0x0054C9A83DF10B89, 0x709534BA6B301EAF, 0x946DACAD7427731E, 0xAC2EB6E68F00FC69, 0x3F6DB9D09C3BA01B, 0x00001A265BE41D99, 0x57D5ED014E4DD155, 0x6D5C31CB5B2C5C7A, 0xA6AD97FB0B0623E9, 0xE54513EEEBEFE7BE, 0xC2EE4D63954EB44C, 0x0787C3EEAFF70E3A, 0x00B6A4C6A9361A81, 0xBED445AA869B9178, 0x83CA42BE39E5B094, 0x8ABC1B0DD7A1576D, 0x15BEBF1B289373B8, 0x00000360B218DB42 }, { 0x0096D07D0323F77A, 0x0606C17CE349FEF3, 0x5CEBFC50B1931D84, 0xFBBE263DB94951D6, 0x98A7EED00D5EF091, 0xF605E31072EAA096, 0x449BA6F4BD1A89AD, 0xFF52625F1A9CBE88, 0x07AFA770C2AEA1AD, 0x02D9CD6D97A1E78C, 0x0FFAE50D69600DA2, 0x00002CB6138ECFD2, 0xC5DA0E84F71FAC81, 0x56FFE24AA54DA311, 0xA0B65B8C3A7551E3, 0xEE137C659706C928, 0x4476B7C8CDA57C69, 0xCA3F96E0B27CF450, 0x1FFD7D9BB76B51BC, 0xCEC64ED8FEB14E77, 0xA23BA1FAE516E3F5, 0x6E0565158E610108, 0xFFE3DAD8298F6290, 0x00004BEE0663CB5F },
+{ 0xF7E4BF86B78B94BD, 0x8F5BA5327AA1E75D, 0x375B7F4C0844F32C, 0x09D523882C4765F0, 0x66AC500AE87605E9, 0x8820E059FAEB4D3F, 0x59C271CC3291DB74, 0x39AF78814F84208C, 0x8956883CE443D693, 0x3E8A1A8C7C144F95, 0x448C5CC297BDB450, 0x0000101968EB0552, 0xBB3350DE85138D59, 0x29B42A805DD3F31C, 0x5E84C56F5CB71E9E, 0x1DDE85F5D2AFE373, 0x9ED11FFCCE67A24B, 0x8036F145B53EB2B7, 0xEDB0AAB179FF5E21, 0x6005B303BE17A23D, 0x8BE8B523891534C8, 0x57E848FFF31F780C, 0x3CAE74D3E0AFCBE4, 0x00002F7F776A623D }, { 0xA41C84E5B94B648E, 0x187AE9FFBAFE0C88, 0x2C5F6E6A16AF7A40, 0x0F014B2B3553728F, 0x10CE1EC3988DB189, 0xA37BE79F17499E04, 0x50D34695137D0231, 0x67B85D281DF9733D, 0x6E28C2ED06442E60, 0x40CF49613851882C, 0x28FBD296E449B5F8, 0x00004082A3585088, 0x72FFE16679C220BB, 0xD5BF3AA55AE1BEFB, 0x5C6384EFBD0B0ECB, 0x9B3A227B61A06D2A, 0x0529E9A78B5D9E80, 0x7DB984A886C5F911, 0x8FECFB1FC2FD0C27, 0x0447CAEF225FE9C4, 0xDB7405303F3D1C0A, 0x34BF336C19827B94, 0x9AF2975FF1DE9E9A, 0x0000327C1C7777E8 },
+{ 0xE6139D400D25C6A0, 0xD0ECB5A2D8F3B8B3, 0x21D3ADB5DB0919DE, 0xBD4857F4F39800CC, 0xD4763F37C312888B, 0xB4CC45A71F679A2A, 0xEB360C1CA0C52BFE, 0xB9AA730120FF90A5, 0xF9D7D0AE07A6319D, 0xD7A350E8FBE911E7, 0xC6DEE72F7FA9F9C9, 0x000058EAD0472CA9, 0x8E94040ACCB3EA5E, 0xE541243C1F43A396, 0x315C158134841960, 0xCC923A47E3D80BD1, 0xA5252434F8E760DB, 0x785C27B727A71968, 0x4AE9FE4FD26766FD, 0x5691C7C63F61254A, 0x446BA094ADDF3735, 0xD06A75C5F24116EE, 0x62D338DADAF43582, 0x00004F9C932A1296 }, { 0x0486A434FAF85F82, 0xF1B193482729652E, 0xBBC7A4012C38617C, 0xD2AD342C85A8ED64, 0x846B26E9D86F94AC, 0xEDC1E6B646E7784E, 0x045CA19EDB119D60, 0x2C0227668A892425, 0x696708027F302FE5, 0x158C3D893C64618D, 0x0F92FEEDD6EAE7E7, 0x00006DF3C4F8FD1C, 0xDE96F32CC0119398, 0xFCD6D3588D2121D4, 0x6C1815C50A8DB221, 0xCAA2C61C406CF84D, 0x81E7DAE72B251D33, 0xDEC31DC60AB34A25, 0x5F9D0069D3E044D4, 0x42A0906E163227E5, 0xFD3170E8FFC769D9, 0xD92B3CC2F5C95602, 0x679DB1D9664A0837, 0x00000F1AEA541D36 },
+{ 0xD601770B563F3F2B, 0x6F4968C114B1E1DE, 0xB18C92F94F2717DE, 0x53187D9B0BCE276F, 0x9F4444B5CE208994, 0x0B14D75A043501CE, 0x1461ACF9003028FF, 0xEF9B5EA9A7F40EE5, 0x4F1FBFA47D51CFC4, 0x5C3085FC3FE11531, 0x2F58D4A80A35F8B7, 0x00005E2DE9C66997, 0xC1AC72E9E6595812, 0x6DEE32AB34D245A8, 0x920FB5AB9C0B1CAF, 0xD62899080FBDAA93, 0xDF4773F02BA9C609, 0x38FB890417789A81, 0x8F1A403E9B902877, 0x19B886E3EB7625AD, 0xAAC8D0E720C59B8F, 0x12517E0A6116F3AC, 0x17BE6B55747B0444, 0x000020830FECBFAB }, { 0xC7A222F5C47A52FB, 0x237AC4C0AC877783, 0x0A930E26453CBB67, 0xDF917588B2BBDC53, 0x3EA49E188F06AA23, 0x607155711C874AE6, 0x5BCD0E31506F85BB, 0xE84E7D608DE15E16, 0x2E11B5BC39E766F8, 0x73829188645DD236, 0x985037A5B96D5B6D, 0x000011780038423A, 0x29EED1E56CC94B2D, 0xDBDF63B71AFAEDF2, 0x3846586AD6B370D2, 0xA413B9A3D783BE28, 0x1ADDD46880E83ECB, 0x498C377C5BB15335, 0x5AEF217F7705EECF, 0x9FEC83DD6209674B, 0x8C153FCEAC40EF9C, 0x203898D522440429, 0xC788136E87F65DAF, 0x000065CCC68206DA },
+{ 0x725A440106A42D43, 0x7B6370818C99238E, 0xC9A7476819FD9BC4, 0xF0C905A4F85990C3, 0x4ED36B8233269067, 0x2B7653B788EE8C11, 0x714F0D0C52F8A53D, 0x38D3836DAA19D172, 0x975CFAB837079687, 0x491560EF76E7E9F4, 0xBDD77265FC063824, 0x00005B50347EB674, 0xEDCEAEA79D66F65E, 0xF16BF814A1717134, 0x3D7840D9453BA027, 0x9618AFC42F1C4E33, 0xECE1080DB30015FB, 0xD4800266EEDB3412, 0x307E5A244693BAA7, 0xB355B61D8A8ED2C0, 0xD39427C2E0244289, 0x2780D8AD6DC55D6D, 0xDA547BAA698DD9AA, 0x0000241C905854B5 }, { 0xC1DAC86931D5B562, 0xCD2D129C4B367E23, 0x7017DE5F437B0F00, 0x07B8755DEF49D891, 0x98F8D114A37DB270, 0x957D047C74E18AE3, 0x237B644D9A5B7A68, 0x1FA75692AB8BDAB7, 0x3196F8AE05F215C7, 0xD9F05BBADB8DB8B7, 0xDA41D1B01DB9A997, 0x000057D17042076D, 0x8431801878C13B33, 0xD3F0CBDB1FF2ACD4, 0xB8CC5253BB594E18, 0xB856E125A9910AC2, 0x772A5902A5E879B6, 0x35CADE404409E9B0, 0x81E6F831613FDBCF, 0x77DAD0339F8E000A, 0xA8002974D72BE63E, 0x51739882EAAEF71D, 0xDBE5F562C4BBB55C, 0x000060BD9846B16A },
+{ 0xB74E9FF74BD3660F, 0x5C28595C2357F7D5, 0x237FF898409C7422, 0x1F16A5D49E8C5A6D, 0x2489F15329921EF4, 0x3C020CF0E3D3BDEC, 0x72CF77FE58F16E03, 0xAD771FBB60EBC5C5, 0xC36782FB6663963C, 0xFEB77768DADA9079, 0x6C35D1171F9944BF, 0x00003FAC0AE2E035, 0xB4B2EC2F342F6750, 0x0E242A4FE7937AF8, 0xABFF83178B826F83, 0xF3316DF1046F21A5, 0x4141018CF231CB95, 0x64CD166714330F0D, 0x4C6EDED26E17F530, 0xD085BD008B90FF61, 0x2F2782E3E2E075EC, 0x4465A8265DEC4C58, 0x5CDD76143850B4EE, 0x000007F4CBF7C778 }, { 0x9DDA6840F2B37605, 0x1C685823F3CE9683, 0x514A3DE52DE49930, 0x19F1B9127EFD95F8, 0x6CF3FF9CB762B75A, 0x7AE8A8CE67307D86, 0xFE250F8C8DB8F800, 0x77C53A6B5920B051, 0xCBA702F0D7668061, 0x14B44021A3A20A74, 0x1BC51712DFB462D4, 0x000042EEF94F74FE, 0x7943FD8EDDCECB93, 0x0C6237F30E3B304C, 0x1BA8B2EF4DF86860, 0xC179FE1AE486F704, 0xBCE8F39E60373AA2, 0x52CBA14011434027, 0x9FA5065F94685D3F, 0xB5C6EEBF9AF772F1, 0x59F3ECDD4F149362, 0xE915C222C3150327, 0x156576CAB6E54095, 0x00002BF2CCBB4C00 },
+{ 0x5DB19CB3CAEAE981, 0x562708EDAE18AE87, 0xDAD6365F218499DD, 0xECBF522048DDE26E, 0x04F71C7B1D28FC00, 0x6E4B245F206A4DC3, 0xD142334F6DB11F3F, 0xF957CBB0FE2902E9, 0x63E0CCD15D32544E, 0xD8C5FA60F8F32D3B, 0x4FEFB6A14E0E5DAB, 0x00005114EE2A624E, 0x69B9F4743B090AF1, 0xCFDB76E9CFD22864, 0xBC9434A0A721F982, 0x424F9E314425EEBF, 0xE95A88D99475800D, 0x28A6E4A4A23B2452, 0xC8F8AEF7AC3692C0, 0xF3A7B9BBB05102A6, 0x79CAA30278368871, 0xF8905A65F238D27B, 0x82DE894D08F6DFC4, 0x000053FC8AAE1EB8 }, { 0xA7C61BD5E6C155C6, 0x76620FAB98B65A2B, 0x0DA223248B9915BD, 0x82E4279A21FB28C1, 0x1AAEF1BDCA91FC81, 0x185C6270D5B52B3A, 0xD63D055D738AB58B, 0xAF0D5FF9EA668FE1, 0x42F030F802813CC1, 0xF26FFEF019060AB6, 0x24E76BDC48150059, 0x000027C6E280B176, 0x96C2C415E8FA8A50, 0x68955FFE4705F182, 0xB38FBC2959277FDE, 0x320B265CEC2C11AC, 0x5277374760E150FA, 0xC2B53A32A402E1FD, 0x58F0697CBF7E909D, 0x414636E3175B6F42, 0x60A82873A4F15026, 0x3E0F3B19CB574BDC, 0x6DDB8E052F3CFCA2, 0x000007F131160BBA },
+{ 0x181A5DAA48797FBA, 0xC49D3F59AB1FD8E5, 0xFA007482C3FB4B33, 0x1D1A170A6AF36BAB, 0xAC95801C223EBB9F, 0x0FF3E232EA395FA2, 0x65FD236AE1D607F4, 0xC40F8E226F352AAE, 0x6EC58AFB185B5732, 0x409B48F5EC580AEC, 0xCB73F161E8263710, 0x0000577837671B26, 0xE6CB14BC5AD30EB9, 0x60C8795C465F9320, 0xDBDCD53DCF960E92, 0x0F74B414B90618C7, 0xF02355D25D499497, 0x1C4C2C4205F1CBB2, 0x6AFFCB58C2AC5138, 0x8CBC9C71ABBE0F31, 0xB67FF043794BB0D2, 0xFB7D5CE613E9848B, 0x009A043B50E7A954, 0x000021BD6A06D08F }, { 0xA455C32461559FDD, 0x15BB9FD34173D049, 0x8274DCC428A5ED29, 0xC3D1D8C9178B43A9, 0xA0BEA08015CA655B, 0x3B888F7E22F0FD92, 0x71FB367AEC08C669, 0x0ED6F59B4329A292, 0xE3B2C137FDB80E0C, 0xAB6350180BF048AC, 0x861E4770BFD06592, 0x000044112667C65F, 0x339B2806A4A82D84, 0xAFF8FE1CF924BFC8, 0x11CCA90C521A0482, 0x8FD7A567D9256D01, 0x9EE6757176AB589F, 0x09A7BD3C84DDE8B7, 0x1A0DBFD0ADB823F2, 0xA573EFB2844680FE, 0x0A9D836CD5A7A858, 0x7A2BA58E84E25A8A, 0x9928C30E85A73784, 0x00003F602DB23021 },
+{ 0xA9FF719158F1B6E7, 0xEBCEE3C8A58EB9FD, 0xFA575E0DD43E062F, 0x67A90EF9385D6906, 0xC8B98D920E08EFE3, 0x6C7D3CFDEBDC4469, 0xA361D5E41DE6A389, 0xB6FC258EFBB08D79, 0x9FD2D0F7BCD7DA81, 0xEEC9816D0BAC6526, 0x3B48A7AF79D738A0, 0x00006AF3F91787B7, 0x3A2093944A17FC2D, 0x947B41E50EAC381C, 0x1BE38F89B4A423D1, 0xB3B7893C77D41405, 0x25F3C3101482BA70, 0x00342E5F8DDF74DD, 0xF1F8DEB893B6C9AF, 0x4A0300AFED7CA6BF, 0x64F815ABA4A5E9D0, 0x28C14519B9FA342B, 0xFDE2A87BE66714FC, 0x00006BDCB64B97A0 }, { 0xFA1508909E8B79A0, 0x872F65F9F97D78ED, 0xFDA6CAA718B8FB0E, 0x1C9F923B6628E5F2, 0x7A4322A3483152F7, 0xFE066A520B39A52A, 0x3D38787AC0B17892, 0xFECE72B7447BE35E, 0xA30ED2BFE837A96B, 0xCDC314D4F2750B38, 0xF65245E5357C9D10, 0x00006372A76831D5, 0xF89905F0D516DE3C, 0xFAAC81908F87DD87, 0x0EEDC27486B14692, 0xC5F61242F1BE9A07, 0xB30E57197A6F994E, 0xAC6423D04253996F, 0x18423E16B2677AD2, 0x8153DE356CCAE6ED, 0x6D447FC410A92C85, 0x8C4816F26F743F1C, 0xF0DF131799C605DB, 0x00005D732AEECC63 },
+{ 0x3BA6703A7BFCF1F5, 0x3C172C573D1F7360, 0x797518255E5ED9A7, 0x9140AC2241336CE3, 0x18B485FAEDD6E810, 0xE25698051228D261, 0x2BB19A8FC55D5E22, 0x3B28969A44AAA0B2, 0x9AE06FA5D59648D0, 0xF69506E9767C7B88, 0x686C356BE0EF9BC1, 0x0000137C29E848EE, 0x6E063E6F4DE34177, 0x9A7A708DCB09889E, 0x434717F358C111E7, 0xE317EFA8F88E48E9, 0xAAFCEB5E699A5508, 0xA89990DD04D46906, 0x90CA869190CE5E88, 0x425C6D060367F19B, 0x60093A05B4B8D152, 0xF1B9D22FB43D7808, 0xFBE524DE4FF6F30A, 0x000010F4E417F33E }, { 0x53669CD8C5167142, 0xEF5AEA1471F2BF63, 0x8B327015215B69F7, 0x69212DD27B961975, 0x861B5229DC8BC6FD, 0x4535850D9B07FCD4, 0x4CFF9ECEE36C5AFB, 0x946FB25E190A7E68, 0x2C89212B5D0D7D23, 0x2B2F010A460616F9, 0xF94E07538B610376, 0x00000736F3275762, 0x5034BA6D795D483D, 0xD1BD9846865BE29A, 0xEE4620A805518147, 0x5058F0E9CDFA1660, 0xBAB06DFAD4AFDCC4, 0xC698172164B91FF4, 0x4C822974B75A8AA5, 0xA6EF87F7A2A7284A, 0xA9FAFBD74E677993, 0x15EA38B96EB6321F, 0x412D5E0B880A1CC5, 0x00002FFBCE9CE87B },
+{ 0xB95ECFDC202757BA, 0xA677C44C033A61BB, 0x4791E4BD83144A28, 0x607B4F4261FB2E68, 0xA7CC5F8FCD09AE8E, 0xBA61B07C04EF2DCD, 0xD91EA092C5AF5E1A, 0x0714D40D231752D2, 0x52528C701EEC2F3F, 0x9D7098DB05780D81, 0x737813D7669D955F, 0x00004DB23FD11216, 0xA92D00B82FD4E614, 0x064D62A3B528D592, 0xE070DF4DA96A4EE8, 0x06DB194661EAD569, 0xCCE1FB247B141EED, 0x1C82F3F5C5997EF4, 0x6E43B35C51828230, 0xF8AAC9B92A940621, 0x115955F425D7482F, 0x7346D8D71EF22CED, 0xE860076F06896FA7, 0x0000087C00AFA732 }, { 0xE443C6F5F38C41E7, 0xDA0857AF56ADCE24, 0x971C29EC65606209, 0xD13FD57C320C59B0, 0xDED90DAD5AE3DC18, 0xC2F1BA4F04F10F98, 0x3B0D0B5E960B1C85, 0xBE269FA613732B84, 0x636F578E92F2E3B7, 0xBD0B1135444A59A2, 0x3E19C4028DEB7576, 0x000025F21D13C669, 0x36AB62127944EAB2, 0x600CED0120E9C47E, 0x95F1172E92CFF4F3, 0xB284F1BBDDA0BECB, 0x18E820FA8BFB3A48, 0x61B72E3FE2988F9A, 0xACB0F76AC8F01913, 0x0633B2C7186CC666, 0x383D13569572D6F9, 0x4AB38A3D067E5A47, 0xDF16C87E078A7CA6, 0x000055DBD408C4CB },
+{ 0x58EAAB4CF24AECA9, 0xDF1265AA0E4B286C, 0x811265D5FDB17A62, 0xD3DB62D4EC8FB59A, 0x757AA179494E6F9D, 0xD17DFC40633A89F0, 0x8BE5D2148DCFAA87, 0x1A331604ECABBB60, 0x9F7E4D975DBB5E91, 0xDF6A2239761B8DD9, 0xED40EC9553FCCD09, 0x00005979DE51B577, 0xB95C978334CE1639, 0x62CB22B2D096F699, 0x50D846AD8CA3C9B0, 0x7C1216990FF93061, 0xCBBD920F32B8F7F0, 0x140B599B3E9C1DCF, 0x2D9C67E02DDF5DB4, 0x9F7AE4A11BC96BFE, 0x94C285BA52CAEFCA, 0xC2E610A3B56336B9, 0xDD73944B1E8908F9, 0x00000C50A3C47F8F }, { 0x7EBED32E8398C5A7, 0x587BC8F0EB721C08, 0x7EA3EFF6D1B4267B, 0x738B8AF3DA1DBF7A, 0xBAD16DF207D7DC02, 0xE3B19FA57EE255CC, 0xB0A4DE3BA7B13E94, 0x54D3D9AC260E910D, 0xF2C214330DDD27D9, 0x40105512E311B8D5, 0x590A64064EE8513E, 0x0000626559C405DE, 0xC96525747494A9F7, 0xE1002666004291E0, 0x8E840039126BC5CD, 0x94004C40E67BBB3F, 0x4F3A3223CAF990B2, 0xCDE611562442A82A, 0x7163C9D90C8FAC61, 0x72F7DDA9E44B5EB8, 0x11A1CCB36C2A1A9C, 0x1207F350452C9DFD, 0x1AE8F164B21FA82C, 0x000015B1F702F851 },
+{ 0x46D9E6F09EDD4300, 0x4689B3CEBA0658D6, 0xB546BC067CB5A7D0, 0x9ED9484E179CE962, 0xDB41FAB7DD0D0A09, 0xACF5DE1621CFE4CE, 0x2417357276F15E7F, 0xF8C7DE77C99ACD2F, 0x91C196D872B9071B, 0xCA2A0B78E7305BA7, 0x40D6A640DB90ACE6, 0x00001350942F992E, 0xED130CA7938E8E5C, 0x2BD84D5341E03A3D, 0xD455FCEDD9D9988C, 0x935CF7C9F54A3FB0, 0x28D2DC9417A69457, 0x112B0C0787A925FB, 0x4B27C95263D32BE2, 0x5CAB112F7BE30285, 0xFBFCA130C2FA4781, 0x8CE4F54B5F12E793, 0x0E969D0664739221, 0x0000062BF80DBF2E }, { 0xE2FC2687BAF78181, 0x6A35451DE8E403B3, 0x9F0CAD2AEFED384E, 0x236EF275472DB299, 0xDC59A82F6B3DB2EB, 0xD996561B7FC1A541, 0x1FBA647AA659F0BE, 0x3F63857E7563E813, 0x87ED7B3B820471C2, 0x60BAD95BF81E59B3, 0x2B763EBEED58A198, 0x00002D9B4C066CED, 0x2040991C7B2277D0, 0x1D30DB02A0B68609, 0x2857032241837EFE, 0xA6728FB0A9D827CD, 0x1E3D250FCF81A52A, 0xA9529923D61A0EC7, 0xB4DBD1261B36F16E, 0x03C4C49657AC00B9, 0xC1D38EFA13E39818, 0x0E0FFCE147A178C4, 0xFC1F39B38ED0B69D, 0x0000590129F3FD30 },
+{ 0x2EBBFB43EBDEAF81, 0x84E43B28B8485FC7, 0x106EACAA5CE69E81, 0x6F7E623CC026B101, 0xD58738B7EE97B737, 0xC10BAE6CF32F9F28, 0x1F555A12A95CFFBD, 0x13B4A3B5DC01872D, 0x4E30FED59B4A0801, 0xE94F83879BF5BC66, 0xA69A89C13284E9A0, 0x000037CF11C41F64, 0x8CF129ED655863D3, 0x84A5B46AB0A1A589, 0xF1847CFD60B50C40, 0x2E16A1C37E4EF48D, 0xFCB577AA814B6536, 0xA281F47AE5ED00D1, 0xF15A419488BEB2E9, 0xE09DCF350668D438, 0xBD59337F44ED3280, 0xA8AF7C8F317260EF, 0xA35012DEB707BAF6, 0x00001B97F6FAF66D }, { 0x45CD2B345CD39342, 0xD4DD5ED05BB859CC, 0x8C3CAE577CA529F0, 0x5E0B220B72D0571D, 0xB7B7187D718D1E5D, 0x372F5093824ECDFD, 0xEF1FE89029E913C3, 0x1A592C4CC141D653, 0x2E366D4B85FB38AB, 0xB41597438225F61E, 0x56B664BE22F30401, 0x000003EE0065446A, 0x4564624D49306479, 0xEF2D42B4A55D2D28, 0xE3969991D1175371, 0xC1C7E2446DC4836F, 0x76C763A9E6ED1841, 0xA5777C70A35E2060, 0x9D4C8B6CF97F392E, 0xBADDF0735D197BBE, 0x2A703C95D01DD0B4, 0x73DA22E7E272FF27, 0x76918762106E466B, 0x0000668770252861 },
+{ 0xD8B247B265577E05, 0xB19C7CFE9D50F34A, 0x532B44294E08C8FA, 0xCBDF209083438DD0, 0xE13DB9B3229E1EDF, 0xF5ACD78B0F49AA38, 0xF582CDF8011D1E5B, 0x4032BC2D379E1F59, 0xEA9DC75E11AEB17C, 0xAD9A6FE052EB11C4, 0xFDB582FDFD93932D, 0x00003083F4D03D56, 0x39B81729C9D354CE, 0x6C0B8EFDD3922CE0, 0x6EE1E8527FCA9830, 0xD1B7277B1C89A346, 0x6B04723700B7FF8F, 0xCE8048EF4DEE4FE6, 0x711BE3178EAD8676, 0x67929EDB6CE131FC, 0x25B08465D49B1C18, 0xB8E318931C433D2F, 0xE05EF2F387DB81A2, 0x00002663F021119A }, { 0xD8B247B265577E05, 0xB19C7CFE9D50F34A, 0x532B44294E08C8FA, 0xCBDF209083438DD0, 0xE13DB9B3229E1EDF, 0xF5ACD78B0F49AA38, 0xF582CDF8011D1E5B, 0x4032BC2D379E1F59, 0xEA9DC75E11AEB17C, 0xAD9A6FE052EB11C4, 0xFDB582FDFD93932D, 0x00003083F4D03D56, 0x39B81729C9D354CE, 0x6C0B8EFDD3922CE0, 0x6EE1E8527FCA9830, 0xD1B7277B1C89A346, 0x6B04723700B7FF8F, 0xCE8048EF4DEE4FE6, 0x711BE3178EAD8676, 0x67929EDB6CE131FC, 0x25B08465D49B1C18, 0xB8E318931C433D2F, 0xE05EF2F387DB81A2, 0x00002663F021119A },
+{ 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 }, { 0xCD761FDF9354AEE1, 0xCF6B96E610BA3389, 0xADC5A2EC3D0B7162, 0xF0589026E5F2210F, 0xF9AFF4F33F13338D, 0x19D711EE0E78EB89, 0x68578D0EEA9D1FD1, 0xA7B0E7F606C1B1C3, 0xB61DC28D54FBA167, 0x3FCD683D192B8A3B, 0x6AA6928138A54902, 0x00002DD29078AF9E, 0xB4AFA3E89FF173D9, 0x386BA80284CD2BD2, 0xC409CB99677DDDAC, 0xF2BEF0505427774F, 0xF517863E5C8DF559, 0x52D61DE98B6C8A82, 0xEA0DE9DF91033F02, 0xB57B063CF6A67009, 0x4588D457BABADDA3, 0x77549BE3D450CC4A, 0x10911C0BEA617954, 0x00000FF84158E9CB },
+{ 0x53012351AF10665C, 0x09A960D18638A1C1, 0xEAD087C89F24A886, 0x0EDDB89BAD3B4A0B, 0x73D3BA9448F8CED0, 0xDF3FFA830D1BCF6A, 0x1DCA4E0726E07021, 0xCB1F89D4F649DB7B, 0x5E54BCEA7D9EC2EE, 0x1D497DC83E31D99E, 0x7C46350D3B16F533, 0x00002A5E2D7815F7, 0x25CDFDF65DCB1BFD, 0xD4C33311D0DB2AC1, 0x11D24274E963A528, 0xC6F9E81A4D42B711, 0x35D095BF2F364E79, 0xFD46CDE7D4835176, 0xE4BB899D5BB4A747, 0x0A90367BC393347A, 0xF15A2CBCD5E857DE, 0xE5A12690E07F5349, 0x0E186D37FF2BE157, 0x0000351911143380 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0x55059D4DA105068A, 0x1D57E1A6121504A6, 0x21400F8879502556, 0xE50E44E9ADF539D5, 0xD17915620CB6DD0B, 0xE862339E3FADFE9C, 0x50CC09832A990913, 0xD49251441F1F759B, 0xE4CC0B39A602E362, 0x6485313D2F321DBC, 0xD891759B5A3C3EC0, 0x00001681E44868B3, 0x087EEAD09ADB3814, 0x12249EC3AD80E227, 0x36603DD663ABA75E, 0xEB3BBEF18CAB1A93, 0x2C69A8F654608308, 0x9D8EC1EEC2203487, 0x7AEEF7848969C77E, 0xE4076A2251F80342, 0xF0BD1D8C7EAE3CDD, 0xED93D92DAB9DAA13, 0xA2DB8679D9E5E201, 0x00002F1348B0B335 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+
+{ 0xD2B427BAE26BE178, 0x8F5C7147DDF2BD0C, 0xA964B691CF532ACE, 0xD85F1B1078129B5E, 0x8B77CCF071B2E995, 0xABA814AB8E416EF7, 0xCFDE5511A3F7C2CB, 0x565AC5C73022F4DC, 0x2F35404EDB5535D3, 0x3114704B2692A366, 0x085371BB480CF829, 0x0000422406FE59A3, 0x1B92C95E57769FAC, 0xB2161EB482109BF0, 0xE58B986FC12EC192, 0xBFB8C62DF34D290A, 0xE1CD5A22AE3E0B09, 0x0448792D318D3258, 0xA7F60F0D77CAF73C, 0xE931C2E7079DF68D, 0xC5201D2EC0DCBAE0, 0xB0C1AFAEC060D728, 0x2ACF15FEF35C348E, 0x000024BE0195047C }, { 0x00000000000249AD, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x8310000000000000, 0x5527B1E4375C6C66, 0x697797BF3F4F24D0, 0xC89DB7B2AC5C4E2E, 0x4CA4B439D2076956, 0x10F7926C7512C7E9, 0x00002D5B24BCE5E2, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0x490AF62E40F4AA30, 0x915288F3832C03F0, 0x82EBAC035490A817, 0xB8632B3D61549008, 0x513188BB8608946A, 0x6D2ECFB3A3FC588B, 0x8DB7852A542FA13E, 0x2A27BAE0C7C7A4BA, 0x68654A21ED548140, 0xD8FCA89FB9C11A38, 0x8C01D8C1CA8DC6C1, 0x0000257A4B4719E3, 0x865B95A9643C2FB6, 0x08E98987DEA60167, 0xBAD1CEBF2031F25C, 0xE7C70229443D4F6B, 0x182A60C21A636D26, 0x63B59C634A00E7B3, 0xE09EC801DCBD0EBD, 0x4861DFE03B7031B3, 0x07890063A1465280, 0x9E961327F4B0A31C, 0x6AABAFFFD6372D0B, 0x000061D8BFE13102 }, { 0x894B8BC219333A12, 0x50869ADFE00B8C22, 0xE11FCA9E068F8297, 0xEE13524E24CC4CA7, 0x14B225DA2AFD2AE5, 0xCC36717ABBD69B83, 0xCCB90042DD64CDB2, 0xC033135F0DF8A665, 0x305C416E15411C3E, 0x8F397E7297770BAB, 0x3C6400062F65EF24, 0x0000018200DD358D, 0x6A86CBEC63F26DA9, 0xF7C23606E6EEF89D, 0x908A8A4C8D85BD9E, 0xD9B730C9C2B2C97C, 0x7197E3A3891438ED, 0x22EAB898032A5788, 0xB26C92DDD12411E6, 0x66389E04D5A8609D, 0xB1738415B1A45BEF, 0x4891EE683259D050, 0xFD27ED862970354D, 0x00001C30D8568043 },
+{ 0x3995FF0C4E2AD610, 0xB84A2C54E548AFAF, 0xF5A5C1E12F172303, 0x9FB714E1D8F3736E, 0xC495E05F6A9BDE21, 0xF8508069F2046D74, 0x0054C9A83DF10B89, 0x709534BA6B301EAF, 0x946DACAD7427731E, 0xAC2EB6E68F00FC69, 0x3F6DB9D09C3BA01B, 0x00001A265BE41D99, 0x57D5ED014E4DD155, 0x6D5C31CB5B2C5C7A, 0xA6AD97FB0B0623E9, 0xE54513EEEBEFE7BE, 0xC2EE4D63954EB44C, 0x0787C3EEAFF70E3A, 0x00B6A4C6A9361A81, 0xBED445AA869B9178, 0x83CA42BE39E5B094, 0x8ABC1B0DD7A1576D, 0x15BEBF1B289373B8, 0x00000360B218DB42 }, { 0x0096D07D0323F77A, 0x0606C17CE349FEF3, 0x5CEBFC50B1931D84, 0xFBBE263DB94951D6, 0x98A7EED00D5EF091, 0xF605E31072EAA096, 0x449BA6F4BD1A89AD, 0xFF52625F1A9CBE88, 0x07AFA770C2AEA1AD, 0x02D9CD6D97A1E78C, 0x0FFAE50D69600DA2, 0x00002CB6138ECFD2, 0xC5DA0E84F71FAC81, 0x56FFE24AA54DA311, 0xA0B65B8C3A7551E3, 0xEE137C659706C928, 0x4476B7C8CDA57C69, 0xCA3F96E0B27CF450, 0x1FFD7D9BB76B51BC, 0xCEC64ED8FEB14E77, 0xA23BA1FAE516E3F5, 0x6E0565158E610108, 0xFFE3DAD8298F6290, 0x00004BEE0663CB5F },
+{ 0xF7E4BF86B78B94BD, 0x8F5BA5327AA1E75D, 0x375B7F4C0844F32C, 0x09D523882C4765F0, 0x66AC500AE87605E9, 0x8820E059FAEB4D3F, 0x59C271CC3291DB74, 0x39AF78814F84208C, 0x8956883CE443D693, 0x3E8A1A8C7C144F95, 0x448C5CC297BDB450, 0x0000101968EB0552, 0xBB3350DE85138D59, 0x29B42A805DD3F31C, 0x5E84C56F5CB71E9E, 0x1DDE85F5D2AFE373, 0x9ED11FFCCE67A24B, 0x8036F145B53EB2B7, 0xEDB0AAB179FF5E21, 0x6005B303BE17A23D, 0x8BE8B523891534C8, 0x57E848FFF31F780C, 0x3CAE74D3E0AFCBE4, 0x00002F7F776A623D }, { 0xA41C84E5B94B648E, 0x187AE9FFBAFE0C88, 0x2C5F6E6A16AF7A40, 0x0F014B2B3553728F, 0x10CE1EC3988DB189, 0xA37BE79F17499E04, 0x50D34695137D0231, 0x67B85D281DF9733D, 0x6E28C2ED06442E60, 0x40CF49613851882C, 0x28FBD296E449B5F8, 0x00004082A3585088, 0x72FFE16679C220BB, 0xD5BF3AA55AE1BEFB, 0x5C6384EFBD0B0ECB, 0x9B3A227B61A06D2A, 0x0529E9A78B5D9E80, 0x7DB984A886C5F911, 0x8FECFB1FC2FD0C27, 0x0447CAEF225FE9C4, 0xDB7405303F3D1C0A, 0x34BF336C19827B94, 0x9AF2975FF1DE9E9A, 0x0000327C1C7777E8 },
+{ 0xE6139D400D25C6A0, 0xD0ECB5A2D8F3B8B3, 0x21D3ADB5DB0919DE, 0xBD4857F4F39800CC, 0xD4763F37C312888B, 0xB4CC45A71F679A2A, 0xEB360C1CA0C52BFE, 0xB9AA730120FF90A5, 0xF9D7D0AE07A6319D, 0xD7A350E8FBE911E7, 0xC6DEE72F7FA9F9C9, 0x000058EAD0472CA9, 0x8E94040ACCB3EA5E, 0xE541243C1F43A396, 0x315C158134841960, 0xCC923A47E3D80BD1, 0xA5252434F8E760DB, 0x785C27B727A71968, 0x4AE9FE4FD26766FD, 0x5691C7C63F61254A, 0x446BA094ADDF3735, 0xD06A75C5F24116EE, 0x62D338DADAF43582, 0x00004F9C932A1296 }, { 0x0486A434FAF85F82, 0xF1B193482729652E, 0xBBC7A4012C38617C, 0xD2AD342C85A8ED64, 0x846B26E9D86F94AC, 0xEDC1E6B646E7784E, 0x045CA19EDB119D60, 0x2C0227668A892425, 0x696708027F302FE5, 0x158C3D893C64618D, 0x0F92FEEDD6EAE7E7, 0x00006DF3C4F8FD1C, 0xDE96F32CC0119398, 0xFCD6D3588D2121D4, 0x6C1815C50A8DB221, 0xCAA2C61C406CF84D, 0x81E7DAE72B251D33, 0xDEC31DC60AB34A25, 0x5F9D0069D3E044D4, 0x42A0906E163227E5, 0xFD3170E8FFC769D9, 0xD92B3CC2F5C95602, 0x679DB1D9664A0837, 0x00000F1AEA541D36 },
+{ 0xD601770B563F3F2B, 0x6F4968C114B1E1DE, 0xB18C92F94F2717DE, 0x53187D9B0BCE276F, 0x9F4444B5CE208994, 0x0B14D75A043501CE, 0x1461ACF9003028FF, 0xEF9B5EA9A7F40EE5, 0x4F1FBFA47D51CFC4, 0x5C3085FC3FE11531, 0x2F58D4A80A35F8B7, 0x00005E2DE9C66997, 0xC1AC72E9E6595812, 0x6DEE32AB34D245A8, 0x920FB5AB9C0B1CAF, 0xD62899080FBDAA93, 0xDF4773F02BA9C609, 0x38FB890417789A81, 0x8F1A403E9B902877, 0x19B886E3EB7625AD, 0xAAC8D0E720C59B8F, 0x12517E0A6116F3AC, 0x17BE6B55747B0444, 0x000020830FECBFAB }, { 0xC7A222F5C47A52FB, 0x237AC4C0AC877783, 0x0A930E26453CBB67, 0xDF917588B2BBDC53, 0x3EA49E188F06AA23, 0x607155711C874AE6, 0x5BCD0E31506F85BB, 0xE84E7D608DE15E16, 0x2E11B5BC39E766F8, 0x73829188645DD236, 0x985037A5B96D5B6D, 0x000011780038423A, 0x29EED1E56CC94B2D, 0xDBDF63B71AFAEDF2, 0x3846586AD6B370D2, 0xA413B9A3D783BE28, 0x1ADDD46880E83ECB, 0x498C377C5BB15335, 0x5AEF217F7705EECF, 0x9FEC83DD6209674B, 0x8C153FCEAC40EF9C, 0x203898D522440429, 0xC788136E87F65DAF, 0x000065CCC68206DA },
+{ 0x725A440106A42D43, 0x7B6370818C99238E, 0xC9A7476819FD9BC4, 0xF0C905A4F85990C3, 0x4ED36B8233269067, 0x2B7653B788EE8C11, 0x714F0D0C52F8A53D, 0x38D3836DAA19D172, 0x975CFAB837079687, 0x491560EF76E7E9F4, 0xBDD77265FC063824, 0x00005B50347EB674, 0xEDCEAEA79D66F65E, 0xF16BF814A1717134, 0x3D7840D9453BA027, 0x9618AFC42F1C4E33, 0xECE1080DB30015FB, 0xD4800266EEDB3412, 0x307E5A244693BAA7, 0xB355B61D8A8ED2C0, 0xD39427C2E0244289, 0x2780D8AD6DC55D6D, 0xDA547BAA698DD9AA, 0x0000241C905854B5 }, { 0xC1DAC86931D5B562, 0xCD2D129C4B367E23, 0x7017DE5F437B0F00, 0x07B8755DEF49D891, 0x98F8D114A37DB270, 0x957D047C74E18AE3, 0x237B644D9A5B7A68, 0x1FA75692AB8BDAB7, 0x3196F8AE05F215C7, 0xD9F05BBADB8DB8B7, 0xDA41D1B01DB9A997, 0x000057D17042076D, 0x8431801878C13B33, 0xD3F0CBDB1FF2ACD4, 0xB8CC5253BB594E18, 0xB856E125A9910AC2, 0x772A5902A5E879B6, 0x35CADE404409E9B0, 0x81E6F831613FDBCF, 0x77DAD0339F8E000A, 0xA8002974D72BE63E, 0x51739882EAAEF71D, 0xDBE5F562C4BBB55C, 0x000060BD9846B16A },
+{ 0xB74E9FF74BD3660F, 0x5C28595C2357F7D5, 0x237FF898409C7422, 0x1F16A5D49E8C5A6D, 0x2489F15329921EF4, 0x3C020CF0E3D3BDEC, 0x72CF77FE58F16E03, 0xAD771FBB60EBC5C5, 0xC36782FB6663963C, 0xFEB77768DADA9079, 0x6C35D1171F9944BF, 0x00003FAC0AE2E035, 0xB4B2EC2F342F6750, 0x0E242A4FE7937AF8, 0xABFF83178B826F83, 0xF3316DF1046F21A5, 0x4141018CF231CB95, 0x64CD166714330F0D, 0x4C6EDED26E17F530, 0xD085BD008B90FF61, 0x2F2782E3E2E075EC, 0x4465A8265DEC4C58, 0x5CDD76143850B4EE, 0x000007F4CBF7C778 }, { 0x9DDA6840F2B37605, 0x1C685823F3CE9683, 0x514A3DE52DE49930, 0x19F1B9127EFD95F8, 0x6CF3FF9CB762B75A, 0x7AE8A8CE67307D86, 0xFE250F8C8DB8F800, 0x77C53A6B5920B051, 0xCBA702F0D7668061, 0x14B44021A3A20A74, 0x1BC51712DFB462D4, 0x000042EEF94F74FE, 0x7943FD8EDDCECB93, 0x0C6237F30E3B304C, 0x1BA8B2EF4DF86860, 0xC179FE1AE486F704, 0xBCE8F39E60373AA2, 0x52CBA14011434027, 0x9FA5065F94685D3F, 0xB5C6EEBF9AF772F1, 0x59F3ECDD4F149362, 0xE915C222C3150327, 0x156576CAB6E54095, 0x00002BF2CCBB4C00 },
+{ 0x5DB19CB3CAEAE981, 0x562708EDAE18AE87, 0xDAD6365F218499DD, 0xECBF522048DDE26E, 0x04F71C7B1D28FC00, 0x6E4B245F206A4DC3, 0xD142334F6DB11F3F, 0xF957CBB0FE2902E9, 0x63E0CCD15D32544E, 0xD8C5FA60F8F32D3B, 0x4FEFB6A14E0E5DAB, 0x00005114EE2A624E, 0x69B9F4743B090AF1, 0xCFDB76E9CFD22864, 0xBC9434A0A721F982, 0x424F9E314425EEBF, 0xE95A88D99475800D, 0x28A6E4A4A23B2452, 0xC8F8AEF7AC3692C0, 0xF3A7B9BBB05102A6, 0x79CAA30278368871, 0xF8905A65F238D27B, 0x82DE894D08F6DFC4, 0x000053FC8AAE1EB8 }, { 0xA7C61BD5E6C155C6, 0x76620FAB98B65A2B, 0x0DA223248B9915BD, 0x82E4279A21FB28C1, 0x1AAEF1BDCA91FC81, 0x185C6270D5B52B3A, 0xD63D055D738AB58B, 0xAF0D5FF9EA668FE1, 0x42F030F802813CC1, 0xF26FFEF019060AB6, 0x24E76BDC48150059, 0x000027C6E280B176, 0x96C2C415E8FA8A50, 0x68955FFE4705F182, 0xB38FBC2959277FDE, 0x320B265CEC2C11AC, 0x5277374760E150FA, 0xC2B53A32A402E1FD, 0x58F0697CBF7E909D, 0x414636E3175B6F42, 0x60A82873A4F15026, 0x3E0F3B19CB574BDC, 0x6DDB8E052F3CFCA2, 0x000007F131160BBA },
+{ 0x181A5DAA48797FBA, 0xC49D3F59AB1FD8E5, 0xFA007482C3FB4B33, 0x1D1A170A6AF36BAB, 0xAC95801C223EBB9F, 0x0FF3E232EA395FA2, 0x65FD236AE1D607F4, 0xC40F8E226F352AAE, 0x6EC58AFB185B5732, 0x409B48F5EC580AEC, 0xCB73F161E8263710, 0x0000577837671B26, 0xE6CB14BC5AD30EB9, 0x60C8795C465F9320, 0xDBDCD53DCF960E92, 0x0F74B414B90618C7, 0xF02355D25D499497, 0x1C4C2C4205F1CBB2, 0x6AFFCB58C2AC5138, 0x8CBC9C71ABBE0F31, 0xB67FF043794BB0D2, 0xFB7D5CE613E9848B, 0x009A043B50E7A954, 0x000021BD6A06D08F }, { 0xA455C32461559FDD, 0x15BB9FD34173D049, 0x8274DCC428A5ED29, 0xC3D1D8C9178B43A9, 0xA0BEA08015CA655B, 0x3B888F7E22F0FD92, 0x71FB367AEC08C669, 0x0ED6F59B4329A292, 0xE3B2C137FDB80E0C, 0xAB6350180BF048AC, 0x861E4770BFD06592, 0x000044112667C65F, 0x339B2806A4A82D84, 0xAFF8FE1CF924BFC8, 0x11CCA90C521A0482, 0x8FD7A567D9256D01, 0x9EE6757176AB589F, 0x09A7BD3C84DDE8B7, 0x1A0DBFD0ADB823F2, 0xA573EFB2844680FE, 0x0A9D836CD5A7A858, 0x7A2BA58E84E25A8A, 0x9928C30E85A73784, 0x00003F602DB23021 },
+{ 0xA9FF719158F1B6E7, 0xEBCEE3C8A58EB9FD, 0xFA575E0DD43E062F, 0x67A90EF9385D6906, 0xC8B98D920E08EFE3, 0x6C7D3CFDEBDC4469, 0xA361D5E41DE6A389, 0xB6FC258EFBB08D79, 0x9FD2D0F7BCD7DA81, 0xEEC9816D0BAC6526, 0x3B48A7AF79D738A0, 0x00006AF3F91787B7, 0x3A2093944A17FC2D, 0x947B41E50EAC381C, 0x1BE38F89B4A423D1, 0xB3B7893C77D41405, 0x25F3C3101482BA70, 0x00342E5F8DDF74DD, 0xF1F8DEB893B6C9AF, 0x4A0300AFED7CA6BF, 0x64F815ABA4A5E9D0, 0x28C14519B9FA342B, 0xFDE2A87BE66714FC, 0x00006BDCB64B97A0 }, { 0xFA1508909E8B79A0, 0x872F65F9F97D78ED, 0xFDA6CAA718B8FB0E, 0x1C9F923B6628E5F2, 0x7A4322A3483152F7, 0xFE066A520B39A52A, 0x3D38787AC0B17892, 0xFECE72B7447BE35E, 0xA30ED2BFE837A96B, 0xCDC314D4F2750B38, 0xF65245E5357C9D10, 0x00006372A76831D5, 0xF89905F0D516DE3C, 0xFAAC81908F87DD87, 0x0EEDC27486B14692, 0xC5F61242F1BE9A07, 0xB30E57197A6F994E, 0xAC6423D04253996F, 0x18423E16B2677AD2, 0x8153DE356CCAE6ED, 0x6D447FC410A92C85, 0x8C4816F26F743F1C, 0xF0DF131799C605DB, 0x00005D732AEECC63 },
+{ 0x3BA6703A7BFCF1F5, 0x3C172C573D1F7360, 0x797518255E5ED9A7, 0x9140AC2241336CE3, 0x18B485FAEDD6E810, 0xE25698051228D261, 0x2BB19A8FC55D5E22, 0x3B28969A44AAA0B2, 0x9AE06FA5D59648D0, 0xF69506E9767C7B88, 0x686C356BE0EF9BC1, 0x0000137C29E848EE, 0x6E063E6F4DE34177, 0x9A7A708DCB09889E, 0x434717F358C111E7, 0xE317EFA8F88E48E9, 0xAAFCEB5E699A5508, 0xA89990DD04D46906, 0x90CA869190CE5E88, 0x425C6D060367F19B, 0x60093A05B4B8D152, 0xF1B9D22FB43D7808, 0xFBE524DE4FF6F30A, 0x000010F4E417F33E }, { 0x53669CD8C5167142, 0xEF5AEA1471F2BF63, 0x8B327015215B69F7, 0x69212DD27B961975, 0x861B5229DC8BC6FD, 0x4535850D9B07FCD4, 0x4CFF9ECEE36C5AFB, 0x946FB25E190A7E68, 0x2C89212B5D0D7D23, 0x2B2F010A460616F9, 0xF94E07538B610376, 0x00000736F3275762, 0x5034BA6D795D483D, 0xD1BD9846865BE29A, 0xEE4620A805518147, 0x5058F0E9CDFA1660, 0xBAB06DFAD4AFDCC4, 0xC698172164B91FF4, 0x4C822974B75A8AA5, 0xA6EF87F7A2A7284A, 0xA9FAFBD74E677993, 0x15EA38B96EB6321F, 0x412D5E0B880A1CC5, 0x00002FFBCE9CE87B },
+{ 0xB95ECFDC202757BA, 0xA677C44C033A61BB, 0x4791E4BD83144A28, 0x607B4F4261FB2E68, 0xA7CC5F8FCD09AE8E, 0xBA61B07C04EF2DCD, 0xD91EA092C5AF5E1A, 0x0714D40D231752D2, 0x52528C701EEC2F3F, 0x9D7098DB05780D81, 0x737813D7669D955F, 0x00004DB23FD11216, 0xA92D00B82FD4E614, 0x064D62A3B528D592, 0xE070DF4DA96A4EE8, 0x06DB194661EAD569, 0xCCE1FB247B141EED, 0x1C82F3F5C5997EF4, 0x6E43B35C51828230, 0xF8AAC9B92A940621, 0x115955F425D7482F, 0x7346D8D71EF22CED, 0xE860076F06896FA7, 0x0000087C00AFA732 }, { 0xE443C6F5F38C41E7, 0xDA0857AF56ADCE24, 0x971C29EC65606209, 0xD13FD57C320C59B0, 0xDED90DAD5AE3DC18, 0xC2F1BA4F04F10F98, 0x3B0D0B5E960B1C85, 0xBE269FA613732B84, 0x636F578E92F2E3B7, 0xBD0B1135444A59A2, 0x3E19C4028DEB7576, 0x000025F21D13C669, 0x36AB62127944EAB2, 0x600CED0120E9C47E, 0x95F1172E92CFF4F3, 0xB284F1BBDDA0BECB, 0x18E820FA8BFB3A48, 0x61B72E3FE2988F9A, 0xACB0F76AC8F01913, 0x0633B2C7186CC666, 0x383D13569572D6F9, 0x4AB38A3D067E5A47, 0xDF16C87E078A7CA6, 0x000055DBD408C4CB },
+{ 0x58EAAB4CF24AECA9, 0xDF1265AA0E4B286C, 0x811265D5FDB17A62, 0xD3DB62D4EC8FB59A, 0x757AA179494E6F9D, 0xD17DFC40633A89F0, 0x8BE5D2148DCFAA87, 0x1A331604ECABBB60, 0x9F7E4D975DBB5E91, 0xDF6A2239761B8DD9, 0xED40EC9553FCCD09, 0x00005979DE51B577, 0xB95C978334CE1639, 0x62CB22B2D096F699, 0x50D846AD8CA3C9B0, 0x7C1216990FF93061, 0xCBBD920F32B8F7F0, 0x140B599B3E9C1DCF, 0x2D9C67E02DDF5DB4, 0x9F7AE4A11BC96BFE, 0x94C285BA52CAEFCA, 0xC2E610A3B56336B9, 0xDD73944B1E8908F9, 0x00000C50A3C47F8F }, { 0x7EBED32E8398C5A7, 0x587BC8F0EB721C08, 0x7EA3EFF6D1B4267B, 0x738B8AF3DA1DBF7A, 0xBAD16DF207D7DC02, 0xE3B19FA57EE255CC, 0xB0A4DE3BA7B13E94, 0x54D3D9AC260E910D, 0xF2C214330DDD27D9, 0x40105512E311B8D5, 0x590A64064EE8513E, 0x0000626559C405DE, 0xC96525747494A9F7, 0xE1002666004291E0, 0x8E840039126BC5CD, 0x94004C40E67BBB3F, 0x4F3A3223CAF990B2, 0xCDE611562442A82A, 0x7163C9D90C8FAC61, 0x72F7DDA9E44B5EB8, 0x11A1CCB36C2A1A9C, 0x1207F350452C9DFD, 0x1AE8F164B21FA82C, 0x000015B1F702F851 },
+{ 0x46D9E6F09EDD4300, 0x4689B3CEBA0658D6, 0xB546BC067CB5A7D0, 0x9ED9484E179CE962, 0xDB41FAB7DD0D0A09, 0xACF5DE1621CFE4CE, 0x2417357276F15E7F, 0xF8C7DE77C99ACD2F, 0x91C196D872B9071B, 0xCA2A0B78E7305BA7, 0x40D6A640DB90ACE6, 0x00001350942F992E, 0xED130CA7938E8E5C, 0x2BD84D5341E03A3D, 0xD455FCEDD9D9988C, 0x935CF7C9F54A3FB0, 0x28D2DC9417A69457, 0x112B0C0787A925FB, 0x4B27C95263D32BE2, 0x5CAB112F7BE30285, 0xFBFCA130C2FA4781, 0x8CE4F54B5F12E793, 0x0E969D0664739221, 0x0000062BF80DBF2E }, { 0xE2FC2687BAF78181, 0x6A35451DE8E403B3, 0x9F0CAD2AEFED384E, 0x236EF275472DB299, 0xDC59A82F6B3DB2EB, 0xD996561B7FC1A541, 0x1FBA647AA659F0BE, 0x3F63857E7563E813, 0x87ED7B3B820471C2, 0x60BAD95BF81E59B3, 0x2B763EBEED58A198, 0x00002D9B4C066CED, 0x2040991C7B2277D0, 0x1D30DB02A0B68609, 0x2857032241837EFE, 0xA6728FB0A9D827CD, 0x1E3D250FCF81A52A, 0xA9529923D61A0EC7, 0xB4DBD1261B36F16E, 0x03C4C49657AC00B9, 0xC1D38EFA13E39818, 0x0E0FFCE147A178C4, 0xFC1F39B38ED0B69D, 0x0000590129F3FD30 },
+{ 0x2EBBFB43EBDEAF81, 0x84E43B28B8485FC7, 0x106EACAA5CE69E81, 0x6F7E623CC026B101, 0xD58738B7EE97B737, 0xC10BAE6CF32F9F28, 0x1F555A12A95CFFBD, 0x13B4A3B5DC01872D, 0x4E30FED59B4A0801, 0xE94F83879BF5BC66, 0xA69A89C13284E9A0, 0x000037CF11C41F64, 0x8CF129ED655863D3, 0x84A5B46AB0A1A589, 0xF1847CFD60B50C40, 0x2E16A1C37E4EF48D, 0xFCB577AA814B6536, 0xA281F47AE5ED00D1, 0xF15A419488BEB2E9, 0xE09DCF350668D438, 0xBD59337F44ED3280, 0xA8AF7C8F317260EF, 0xA35012DEB707BAF6, 0x00001B97F6FAF66D }, { 0x45CD2B345CD39342, 0xD4DD5ED05BB859CC, 0x8C3CAE577CA529F0, 0x5E0B220B72D0571D, 0xB7B7187D718D1E5D, 0x372F5093824ECDFD, 0xEF1FE89029E913C3, 0x1A592C4CC141D653, 0x2E366D4B85FB38AB, 0xB41597438225F61E, 0x56B664BE22F30401, 0x000003EE0065446A, 0x4564624D49306479, 0xEF2D42B4A55D2D28, 0xE3969991D1175371, 0xC1C7E2446DC4836F, 0x76C763A9E6ED1841, 0xA5777C70A35E2060, 0x9D4C8B6CF97F392E, 0xBADDF0735D197BBE, 0x2A703C95D01DD0B4, 0x73DA22E7E272FF27, 0x76918762106E466B, 0x0000668770252861 },
+{ 0xD8B247B265577E05, 0xB19C7CFE9D50F34A, 0x532B44294E08C8FA, 0xCBDF209083438DD0, 0xE13DB9B3229E1EDF, 0xF5ACD78B0F49AA38, 0xF582CDF8011D1E5B, 0x4032BC2D379E1F59, 0xEA9DC75E11AEB17C, 0xAD9A6FE052EB11C4, 0xFDB582FDFD93932D, 0x00003083F4D03D56, 0x39B81729C9D354CE, 0x6C0B8EFDD3922CE0, 0x6EE1E8527FCA9830, 0xD1B7277B1C89A346, 0x6B04723700B7FF8F, 0xCE8048EF4DEE4FE6, 0x711BE3178EAD8676, 0x67929EDB6CE131FC, 0x25B08465D49B1C18, 0xB8E318931C433D2F, 0xE05EF2F387DB81A2, 0x00002663F021119A }, { 0xD8B247B265577E05, 0xB19C7CFE9D50F34A, 0x532B44294E08C8FA, 0xCBDF209083438DD0, 0xE13DB9B3229E1EDF, 0xF5ACD78B0F49AA38, 0xF582CDF8011D1E5B, 0x4032BC2D379E1F59, 0xEA9DC75E11AEB17C, 0xAD9A6FE052EB11C4, 0xFDB582FDFD93932D, 0x00003083F4D03D56, 0x39B81729C9D354CE, 0x6C0B8EFDD3922CE0, 0x6EE1E8527FCA9830, 0xD1B7277B1C89A346, 0x6B04723700B7FF8F, 0xCE8048EF4DEE4FE6, 0x711BE3178EAD8676, 0x67929EDB6CE131FC, 0x25B08465D49B1C18, 0xB8E318931C433D2F, 0xE05EF2F387DB81A2, 0x00002663F021119A },
+{ 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 }, { 0xCD761FDF9354AEE1, 0xCF6B96E610BA3389, 0xADC5A2EC3D0B7162, 0xF0589026E5F2210F, 0xF9AFF4F33F13338D, 0x19D711EE0E78EB89, 0x68578D0EEA9D1FD1, 0xA7B0E7F606C1B1C3, 0xB61DC28D54FBA167, 0x3FCD683D192B8A3B, 0x6AA6928138A54902, 0x00002DD29078AF9E, 0xB4AFA3E89FF173D9, 0x386BA80284CD2BD2, 0xC409CB99677DDDAC, 0xF2BEF0505427774F, 0xF517863E5C8DF559, 0x52D61DE98B6C8A82, 0xEA0DE9DF91033F02, 0xB57B063CF6A67009, 0x4588D457BABADDA3, 0x77549BE3D450CC4A, 0x10911C0BEA617954, 0x00000FF84158E9CB },
+{ 0x53012351AF10665C, 0x09A960D18638A1C1, 0xEAD087C89F24A886, 0x0EDDB89BAD3B4A0B, 0x73D3BA9448F8CED0, 0xDF3FFA830D1BCF6A, 0x1DCA4E0726E07021, 0xCB1F89D4F649DB7B, 0x5E54BCEA7D9EC2EE, 0x1D497DC83E31D99E, 0x7C46350D3B16F533, 0x00002A5E2D7815F7, 0x25CDFDF65DCB1BFD, 0xD4C33311D0DB2AC1, 0x11D24274E963A528, 0xC6F9E81A4D42B711, 0x35D095BF2F364E79, 0xFD46CDE7D4835176, 0xE4BB899D5BB4A747, 0x0A90367BC393347A, 0xF15A2CBCD5E857DE, 0xE5A12690E07F5349, 0x0E186D37FF2BE157, 0x0000351911143380 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0x55059D4DA105068A, 0x1D57E1A6121504A6, 0x21400F8879502556, 0xE50E44E9ADF539D5, 0xD17915620CB6DD0B, 0xE862339E3FADFE9C, 0x50CC09832A990913, 0xD49251441F1F759B, 0xE4CC0B39A602E362, 0x6485313D2F321DBC, 0xD891759B5A3C3EC0, 0x00001681E44868B3, 0x087EEAD09ADB3814, 0x12249EC3AD80E227, 0x36603DD663ABA75E, 0xEB3BBEF18CAB1A93, 0x2C69A8F654608308, 0x9D8EC1EEC2203487, 0x7AEEF7848969C77E, 0xE4076A2251F80342, 0xF0BD1D8C7EAE3CDD, 0xED93D92DAB9DAA13, 0xA2DB8679D9E5E201, 0x00002F1348B0B335 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+};
+const f2elm_t64 DBL_TABLE_EE[2*(NBITS_STATE+1)] = { // A point per row represented in (X:Z) coordinates
+{ 0x43340DF4BEE17709, 0x6E9EACF34DD8DDF6, 0xA0F2BB8F94E1DB29, 0x87A3F5FC49BE608C, 0x3D85A394045F5F4D, 0xD3D19B1D5C39EF0C, 0x7F4D9D60E99BC919, 0x8058C1AD2945F024, 0xBEA761B4A22DEBEF, 0x564F81971478071F, 0x699EB13FEC1BFCB4, 0x0000271FA0F3A7B3, 0x4819E751210446BF, 0x30AC7CAF4697A600, 0x2CF06E69BD1163C2, 0x9DABC80F02D063AB, 0xF393811C0FF67B4C, 0x401004A23B08043A, 0x4F3B2C8E6240C51B, 0xF5368D093FB18DE8, 0x5361C56C105EA392, 0xFED8ABAC75EEC8D6, 0x6A34971D3B3A15C3, 0x00001B37ED6B42FC }, { 0x00000000000249AD, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x8310000000000000, 0x5527B1E4375C6C66, 0x697797BF3F4F24D0, 0xC89DB7B2AC5C4E2E, 0x4CA4B439D2076956, 0x10F7926C7512C7E9, 0x00002D5B24BCE5E2, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0x9904C83EF52E08A2, 0x5F953D03981E6D68, 0xF219D5F1F0FCF2AD, 0xA898164DCAEAB87F, 0x5C16625C6429FB83, 0x569E3BEB349D5318, 0xE48B92C6878D75B0, 0x76E2E5C7B90151EF, 0x7B40BEBDE9D5CA2B, 0xEC648EA2C7C2D870, 0x8DFB561CDF9F6B8D, 0x000022AD1A4C4613, 0x8928E394CE0BF751, 0xD11B8E6ACB4EC692, 0xB177C14AFA355D97, 0xC541632A79CB3C9C, 0x1E5FB7E48D97A63B, 0x9B28D2DD95FA6B10, 0x388D096495CF6C09, 0xA7AD81560D7AD99F, 0x1D7758E7527277B1, 0x3636099250679028, 0x1C8D04E03EBE68F1, 0x0000080D4356B475 }, { 0xE08F92D19F370197, 0x21E9C0DEE7F8D107, 0x552FC65A415A26AE, 0x1EFABB856082D3E4, 0xCADF7C0071AA553C, 0x54ABF5E45651E33C, 0x540A052AE70F282D, 0xEC76903296951AE1, 0x8459DEC5E18EEB94, 0xADE469D2A122E51D, 0x670B2BAB4F386E6E, 0x00002069112B4A8E, 0x218981C2E8112381, 0xA1EB9F5451D19C9B, 0x2D91BFD2A8DE5B68, 0x4CC00FF816653CB0, 0x97C12B9058E4AF01, 0x5AAE377DE2F5924A, 0x0AC40578105035E6, 0x076E18C18D5F42AC, 0xDE32514B167F3B98, 0x73BCBABCB656596B, 0x39CD4F8622515037, 0x00006567DA7CC9E4 },
+{ 0x026F12FFD0770587, 0xE6E0A84B5D457E66, 0xCD6F52BE92DFC895, 0xD446B9F599960170, 0xE699FA4E6546D427, 0x8C590637BFDE4C16, 0x9F60DF9E6660F39A, 0x943C9C7F0A2DB9CA, 0xEF16721A04515250, 0xEE23AE295F72FCA2, 0x655E7CB5CA9835B5, 0x0000294841A0BA4A, 0x0089274473EE558F, 0xDAC0D75B513745B1, 0xA8D32A9729353DD5, 0x26A9F6AF4BC1BCFB, 0x5A462B225F8983FA, 0x3DF263C911CF401B, 0x28DE093A7410BFE2, 0x9E8327E18784F359, 0xAC486507C4DCA079, 0xECD83EF3BD654264, 0xB017493819C92E54, 0x00000364F7342005 }, { 0x6262E774FDE8160D, 0x2F1584AC2F7FDB6A, 0xD543E657AE4633D4, 0x457FA6AE773FAD7F, 0xEF33F231442E83F9, 0xA7A4EE00A22EA9F4, 0xD316B9104A352CC5, 0x2AC0033E7DCB429F, 0xB1A879A79445F8DB, 0x108AD31DFEBF68AB, 0x9EC3DF97C5BE18B0, 0x00001B08506BB0E9, 0xD0D2AE26A0933E64, 0x17C979C18319770B, 0x6E32BD1D7DE2601C, 0x226B0EE56C5609E6, 0xB223184A034D8AEE, 0x1764EC560157CD4B, 0xA0FAC2ADCA968EA6, 0x0658413838C9C342, 0x65E1BF5E7BDC642D, 0xF65DFBE197A72204, 0x42600521B6D6AB99, 0x00003B610FAB6BCD },
+{ 0x94D151AE134A2B3A, 0x1D69B4A51A0FC5CF, 0x01AFE9FB3E5EA3C6, 0xC44F4AFD57AC8A76, 0x0F3AA30148355432, 0x1156FA8FD12E0B58, 0x126EE534FB1BED61, 0xB8930A0B03ED7FD8, 0xC6D6EF51F6E1153B, 0x86BF754D749AEF6D, 0x90AC3A8544A35FCE, 0x00004548B02142D7, 0xF21C17101D8DD5DE, 0x11C35C1CCC117658, 0x952ACC6672C16F15, 0x1927500FE0337416, 0x626BFA0A885789A0, 0x286368F4C86083E6, 0x07715A43683AAB4D, 0xF076D118D014F919, 0xE4AC138DDE211CCC, 0x0D67FD6E6D036391, 0x75D53074FD15A1D9, 0x00005511B0FB5E5F }, { 0x0BC1E2875F28234D, 0xA8F50211A535F5AB, 0x002C96272A1DD094, 0x61F1F6A2AC9FE72D, 0xD61459E426BCD7D2, 0x378EF938B894E743, 0xFC887580554C3138, 0x5ED4828F914FC939, 0xA08AD171FC93B7E8, 0x0E720419F024A889, 0x37D9B403BB00B704, 0x000013B038EFCF56, 0xEF2C7B8BCC0EED1B, 0x8407E740F52F4802, 0x3CFC72A39D59FBE9, 0xE47E87DAB0FAFAE0, 0x40C322E6D6C50426, 0xCDD83F3C48AD45EE, 0x9F856AADA948F278, 0x990730612CFB675B, 0x58DA0535E238C6D6, 0x44B91E01932DBBEF, 0x22B18698E54A9E19, 0x0000242F097AB518 },
+{ 0xB6D6B5D9A705D51B, 0xF20F96DED9A5E4C9, 0x219BDCE9D21FA642, 0xD49AF97B482C004C, 0x29A607F3F694D1D8, 0xEADEA344F1FD8219, 0xFF95A98A844DE90D, 0xA2FB587A824FED46, 0xC852D7974104C038, 0x36EBA3486AD71A67, 0x545066A3690376CE, 0x000038D7B89CC514, 0x77315E5EE4D89D00, 0x356E32236F5CE436, 0x5D7B1A63BCD5A320, 0x78ACF04C5D237B76, 0xAB1F2C2F0F9D567C, 0xA0A822C658CA8F53, 0x2315D59B9379F78E, 0x573E499DF3B2EE2A, 0xD964EC3A69CFAD43, 0x31A7694842C79781, 0x1BACBBDCB6F7C100, 0x000038A2EE50B52D }, { 0xA21581D3B2E97499, 0xBA70E12A2889DA0E, 0x1D222B0AEF8E4021, 0x9A34C935054FD2C7, 0xB73C9CE4EE27ACEC, 0xBED993C367141FDA, 0xC1AEA5350293AC5D, 0x51E28E76A5D67A5D, 0x5F7020A47A0253B1, 0x570071F7AC0BAC56, 0x8ADC48F94A6FB310, 0x0000602470BA299A, 0x000B95B0D3CEB135, 0x3913C337C12B239D, 0xAB87B228F3D03D67, 0xC7257D61AE2738D2, 0xCF729EFE17D11E00, 0xB779D777C4089C5C, 0x8C335BAD8330BEBF, 0xFEEDCE5A47D6729B, 0x2836FC6D801A804F, 0xAC4D9487C6C3A47D, 0x7E1D6C076B94D5B2, 0x00000433EB5FADE1 },
+{ 0xF82E7E82A49BE9EA, 0x625DF84E7EFE55B1, 0x8A84FC80CBE00BA7, 0x5606AF885032A99A, 0x7157783852AB8ADA, 0xAFC267924656B7B4, 0xA1C6DB40567AFFA8, 0xE234CCD5AFB9226A, 0xEBD29EE9449DEE54, 0xF3427E8530670BEE, 0x76CEE958ABA50C96, 0x00002FB97FCB5252, 0x933F2137C14DCC14, 0x144A9DD04E892719, 0x2E5B7A951F9E5A80, 0x185A9A43A7CBD975, 0x16A3E8F08906ED71, 0x69CA428F8BFC3DC0, 0xD1219837A3F3C247, 0x6B84E6A62BFF6D04, 0x7BBDA03A7E9EBFB5, 0xBE616FA5511C9DB0, 0x8A6CCE0535DB8027, 0x00000072FA2B55ED }, { 0x271CBAB24C959E6F, 0xC9DBEFDA01138777, 0x4E8095B6802FAFB3, 0xFC7223D2E1281B77, 0xC03C5F0D29BD9CCE, 0xC204E42674EF25F5, 0xC43E10D113D54F3E, 0x70FA74EFD410A103, 0x0BAA414D6683AA07, 0x7AA8A552912AC18E, 0xCCF0BF56A0457500, 0x00000F07D46C293E, 0x0826A69135A05BC1, 0x0E1D37E03CF9F686, 0x07A610707AE0DFA1, 0x8630C88C578E7223, 0x1DE89A24AFEB20BE, 0xD49A41674E21E1E8, 0x8CB3109180300E3F, 0x6C6559713BAC6F30, 0x0D3C4C8B5A302954, 0xC06BCC6BC92DB65B, 0xA8230B033197930C, 0x0000334F1C1D99DA },
+{ 0x38D13354723F6C3C, 0xF46A8AC66AC5AAAC, 0xEF2413C2E3D51034, 0xD1AFAAEACBF26BD8, 0xEAEFE3955396A43B, 0x1F3159AA374919F2, 0x97E60A7874B374B5, 0x71D6935360C4B9FA, 0xE2685F0FDE321309, 0x0AD9D5CBDDCCD888, 0x579591F14A03A083, 0x000017E1287FAAF5, 0xACEAA9C3F82928B3, 0xC1FA33A5D1C2D786, 0x1DE5D700B5686F7D, 0x38AF3E82D8A89B52, 0x0B275AF098AF0282, 0xC203A8974F059810, 0x0547DB5709FE0BF0, 0x371122B5701AA603, 0x61B5F787502B90AE, 0xF78340A34C414E5C, 0x91A85456A3016105, 0x00002EEFB2203C64 }, { 0x1C3C2FF6A4A74D00, 0x14E14DAAFCD8A6B3, 0x08868BAA713ED96C, 0x5BA46064F99618BA, 0xD95BF7C564A8DF0F, 0xF66B5EEEDEC1BED1, 0xCBE08D141041E0FD, 0xD653187BF9F14F24, 0x195416003A9D3C55, 0xF633984C1DE7CE55, 0x188DC777C6D31FF1, 0x00004F7B54422A98, 0x0F849356846AB4A3, 0xCE5D37798896D722, 0x7886C529DCB7A95E, 0x8DEE6241A4779A3F, 0x5411B65D2DD4DE2C, 0x8C56596544328976, 0xB5A664823177EAC2, 0x777C54A4653FCED1, 0xB27CB3C3218C6F9D, 0xE80BDC36F727CC07, 0xD84B714EF5DE0074, 0x00005B1A04E2BEE9 },
+{ 0x5F7335EE3F0DDDE9, 0xD407760A124265F9, 0xEA10E458DC001FCA, 0x02DA3E01C2B7DE77, 0xC827847D603321CB, 0x80133410D4F1F5BE, 0xFB533D102CD32BDE, 0xDCD5D0515B38C407, 0xBDEF8AFDDC6DA421, 0x9E0317EDF893C35A, 0xB570CD63C50FB79E, 0x0000618B328DC6E1, 0x099BA148EA101B2B, 0x538DED29917D982A, 0x75DFE364B21A4562, 0xB7EB50C64B9C5530, 0x03BE2F844145F220, 0xFA574E56C9FA4831, 0x113BD7D1F6CC4543, 0xB07CF250B206879B, 0x5A7D1C70BCD91604, 0x720A449B778FA64D, 0x8396545F40BBA90A, 0x000021176758AF4C }, { 0xC8D4154BA8E6F4A2, 0x97FBB620763440C3, 0xD7D31231D5560ACD, 0x234DAD90221A9289, 0x03200CB5270E1125, 0x503463692FE71108, 0x2E7D1ACCA5137522, 0xBAF1FB34C36EBD90, 0xCB15369DA80566CF, 0x9F0A31E9B60E3F01, 0x487899DD10466DDE, 0x000050E8E4F409C9, 0x54A37E281F5CBF26, 0x0291F1D92F120150, 0xE534E183EA448F66, 0xE6660EBAC34F3E0A, 0xF06AD07463A6F175, 0xBB917E5A1810DBC4, 0x4E347C5F5B5FA97A, 0xD65E8C7931B83345, 0x82C1BC52BBD930B4, 0xD5B249A119BA6076, 0x229F51B8B973E833, 0x00003381096862A8 },
+{ 0xE2D81E65D019A54C, 0xB6CDB4AE33CE2D71, 0x968FDD074DA6DEC9, 0x6DB96A7D28E18E5F, 0xABE4D6D372AAF7C7, 0xAB95DCE342C82A7B, 0x2326D5C77D18313C, 0x690B288C6A244AC5, 0xF8F30A1A4FB296A6, 0x3EECBC3878247DAE, 0x5FEA4C6CC8D872DF, 0x0000054800CA0A31, 0xBD4238C3288918F3, 0xFA568097C843D5CD, 0xB17FD38C4388ECEE, 0xC1DEEDE8F70A2EA1, 0xC90CD8278E4CF359, 0x741105247A3C11E3, 0xE295E22D270DFA99, 0x91A9F4782910C8C6, 0xA302C7DF6C2A956D, 0x6C85A684185E8F11, 0xD20BA046732C11CF, 0x00006416B78EC3C4 }, { 0xAAB2513AC604C923, 0x0B956001F55423BF, 0x98E69907FB094709, 0xEF1B7B03F756B407, 0x09698550D455C84D, 0xD265E234516F6458, 0x8A920474169E736F, 0x64322503B9CF3C37, 0x18E5129CE759F00C, 0x0945FAA6639E8F19, 0xB1E3E0B9F66232CD, 0x00001A456AA5EAF9, 0x28413B88E72D1CBF, 0xE5EAC82A0B349C4C, 0xAFE7AFF1A8F79207, 0x5241288B7FB0F2B4, 0xE0DEA83DEE15A396, 0xEEC251319A32B857, 0x656844F91536C121, 0xAFCA61919541EBBB, 0x07B1FCE07B092BCA, 0x505947B8A8AD363B, 0xB6444547998F3E32, 0x000012FB2EB59164 },
+{ 0xC90DD0BA43B255D4, 0xD2756A5925482178, 0x4CADE8D2DD2044F1, 0x5194AAA64639303C, 0x2BAAB24E902FE749, 0x443B0217E4451418, 0x1BA477D0C2772961, 0xA7333A21945A4668, 0x8E3B94645DDD4DD3, 0xA6DACB10DE8C022E, 0xB20B781E48A1EAA3, 0x0000294599E69EC3, 0xF28CF1E5199F066F, 0xB822F4559B1344CB, 0x973C495F65F594DA, 0x73B2A2F729B58E14, 0x31A6D934FA0B5DF8, 0xBF1156B32042AB76, 0x1D8B16C3E6C7B335, 0x855760EAAF858DC9, 0x3614385F84A5FD8C, 0xDD3A69C0E88E15C7, 0x2D22D57DB101ECF0, 0x0000129BE5CDFA25 }, { 0x3DE042C21C847444, 0x9A65327594391DC9, 0xF6534864AE310321, 0x0F8A3DD8455201F4, 0x98649D54E609D9FE, 0xC9C44D32AB6A4239, 0xDBC64B2EFD571BE0, 0x24A697CE6D7F82D8, 0x6BA46E4AFBA353BE, 0xDB8D55129DA94C08, 0xF2098999BD89AF80, 0x0000314C8F04B4D0, 0x041A9B5AE398AE99, 0x7991CC68FF2D5166, 0x6A4D69E14A62F7DC, 0xAA3C21EA6467F67A, 0x209E2B01C4E1103D, 0x61863C047647CF49, 0x94779FC3F27BB485, 0x9BC9DBB6DF00CEEE, 0x848329CB0FEBA0A2, 0x265FF406623A79BB, 0x1CD9449DE4CB4CDB, 0x00003674018B6FB3 },
+{ 0x7416F5C39FF1689C, 0xA4FAA4C43EAC9305, 0x27E2A9A17D35DDB2, 0xC340839C37CB76C8, 0x16FF3E36A6A241DA, 0xF648EBEC16FEE0A6, 0x060B5B5012CB0161, 0xF5611FF8FFB12A2E, 0xB4668C46229354FF, 0x9742AC6CF563873D, 0x97D48EDC1054983B, 0x000034AD00CF6AEF, 0xADBFC6EE4353320E, 0x6D23E4EEBBE275D3, 0x5F66DE6DC173A798, 0x112FE546D8FC97FD, 0x634D26BD62204C69, 0x395F4E43A935D100, 0xF858AF7E3A533B5E, 0xA9F945DF27C661CB, 0x0A388F1CB57AD9C8, 0xFEC4AD7E8C94175D, 0x590DE17B8A691B66, 0x0000540723DE0D12 }, { 0x963732E4E0194F6E, 0x384320E7A518FDA5, 0x319D96C62EA63892, 0xDB0ED17385EB1AEE, 0x095CDBA8867B4980, 0x0454CB4798EE079C, 0x21C8991F7E6DB95E, 0x84CDBED7C18FD652, 0x724F2AFF2F83F2A1, 0x153AFCFD7249EA27, 0xF678BEB6112229BB, 0x00005A4CE61266F4, 0x23E5E58EBC7A293F, 0x50F3164CEA7AD42F, 0x3644E6752ED984C4, 0xD91EDC22D75F0CE1, 0xF597CFCDB1A21B62, 0x563AA2873FE4A842, 0x3AA335FDE961FC31, 0xB013CFD1665AF3C6, 0xAA8BA6FA0041887E, 0xF915112D939EF273, 0x3D33640CFD10C600, 0x000040121DE53C65 },
+{ 0xFA9B3E303CACF40A, 0x59E3F39424554C04, 0x0C8E33E4B6776644, 0xDD9BDE75FBFC22F0, 0xA80FBAAC8408189C, 0x77E20983C87BAB9A, 0x431FF54CCC6B5BE7, 0x2F03D312FA134F8D, 0xBBAF9DC9A99E9F65, 0x4844F2BB71C0C91E, 0x18AABD76BED165CF, 0x000001F298E0CB6F, 0x036E3EC6D9DCE201, 0x1C1C947EF8B78371, 0x2101AD360CD44873, 0x84EA948705EA8068, 0x723B2E82AFB22CD9, 0x44105A800E3C0F73, 0xC84E8B84E3BEC461, 0x0FA8F1904FF2F1BF, 0x1C1189E256F96BEE, 0x36BC5238096782DD, 0x6265EECDBC7DC34D, 0x00005046A4CA7314 }, { 0x8546C2DB00453689, 0x4FDF5E2C0CE90ADA, 0x1659E774E59AC2BB, 0xFBB44A6DC17E4FE4, 0x1E9AB6BE4DDFA1CB, 0x421158530E91E102, 0x17DEE54A89C37C76, 0xA61BD95EC3CA9373, 0x44A85E138B9DC79C, 0xDEB22749AB7678F5, 0x9A2B1CA25BA989EA, 0x00001848B1C430D4, 0xFA72EC15338BF9A3, 0x1E58ACE0A1A2DFDB, 0x34C3BB50835F0699, 0xA1218709D4610324, 0xF50FAF3D8C59DCC7, 0x8F1FB806105D6533, 0xCD1171B97883D89A, 0x9E53B48D25EF4825, 0x4A58EA25D4684463, 0xDEA17E5302B8B1B8, 0xCBDB2B163BD4A5E5, 0x00006F5129B9B81D },
+{ 0xF3A1CC632E0B2CA1, 0x925811714034F423, 0xB5D1F54664FD3BCA, 0xEC01BD854C343B82, 0x2B8F5B04350552D7, 0xF7B3FBBA3B0D2CCF, 0x0688BDFC00B7DBC1, 0x15B3A1CC602439C8, 0x662A931C5841A57D, 0x0AC7321C42E42507, 0xFC1318B935572F56, 0x00002ED262527E7E, 0xC9967CC1F506B378, 0x71A43F7C76404A29, 0x12A30D7E81220D69, 0x70E8831CEF9F9B57, 0x023AEE59ABF2F5FF, 0x04C04A8450DF14D0, 0x179057410AF2652D, 0x9E56A22DD5206114, 0x82F14E3B0FF8A6F1, 0x229694CD5584126A, 0xE223681D74EFF30F, 0x00006267900BC630 }, { 0x6E2F639D2F4743E4, 0xE97195D61440B8F1, 0x191A4146D197D9B8, 0x54D2EEF2BB339329, 0x3322A2984C10626E, 0x9A12C214513215D3, 0x920F1D11D49800E3, 0xBEAD6EAB31FB76F7, 0x6A5F35C6B41FD359, 0xD18DA5CD79174BA3, 0x5A23F3978D449891, 0x000015F04AB84A80, 0xBD3210855277B2C7, 0xFA1555A436D5296D, 0xB77A56BA676BEA04, 0x1CE4899D464E6537, 0xBAF23BEB3087317E, 0x07537BC475244C53, 0x3CA1508EFF259F27, 0xDC02E3A300FB5B63, 0xE0B54343FEA7FBC8, 0xB1EB63EBB89887C1, 0xC13FBCD04E7A5D98, 0x00002CA12AD1E776 },
+{ 0xC7E988EBB920DA6D, 0xB5788455B8EF0D03, 0x47B1C831F530B012, 0xBA4F7687502A89B1, 0x7C8D695DDCA41930, 0x2264E6896E5D2C0B, 0x9EAB94381F898B35, 0x74A2FD9FF284885C, 0xABBE5A38506C95C0, 0xD3C351B470418985, 0x2E25D5BE9D709CA6, 0x000033B99FA58E65, 0x0EF3C4AFFEA82289, 0xA9FFD53632027507, 0x6BCD308A253A24EB, 0x8073F35B866E0DD3, 0xB338CC8F53AC79F1, 0xDEFC350EDA798DAA, 0x42CF045784DA2F9B, 0x6C4C0CC23C95B2AF, 0x4A09BD31D3840C4D, 0x49C002297D00DF90, 0xB705007743EDBAF4, 0x000030DFCD8825C7 }, { 0x3075A1CD22454529, 0xE84F0E016499154F, 0x338608E1539AF047, 0x8144782647456341, 0x316FB25A8780BB95, 0xBE6193AB71949D3F, 0x43250E5EC549B25D, 0x54CAA634AB1480F3, 0x89C789545F6AE100, 0x9ED2C759BA63FEDF, 0x40A6A6F2BB988C9A, 0x00001D0AA4FE35C2, 0x69B0ABCF160A7069, 0xD860D8DE6350B54A, 0xCBD2D3361F92A588, 0xF3528942A9DDFD9F, 0x5796CD28C38040ED, 0x5455CE114810F21F, 0xE262D417647343A6, 0x3C36FDA8417143DF, 0x7C59881FB8C51292, 0x96CD979A328B1F9B, 0x5AC01521EC6F8320, 0x00005A4111AD5AB5 },
+{ 0xD02AFFE24DB240B5, 0xBB61F989B44DF4F7, 0x41920476901954BE, 0x8EBA66773C3FBFCB, 0x6E54E8F7FE3463E1, 0x9B41ECDC193231B9, 0x3B3EE8A2FFA1DFBF, 0x32E7B7D784CB730A, 0xC59855664BF3868E, 0x5BBFD8D2E06E0CA2, 0xB561EF08A62A9CC3, 0x000046FEF6BF4B41, 0x3E3E90091022354F, 0xA7782853DA15737D, 0x938F1054FB4DE1EE, 0xB00458C82D861077, 0x9534ED3A520820FD, 0x0950BD6CEF3BDC24, 0x430922D47F369426, 0xFFECEE94D7B276B3, 0x540F2C1980183C49, 0x58D3BD05864F1BF8, 0x1B205DEA735053E2, 0x000017D02ED33093 }, { 0x31FEA106104AD243, 0x076422B1E8460286, 0xD71C6CE8B12D084D, 0x21C2CB0A3EDEE3DA, 0x4DE411891146821C, 0x47262DFDD34D01DF, 0x01E6E8D99284E664, 0xCE266B7F5B8CD494, 0x63350CAD0CACE177, 0x6112CEA9A4D925D5, 0x69AF8E2A4E5B3376, 0x00003638CC143D67, 0x68A1207D21438CBB, 0x68BA342FBF38BFD4, 0x3EE16DF4A34C792D, 0xC290F4238579E81E, 0x5D91BF28C5E9C3FD, 0x4849559D85FB6003, 0x049AB83A22546171, 0x25AC70026939C0C8, 0x28617886348DFA05, 0x5D9E6887BDD0BC40, 0x35BBB2D64F4D0920, 0x000064EE686A59C3 },
+{ 0xA47FA868705EB693, 0x66C2D470E49019A0, 0xAEFA26F0611D12C2, 0x3AA16C39352CDAF9, 0xC05A603A2E93A776, 0x5103555F244D9770, 0xEDF98217E09C9B4C, 0x2DA577B28486EF2C, 0x37A9E4E2CD3DDBC8, 0x2AAB098CC21BB50B, 0xAAC97882D3C0B034, 0x0000083E522331A7, 0xFEC52EBD52987954, 0x9BC1F0AE8BAD4CE1, 0x3BA9C1F08096A354, 0x67FAD785EBA88DE1, 0xF84213C9B1F994AF, 0x4EC124CED8A20537, 0x28656F34B22B4DC7, 0x47164288DFED2918, 0x509A1B43ECF258B0, 0xC5B3C34B1D313D9C, 0x78952DE8C3E49521, 0x0000002F0E10024C }, { 0x662AB4F20756EA7C, 0x90F76EBF45E8CE9B, 0x176C1A7CD7C4168B, 0x0485B0B6823E47BF, 0xE19E6BA4891CC69A, 0x748D76A1F00CBCFE, 0x5595648DD0A0D5C8, 0x8E590047D4104956, 0x7A179D641D7DFCAD, 0xF3AA8C73B0CB33E3, 0x4E56FAC09EE21D3F, 0x000039BF0810D0A7, 0x7644DAD465DADA9D, 0x351BE5325858ADA1, 0x206BA86F165D4796, 0xE83493A24A6AFA2D, 0x7AFFF4D0F354F654, 0x61A9294E44E53668, 0xE68105EFB3E75493, 0x8CB84EDA22244A30, 0x5AE008BBD660FC06, 0x18D95B7F3AA77A32, 0xC14232D5AEC20BBB, 0x000064F6AB392EB9 },
+{ 0x4F2EADED533E36BA, 0x0FC8AAA22A3C47E7, 0x2E339DC27EC14C81, 0x6E7D3F543573C6A3, 0x9EFB7C0091A8128A, 0xC7F3BA78C53B8615, 0x13DA819C080FC93E, 0xB34216E9082EEB45, 0xCD4D5CE2FD20F97F, 0x976625C2BCA87E13, 0xBEA99476986AAD58, 0x00005035E42718AA, 0x9D2B1B405C8C1050, 0xAE8ADF1511EBC11E, 0xCD8A652708775A3D, 0x92D4CD591A85DC23, 0xE2BF64844BB57BA5, 0x71345D9B64D18846, 0x11A7680715D43AE0, 0x627DFF2F80A0D8C3, 0xDFB09A451277C5C1, 0xD2436B13ABD4A6B2, 0xB41DFEE6153C7457, 0x0000616FBC88354E }, { 0x4F2EADED533E36BA, 0x0FC8AAA22A3C47E7, 0x2E339DC27EC14C81, 0x6E7D3F543573C6A3, 0x9EFB7C0091A8128A, 0xC7F3BA78C53B8615, 0x13DA819C080FC93E, 0xB34216E9082EEB45, 0xCD4D5CE2FD20F97F, 0x976625C2BCA87E13, 0xBEA99476986AAD58, 0x00005035E42718AA, 0x9D2B1B405C8C1050, 0xAE8ADF1511EBC11E, 0xCD8A652708775A3D, 0x92D4CD591A85DC23, 0xE2BF64844BB57BA5, 0x71345D9B64D18846, 0x11A7680715D43AE0, 0x627DFF2F80A0D8C3, 0xDFB09A451277C5C1, 0xD2436B13ABD4A6B2, 0xB41DFEE6153C7457, 0x0000616FBC88354E },
+{ 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 }, { 0xD08394B399DE419A, 0x55612D7DE24503E6, 0x986DAEF32F42B896, 0xF8878D03E8678353, 0x15195E2AE5ADCFCF, 0x5CC4541611B5CFB2, 0xC726D6D809077988, 0x24E78A3E759F5133, 0xAC0400C7C4CBC8F4, 0xDFBD076777FDE4AB, 0xE926D91E281B86B0, 0x0000393025572082, 0x40FA452A8F07FB1D, 0xE702519BF9C9CA8A, 0x52ECCCF5255C7DB5, 0x2BC613DFD8D61DB6, 0xFEC26E773B59287C, 0x9F483E6520C1EA58, 0xD11718F4B97A898D, 0xA03D6D83B5678A7E, 0xFEB5318EFB2DD9F6, 0x92725A0B0354F8E3, 0x81D4ECFFA5BA0A52, 0x00000C23C52B0412 },
+{ 0x4D108EFDE08C3227, 0x5112BFE849FF2589, 0xFFFA141C5870A86B, 0xFC0A4C068DE2D2DE, 0x263762873C171244, 0xEE7E16AFFD001B30, 0x9A21F66A16A41982, 0x31B5F3918791C379, 0xB5E2E8CF505F196D, 0xB0E85279FC523A39, 0xDE4776AF9EA8052A, 0x00002235F4B21145, 0x69C7D675A8698281, 0x3D194E5474F9409D, 0x676DFEFC3F892F23, 0xC42A44CBE3D12E5B, 0x531671DED2011E3F, 0x89C1F9673B90141E, 0xA617367DEA6E37FC, 0x93BE8B1940EC5A0E, 0x1BFFF58EA2DE6576, 0xEC49D1526F0EB3F7, 0x9842F1B8732AD791, 0x000060908F15B8BE }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+{ 0x511F5E8CD8B0451F, 0xCC0E2ABFA67AFE14, 0x5271474AA1D245AC, 0x24F1F89BAEA9806B, 0xA72D98ED0069AED7, 0xF1C7D88AD13A775D, 0xEA37060DA998D979, 0x72EE0129BF6491F1, 0x54CEBA0A0C336D7B, 0x01ECDE9446E24FE3, 0x065E056AAA118C64, 0x0000473C15A0CF01, 0x1029961BFA9D4CC0, 0x7A585AC580AE0ED7, 0x933E1968C217BE08, 0x2A5DF8087684C8E5, 0xC95593E31FEEA066, 0x51F27B6039453D3F, 0x21247AA34E3E6599, 0x735BEFE7B545073E, 0x8873ADDE3313614F, 0x84E6E137316572E1, 0xFE55EFE39982851F, 0x00000BF8B631C6B6 }, { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+};
+
 #endif
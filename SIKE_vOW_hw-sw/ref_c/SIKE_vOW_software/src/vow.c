@@ -9,66 +9,305 @@
 #include <signal.h>
 #endif
 #include "vow.h"
+#if !defined(HRDW) && (OS_TARGET == OS_LINUX)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+
+static inline uint32_t shared_function_version(shared_state_t *S)
+{ // Reads the random function currently used by all walkers
+    uint32_t function_version;
+
+#pragma omp atomic read
+    function_version = S->function_version;
+    return function_version;
+}
+
+static void resync_state(shared_state_t *S, private_state_t *private_state)
+{ // Moves a walker to the current shared random function and samples new starting points for its walks
+    private_state->function_version = shared_function_version(S);
+    private_state->random_functions = private_state->function_version;
+    private_state->current_dist = 0;
+    SampleWalksSIDH(private_state);
+}
+
+static inline void record_trail(private_state_t *private_state, trail_t *trail)
+{ // Keeps the state of the current walk as a trail checkpoint every TRAIL_INTERVAL steps
+    uint32_t steps = private_state->current.current_steps;
+
+    if (private_state->TRAIL_INTERVAL != 0 && steps == (trail->count + 1) * private_state->TRAIL_INTERVAL && trail->count < private_state->TRAIL_POINTS)
+        copy_st(trail->points[trail->count++], private_state->current.current_state);
+}
+
+static double wall_clock(void)
+{
+#if defined(_OPENMP)
+    return omp_get_wtime();
+#else
+    return (double)time(NULL);
+#endif
+}
+
+static void record_distinct_collision(shared_state_t *S, const st_t c0, const st_t c1)
+{ // Adds the collision of states c0 and c1 to the set of distinct collisions. A collision is identified by a hash of its pair of 
+  // states (only their NBITS_STATE bits, the random function leaves the rest of the words undefined)
+    uint64_t s0 = (uint64_t)c0[0] & low_mask(insts_constants.NBITS_STATE);
+    uint64_t s1 = (uint64_t)c1[0] & low_mask(insts_constants.NBITS_STATE), key, i;
+
+    if (s0 > s1) {
+        key = s0;
+        s0 = s1;
+        s1 = key;
+    }
+    key = (s0 * 0x9E3779B97F4A7C15ULL) ^ ((s1 + 0x632BE59BD9B4E019ULL) * 0xC2B2AE3D27D4EB4FULL);
+    key ^= key >> 29;
+    if (key == 0)
+        key = 1;  // 0 marks an empty slot
+
+#pragma omp critical(vow_collision_set)
+    {
+        // Stop counting before the set gets too full (it holds 4w collisions, about 3 times the expected number)
+        if (4 * (uint64_t)S->dist_cols < 3 * S->collision_set_size) {
+            i = key & (S->collision_set_size - 1);
+            while (S->collision_set[i] != 0 && S->collision_set[i] != key)
+                i = (i + 1) & (S->collision_set_size - 1);
+            if (S->collision_set[i] == 0) {
+                S->collision_set[i] = key;
+                S->dist_cols++;
+            }
+        }
+    }
+}
+
+static bool queue_collision(shared_state_t *S, private_state_t *private_state, const trip_t *found, bool has_trails, const trail_t *found_trail)
+{ // Queues the collision of the triple found by the walker with the triple private_state->trip read from memory, for a 
+  // locator to backtrack. Returns false if the queue is full
+    locate_queue_t *queue = S->locate_queue;
+    locate_record_t *record;
+    bool queued = false;
 
+#pragma omp critical(vow_locate_queue)
+    {
+        if (queue->depth < LOCATE_QUEUE_SIZE) {
+            record = &queue->records[(queue->head + queue->depth) % LOCATE_QUEUE_SIZE];
+            copy_trip(&record->stored, &private_state->trip);
+            copy_trip(&record->found, found);
+            record->has_trails = has_trails;
+            if (has_trails) {
+                record->stored_trail = private_state->trail;
+                record->found_trail = *found_trail;
+            }
+            record->function_version = private_state->function_version;
+            record->queued = wall_clock();
+            queue->depth++;
+            S->queued_collisions++;
+            S->sum_queue_depth += queue->depth;
+            if (queue->depth > S->max_queue_depth)
+                S->max_queue_depth = queue->depth;
+            queued = true;
+        }
+    }
+    return queued;
+}
+
+static void locate_collisions(shared_state_t *S, private_state_t *private_state, unsigned int *walkers_running, bool *success, bool *finished)
+{ // Locator: backtracks the queued collisions until one of them is the golden collision, or all walkers stopped and the 
+  // queue is empty. The collisions are located for the random function they were found with
+    locate_queue_t *queue = S->locate_queue;
+    locate_record_t record;
+    unsigned int running;
+    uint32_t collisions;
+    bool popped, stop, golden;
+    double latency;
+
+    while (true) {
+#pragma omp atomic read
+        stop = *success;
+        if (stop)
+            break;
+        // Read before looking at the queue: a walker queues its last collision before it stops
+#pragma omp atomic read
+        running = *walkers_running;
+        popped = false;
+#pragma omp critical(vow_locate_queue)
+        {
+            if (queue->depth > 0) {
+                record = queue->records[queue->head];
+                queue->head = (queue->head + 1) % LOCATE_QUEUE_SIZE;
+                queue->depth--;
+                popped = true;
+            }
+        }
+        if (!popped) {
+            if (running == 0)
+                break;
+#if !defined(HRDW) && (OS_TARGET == OS_LINUX)
+            usleep(100);
+#endif
+            continue;
+        }
+
+        private_state->function_version = record.function_version;
+        collisions = private_state->collisions;
+        PROFILE_BEGIN(PROFILE_BACKTRACK);
+        golden = BacktrackSIDH(&record.stored, &record.found, record.has_trails ? &record.stored_trail : NULL, record.has_trails ? &record.found_trail : NULL, private_state);
+        PROFILE_END(PROFILE_BACKTRACK);
+        if (S->collision_set != NULL && private_state->collisions != collisions)
+            record_distinct_collision(S, private_state->collision[0], private_state->collision[1]);
+        latency = wall_clock() - record.queued;
+#pragma omp critical(vow_stats)
+        {
+            S->located_queued++;
+            S->sum_locate_latency += latency;
+            if (latency > S->max_locate_latency)
+                S->max_locate_latency = latency;
+        }
+        // Only check for success when not running for stats
+        if (!private_state->collect_vow_stats && golden) {
+#pragma omp atomic write
+            *success = true;
+#pragma omp atomic write
+            *finished = true;
+        }
+    }
+
+#pragma omp critical(vow_stats)
+    {
+        S->collisions += private_state->collisions;
+        S->number_steps_locate += private_state->number_steps_locate;
+        S->number_steps = S->number_steps_collect + S->number_steps_locate;
+    }
+}
 
 static inline bool vOW_one_iteration(shared_state_t *S, private_state_t *private_state, trip_t *t, bool *success)
-{ // Runs one "iteration" of vOW: sampling a point, checking for distinguishedness and possibly backtracking
+{ // Runs one "iteration" of vOW: a random function step for each walk, then for each walk checking for 
+  // distinguishedness and possibly backtracking or sampling a new point
   // Inputs:  S stats pointer, private_state private state pointer, t temporary triple pointer
   // Output:  success pointer: return true vOW terminated, break out of loop, 
   //                           return false keep looping
 
-    // Walk to the next point using the current random function
+#if !defined(HRDW) && (OS_TARGET == OS_LINUX)
+    // Distributed attack: the store server may have moved on to a new random function or stopped the attack
+    if (S->links != NULL && store_poll(S, private_state, success))
+        return true;
+#endif
+
+    // Another walker may have moved on to a new random function
+    if (private_state->function_version != shared_function_version(S))
+        resync_state(S, private_state);
+
+    // Walk to the next point of each walk using the current random function
     UpdateSIDH(private_state);
-    private_state->current.current_steps += 1;
-
-    // Check if the new point is distinguished
-    if (DistinguishedSIDH(private_state)) {
-        // Found a distinguished point. Try backtracking if unsuccessful, sample a new starting point
-        digit_t id;
-        bool read, res;
-        private_state->current_dist++;
-        private_state->dist_points++;  // S->current_dist gets reset, this doesn't
+
+    for (unsigned int k = 0; k < private_state->n_walks; k++) {
+        copy_trip(&private_state->current, &private_state->walks[k]);
+        private_state->current.current_steps += 1;
+        record_trail(private_state, &private_state->trails[k]);
+
+        // Check if the new point is distinguished
+        if (DistinguishedSIDH(private_state)) {
+            // Found a distinguished point. Try backtracking if unsuccessful, sample a new starting point
+            digit_t id;
+            bool read, res, trail;
+            uint32_t collisions;
+            uint64_t current_dist;
+            private_state->dist_points++;  // S->current_dist gets reset, this doesn't
+#if !defined(HRDW) && (OS_TARGET == OS_LINUX)
+            if (S->links != NULL) {
+                // Distributed attack: the store server checks the point against its memory and counts the points of the
+                // current function version, and the walker locates the collisions it reports (see store_point())
+                if (store_point(S, private_state, success))
+                    return true;
+                SampleSIDH(private_state);
+                private_state->trails[k].count = 0;
+                copy_trip(&private_state->walks[k], &private_state->current);
+                continue;
+            }
+#endif
+            // Only count points of the current function version, as walkers only resync after the current step. A version
+            // switch between the check and the capture can still count one point for the next version, but cannot trigger it
+            current_dist = 0;
+            if (shared_function_version(S) == private_state->function_version) {
+#pragma omp atomic capture
+                current_dist = ++S->current_dist;
+                if (shared_function_version(S) != private_state->function_version)
+                    current_dist = 0;
+            }
+            private_state->current_dist = current_dist;
                 
-        // Read triple from memory
-        id = MemIndexSIDH(private_state);
-        read_from_memory(&private_state->trip, S, id);
-        read = (private_state->trip.current_steps > 0);
-
-        // Did not get a collision in value, hence it was just a memory address collision
-        if (!read || !is_equal_st(private_state->trip.current_state, private_state->current.current_state)) {
-            private_state->mem_collisions += 1;
-        } else {
-            // Not a simple memory collision, backtrack!
-            copy_trip(t, &private_state->current);
-            res = BacktrackSIDH(&private_state->trip, t, private_state);
-
-            // Only check for success when not running for stats
-            if (!private_state->collect_vow_stats) {
-                if (res || *success) {  //// NOTE: I don't think success needs to be evaluated here. It is updated and evaluated before hitting this part again 
+            // Read triple from memory
+            id = MemIndexSIDH(private_state);
+            PROFILE_BEGIN(PROFILE_MEMORY_READ);
+            read = read_from_memory(&private_state->trip, S, id, private_state->random_functions);
+            PROFILE_END(PROFILE_MEMORY_READ);
+
+            // Did not get a collision in value, hence it was just a memory address collision
+            if (!read || !is_equal_st(private_state->trip.current_state, private_state->current.current_state)) {
+                private_state->mem_collisions += 1;
+            } else {
+                // Not a simple memory collision, backtrack!
+                copy_trip(t, &private_state->current);
+                PROFILE_BEGIN(PROFILE_MEMORY_READ);
+                trail = (S->trails != NULL && read_trail_from_memory(&private_state->trail, &private_state->trip, S, id, private_state->random_functions));
+                PROFILE_END(PROFILE_MEMORY_READ);
+                if (S->N_OF_LOCATORS > 0 && queue_collision(S, private_state, t, trail, &private_state->trails[k])) {
+                    res = false;  // A locator reports the golden collision
+                } else {
+                    if (S->N_OF_LOCATORS > 0) {
+#pragma omp atomic
+                        S->located_inline++;
+                    }
+                    collisions = private_state->collisions;
+                    PROFILE_BEGIN(PROFILE_BACKTRACK);
+                    res = BacktrackSIDH(&private_state->trip, t, trail ? &private_state->trail : NULL, &private_state->trails[k], private_state);
+                    PROFILE_END(PROFILE_BACKTRACK);
+                    if (S->collision_set != NULL && private_state->collisions != collisions)
+                        record_distinct_collision(S, private_state->collision[0], private_state->collision[1]);
+                }
+
+                // Only check for success when not running for stats
+                if (!private_state->collect_vow_stats && res) {
+#pragma omp atomic write
                     *success = true;
                     return true;
                 }
             }
+            // Didn't get the golden collision, write the current distinguished point to memory and sample a new starting point
+            PROFILE_BEGIN(PROFILE_MEMORY_WRITE);
+            write_to_memory(&private_state->current, S, id, private_state->random_functions);
+            if (S->trails != NULL)
+                write_trail_to_memory(&private_state->trails[k], &private_state->current, S, id, private_state->random_functions);
+            PROFILE_END(PROFILE_MEMORY_WRITE);
+            SampleSIDH(private_state);
+            private_state->trails[k].count = 0;
+        } else if (private_state->current.current_steps >= S->MAX_STEPS) {
+            // Walked too long without finding a new distinguished point, hence sample a new starting point
+            SampleSIDH(private_state);
+            private_state->trails[k].count = 0;
         }
-        // Didn't get the golden collision, write the current distinguished point to memory and sample a new starting point
-        write_to_memory(&private_state->current, S, id);
-        SampleSIDH(private_state);
-    }
-
-    // Check if enough points have been mined for the current random function
-    if (private_state->current_dist >= insts_constants.MAX_DIST) {
-        if (private_state->collect_vow_stats)  // We are only collecting stats for one random function, can stop vOW
-            return true;
-        // Done with the current function version, sample a new starting point, and update the random function 
-        SampleSIDH(private_state);       
-        private_state->function_version++;
-        private_state->random_functions++;
-        private_state->current_dist = 0;
-    }
+        copy_trip(&private_state->walks[k], &private_state->current);
 
-    if (private_state->current.current_steps >= insts_constants.MAX_STEPS) {
-        // Walked too long without finding a new distinguished point, hence sample a new starting point
-        SampleSIDH(private_state);
+        // Check if enough points have been mined for the current random function
+        if (private_state->current_dist >= S->MAX_DIST) {
+            if (private_state->collect_vow_stats)  // We are only collecting stats for one random function, can stop vOW
+                return true;
+            // Done with the current function version, update the random function (only once if several walkers get here) 
+#pragma omp critical(vow_function_version)
+            {
+                if (S->function_version == private_state->function_version) {
+#pragma omp atomic write
+                    S->current_dist = 0;
+#pragma omp atomic write
+                    S->function_version = private_state->function_version + 1;
+                }
+            }
+            // Sample new starting points for the new random function
+            resync_state(S, private_state);
+            return false;
+        }
     }
     return false;
 }
@@ -83,45 +322,197 @@ void sigintHandler(int sig_num)
 }
 #endif
 
+static void collect_stats(shared_state_t *S, private_state_t *private_state)
+{ // Adds the statistics of a walker to the shared state
+#pragma omp critical(vow_stats)
+    {
+        S->collisions += private_state->collisions;
+        S->mem_collisions += private_state->mem_collisions;
+        S->dist_points += private_state->dist_points;
+        S->number_steps_collect += private_state->number_steps_collect;
+        S->number_steps_locate += private_state->number_steps_locate;
+        S->number_steps = S->number_steps_collect + S->number_steps_locate;
+        S->final_avg_random_functions += (double)private_state->random_functions / (double)S->N_OF_CORES;
+    }
+}
+
+static private_state_t *checkpoint_walkers(shared_state_t *S)
+{ // Private states of the walkers, stored in the checkpoint file
+    return (private_state_t *)((unsigned char *)S->checkpoint + S->checkpoint->walkers_offset);
+}
+
+#if !defined(HRDW) && (OS_TARGET == OS_LINUX)
+static bool write_checkpoint(shared_state_t *S, double wall_time, bool finished, bool success)
+{ // Saves the progress of the attack while no walker is running. The memory and the walkers already live in the file
+    checkpoint_t *header = S->checkpoint;
+
+    header->collect_vow_stats = S->collect_vow_stats;
+    header->N_OF_WALKS = S->N_OF_WALKS;
+    header->function_version = S->function_version;
+    header->current_dist = S->current_dist;
+    header->wall_time = wall_time;
+    header->finished = finished;
+    header->success = success;
+    header->checkpoints++;
+    header->walkers_valid = true;
+    return (msync(S->checkpoint, (size_t)S->checkpoint_size, MS_SYNC) == 0);
+}
+#endif
+
 bool vOW(shared_state_t *S)
-{
-    bool success = false;
-    private_state_t private_state;
-    trip_t t;    
-    
-    init_private_state(S, &private_state);
+{ // Runs the attack with S->N_OF_CORES walkers sharing the memory in S
+  // With a checkpoint file, all walkers stop every S->checkpoint_interval seconds (and when interrupted) so that 
+  // their states are saved, and the attack continues from the saved states if S->resume is set
+    bool success = false, finished = false, pause = false, walkers_valid = false;
+    unsigned int walkers_running;
+    double start_wall_time = wall_clock(), previous_wall_time = 0., next_checkpoint;
+
+    if (S->resume && S->checkpoint != NULL) {
+        walkers_valid = true;
+        previous_wall_time = S->checkpoint->wall_time;
+        // Nothing left to do, only report the saved stats
+        finished = S->checkpoint->finished;
+        success = S->checkpoint->success;
+    } else if (S->links == NULL) {  // A worker of a distributed attack starts with the function version of the store server
+        S->function_version = 1;
+        S->current_dist = 0;
+    }
+    if (S->N_OF_CORES == 0)
+        S->N_OF_CORES = 1;
+    if (S->LOCATE_THREADS != 2)
+        S->LOCATE_THREADS = 1;
+#if defined(_OPENMP)
+    if (S->LOCATE_THREADS > 1)
+        omp_set_max_active_levels(2);  // Helper threads of the walkers for locating collisions
+#else
+    S->N_OF_LOCATORS = 0;  // Locators run alongside the walkers
+#endif
+    if (S->links != NULL)
+        S->N_OF_LOCATORS = 0;  // The walkers of a worker locate the collisions reported by the store server
+    PROFILE_RESET();  // Leave out the work done before the attack, e.g., tuning the isogeny strategy
+    if (S->collect_vow_stats) {
+        // Distinct collisions of the single function version. Only those located by this call are counted after --resume
+        S->collision_set_size = 4 * S->MEMORY_SIZE;
+        S->collision_set = (uint64_t *)calloc((size_t)S->collision_set_size, sizeof(uint64_t));
+        if (S->collision_set == NULL)
+            S->collision_set_size = 0;
+    }
+    if (S->N_OF_LOCATORS > 0) {
+        S->locate_queue = (locate_queue_t *)calloc(1, sizeof(locate_queue_t));
+        if (S->locate_queue == NULL)
+            S->N_OF_LOCATORS = 0;
+    }
 
 #if !defined(HRDW) && (OS_TARGET == OS_LINUX)
     // Set a Ctrl+C handler to dump statistics
     signal(SIGINT, sigintHandler);
+    if (S->checkpoint != NULL)
+        signal(SIGTERM, sigintHandler);  // Also checkpoint jobs that get preempted
+#endif
+
+    while (!finished) {
+        pause = false;
+        next_checkpoint = wall_clock() + S->checkpoint_interval;
+        walkers_running = S->N_OF_CORES;
+
+        // Threads N_OF_CORES, ..., N_OF_CORES + N_OF_LOCATORS - 1 are the locators
+#pragma omp parallel num_threads(S->N_OF_CORES + S->N_OF_LOCATORS)
+        {
+            private_state_t local_state, *private_state = &local_state;
+            trip_t t;
+            bool stop;
+            int thread_num = 0;
+
+            PROFILE_BEGIN(PROFILE_THREADS);
+#if defined(_OPENMP)
+            thread_num = omp_get_thread_num();
 #endif
-    // While we haven't exhausted the random functions to try
-    while (private_state.random_functions <= insts_constants.MAX_FUNCTION_VERSIONS && !success) {
+            if (thread_num >= S->N_OF_CORES) {
+                // Locators drain the queue before a checkpoint, so that no collision is lost
+                init_private_state(S, private_state);
+                locate_collisions(S, private_state, &walkers_running, &success, &finished);
+            } else {
+                if (S->checkpoint != NULL)
+                    private_state = &checkpoint_walkers(S)[thread_num];
+                if (!walkers_valid)
+                    init_private_state(S, private_state);
+                private_state->LOCATE_THREADS = S->LOCATE_THREADS;
+                if (private_state->TRAIL_INTERVAL != S->TRAIL_INTERVAL || private_state->TRAIL_POINTS != S->TRAIL_POINTS) {
+                    // Resumed with other trail checkpoints, which the walks in progress do not have
+                    private_state->TRAIL_INTERVAL = S->TRAIL_INTERVAL;
+                    private_state->TRAIL_POINTS = S->TRAIL_POINTS;
+                    SampleWalksSIDH(private_state);
+                }
+
+                // While we haven't exhausted the random functions to try
+                while (private_state->random_functions <= insts_constants.MAX_FUNCTION_VERSIONS) {
+                    // Some walker found the golden collision or collected enough stats
+#pragma omp atomic read
+                    stop = finished;
+                    if (stop)
+                        break;
+#pragma omp atomic read
+                    stop = pause;
+                    if (stop)
+                        break;
 #if !defined(HRDW) && (OS_TARGET == OS_LINUX)
-        if (ctrl_c_pressed) {
-            printf("\n%d: thinks ctrl+c was pressed", private_state.thread_id);
-            break;
+                    if (ctrl_c_pressed) {
+                        printf("\n%d: thinks ctrl+c was pressed", private_state->thread_id);
+                        break;
+                    }
+#endif
+                    // Time for a periodic checkpoint
+                    if (S->checkpoint != NULL && S->checkpoint_interval > 0 && wall_clock() >= next_checkpoint) {
+#pragma omp atomic write
+                        pause = true;
+                        break;
+                    }
+                    // Mine new points
+                    if (vOW_one_iteration(S, private_state, &t, &success)) {
+#pragma omp atomic write
+                        finished = true;
+                        break;
+                    }
+                }
+
+                // Walkers in the checkpoint file are collected once the attack stops
+                if (S->checkpoint == NULL)
+                    collect_stats(S, private_state);
+#pragma omp atomic
+                walkers_running--;
+            }
+            PROFILE_END(PROFILE_THREADS);
+            PROFILE_FLUSH();
         }
+
+        walkers_valid = true;
+#if !defined(HRDW) && (OS_TARGET == OS_LINUX)
+        if (S->checkpoint != NULL && !write_checkpoint(S, previous_wall_time + wall_clock() - start_wall_time, finished, success))
+            printf("\n  Could not write the checkpoint file");
 #endif
-        // Mine new points
-        if (vOW_one_iteration(S, &private_state, &t, &success)) {
+        if (!pause)
             break;
-        }
     }
 
-// Collect all the stats
-    S->collisions += private_state.collisions;
-    S->mem_collisions += private_state.mem_collisions;
-    S->dist_points += private_state.dist_points;
-    S->number_steps_collect += private_state.number_steps_collect;
-    S->number_steps_locate += private_state.number_steps_locate;
-    S->number_steps = S->number_steps_collect + S->number_steps_locate;
-    S->final_avg_random_functions += (double)private_state.random_functions;
+    // Collect all the stats
+    if (S->checkpoint != NULL) {
+        for (unsigned int i = 0; i < S->N_OF_CORES; i++)
+            collect_stats(S, &checkpoint_walkers(S)[i]);
+    }
+#if !defined(HRDW) && (OS_TARGET == OS_LINUX)
+    if (S->links != NULL && !store_finish(S))  // Steps and collisions of the worker, for the totals of the store server
+        printf("\n  Could not report the stats of the worker to the store server");
+#endif
 
 #if !defined(HRDW) && (OS_TARGET == OS_LINUX)
     ctrl_c_pressed = false;
 #endif
+    free(S->locate_queue);
+    S->locate_queue = NULL;
+    free(S->collision_set);
+    S->collision_set = NULL;
     S->success = success;
+    S->wall_time = previous_wall_time + wall_clock() - start_wall_time;
 
     return success;
 }
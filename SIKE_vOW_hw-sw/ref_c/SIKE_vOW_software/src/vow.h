@@ -4,6 +4,10 @@
 #include "curve_math.h"
 #include "prng.h"
 #include "instance.h"
+#include "profile.h"
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
 
 extern instance_t insts_constants;
 extern f2elm_t64 DBL_TABLE_ES[], DBL_TABLE_EE[];
@@ -20,9 +24,124 @@ typedef struct
     st_t initial_state;
 } trip_t;
 
+// Triples are stored bit-packed in a single word, from the least significant bit:
+//   current_steps (STEPS_BITS) | distinguisher value of current_state (DIST_BITS) | initial_state (NBITS_STATE) | function version tag
+// The low MEMORY_LOG_SIZE bits of current_state are implied by the slot address, and the remaining bits are 
+// recovered from the value checked by DistinguishedSIDH(). An all-zero slot is empty (current_steps >= 1).
+typedef uint64_t mem_slot_t;
+
+#define MAX_MEMORY_LOG_SIZE    34   // Largest supported memory, w = 2^34 triples
+
+// Trail checkpoints: the states of a walk after TRAIL_INTERVAL, 2*TRAIL_INTERVAL, ... steps. They are kept for the trail of 
+// each triple in memory in a side table, so that BacktrackSIDH() can restart both trails close to where they merge
+#define MAX_TRAIL_POINTS       32
+
+typedef struct
+{
+    uint32_t count;                 // Checkpoints held, for steps TRAIL_INTERVAL, ..., count*TRAIL_INTERVAL
+    st_t points[MAX_TRAIL_POINTS];
+} trail_t;
+
+// Locate queue: with N_OF_LOCATORS > 0, walkers hand the collisions they find over to dedicated locator threads and keep 
+// mining. A walker that finds the queue full locates its collision itself
+#define LOCATE_QUEUE_SIZE      256
+
+typedef struct
+{
+    trip_t stored;                  // Triple read from memory
+    trip_t found;                   // Distinguished triple of the walker that collided with it
+    trail_t stored_trail;           // Trail checkpoints of both triples, if has_trails
+    trail_t found_trail;
+    bool has_trails;
+    uint32_t function_version;      // Random function of both trails
+    double queued;                  // Wall-clock time the collision was queued
+} locate_record_t;
+
+typedef struct
+{
+    locate_record_t records[LOCATE_QUEUE_SIZE];
+    uint32_t head;                  // Oldest record
+    uint32_t depth;                 // Records waiting for a locator
+} locate_queue_t;
+
+// Distributed attack: a store server owns the memory and worker processes run the walkers (see vow_net.c). Each walker of a
+// worker has its own TCP connection to the server, over which it sends its distinguished triples in batches of STORE_BATCH
+#define STORE_MAX_BATCH        256
+#define STORE_MESSAGE_BYTES    (8 + 24*STORE_MAX_BATCH)   // Largest message: a full batch of triples
+
+typedef struct
+{
+    int fd;                         // Connection to the store server
+    uint32_t worker_id;             // Assigned by the server, salts the PRNG seed of the walker
+    uint32_t pending;               // Triples waiting to be sent
+    trip_t batch[STORE_MAX_BATCH];
+    uint32_t versions[STORE_MAX_BATCH];  // Function version each of them was found with
+    unsigned char message[STORE_MESSAGE_BYTES];
+} store_link_t;
+
+// Checkpoint file: this header, followed by the walkers' private states and the memory, each at the given offset.
+// The memory is used in place through a shared mapping of the file, so a checkpoint only has to store the rest.
+#define CHECKPOINT_MAGIC       "vOW4SIKE"
+#define CHECKPOINT_FORMAT      1
+
+typedef struct
+{
+    char magic[8];
+    uint32_t format;
+    char MODULUS[10];               // Instance the attack runs on
+    uint32_t e;
+    uint32_t PRNG_SEED;
+    uint32_t MEMORY_LOG_SIZE;
+    uint32_t N_OF_CORES;
+    uint32_t private_state_size;    // sizeof(private_state_t) of the binary that wrote the file
+    uint64_t walkers_offset;
+    uint64_t memory_offset;
+    // Attack progress, valid once walkers_valid is set
+    bool walkers_valid;
+    bool finished;                  // The attack stopped, either successfully or after collecting stats
+    bool success;
+    bool collect_vow_stats;
+    uint32_t N_OF_WALKS;
+    uint32_t function_version;
+    uint64_t current_dist;
+    double wall_time;               // Seconds spent on the attack before the checkpoint
+    uint32_t checkpoints;           // Number of checkpoints taken
+} checkpoint_t;
+
 typedef struct
 {
-    trip_t memory[MEMORY_SIZE];     // Memory holding triples
+    mem_slot_t *memory;             // Memory holding packed triples, allocated by init_shared_memory()
+    uint64_t MEMORY_SIZE;           // w = 2^MEMORY_LOG_SIZE triples
+    unsigned int MEMORY_LOG_SIZE;
+    unsigned int STEPS_BITS;        // Bits of a packed triple holding current_steps <= MAX_STEPS
+    unsigned int DIST_BITS;         // Bits of a packed triple holding the distinguisher value <= DIST_BOUND
+    unsigned int TAG_BITS;          // Bits left for the function version tag
+    // Parameters derived from w and the instance's ALPHA, BETA and GAMMA 
+    uint32_t MAX_STEPS;             // ceil(GAMMA / THETA), where THETA = ALPHA * sqrt(w / 2^NBITS_STATE)
+    uint64_t MAX_DIST;              // BETA * w
+    uint64_t DIST_BOUND;            // floor(THETA * 2^(NBITS_STATE - log(w)))
+    // Trail checkpoints, disabled if TRAIL_INTERVAL = 0
+    uint64_t *trails;               // Side table: for each memory slot, the packed triple as a tag, the count and TRAIL_POINTS states
+    uint32_t TRAIL_INTERVAL;        // Steps between checkpoints
+    uint32_t TRAIL_POINTS;          // Checkpoints kept per trail, min((MAX_STEPS - 1) / TRAIL_INTERVAL, MAX_TRAIL_POINTS)
+    uint16_t N_OF_CORES;            // Number of walkers (threads) sharing the memory
+    uint16_t N_OF_WALKS;            // Number of walks advanced in lockstep by each walker, at most MAX_WALKS
+    uint16_t LOCATE_THREADS;        // Threads used by each walker to locate a collision, 1 or 2 (see BacktrackSIDH())
+    uint16_t N_OF_LOCATORS;         // Threads locating the collisions queued by the walkers, 0 to locate them in the walkers
+    locate_queue_t *locate_queue;   // Allocated by vOW() if N_OF_LOCATORS > 0
+    // Current random function, shared by all walkers
+    uint32_t function_version;
+    uint64_t current_dist;          // Distinguished points mined by all walkers for the current function version
+    // Checkpointing
+    checkpoint_t *checkpoint;       // Mapped checkpoint file holding the memory and the walkers, NULL if the memory is on the heap
+    uint64_t checkpoint_size;
+    double checkpoint_interval;     // Seconds between periodic checkpoints, 0 to only checkpoint when interrupted
+    bool resume;                    // Continue the attack saved in the checkpoint file
+    // Distributed attack
+    store_link_t *links;            // Connections of the walkers of a worker to the store server, NULL if the memory is local
+    uint16_t STORE_BATCH;           // Triples sent at a time by each walker of a worker, at most STORE_MAX_BATCH
+    int store_fd;                   // Listening socket of a store server, -1 if none
+    uint16_t store_port;
     // Statistics
     bool collect_vow_stats;     
     bool success;
@@ -31,18 +150,42 @@ typedef struct
     uint32_t collisions;
     uint32_t mem_collisions;
     uint32_t dist_points;
+    uint32_t dist_cols;             // Distinct collisions located, only counted when collecting stats
+    uint64_t *collision_set;        // Hashes of these collisions (open addressing), allocated by vOW() when collecting stats
+    uint64_t collision_set_size;
     double final_avg_random_functions;
     uint32_t number_steps_collect;  // Counts function evaluations for collecting distinguished points
     uint32_t number_steps_locate;   // Counts function evaluations during collision locating
     uint32_t number_steps;          // Total count, the sum of the above
+    uint32_t queued_collisions;     // Collisions queued by the walkers
+    uint32_t located_queued;        // Queued collisions located before the attack stopped
+    uint32_t located_inline;        // Collisions located by walkers that found the locate queue full
+    uint32_t max_queue_depth;       // Largest depth of the locate queue after queueing a collision
+    uint64_t sum_queue_depth;       // Sum of these depths, for the average
+    double sum_locate_latency;      // Seconds from queueing a collision until it was located, summed over located_queued
+    double max_locate_latency;
+    uint32_t store_workers;         // Walkers that connected to the store server
+    uint32_t store_batches;         // Batches of triples received by the store server
+    uint32_t store_dropped;         // Triples dropped by the store server, found with an older function version
+    uint32_t store_collisions;      // Triples the store server found in memory and returned to their walker
 } shared_state_t;
 
 typedef struct
 {
     int thread_id;
+    // Memory parameters (copied from the shared state)
+    uint64_t MEMORY_SIZE;
+    unsigned int MEMORY_LOG_SIZE;
+    uint64_t DIST_BOUND;
+    uint32_t TRAIL_INTERVAL;
+    uint32_t TRAIL_POINTS;
+    uint16_t LOCATE_THREADS;
     // State
-    trip_t current;
-    uint32_t current_dist;
+    trip_t current;                 // Walk being checked for distinguishedness
+    trip_t walks[MAX_WALKS];        // Walks advanced in lockstep, one random function step at a time
+    unsigned int n_walks;
+    trail_t trails[MAX_WALKS];      // Trail checkpoints of the walks
+    uint64_t current_dist;
     uint32_t function_version;
     uint32_t random_functions;
     // Prng
@@ -58,16 +201,64 @@ typedef struct
     uint32_t number_steps_locate;   // Counts function evaluations during collision locating
     // Storage
     trip_t trip;
+    trail_t trail;
+    st_t collision[2];              // States of the trails that reach the same point, for the last collision located
 } private_state_t;
 
+// Costs of the isogeny strategy model, in cycles per walk (see optimal_strategy())
+typedef struct
+{
+    double dbl4;                    // Multiplication of a kernel point by 4
+    double eval4;                   // Evaluation of a 4-isogeny at a saved kernel point
+    double other;                   // Rest of a random function step (ladder, 4-isogenies, j-invariant, hash), < 0 if unknown
+} isogeny_costs_t;
+
 
 // Initialization functions
+bool init_shared_memory(shared_state_t *S, unsigned int memory_log_size);
+bool init_shared_memory_file(shared_state_t *S, unsigned int memory_log_size, uint16_t cores, const char *path);
+bool resume_shared_memory(shared_state_t *S, const char *path);
+bool init_trail_memory(shared_state_t *S, uint32_t interval);
+void free_shared_memory(shared_state_t *S);
 void init_stats(shared_state_t *S);
 void init_private_state(shared_state_t *S, private_state_t *private_state);
 
+// Functions for accessing memory
+bool read_from_memory(trip_t *t, shared_state_t *S, digit_t address, uint32_t function_version);
+bool write_to_memory(trip_t *t, shared_state_t *S, digit_t address, uint32_t function_version);
+bool read_trail_from_memory(trail_t *trail, const trip_t *t, shared_state_t *S, digit_t address, uint32_t function_version);
+void write_trail_to_memory(const trail_t *trail, const trip_t *t, shared_state_t *S, digit_t address, uint32_t function_version);
+
 // Functions for vOW
 bool vOW(shared_state_t *S);
 bool DistinguishedSIDH(private_state_t *private_state);
 void SampleSIDH(private_state_t *private_state);
+void SampleWalksSIDH(private_state_t *private_state);
 void UpdateSIDH(private_state_t *private_state);
-bool BacktrackSIDH(trip_t *c0, trip_t *c1, private_state_t *private_state);
\ No newline at end of file
+bool BacktrackSIDH(trip_t *c0, trip_t *c1, const trail_t *trail0, const trail_t *trail1, private_state_t *private_state);
+void KernelPointSIDH(point_proj_t R, const st_t s);
+void CodomainSIDH(f2elm_t jinv, point_proj_t R, const st_t s);
+void GetIsogenySIDH(f2elm_t jinv, const st_t s);
+void StepSIDH(unsigned char jinvariant[FP2_ENCODED_BYTES], st_t r, const st_t s, uint32_t function_version);
+
+// Functions for the distributed attack
+bool listen_store(shared_state_t *S, unsigned int port);
+bool vOW_serve(shared_state_t *S);
+bool connect_store(shared_state_t *S, const char *host, unsigned int port, uint16_t batch);
+bool store_poll(shared_state_t *S, private_state_t *private_state, bool *success);
+bool store_point(shared_state_t *S, private_state_t *private_state, bool *success);
+bool store_finish(shared_state_t *S);
+
+// Functions for instance files
+bool check_strategy(const unsigned int *strat, const unsigned int lenstrat);
+bool save_instance(const char *path, const instance_t *inst, const f2elm_t64 *table_es, const f2elm_t64 *table_ee);
+bool load_instance(const char *path);
+bool IsGoldenPairSIDH(const st_t s0, const st_t s1);
+
+// Functions for isogeny strategies
+void strategy_counts(const unsigned int *strat, const unsigned int lenstrat, unsigned int *mults, unsigned int *evals);
+double optimal_strategy(unsigned int *strat, const unsigned int lenstrat, const isogeny_costs_t *costs);
+bool strategy_preserves_function(const unsigned int *strat, const unsigned int samples);
+double measure_step_cycles(const unsigned int n_walks, const unsigned int steps);
+bool measure_isogeny_costs(isogeny_costs_t *costs, const unsigned int n_walks, const unsigned int steps);
+bool read_isogeny_costs(const char *path, isogeny_costs_t *costs);
\ No newline at end of file
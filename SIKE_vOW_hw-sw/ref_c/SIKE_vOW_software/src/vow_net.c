@@ -0,0 +1,714 @@
+/********************************************************************************************
+* Implementation of the von Oorschot-Wiener (vOW) algorithm on SIKE
+* Based on the SIDH and vOW4SIKE libraries
+*
+* Abstract: distributed vOW, with a store server owning the memory and worker processes running the walkers
+*********************************************************************************************/
+
+#if !defined(HRDW) && (OS_TARGET == OS_LINUX)
+#include <errno.h>
+#include <netdb.h>
+#include <poll.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+// Messages are a header of two 32-bit words, the type and the length of the payload in bytes, followed by the payload.
+// All fields are little-endian, and states are sent as 64-bit words.
+//   Worker to server: STORE_HELLO (instance), then STORE_POINTS (distinguished triples), STORE_LOCATED (states of a located
+//                     collision, sent for the golden collision and, when collecting stats, for all collisions) and STORE_STATS
+//                     (steps and collisions of the worker, once it stopped)
+//   Server to worker: STORE_WELCOME (worker ID, memory size, function version and mode), then STORE_RESULTS (one result per
+//                     triple of a STORE_POINTS message, in order) and the broadcasts STORE_VERSION (new function version) and
+//                     STORE_STOP (end of the attack, and whether the golden collision was found)
+// A walker sends a batch and waits for its results, so the server only has to buffer one message per connection.
+#define STORE_MAGIC            "vOWstore"
+#define STORE_FORMAT           1
+
+#define STORE_HELLO            1
+#define STORE_WELCOME          2
+#define STORE_POINTS           3
+#define STORE_RESULTS          4
+#define STORE_LOCATED          5
+#define STORE_STATS            6
+#define STORE_VERSION          7
+#define STORE_STOP             8
+
+#define STORE_HELLO_BYTES      40   // Magic, format, MODULUS (12 bytes), e, NBITS_STATE and fingerprint (see store_fingerprint())
+#define STORE_WELCOME_BYTES    16   // Worker ID, MEMORY_LOG_SIZE, function version and stats mode
+#define STORE_POINT_BYTES      24   // current_state, initial_state, current_steps and function version
+#define STORE_RESULT_BYTES     16   // Result, and current_steps and initial_state of the triple in memory for STORE_COLLISION
+#define STORE_LOCATED_BYTES    16   // Both states of the collision
+#define STORE_STATS_BYTES      12   // number_steps_collect, number_steps_locate and collisions
+
+// Results of a triple
+#define STORE_NEW              0    // Not in memory (empty slot or another point at its address): stored
+#define STORE_COLLISION        1    // Same point in memory, whose triple is returned: stored in its place
+#define STORE_DROPPED          2    // Found with an older function version, after the attack stopped or not distinguished
+
+#define STORE_CONNECT_TRIES    50   // Attempts to reach the server, so that workers can be started along with it
+#define STORE_CONNECT_WAIT     100000   // Microseconds between attempts
+#define STORE_POLL_TIMEOUT     200  // Milliseconds between checks for Ctrl+C by the server
+
+static bool set_memory_parameters(shared_state_t *S, unsigned int memory_log_size);
+
+
+static inline void put_u32(unsigned char *p, uint32_t x)
+{
+    for (unsigned int i = 0; i < 4; i++)
+        p[i] = (unsigned char)(x >> (8*i));
+}
+
+static inline void put_u64(unsigned char *p, uint64_t x)
+{
+    for (unsigned int i = 0; i < 8; i++)
+        p[i] = (unsigned char)(x >> (8*i));
+}
+
+static inline uint32_t get_u32(const unsigned char *p)
+{
+    uint32_t x = 0;
+
+    for (unsigned int i = 0; i < 4; i++)
+        x |= (uint32_t)p[i] << (8*i);
+    return x;
+}
+
+static inline uint64_t get_u64(const unsigned char *p)
+{
+    uint64_t x = 0;
+
+    for (unsigned int i = 0; i < 8; i++)
+        x |= (uint64_t)p[i] << (8*i);
+    return x;
+}
+
+static bool send_all(int fd, const unsigned char *buffer, size_t length)
+{
+    ssize_t n;
+
+    while (length > 0) {
+        n = send(fd, buffer, length, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        buffer += n;
+        length -= (size_t)n;
+    }
+    return true;
+}
+
+static bool recv_all(int fd, unsigned char *buffer, size_t length)
+{
+    ssize_t n;
+
+    while (length > 0) {
+        n = recv(fd, buffer, length, 0);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        buffer += n;
+        length -= (size_t)n;
+    }
+    return true;
+}
+
+static bool send_message(int fd, unsigned char *message, uint32_t type, uint32_t length)
+{ // Sends a message whose payload of the given length follows the header in message
+    put_u32(message, type);
+    put_u32(message + 4, length);
+    return send_all(fd, message, 8 + (size_t)length);
+}
+
+static bool recv_message(int fd, unsigned char *message, uint32_t *type, uint32_t *length)
+{ // Receives a message of at most STORE_MESSAGE_BYTES, with its payload after the header in message
+    if (!recv_all(fd, message, 8))
+        return false;
+    *type = get_u32(message);
+    *length = get_u32(message + 4);
+    return (*length <= STORE_MESSAGE_BYTES - 8 && recv_all(fd, message + 8, *length));
+}
+
+static uint64_t store_fingerprint(void)
+{ // XOF of the golden j-invariant, which differs between instances and between XOFs (and so between random functions)
+    unsigned char out[8];
+
+    XOF(out, (unsigned char *)insts_constants.jinv, sizeof(out), sizeof(insts_constants.jinv), (unsigned long)insts_constants.PRNG_SEED);
+    return get_u64(out);
+}
+
+static void put_hello(unsigned char *p)
+{
+    memset(p, 0, STORE_HELLO_BYTES);
+    memcpy(p, STORE_MAGIC, 8);
+    put_u32(p + 8, STORE_FORMAT);
+    memcpy(p + 12, insts_constants.MODULUS, sizeof(insts_constants.MODULUS));
+    put_u32(p + 24, insts_constants.e);
+    put_u32(p + 28, insts_constants.NBITS_STATE);
+    put_u64(p + 32, store_fingerprint());
+}
+
+static void close_store(shared_state_t *S)
+{ // Closes the connections of a worker or the listening socket of a store server
+    if (S->links != NULL) {
+        for (unsigned int i = 0; i < S->N_OF_CORES; i++) {
+            if (S->links[i].fd >= 0)
+                close(S->links[i].fd);
+        }
+        free(S->links);
+        S->links = NULL;
+    }
+    if (S->store_fd >= 0) {
+        close(S->store_fd);
+        S->store_fd = -1;
+    }
+}
+
+
+// Functions for the workers
+
+static int connect_to(const char *host, unsigned int port)
+{ // Opens a TCP connection to host:port, retrying for a while if the server is not up yet
+    struct addrinfo hints, *addrs, *a;
+    char service[8];
+    int fd = -1, one = 1;
+
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    snprintf(service, sizeof(service), "%u", port);
+    if (getaddrinfo(host, service, &hints, &addrs) != 0)
+        return -1;
+    for (unsigned int tries = 0; fd < 0 && tries < STORE_CONNECT_TRIES; tries++) {
+        if (tries > 0)
+            usleep(STORE_CONNECT_WAIT);
+        for (a = addrs; a != NULL; a = a->ai_next) {
+            fd = socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+            if (fd < 0)
+                continue;
+            if (connect(fd, a->ai_addr, a->ai_addrlen) == 0)
+                break;
+            close(fd);
+            fd = -1;
+        }
+    }
+    freeaddrinfo(addrs);
+    if (fd >= 0)
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));  // Walkers wait for the results of each batch
+    return fd;
+}
+
+bool connect_store(shared_state_t *S, const char *host, unsigned int port, uint16_t batch)
+{ // Connects each of the S->N_OF_CORES walkers of a worker to the store server at host:port, and takes the memory size, function
+  // version and mode of the attack from the server. The walkers send their triples batch at a time, 1 <= batch <= STORE_MAX_BATCH
+  // Returns false if the server cannot be reached or turns the worker away (e.g., if it runs another instance or XOF)
+    uint16_t cores = (S->N_OF_CORES == 0) ? 1 : S->N_OF_CORES;
+    uint32_t type, length, memory_log_size = 0, function_version = 0;
+    bool collect_vow_stats = false;
+    store_link_t *links;
+    unsigned int i;
+
+    if (batch == 0 || batch > STORE_MAX_BATCH || port == 0 || port > UINT16_MAX)
+        return false;
+    links = (store_link_t *)calloc(cores, sizeof(store_link_t));
+    if (links == NULL)
+        return false;
+    for (i = 0; i < cores; i++)
+        links[i].fd = -1;
+
+    for (i = 0; i < cores; i++) {
+        links[i].fd = connect_to(host, port);
+        if (links[i].fd < 0)
+            goto fail;
+        put_hello(links[i].message + 8);
+        if (!send_message(links[i].fd, links[i].message, STORE_HELLO, STORE_HELLO_BYTES) ||
+            !recv_message(links[i].fd, links[i].message, &type, &length) || type != STORE_WELCOME || length != STORE_WELCOME_BYTES)
+            goto fail;
+        links[i].worker_id = get_u32(links[i].message + 8);
+        memory_log_size = get_u32(links[i].message + 12);
+        if (get_u32(links[i].message + 16) > function_version)  // The server may move on while the walkers connect
+            function_version = get_u32(links[i].message + 16);
+        collect_vow_stats = (get_u32(links[i].message + 20) != 0);
+    }
+    if (!set_memory_parameters(S, memory_log_size))
+        goto fail;
+
+    S->links = links;
+    S->STORE_BATCH = batch;
+    S->N_OF_CORES = cores;
+    S->function_version = function_version;
+    S->current_dist = 0;
+    S->collect_vow_stats = collect_vow_stats;
+    return true;
+
+fail:
+    for (i = 0; i < cores; i++) {
+        if (links[i].fd >= 0)
+            close(links[i].fd);
+    }
+    free(links);
+    return false;
+}
+
+static bool store_lost(const private_state_t *private_state)
+{ // The connection of a walker to the store server failed: the worker stops
+    printf("\n%d: lost the connection to the store server", private_state->thread_id);
+    return true;
+}
+
+static void move_function_version(shared_state_t *S, uint32_t function_version)
+{ // Passes a function version broadcast by the store server on to all walkers of the worker (see vOW_one_iteration())
+#pragma omp critical(vow_function_version)
+    {
+        if (function_version > S->function_version) {
+#pragma omp atomic write
+            S->function_version = function_version;
+        }
+    }
+}
+
+static bool take_broadcast(shared_state_t *S, const unsigned char *message, uint32_t type, uint32_t length, bool *stop, bool *golden)
+{ // Handles a STORE_VERSION or STORE_STOP broadcast of the store server. Returns false for any other message
+    if (type == STORE_VERSION && length == 4) {
+        move_function_version(S, get_u32(message + 8));
+    } else if (type == STORE_STOP && length == 4) {
+        *stop = true;
+        *golden = (get_u32(message + 8) != 0);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool store_poll(shared_state_t *S, private_state_t *private_state, bool *success)
+{ // Takes the broadcasts that the store server sent to a walker since it last heard from it, without waiting, so that the walker
+  // moves on to a new function version or stops with its next step rather than with its next batch. Returns true if the attack is over
+    store_link_t *link = &S->links[private_state->thread_id];
+    struct pollfd pfd = {link->fd, POLLIN, 0};
+    uint32_t type, length;
+    bool stop = false, golden = false;
+
+    // No results are pending between batches, so only broadcasts can come
+    while (!stop && poll(&pfd, 1, 0) > 0) {
+        if (!recv_message(link->fd, link->message, &type, &length) || !take_broadcast(S, link->message, type, length, &stop, &golden))
+            return store_lost(private_state);
+    }
+    if (golden) {
+#pragma omp atomic write
+        *success = true;
+    }
+    return stop;
+}
+
+static bool send_points(shared_state_t *S, private_state_t *private_state, store_link_t *link, bool *success)
+{ // Sends the queued triples of a walker to the store server and locates the collisions in its results. The broadcasts received
+  // meanwhile are passed on to the other walkers of the worker. Returns true if the attack is over
+    unsigned char *message = link->message, *p, located[8 + STORE_LOCATED_BYTES];
+    uint32_t type, length, n = link->pending, status, collisions, i;
+    bool stop = false, golden = false;
+    trip_t stored;
+
+    link->pending = 0;
+    for (i = 0, p = message + 8; i < n; i++, p += STORE_POINT_BYTES) {
+        put_u64(p, (uint64_t)link->batch[i].current_state[0]);
+        put_u64(p + 8, (uint64_t)link->batch[i].initial_state[0]);
+        put_u32(p + 16, link->batch[i].current_steps);
+        put_u32(p + 20, link->versions[i]);
+    }
+    if (!send_message(link->fd, message, STORE_POINTS, n * STORE_POINT_BYTES))
+        return store_lost(private_state);
+
+    // Broadcasts can come before the results
+    while (true) {
+        if (!recv_message(link->fd, message, &type, &length))
+            return store_lost(private_state);
+        if (type == STORE_RESULTS && length == n * STORE_RESULT_BYTES)
+            break;
+        if (!take_broadcast(S, message, type, length, &stop, &golden))
+            return store_lost(private_state);
+    }
+    if (stop) {
+        if (golden) {
+#pragma omp atomic write
+            *success = true;
+        }
+        return true;
+    }
+
+    for (i = 0, p = message + 8; i < n; i++, p += STORE_RESULT_BYTES) {
+        status = get_u32(p);
+        if (status == STORE_NEW)
+            private_state->mem_collisions += 1;
+        // A collision is always for the current function version, since the server drops the triples of older ones
+        if (status != STORE_COLLISION || link->versions[i] != private_state->function_version)
+            continue;
+
+        // Not a simple memory collision, backtrack!
+        copy_st(stored.current_state, link->batch[i].current_state);
+        stored.current_steps = get_u32(p + 4);
+        stored.initial_state[0] = (digit_t)get_u64(p + 8);
+        collisions = private_state->collisions;
+        PROFILE_BEGIN(PROFILE_BACKTRACK);
+        golden = BacktrackSIDH(&stored, &link->batch[i], NULL, NULL, private_state);
+        PROFILE_END(PROFILE_BACKTRACK);
+        if (private_state->collisions == collisions)
+            continue;  // Robin Hood
+        if (S->collision_set != NULL)
+            record_distinct_collision(S, private_state->collision[0], private_state->collision[1]);
+
+        // The server checks the golden collision before stopping the attack, and counts the distinct collisions of all workers
+        if (golden || private_state->collect_vow_stats) {
+            put_u64(located + 8, (uint64_t)private_state->collision[0][0]);
+            put_u64(located + 16, (uint64_t)private_state->collision[1][0]);
+            if (!send_message(link->fd, located, STORE_LOCATED, STORE_LOCATED_BYTES))
+                return store_lost(private_state);
+        }
+        // Only check for success when not running for stats
+        if (!private_state->collect_vow_stats && golden) {
+#pragma omp atomic write
+            *success = true;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool store_point(shared_state_t *S, private_state_t *private_state, bool *success)
+{ // Queues the distinguished triple private_state->current of a walker for the store server, and sends the queue once it holds
+  // S->STORE_BATCH triples. Returns true if the attack is over: the server stopped it or the walker located the golden collision
+    store_link_t *link = &S->links[private_state->thread_id];
+
+    copy_trip(&link->batch[link->pending], &private_state->current);
+    link->versions[link->pending++] = private_state->function_version;
+    if (link->pending < S->STORE_BATCH)
+        return false;
+    return send_points(S, private_state, link, success);
+}
+
+bool store_finish(shared_state_t *S)
+{ // Reports the steps and collisions of a worker that stopped to the store server, over the connection of its first walker
+  // Returns false if the connection failed
+    unsigned char *message = S->links[0].message;
+
+    put_u32(message + 8, S->number_steps_collect);
+    put_u32(message + 12, S->number_steps_locate);
+    put_u32(message + 16, S->collisions);
+    return send_message(S->links[0].fd, message, STORE_STATS, STORE_STATS_BYTES);
+}
+
+
+// Functions for the store server
+
+typedef struct
+{
+    int fd;
+    uint32_t worker_id;             // 0 until the worker said hello
+    uint32_t fill;                  // Bytes of message received so far
+    unsigned char message[STORE_MESSAGE_BYTES];
+} store_client_t;
+
+typedef struct
+{
+    store_client_t *clients;
+    unsigned int n_clients;
+    unsigned int capacity;
+    bool stopped;
+    unsigned char reply[STORE_MESSAGE_BYTES];
+} store_server_t;
+
+bool listen_store(shared_state_t *S, unsigned int port)
+{ // Opens the listening socket of a store server on the given TCP port, or on a free port if port is 0, and sets S->store_port
+  // to it. To be called after the memory is initialized. Returns false if the port cannot be used
+    struct sockaddr_in address;
+    socklen_t size = sizeof(address);
+    int one = 1;
+
+    if (port > UINT16_MAX)
+        return false;
+    S->store_fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (S->store_fd < 0)
+        return false;
+    setsockopt(S->store_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons((uint16_t)port);
+    if (bind(S->store_fd, (struct sockaddr *)&address, sizeof(address)) != 0 || listen(S->store_fd, 64) != 0 ||
+        getsockname(S->store_fd, (struct sockaddr *)&address, &size) != 0) {
+        close(S->store_fd);
+        S->store_fd = -1;
+        return false;
+    }
+    S->store_port = ntohs(address.sin_port);
+    return true;
+}
+
+static void broadcast(store_server_t *server, uint32_t type, uint32_t value)
+{ // Sends a message with a 32-bit payload to all workers. A worker that cannot be reached is dropped when its connection is read
+    unsigned char message[12];
+
+    put_u32(message + 8, value);
+    for (unsigned int i = 0; i < server->n_clients; i++) {
+        if (server->clients[i].worker_id != 0)
+            send_message(server->clients[i].fd, message, type, 4);
+    }
+}
+
+static void stop_attack(shared_state_t *S, store_server_t *server, bool success)
+{
+    server->stopped = true;
+    S->success = success;
+    broadcast(server, STORE_STOP, success ? 1 : 0);
+}
+
+static void next_function_version(shared_state_t *S, store_server_t *server)
+{ // Enough points were mined for the current random function: moves all workers to the next one, or stops the attack after
+  // one function version when collecting stats or after the last one
+    if (S->collect_vow_stats || S->function_version >= insts_constants.MAX_FUNCTION_VERSIONS) {
+        stop_attack(S, server, false);
+        return;
+    }
+    S->function_version++;
+    S->current_dist = 0;
+    broadcast(server, STORE_VERSION, S->function_version);
+}
+
+static uint32_t serve_point(shared_state_t *S, store_server_t *server, trip_t *t, uint32_t function_version, trip_t *stored)
+{ // Checks a triple sent by a walker against the memory and stores it, as vOW_one_iteration() does for the walkers of vOW()
+    unsigned int log_dist = insts_constants.NBITS_STATE - S->MEMORY_LOG_SIZE;
+    digit_t address;
+    uint64_t val;
+    uint32_t status;
+
+    // Distinguisher value, as computed in DistinguishedSIDH(). The packed triple only has room for distinguished points
+    val = ((uint64_t)t->current_state[0] >> S->MEMORY_LOG_SIZE) + (uint64_t)function_version * S->DIST_BOUND;
+    val &= low_mask(log_dist);
+    if (server->stopped || function_version != S->function_version || val > S->DIST_BOUND ||
+        t->current_steps == 0 || t->current_steps > S->MAX_STEPS) {
+        S->store_dropped++;
+        return STORE_DROPPED;
+    }
+    S->dist_points++;
+
+    address = (digit_t)(((uint64_t)t->current_state[0] + function_version) & (S->MEMORY_SIZE - 1));  // As MemIndexSIDH()
+    if (read_from_memory(stored, S, address, function_version) && is_equal_st(stored->current_state, t->current_state)) {
+        S->store_collisions++;
+        status = STORE_COLLISION;
+    } else {
+        S->mem_collisions++;
+        status = STORE_NEW;
+    }
+    write_to_memory(t, S, address, function_version);
+
+    if (++S->current_dist >= S->MAX_DIST)
+        next_function_version(S, server);
+    return status;
+}
+
+static bool serve_message(shared_state_t *S, store_server_t *server, store_client_t *client, uint32_t type, const unsigned char *payload, uint32_t length)
+{ // Handles a message of a worker. Returns false if the worker is turned away or broke the protocol
+    uint64_t mask = low_mask(insts_constants.NBITS_STATE);
+    unsigned char *reply = server->reply, *p;
+    unsigned char hello[STORE_HELLO_BYTES];
+    st_t c0, c1;
+    trip_t t, stored;
+    uint32_t n, i;
+
+    if (type == STORE_HELLO) {
+        put_hello(hello);
+        if (client->worker_id != 0 || length != STORE_HELLO_BYTES || memcmp(payload, hello, STORE_HELLO_BYTES) != 0) {
+            printf("\n  Turned away a worker built for another instance or XOF\n");
+            return false;
+        }
+        client->worker_id = ++S->store_workers;
+        put_u32(reply + 8, client->worker_id);
+        put_u32(reply + 12, S->MEMORY_LOG_SIZE);
+        put_u32(reply + 16, S->function_version);
+        put_u32(reply + 20, S->collect_vow_stats ? 1 : 0);
+        if (!send_message(client->fd, reply, STORE_WELCOME, STORE_WELCOME_BYTES))
+            return false;
+        if (server->stopped) {
+            put_u32(reply + 8, S->success ? 1 : 0);
+            return send_message(client->fd, reply, STORE_STOP, 4);
+        }
+        return true;
+    }
+    if (client->worker_id == 0)
+        return false;
+
+    switch (type) {
+    case STORE_POINTS:
+        n = length / STORE_POINT_BYTES;
+        if (length != n * STORE_POINT_BYTES || n > STORE_MAX_BATCH)
+            return false;
+        S->store_batches++;
+        memset(reply + 8, 0, (size_t)n * STORE_RESULT_BYTES);
+        for (i = 0, p = reply + 8; i < n; i++, p += STORE_RESULT_BYTES) {
+            t.current_state[0] = (digit_t)(get_u64(payload + i*STORE_POINT_BYTES) & mask);
+            t.initial_state[0] = (digit_t)(get_u64(payload + i*STORE_POINT_BYTES + 8) & mask);
+            t.current_steps = get_u32(payload + i*STORE_POINT_BYTES + 16);
+            put_u32(p, serve_point(S, server, &t, get_u32(payload + i*STORE_POINT_BYTES + 20), &stored));
+            if (get_u32(p) == STORE_COLLISION) {
+                put_u32(p + 4, stored.current_steps);
+                put_u64(p + 8, (uint64_t)stored.initial_state[0]);
+            }
+        }
+        return send_message(client->fd, reply, STORE_RESULTS, n * STORE_RESULT_BYTES);
+    case STORE_LOCATED:
+        if (length != STORE_LOCATED_BYTES)
+            return false;
+        c0[0] = (digit_t)(get_u64(payload) & mask);
+        c1[0] = (digit_t)(get_u64(payload + 8) & mask);
+        if (S->collision_set != NULL)
+            record_distinct_collision(S, c0, c1);
+        // Only check for success when not running for stats
+        if (!S->collect_vow_stats && !server->stopped && (IsGoldenPairSIDH(c0, c1) || IsGoldenPairSIDH(c1, c0)))
+            stop_attack(S, server, true);
+        return true;
+    case STORE_STATS:
+        if (length != STORE_STATS_BYTES)
+            return false;
+        S->number_steps_collect += get_u32(payload);
+        S->number_steps_locate += get_u32(payload + 4);
+        S->collisions += get_u32(payload + 8);
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool read_client(shared_state_t *S, store_server_t *server, store_client_t *client)
+{ // Reads what a worker sent and handles its complete messages. Returns false if the worker disconnected or is dropped
+    uint32_t type, length;
+    ssize_t n;
+
+    n = recv(client->fd, client->message + client->fill, STORE_MESSAGE_BYTES - client->fill, MSG_DONTWAIT);
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+        return true;
+    if (n <= 0)
+        return false;
+    client->fill += (uint32_t)n;
+
+    while (client->fill >= 8) {
+        type = get_u32(client->message);
+        length = get_u32(client->message + 4);
+        if (length > STORE_MESSAGE_BYTES - 8)
+            return false;
+        if (client->fill < 8 + length)
+            break;
+        if (!serve_message(S, server, client, type, client->message + 8, length))
+            return false;
+        client->fill -= 8 + length;
+        memmove(client->message, client->message + 8 + length, client->fill);
+    }
+    return true;
+}
+
+static bool accept_client(shared_state_t *S, store_server_t *server)
+{ // Accepts the connection of a walker. Returns false if it cannot be accepted
+    store_client_t *clients;
+    int fd, one = 1;
+
+    fd = accept(S->store_fd, NULL, NULL);
+    if (fd < 0)
+        return false;
+    if (server->n_clients == server->capacity) {
+        clients = (store_client_t *)realloc(server->clients, (2*server->capacity + 8) * sizeof(store_client_t));
+        if (clients == NULL) {
+            close(fd);
+            return false;
+        }
+        server->clients = clients;
+        server->capacity = 2*server->capacity + 8;
+    }
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    server->clients[server->n_clients].fd = fd;
+    server->clients[server->n_clients].worker_id = 0;
+    server->clients[server->n_clients].fill = 0;
+    server->n_clients++;
+    return true;
+}
+
+bool vOW_serve(shared_state_t *S)
+{ // Store server of a distributed attack, on the socket opened by listen_store(). It keeps the memory, checks the triples sent by the
+  // walkers of the workers against it and returns the collisions, moves all walkers to the next function version after S->MAX_DIST
+  // points and stops them once one locates the golden collision (or after one function version when collecting stats)
+  // Returns when the attack stopped and all workers disconnected, with S->success and the totals of the attack in S
+    store_server_t *server;
+    struct pollfd *fds = NULL, *grown;
+    unsigned int i, j, n_fds = 0;
+    double start_wall_time = wall_clock();
+    int ready;
+
+    if (S->store_fd < 0 || S->memory == NULL)
+        return false;
+    server = (store_server_t *)calloc(1, sizeof(store_server_t));
+    if (server == NULL)
+        return false;
+    S->function_version = 1;
+    S->current_dist = 0;
+    S->success = false;
+    if (S->collect_vow_stats) {
+        // Distinct collisions of the single function version, located by all workers
+        S->collision_set_size = 4 * S->MEMORY_SIZE;
+        S->collision_set = (uint64_t *)calloc((size_t)S->collision_set_size, sizeof(uint64_t));
+        if (S->collision_set == NULL)
+            S->collision_set_size = 0;
+    }
+    // Set a Ctrl+C handler to stop all workers
+    signal(SIGINT, sigintHandler);
+
+    while (!server->stopped || server->n_clients > 0) {
+        if (ctrl_c_pressed && !server->stopped)
+            stop_attack(S, server, false);
+        if (n_fds < server->n_clients + 1) {
+            grown = (struct pollfd *)realloc(fds, (server->n_clients + 1) * sizeof(struct pollfd));
+            if (grown == NULL)
+                break;
+            fds = grown;
+            n_fds = server->n_clients + 1;
+        }
+        fds[0].fd = S->store_fd;
+        fds[0].events = POLLIN;
+        for (i = 0; i < server->n_clients; i++) {
+            fds[i + 1].fd = server->clients[i].fd;
+            fds[i + 1].events = POLLIN;
+        }
+        ready = poll(fds, server->n_clients + 1, STORE_POLL_TIMEOUT);
+        if (ready < 0 && errno != EINTR)
+            break;
+        if (ready <= 0)
+            continue;
+
+        // Drop the workers that disconnected, keeping the order of the others
+        for (i = 0, j = 0; i < server->n_clients; i++) {
+            if ((fds[i + 1].revents & (POLLIN | POLLHUP | POLLERR)) && !read_client(S, server, &server->clients[i])) {
+                close(server->clients[i].fd);
+                continue;
+            }
+            if (j != i)
+                server->clients[j] = server->clients[i];
+            j++;
+        }
+        server->n_clients = j;
+        if (fds[0].revents & POLLIN)
+            accept_client(S, server);
+    }
+
+    for (i = 0; i < server->n_clients; i++)
+        close(server->clients[i].fd);
+    free(server->clients);
+    free(server);
+    free(fds);
+    free(S->collision_set);
+    S->collision_set = NULL;
+    ctrl_c_pressed = false;
+    S->number_steps = S->number_steps_collect + S->number_steps_locate;
+    S->final_avg_random_functions = (double)S->function_version;
+    S->wall_time = wall_clock() - start_wall_time;
+    return S->success;
+}
+
+#endif
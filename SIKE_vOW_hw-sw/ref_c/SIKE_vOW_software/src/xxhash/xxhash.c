@@ -1027,4 +1027,404 @@ XXH_PUBLIC_API XXH64_hash_t XXH64_hashFromCanonical(const XXH64_canonical_t* src
     return XXH_readBE64(src);
 }
 
+
+/* *******************************************************************
+*  XXH3 (scalar port of the one-shot functions of xxHash v0.8.2)
+*********************************************************************/
+
+#define XXH3_SECRET_SIZE_MIN       136
+#define XXH3_SECRET_DEFAULT_SIZE   192
+#define XXH3_MIDSIZE_MAX           240
+#define XXH3_MIDSIZE_STARTOFFSET   3
+#define XXH3_MIDSIZE_LASTOFFSET    17
+#define XXH3_STRIPE_LEN            64
+#define XXH3_SECRET_CONSUME_RATE   8
+#define XXH3_ACC_NB                8
+#define XXH3_SECRET_LASTACC_START  7
+#define XXH3_SECRET_MERGEACCS_START 11
+
+/* Pseudorandom secret taken directly from FARSH */
+static const BYTE XXH3_kSecret[XXH3_SECRET_DEFAULT_SIZE] = {
+    0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+    0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+    0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+    0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+    0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+    0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+    0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+    0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+    0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+    0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+    0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+    0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+};
+
+static const U64 PRIME_MX1 = 0x165667919E3779F9ULL;
+static const U64 PRIME_MX2 = 0x9FB21C651E98DF25ULL;
+
+static U32 XXH3_readLE32(const void* ptr)
+{
+    return XXH_CPU_LITTLE_ENDIAN ? XXH_read32(ptr) : XXH_swap32(XXH_read32(ptr));
+}
+
+static U64 XXH3_readLE64(const void* ptr)
+{
+    return XXH_CPU_LITTLE_ENDIAN ? XXH_read64(ptr) : XXH_swap64(XXH_read64(ptr));
+}
+
+static void XXH3_writeLE64(void* dst, U64 v64)
+{
+    if (!XXH_CPU_LITTLE_ENDIAN) v64 = XXH_swap64(v64);
+    memcpy(dst, &v64, sizeof(v64));
+}
+
+static XXH128_hash_t XXH3_mult64to128(U64 lhs, U64 rhs)
+{
+    XXH128_hash_t r128;
+#if defined(__SIZEOF_INT128__)
+    __uint128_t const product = (__uint128_t)lhs * (__uint128_t)rhs;
+    r128.low64  = (U64)product;
+    r128.high64 = (U64)(product >> 64);
+#else
+    U64 const lo_lo = (U64)(U32)lhs * (U32)rhs;
+    U64 const hi_lo = (lhs >> 32) * (U32)rhs;
+    U64 const lo_hi = (U64)(U32)lhs * (rhs >> 32);
+    U64 const hi_hi = (lhs >> 32) * (rhs >> 32);
+    U64 const cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + lo_hi;
+    r128.low64  = (cross << 32) | (lo_lo & 0xFFFFFFFF);
+    r128.high64 = (hi_lo >> 32) + (cross >> 32) + hi_hi;
+#endif
+    return r128;
+}
+
+static U64 XXH3_mul128_fold64(U64 lhs, U64 rhs)
+{
+    XXH128_hash_t const product = XXH3_mult64to128(lhs, rhs);
+    return product.low64 ^ product.high64;
+}
+
+static U64 XXH3_avalanche(U64 h64)
+{
+    h64 ^= h64 >> 37;
+    h64 *= PRIME_MX1;
+    h64 ^= h64 >> 32;
+    return h64;
+}
+
+static U64 XXH3_rrmxmx(U64 h64, U64 len)
+{
+    h64 ^= XXH_rotl64(h64, 49) ^ XXH_rotl64(h64, 24);
+    h64 *= PRIME_MX2;
+    h64 ^= (h64 >> 35) + len;
+    h64 *= PRIME_MX2;
+    return h64 ^ (h64 >> 28);
+}
+
+static U64 XXH3_mix16B(const BYTE* input, const BYTE* secret, U64 seed64)
+{
+    U64 const input_lo = XXH3_readLE64(input);
+    U64 const input_hi = XXH3_readLE64(input + 8);
+    return XXH3_mul128_fold64(input_lo ^ (XXH3_readLE64(secret) + seed64),
+                              input_hi ^ (XXH3_readLE64(secret + 8) - seed64));
+}
+
+
+/*======   Short inputs, 64-bit   ======*/
+
+static U64 XXH3_len_0to16_64b(const BYTE* input, size_t len, const BYTE* secret, U64 seed)
+{
+    if (len > 8) {
+        U64 const bitflip1 = (XXH3_readLE64(secret + 24) ^ XXH3_readLE64(secret + 32)) + seed;
+        U64 const bitflip2 = (XXH3_readLE64(secret + 40) ^ XXH3_readLE64(secret + 48)) - seed;
+        U64 const input_lo = XXH3_readLE64(input) ^ bitflip1;
+        U64 const input_hi = XXH3_readLE64(input + len - 8) ^ bitflip2;
+        U64 const acc = len + XXH_swap64(input_lo) + input_hi + XXH3_mul128_fold64(input_lo, input_hi);
+        return XXH3_avalanche(acc);
+    }
+    if (len >= 4) {
+        U64 const seed2 = seed ^ ((U64)XXH_swap32((U32)seed) << 32);
+        U32 const input1 = XXH3_readLE32(input);
+        U32 const input2 = XXH3_readLE32(input + len - 4);
+        U64 const bitflip = (XXH3_readLE64(secret + 8) ^ XXH3_readLE64(secret + 16)) - seed2;
+        U64 const input64 = input2 + (((U64)input1) << 32);
+        return XXH3_rrmxmx(input64 ^ bitflip, len);
+    }
+    if (len) {
+        BYTE const c1 = input[0];
+        BYTE const c2 = input[len >> 1];
+        BYTE const c3 = input[len - 1];
+        U32 const combined = ((U32)c1 << 16) | ((U32)c2 << 24) | ((U32)c3 << 0) | ((U32)len << 8);
+        U64 const bitflip = (XXH3_readLE32(secret) ^ XXH3_readLE32(secret + 4)) + seed;
+        return XXH64_avalanche((U64)combined ^ bitflip);
+    }
+    return XXH64_avalanche(seed ^ (XXH3_readLE64(secret + 56) ^ XXH3_readLE64(secret + 64)));
+}
+
+static U64 XXH3_len_17to128_64b(const BYTE* input, size_t len, const BYTE* secret, U64 seed)
+{
+    U64 acc = len * PRIME64_1;
+
+    if (len > 32) {
+        if (len > 64) {
+            if (len > 96) {
+                acc += XXH3_mix16B(input + 48, secret + 96, seed);
+                acc += XXH3_mix16B(input + len - 64, secret + 112, seed);
+            }
+            acc += XXH3_mix16B(input + 32, secret + 64, seed);
+            acc += XXH3_mix16B(input + len - 48, secret + 80, seed);
+        }
+        acc += XXH3_mix16B(input + 16, secret + 32, seed);
+        acc += XXH3_mix16B(input + len - 32, secret + 48, seed);
+    }
+    acc += XXH3_mix16B(input + 0, secret + 0, seed);
+    acc += XXH3_mix16B(input + len - 16, secret + 16, seed);
+    return XXH3_avalanche(acc);
+}
+
+static U64 XXH3_len_129to240_64b(const BYTE* input, size_t len, const BYTE* secret, U64 seed)
+{
+    U64 acc = len * PRIME64_1, acc_end;
+    unsigned int const nbRounds = (unsigned int)len / 16;
+    unsigned int i;
+
+    for (i = 0; i < 8; i++)
+        acc += XXH3_mix16B(input + (16 * i), secret + (16 * i), seed);
+    acc_end = XXH3_mix16B(input + len - 16, secret + XXH3_SECRET_SIZE_MIN - XXH3_MIDSIZE_LASTOFFSET, seed);
+    acc = XXH3_avalanche(acc);
+    for (i = 8; i < nbRounds; i++)
+        acc_end += XXH3_mix16B(input + (16 * i), secret + (16 * (i - 8)) + XXH3_MIDSIZE_STARTOFFSET, seed);
+    return XXH3_avalanche(acc + acc_end);
+}
+
+
+/*======   Short inputs, 128-bit   ======*/
+
+static XXH128_hash_t XXH3_len_0to16_128b(const BYTE* input, size_t len, const BYTE* secret, U64 seed)
+{
+    XXH128_hash_t h128;
+
+    if (len > 8) {
+        U64 const bitflipl = (XXH3_readLE64(secret + 32) ^ XXH3_readLE64(secret + 40)) - seed;
+        U64 const bitfliph = (XXH3_readLE64(secret + 48) ^ XXH3_readLE64(secret + 56)) + seed;
+        U64 const input_lo = XXH3_readLE64(input);
+        U64 input_hi = XXH3_readLE64(input + len - 8);
+        XXH128_hash_t m128 = XXH3_mult64to128(input_lo ^ input_hi ^ bitflipl, PRIME64_1);
+
+        m128.low64 += (U64)(len - 1) << 54;
+        input_hi ^= bitfliph;
+        if (sizeof(void*) < sizeof(U64))  /* 32-bit */
+            m128.high64 += (input_hi & 0xFFFFFFFF00000000ULL) + (U64)(U32)input_hi * PRIME32_2;
+        else
+            m128.high64 += input_hi + (U64)(U32)input_hi * (PRIME32_2 - 1);
+        m128.low64 ^= XXH_swap64(m128.high64);
+        h128 = XXH3_mult64to128(m128.low64, PRIME64_2);
+        h128.high64 += m128.high64 * PRIME64_2;
+        h128.low64 = XXH3_avalanche(h128.low64);
+        h128.high64 = XXH3_avalanche(h128.high64);
+        return h128;
+    }
+    if (len >= 4) {
+        U64 const seed2 = seed ^ ((U64)XXH_swap32((U32)seed) << 32);
+        U32 const input_lo = XXH3_readLE32(input);
+        U32 const input_hi = XXH3_readLE32(input + len - 4);
+        U64 const input_64 = input_lo + ((U64)input_hi << 32);
+        U64 const bitflip = (XXH3_readLE64(secret + 16) ^ XXH3_readLE64(secret + 24)) + seed2;
+        XXH128_hash_t m128 = XXH3_mult64to128(input_64 ^ bitflip, PRIME64_1 + (len << 2));
+
+        m128.high64 += (m128.low64 << 1);
+        m128.low64 ^= (m128.high64 >> 3);
+        m128.low64 ^= m128.low64 >> 35;
+        m128.low64 *= PRIME_MX2;
+        m128.low64 ^= m128.low64 >> 28;
+        m128.high64 = XXH3_avalanche(m128.high64);
+        return m128;
+    }
+    if (len) {
+        BYTE const c1 = input[0];
+        BYTE const c2 = input[len >> 1];
+        BYTE const c3 = input[len - 1];
+        U32 const combinedl = ((U32)c1 << 16) | ((U32)c2 << 24) | ((U32)c3 << 0) | ((U32)len << 8);
+        U32 const combinedh = XXH_rotl32(XXH_swap32(combinedl), 13);
+        U64 const bitflipl = (XXH3_readLE32(secret) ^ XXH3_readLE32(secret + 4)) + seed;
+        U64 const bitfliph = (XXH3_readLE32(secret + 8) ^ XXH3_readLE32(secret + 12)) - seed;
+
+        h128.low64 = XXH64_avalanche((U64)combinedl ^ bitflipl);
+        h128.high64 = XXH64_avalanche((U64)combinedh ^ bitfliph);
+        return h128;
+    }
+    h128.low64 = XXH64_avalanche(seed ^ (XXH3_readLE64(secret + 64) ^ XXH3_readLE64(secret + 72)));
+    h128.high64 = XXH64_avalanche(seed ^ (XXH3_readLE64(secret + 80) ^ XXH3_readLE64(secret + 88)));
+    return h128;
+}
+
+static XXH128_hash_t XXH128_mix32B(XXH128_hash_t acc, const BYTE* input_1, const BYTE* input_2, const BYTE* secret, U64 seed)
+{
+    acc.low64 += XXH3_mix16B(input_1, secret + 0, seed);
+    acc.low64 ^= XXH3_readLE64(input_2) + XXH3_readLE64(input_2 + 8);
+    acc.high64 += XXH3_mix16B(input_2, secret + 16, seed);
+    acc.high64 ^= XXH3_readLE64(input_1) + XXH3_readLE64(input_1 + 8);
+    return acc;
+}
+
+static XXH128_hash_t XXH3_finalize_128b(XXH128_hash_t acc, size_t len, U64 seed)
+{
+    XXH128_hash_t h128;
+
+    h128.low64 = acc.low64 + acc.high64;
+    h128.high64 = (acc.low64 * PRIME64_1) + (acc.high64 * PRIME64_4) + ((len - seed) * PRIME64_2);
+    h128.low64 = XXH3_avalanche(h128.low64);
+    h128.high64 = (U64)0 - XXH3_avalanche(h128.high64);
+    return h128;
+}
+
+static XXH128_hash_t XXH3_len_17to128_128b(const BYTE* input, size_t len, const BYTE* secret, U64 seed)
+{
+    XXH128_hash_t acc;
+
+    acc.low64 = len * PRIME64_1;
+    acc.high64 = 0;
+    if (len > 32) {
+        if (len > 64) {
+            if (len > 96)
+                acc = XXH128_mix32B(acc, input + 48, input + len - 64, secret + 96, seed);
+            acc = XXH128_mix32B(acc, input + 32, input + len - 48, secret + 64, seed);
+        }
+        acc = XXH128_mix32B(acc, input + 16, input + len - 32, secret + 32, seed);
+    }
+    acc = XXH128_mix32B(acc, input, input + len - 16, secret, seed);
+    return XXH3_finalize_128b(acc, len, seed);
+}
+
+static XXH128_hash_t XXH3_len_129to240_128b(const BYTE* input, size_t len, const BYTE* secret, U64 seed)
+{
+    XXH128_hash_t acc;
+    unsigned int i;
+
+    acc.low64 = len * PRIME64_1;
+    acc.high64 = 0;
+    for (i = 32; i < 160; i += 32)
+        acc = XXH128_mix32B(acc, input + i - 32, input + i - 16, secret + i - 32, seed);
+    acc.low64 = XXH3_avalanche(acc.low64);
+    acc.high64 = XXH3_avalanche(acc.high64);
+    for (i = 160; i <= len; i += 32)
+        acc = XXH128_mix32B(acc, input + i - 32, input + i - 16, secret + XXH3_MIDSIZE_STARTOFFSET + i - 160, seed);
+    acc = XXH128_mix32B(acc, input + len - 16, input + len - 32, secret + XXH3_SECRET_SIZE_MIN - XXH3_MIDSIZE_LASTOFFSET - 16, (U64)0 - seed);
+    return XXH3_finalize_128b(acc, len, seed);
+}
+
+
+/*======   Long inputs   ======*/
+
+static void XXH3_accumulate_512(U64* acc, const BYTE* input, const BYTE* secret)
+{
+    size_t i;
+
+    for (i = 0; i < XXH3_ACC_NB; i++) {
+        U64 const data_val = XXH3_readLE64(input + 8 * i);
+        U64 const data_key = data_val ^ XXH3_readLE64(secret + 8 * i);
+        acc[i ^ 1] += data_val;  /* swap adjacent lanes */
+        acc[i] += (U64)(U32)data_key * (U64)(U32)(data_key >> 32);
+    }
+}
+
+static void XXH3_scrambleAcc(U64* acc, const BYTE* secret)
+{
+    size_t i;
+
+    for (i = 0; i < XXH3_ACC_NB; i++) {
+        U64 acc64 = acc[i];
+        acc64 ^= acc64 >> 47;
+        acc64 ^= XXH3_readLE64(secret + 8 * i);
+        acc64 *= PRIME32_1;
+        acc[i] = acc64;
+    }
+}
+
+static void XXH3_hashLong_loop(U64* acc, const BYTE* input, size_t len, const BYTE* secret, size_t secretSize)
+{
+    size_t const nbStripesPerBlock = (secretSize - XXH3_STRIPE_LEN) / XXH3_SECRET_CONSUME_RATE;
+    size_t const block_len = XXH3_STRIPE_LEN * nbStripesPerBlock;
+    size_t const nb_blocks = (len - 1) / block_len;
+    size_t n, s, nbStripes;
+
+    acc[0] = PRIME32_3; acc[1] = PRIME64_1; acc[2] = PRIME64_2; acc[3] = PRIME64_3;
+    acc[4] = PRIME64_4; acc[5] = PRIME32_2; acc[6] = PRIME64_5; acc[7] = PRIME32_1;
+    for (n = 0; n < nb_blocks; n++) {
+        for (s = 0; s < nbStripesPerBlock; s++)
+            XXH3_accumulate_512(acc, input + n * block_len + s * XXH3_STRIPE_LEN, secret + s * XXH3_SECRET_CONSUME_RATE);
+        XXH3_scrambleAcc(acc, secret + secretSize - XXH3_STRIPE_LEN);
+    }
+    nbStripes = ((len - 1) - (block_len * nb_blocks)) / XXH3_STRIPE_LEN;
+    for (s = 0; s < nbStripes; s++)
+        XXH3_accumulate_512(acc, input + nb_blocks * block_len + s * XXH3_STRIPE_LEN, secret + s * XXH3_SECRET_CONSUME_RATE);
+    XXH3_accumulate_512(acc, input + len - XXH3_STRIPE_LEN, secret + secretSize - XXH3_STRIPE_LEN - XXH3_SECRET_LASTACC_START);
+}
+
+static U64 XXH3_mergeAccs(const U64* acc, const BYTE* secret, U64 start)
+{
+    U64 result64 = start;
+    size_t i;
+
+    for (i = 0; i < 4; i++)
+        result64 += XXH3_mul128_fold64(acc[2 * i] ^ XXH3_readLE64(secret + 16 * i), acc[2 * i + 1] ^ XXH3_readLE64(secret + 16 * i + 8));
+    return XXH3_avalanche(result64);
+}
+
+static const BYTE* XXH3_seededSecret(BYTE* customSecret, U64 seed)
+{ /* The secret of a seeded long hash, derived from the default one */
+    int i;
+
+    if (seed == 0)
+        return XXH3_kSecret;
+    for (i = 0; i < XXH3_SECRET_DEFAULT_SIZE / 16; i++) {
+        XXH3_writeLE64(customSecret + 16 * i,     XXH3_readLE64(XXH3_kSecret + 16 * i) + seed);
+        XXH3_writeLE64(customSecret + 16 * i + 8, XXH3_readLE64(XXH3_kSecret + 16 * i + 8) - seed);
+    }
+    return customSecret;
+}
+
+
+/*======   Public entry points   ======*/
+
+XXH_PUBLIC_API XXH64_hash_t XXH3_64bits_withSeed(const void* input, size_t len, XXH64_hash_t seed)
+{
+    const BYTE* p = (const BYTE*)input;
+
+    if (len <= 16)
+        return XXH3_len_0to16_64b(p, len, XXH3_kSecret, seed);
+    if (len <= 128)
+        return XXH3_len_17to128_64b(p, len, XXH3_kSecret, seed);
+    if (len <= XXH3_MIDSIZE_MAX)
+        return XXH3_len_129to240_64b(p, len, XXH3_kSecret, seed);
+    {   BYTE customSecret[XXH3_SECRET_DEFAULT_SIZE];
+        U64 acc[XXH3_ACC_NB];
+        const BYTE* secret = XXH3_seededSecret(customSecret, seed);
+
+        XXH3_hashLong_loop(acc, p, len, secret, XXH3_SECRET_DEFAULT_SIZE);
+        return XXH3_mergeAccs(acc, secret + XXH3_SECRET_MERGEACCS_START, (U64)len * PRIME64_1);
+    }
+}
+
+XXH_PUBLIC_API XXH128_hash_t XXH3_128bits_withSeed(const void* input, size_t len, XXH64_hash_t seed)
+{
+    const BYTE* p = (const BYTE*)input;
+
+    if (len <= 16)
+        return XXH3_len_0to16_128b(p, len, XXH3_kSecret, seed);
+    if (len <= 128)
+        return XXH3_len_17to128_128b(p, len, XXH3_kSecret, seed);
+    if (len <= XXH3_MIDSIZE_MAX)
+        return XXH3_len_129to240_128b(p, len, XXH3_kSecret, seed);
+    {   BYTE customSecret[XXH3_SECRET_DEFAULT_SIZE];
+        U64 acc[XXH3_ACC_NB];
+        XXH128_hash_t h128;
+        const BYTE* secret = XXH3_seededSecret(customSecret, seed);
+
+        XXH3_hashLong_loop(acc, p, len, secret, XXH3_SECRET_DEFAULT_SIZE);
+        h128.low64 = XXH3_mergeAccs(acc, secret + XXH3_SECRET_MERGEACCS_START, (U64)len * PRIME64_1);
+        h128.high64 = XXH3_mergeAccs(acc, secret + XXH3_SECRET_DEFAULT_SIZE - sizeof(acc) - XXH3_SECRET_MERGEACCS_START, ~((U64)len * PRIME64_2));
+        return h128;
+    }
+}
+
 #endif  /* XXH_NO_LONG_LONG */
@@ -143,6 +143,8 @@ typedef enum { XXH_OK=0, XXH_ERROR } XXH_errorcode;
 #  define XXH64_copyState XXH_NAME2(XXH_NAMESPACE, XXH64_copyState)
 #  define XXH64_canonicalFromHash XXH_NAME2(XXH_NAMESPACE, XXH64_canonicalFromHash)
 #  define XXH64_hashFromCanonical XXH_NAME2(XXH_NAMESPACE, XXH64_hashFromCanonical)
+#  define XXH3_64bits_withSeed XXH_NAME2(XXH_NAMESPACE, XXH3_64bits_withSeed)
+#  define XXH3_128bits_withSeed XXH_NAME2(XXH_NAMESPACE, XXH3_128bits_withSeed)
 #endif
 
 
@@ -239,6 +241,17 @@ XXH_PUBLIC_API XXH64_hash_t  XXH64_digest (const XXH64_state_t* statePtr);
 typedef struct { unsigned char digest[8]; } XXH64_canonical_t;
 XXH_PUBLIC_API void XXH64_canonicalFromHash(XXH64_canonical_t* dst, XXH64_hash_t hash);
 XXH_PUBLIC_API XXH64_hash_t XXH64_hashFromCanonical(const XXH64_canonical_t* src);
+
+
+/*-**********************************************************************
+*  XXH3 (64-bit and 128-bit), seeded one-shot variants
+************************************************************************/
+/* Scalar port of the XXH3 one-shot functions of xxHash v0.8.2 (same outputs).
+ * XXH3 is much faster than XXH64 on small inputs (up to 240 bytes), which are hashed without any loop over stripes. */
+typedef struct { XXH64_hash_t low64; XXH64_hash_t high64; } XXH128_hash_t;
+
+XXH_PUBLIC_API XXH64_hash_t  XXH3_64bits_withSeed (const void* input, size_t length, XXH64_hash_t seed);
+XXH_PUBLIC_API XXH128_hash_t XXH3_128bits_withSeed(const void* input, size_t length, XXH64_hash_t seed);
 #endif  /* XXH_NO_LONG_LONG */
 
 
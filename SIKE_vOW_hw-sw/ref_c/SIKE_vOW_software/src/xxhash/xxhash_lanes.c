@@ -0,0 +1,77 @@
+/********************************************************************************************
+* vOW4SIKE on HW: a HW/SW co-design implementation of the vOW algorithm on SIKE
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/vOW4SIKE_on_HW
+* Released under MIT license
+*
+* Abstract: XXH64 of VLANES inputs of the same length at a time, one per 64-bit lane, for one SIMD backend.
+*           This file is included by prng.c once per backend, after defining the vector type vec_t, the V_*
+*           primitives, VLANES, SIMD_NAME() and SIMD_TARGET. V_LOADN(input, offset, n) loads the n bytes at
+*           input[j] + offset into lane j, and V_LOAD_STRIPE(w, input, offset) the 32 bytes at input[j] + offset
+*           into lane j of w[0..3], 8 bytes per vector. The steps are the ones of XXH64() in xxhash.c.
+*********************************************************************************************/
+
+static SIMD_TARGET vec_t SIMD_NAME(xxh64_round)(vec_t acc, const vec_t input)
+{
+    acc = V_ADD(acc, V_MUL(input, XXH_PRIME64_2));
+    acc = V_ROTL(acc, 31);
+    return V_MUL(acc, XXH_PRIME64_1);
+}
+
+static SIMD_TARGET vec_t SIMD_NAME(xxh64_merge_round)(vec_t acc, const vec_t val)
+{
+    acc = V_XOR(acc, SIMD_NAME(xxh64_round)(V_ZERO(), val));
+    return V_ADD(V_MUL(acc, XXH_PRIME64_1), V_SET1(XXH_PRIME64_4));
+}
+
+static SIMD_TARGET void SIMD_NAME(xxh64_lanes)(uint64_t *hash, unsigned char *const *input, const unsigned long nbytes_input)
+{ // hash[j] = XXH64(input[j], nbytes_input, hash[j]) for the VLANES lanes
+    vec_t seed = V_LOAD(hash), h, v1, v2, v3, v4, w[4];
+    unsigned long offset = 0;
+
+    if (nbytes_input >= 32) {
+        v1 = V_ADD(seed, V_SET1(XXH_PRIME64_1 + XXH_PRIME64_2));
+        v2 = V_ADD(seed, V_SET1(XXH_PRIME64_2));
+        v3 = seed;
+        v4 = V_SUB(seed, V_SET1(XXH_PRIME64_1));
+        for (; offset + 32 <= nbytes_input; offset += 32) {
+            V_LOAD_STRIPE(w, input, offset);
+            v1 = SIMD_NAME(xxh64_round)(v1, w[0]);
+            v2 = SIMD_NAME(xxh64_round)(v2, w[1]);
+            v3 = SIMD_NAME(xxh64_round)(v3, w[2]);
+            v4 = SIMD_NAME(xxh64_round)(v4, w[3]);
+        }
+        h = V_ADD(V_ADD(V_ROTL(v1, 1), V_ROTL(v2, 7)), V_ADD(V_ROTL(v3, 12), V_ROTL(v4, 18)));
+        h = SIMD_NAME(xxh64_merge_round)(h, v1);
+        h = SIMD_NAME(xxh64_merge_round)(h, v2);
+        h = SIMD_NAME(xxh64_merge_round)(h, v3);
+        h = SIMD_NAME(xxh64_merge_round)(h, v4);
+    } else {
+        h = V_ADD(seed, V_SET1(XXH_PRIME64_5));
+    }
+    h = V_ADD(h, V_SET1(nbytes_input));
+
+    // Remaining bytes: 8 at a time, then 4 and then one at a time
+    for (; offset + 8 <= nbytes_input; offset += 8) {
+        h = V_XOR(h, SIMD_NAME(xxh64_round)(V_ZERO(), V_LOADN(input, offset, 8)));
+        h = V_ADD(V_MUL(V_ROTL(h, 27), XXH_PRIME64_1), V_SET1(XXH_PRIME64_4));
+    }
+    if (offset + 4 <= nbytes_input) {
+        h = V_XOR(h, V_MUL(V_LOADN(input, offset, 4), XXH_PRIME64_1));
+        h = V_ADD(V_MUL(V_ROTL(h, 23), XXH_PRIME64_2), V_SET1(XXH_PRIME64_3));
+        offset += 4;
+    }
+    for (; offset < nbytes_input; offset++) {
+        h = V_XOR(h, V_MUL(V_LOADN(input, offset, 1), XXH_PRIME64_5));
+        h = V_MUL(V_ROTL(h, 11), XXH_PRIME64_1);
+    }
+
+    // Avalanche
+    h = V_XOR(h, V_SRL(h, 33));
+    h = V_MUL(h, XXH_PRIME64_2);
+    h = V_XOR(h, V_SRL(h, 29));
+    h = V_MUL(h, XXH_PRIME64_3);
+    h = V_XOR(h, V_SRL(h, 32));
+    V_STORE(hash, h);
+}
@@ -188,6 +188,28 @@ bool fp_test()
     if (passed==1) printf("  GF(p) inversion tests............................................ PASSED");
     else { printf("  GF(p) inversion tests... FAILED"); printf("\n"); return false; }
     printf("\n");
+
+    // Field inversion variants over the prime p503, checked against each other
+    passed = 1;
+    for (n=0; n<TEST_LOOPS; n++)
+    {
+        fprandom503_test(a); 
+        to_mont(a, ma);
+        fpcopy503(ma, mb);
+        fpinv503_mont_bingcd(mb);
+        fpcorrection503(mb);
+        fpcopy503(ma, mc);
+        fpinv503_mont_safegcd(mc);
+        fpcorrection503(mc);
+        if (compare_words(mb, mc, NWORDS_FIELD)!=0) { passed=0; break; }
+        fpcopy503(ma, md);
+        fpinv503_mont_ct(md);
+        fpcorrection503(md);
+        if (compare_words(mb, md, NWORDS_FIELD)!=0) { passed=0; break; }
+    }
+    if (passed==1) printf("  GF(p) inversion cross-check tests................................ PASSED");
+    else { printf("  GF(p) inversion cross-check tests... FAILED"); printf("\n"); return false; }
+    printf("\n");
     
     return OK;
 }
@@ -413,16 +435,40 @@ bool fp_run()
     printf("  GF(p) reduction runs in ......................................... %7lld ", cycles/BENCH_LOOPS); print_unit;
     printf("\n");
 
-    // GF(p) inversion
+    // GF(p) inversion (safegcd)
+    cycles = 0;
+    for (n=0; n<SMALL_BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        fpinv503_mont_safegcd(a);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  GF(p) inversion (safegcd) runs in ............................... %7lld ", cycles/SMALL_BENCH_LOOPS); print_unit;
+    printf("\n"); 
+
+    // GF(p) inversion (binary GCD)
+    cycles = 0;
+    for (n=0; n<SMALL_BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        fpinv503_mont_bingcd(a);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  GF(p) inversion (binary GCD) runs in ............................ %7lld ", cycles/SMALL_BENCH_LOOPS); print_unit;
+    printf("\n"); 
+
+    // GF(p) inversion (addition chain)
     cycles = 0;
     for (n=0; n<SMALL_BENCH_LOOPS; n++)
     {
         cycles1 = cpucycles(); 
-        fpinv503_mont(a);
+        fpinv503_mont_ct(a);
         cycles2 = cpucycles();
         cycles = cycles+(cycles2-cycles1);
     }
-    printf("  GF(p) inversion (exponentiation) runs in ........................ %7lld ", cycles/SMALL_BENCH_LOOPS); print_unit;
+    printf("  GF(p) inversion (addition chain) runs in ........................ %7lld ", cycles/SMALL_BENCH_LOOPS); print_unit;
     printf("\n"); 
     
     return OK;
@@ -498,13 +544,147 @@ bool fp2_run()
         cycles2 = cpucycles();
         cycles = cycles+(cycles2-cycles1);
     }
-    printf("  GF(p^2) inversion (exponentiation) runs in ...................... %7lld ", cycles/SMALL_BENCH_LOOPS); print_unit;
+    printf("  GF(p^2) inversion (safegcd) runs in ............................. %7lld ", cycles/SMALL_BENCH_LOOPS); print_unit;
     printf("\n");
     
     return OK;
 }
 
 
+bool fp2simd_test()
+{ // Tests for the lane-parallel GF(p^2) arithmetic against the scalar functions
+    bool OK = true;
+#if defined(SIMD_SUPPORT)
+    int n, passed;
+    unsigned int i, k, lanes;
+    f2elm_t a[SIMD_LANES], b[SIMD_LANES], c[SIMD_LANES], d[SIMD_LANES], e[SIMD_LANES], t;
+    vf2elm_t va, vb, vc, vd;
+    const unsigned int backends[2] = {SIMD_AVX2, SIMD_AVX512};
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
+    printf("Testing lane-parallel arithmetic over GF(p503^2): \n\n"); 
+
+    for (k = 0; k < 2; k++) {
+        if (!fp2simd_select(backends[k])) {
+            printf("  Backend %s not available, skipped", fp2simd_name(backends[k])); printf("\n");
+            continue;
+        }
+        passed = 1;
+        for (n=0; n<TEST_LOOPS; n++)
+        {
+            lanes = 1 + n % SIMD_LANES;                         // Also test partially filled vectors
+            for (i = 0; i < lanes; i++) {
+                fp2random503_test((digit_t*)t); to_fp2mont(t, a[i]);
+                fp2random503_test((digit_t*)t); to_fp2mont(t, b[i]);
+                fp2random503_test((digit_t*)t); to_fp2mont(t, c[i]);
+            }
+            to_fp2simd((const f2elm_t*)a, va, lanes);
+            to_fp2simd((const f2elm_t*)b, vb, lanes);
+            to_fp2simd((const f2elm_t*)c, vc, lanes);
+
+            fp2mul503_simd((const vfelm_t*)va, (const vfelm_t*)vb, vd, lanes);    // d = ((a*b+c)^2-a)*(b-c)
+            fp2add503_simd((const vfelm_t*)vd, (const vfelm_t*)vc, vd, lanes);
+            fp2sqr503_simd((const vfelm_t*)vd, vd, lanes);
+            fp2sub503_simd((const vfelm_t*)vd, (const vfelm_t*)va, vd, lanes);
+            fp2sub503_simd((const vfelm_t*)vb, (const vfelm_t*)vc, vb, lanes);
+            fp2mul503_simd((const vfelm_t*)vd, (const vfelm_t*)vb, vd, lanes);
+            from_fp2simd((const vfelm_t*)vd, d, lanes);
+
+            for (i = 0; i < lanes; i++) {
+                fp2mul503_mont(a[i], b[i], e[i]);
+                fp2add503(e[i], c[i], e[i]);
+                fp2sqr503_mont(e[i], e[i]);
+                fp2sub503(e[i], a[i], e[i]);
+                fp2sub503(b[i], c[i], t);
+                fp2mul503_mont(e[i], t, e[i]);
+                fp2correction503(d[i]);
+                fp2correction503(e[i]);
+                if (compare_words((digit_t*)d[i], (digit_t*)e[i], 2*NWORDS_FIELD)!=0) { passed=0; break; }
+            }
+            if (passed==0) break;
+        }
+        if (passed==1) { printf("  GF(p^2) %-6s lane-parallel tests .............................. PASSED", fp2simd_name(backends[k])); }
+        else { printf("  GF(p^2) %-6s lane-parallel tests... FAILED", fp2simd_name(backends[k])); printf("\n"); OK = false; break; }
+        printf("\n");
+    }
+    fp2simd_select(SIMD_SCALAR);
+#endif
+    return OK;
+}
+
+
+bool fp2simd_run()
+{ // Benchmarks of the lane-parallel GF(p^2) arithmetic, per vector operation and per element
+    bool OK = true;
+#if defined(SIMD_SUPPORT)
+    int n;
+    unsigned int i, k, lanes;
+    unsigned long long cycles, cycles1, cycles2;
+    f2elm_t a[SIMD_LANES];
+    vf2elm_t va, vb, vc;
+    const unsigned int backends[2] = {SIMD_AVX2, SIMD_AVX512};
+        
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
+    printf("Benchmarking lane-parallel arithmetic over GF(p503^2) (cycles per vector operation / per element): \n\n"); 
+
+    for (k = 0; k < 2; k++) {
+        if (!fp2simd_select(backends[k])) continue;
+        lanes = fp2simd_lanes();
+        for (i = 0; i < SIMD_LANES; i++) fp2random503_test((digit_t*)a[i]);
+        to_fp2simd((const f2elm_t*)a, va, lanes);
+        to_fp2simd((const f2elm_t*)a, vb, lanes);
+
+        // GF(p^2) addition, {lanes} lanes
+        cycles = 0;
+        for (n=0; n<BENCH_LOOPS; n++)
+        {
+            cycles1 = cpucycles(); 
+            fp2add503_simd((const vfelm_t*)va, (const vfelm_t*)vb, vc, lanes);
+            cycles2 = cpucycles();
+            cycles = cycles+(cycles2-cycles1);
+        }
+        printf("  GF(p^2) addition (%-6s x%u) runs in ............................ %7lld / %5lld ", fp2simd_name(backends[k]), lanes, cycles/BENCH_LOOPS, cycles/(BENCH_LOOPS*lanes)); print_unit;
+        printf("\n");
+        // GF(p^2) subtraction, {lanes} lanes
+        cycles = 0;
+        for (n=0; n<BENCH_LOOPS; n++)
+        {
+            cycles1 = cpucycles(); 
+            fp2sub503_simd((const vfelm_t*)va, (const vfelm_t*)vb, vc, lanes);
+            cycles2 = cpucycles();
+            cycles = cycles+(cycles2-cycles1);
+        }
+        printf("  GF(p^2) subtraction (%-6s x%u) runs in ......................... %7lld / %5lld ", fp2simd_name(backends[k]), lanes, cycles/BENCH_LOOPS, cycles/(BENCH_LOOPS*lanes)); print_unit;
+        printf("\n");
+        // GF(p^2) multiplication, {lanes} lanes
+        cycles = 0;
+        for (n=0; n<BENCH_LOOPS; n++)
+        {
+            cycles1 = cpucycles(); 
+            fp2mul503_simd((const vfelm_t*)va, (const vfelm_t*)vb, vc, lanes);
+            cycles2 = cpucycles();
+            cycles = cycles+(cycles2-cycles1);
+        }
+        printf("  GF(p^2) multiplication (%-6s x%u) runs in ...................... %7lld / %5lld ", fp2simd_name(backends[k]), lanes, cycles/BENCH_LOOPS, cycles/(BENCH_LOOPS*lanes)); print_unit;
+        printf("\n");
+        // GF(p^2) squaring, {lanes} lanes
+        cycles = 0;
+        for (n=0; n<BENCH_LOOPS; n++)
+        {
+            cycles1 = cpucycles(); 
+            fp2sqr503_simd((const vfelm_t*)va, vc, lanes);
+            cycles2 = cpucycles();
+            cycles = cycles+(cycles2-cycles1);
+        }
+        printf("  GF(p^2) squaring (%-6s x%u) runs in ............................ %7lld / %5lld ", fp2simd_name(backends[k]), lanes, cycles/BENCH_LOOPS, cycles/(BENCH_LOOPS*lanes)); print_unit;
+        printf("\n");
+    }
+    fp2simd_select(SIMD_SCALAR);
+#endif
+    return OK;
+}
+
+
 bool ecisog_run()
 {
     bool OK = true;
@@ -611,6 +791,9 @@ int main()
 
     OK = OK && fp2_test();         // Test arithmetic functions over GF(p503^2)
     OK = OK && fp2_run();          // Benchmark arithmetic functions over GF(p503^2)
+
+    OK = OK && fp2simd_test();     // Test the lane-parallel arithmetic over GF(p503^2) against the scalar functions
+    OK = OK && fp2simd_run();      // Benchmark the lane-parallel arithmetic over GF(p503^2)
     
     OK = OK && ecisog_run();       // Benchmark elliptic curve and isogeny functions
 
@@ -0,0 +1,336 @@
+/********************************************************************************************
+* vOW4SIKE on HW: a HW/SW co-design implementation of the vOW algorithm on SIKE
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/vOW4SIKE_on_HW
+* Released under MIT license
+*
+* Based on the SIDH library (https://github.com/microsoft/PQCrypto-SIDH) and the vOW4SIKE
+* library (https://github.com/microsoft/vOW4SIKE)
+*
+* Abstract: benchmarks of the vOW kernels, one line per kernel to compare builds
+*********************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "test_extras.h"
+#include "../src/vow.h"
+
+#define WARMUP_RUNS         2           // Untimed runs of each kernel before the timed ones
+#define DEFAULT_RUNS        11          // Timed runs of each kernel
+#define MAX_RUNS            1001
+#define RUN_SECONDS         0.02        // Target duration of a timed run, which sets the calls per run
+#define BACKTRACK_STEPS     8           // Steps of the shorter trail of each collision located
+#define FUNCTION_VERSION    1
+
+// Inputs and outputs of the kernels. Each kernel walks from the state its last call reached, so that its inputs vary
+typedef struct {
+    shared_state_t S;
+    private_state_t private_state;
+    prng_state_t prng_state;
+    st_t state;
+    unsigned char jinvariant[FP2_ENCODED_BYTES];
+    unsigned char prng_blocks[16 * PRNG_BUFFER_BLOCKS];
+    unsigned char jinvariants[MAX_WALKS][FP2_ENCODED_BYTES];
+    st_t states[MAX_WALKS];
+    f2elm_t jinv;
+    point_proj_t R;
+    uint64_t x;                         // xorshift64 state for memory addresses
+    uint64_t sink;                      // Keeps the results of the memory kernels alive
+} bench_t;
+
+// A kernel does the given number of calls and returns the number of operations they amount to
+typedef uint64_t (*kernel_t)(bench_t *b, uint64_t calls);
+
+
+static uint64_t next_rand(uint64_t *x)
+{ // xorshift64
+    *x ^= *x << 13;
+    *x ^= *x >> 7;
+    *x ^= *x << 17;
+    return *x;
+}
+
+static void next_state(bench_t *b, const unsigned char *bytes, unsigned int nbytes)
+{ // Derives the input of the next call from the output of the last one
+    memset(b->state, 0, sizeof(st_t));
+    XOF((unsigned char *)b->state, (unsigned char *)bytes, (unsigned long)insts_constants.NBYTES_STATE, (unsigned long)nbytes, 0);
+    b->state[0] &= (digit_t)(((uint64_t)1 << insts_constants.NBITS_STATE) - 1);
+}
+
+static uint64_t bench_step(bench_t *b, uint64_t calls)
+{
+    for (uint64_t i = 0; i < calls; i++)
+        StepSIDH(b->jinvariant, b->state, b->state, FUNCTION_VERSION);
+    return calls;
+}
+
+static uint64_t bench_get_isogeny(bench_t *b, uint64_t calls)
+{
+    for (uint64_t i = 0; i < calls; i++) {
+        GetIsogenySIDH(b->jinv, b->state);
+        next_state(b, (const unsigned char *)b->jinv, sizeof(f2elm_t));
+    }
+    return calls;
+}
+
+static uint64_t bench_ladder(bench_t *b, uint64_t calls)
+{
+    for (uint64_t i = 0; i < calls; i++) {
+        KernelPointSIDH(b->R, b->state);
+        next_state(b, (const unsigned char *)b->R->X, sizeof(f2elm_t));
+    }
+    return calls;
+}
+
+static uint64_t bench_traverse_tree(bench_t *b, uint64_t calls)
+{
+    point_proj_t R;
+
+    KernelPointSIDH(b->R, b->state);  // The kernel point of the state walked by CodomainSIDH()
+    for (uint64_t i = 0; i < calls; i++) {
+        memcpy(R, b->R, sizeof(point_proj_t));
+        CodomainSIDH(b->jinv, R, b->state);
+    }
+    return calls;
+}
+
+static uint64_t bench_xof_with(bench_t *b, uint64_t calls, void (*xof)(unsigned char *, unsigned char *, unsigned long, unsigned long, unsigned long))
+{
+    for (uint64_t i = 0; i < calls; i++) {
+        xof((unsigned char *)b->state, b->jinvariant, (unsigned long)insts_constants.NBYTES_STATE, FP2_ENCODED_BYTES, FUNCTION_VERSION);
+        b->jinvariant[0] ^= ((unsigned char *)b->state)[0];
+    }
+    return calls;
+}
+
+static uint64_t bench_xof(bench_t *b, uint64_t calls)
+{ // The XOF selected in prng.h
+    return bench_xof_with(b, calls, XOF);
+}
+
+static uint64_t bench_xof_xxh64(bench_t *b, uint64_t calls)
+{
+    return bench_xof_with(b, calls, XOF_XXH64);
+}
+
+static uint64_t bench_xof_xxh3(bench_t *b, uint64_t calls)
+{
+    return bench_xof_with(b, calls, XOF_XXH3);
+}
+
+static uint64_t bench_xof_aes(bench_t *b, uint64_t calls)
+{
+    return bench_xof_with(b, calls, XOF_AES);
+}
+
+static uint64_t bench_xof_shake(bench_t *b, uint64_t calls)
+{
+    return bench_xof_with(b, calls, XOF_SHAKE);
+}
+
+static uint64_t bench_xof_batch(bench_t *b, uint64_t calls)
+{ // XOF_batch() of MAX_WALKS j-invariants, as for -k 8 (operations are j-invariants)
+    unsigned char *input[MAX_WALKS], *output[MAX_WALKS];
+    unsigned int k;
+
+    for (k = 0; k < MAX_WALKS; k++) {
+        memcpy(b->jinvariants[k], b->jinvariant, FP2_ENCODED_BYTES);
+        b->jinvariants[k][0] ^= (unsigned char)k;
+        input[k] = b->jinvariants[k];
+        output[k] = (unsigned char *)b->states[k];
+    }
+    for (uint64_t i = 0; i < calls; i++) {
+        XOF_batch(output, input, MAX_WALKS, (unsigned long)insts_constants.NBYTES_STATE, FP2_ENCODED_BYTES, FUNCTION_VERSION);
+        b->jinvariants[i % MAX_WALKS][1] ^= ((unsigned char *)b->states[0])[0];
+    }
+    return calls * MAX_WALKS;
+}
+
+static uint64_t bench_prng(bench_t *b, uint64_t calls)
+{
+    for (uint64_t i = 0; i < calls; i++)
+        sample_prng(&b->prng_state, (unsigned char *)b->state, (unsigned long)insts_constants.NBYTES_STATE);
+    b->state[0] &= (digit_t)(((uint64_t)1 << insts_constants.NBITS_STATE) - 1);
+    return calls;
+}
+
+static uint64_t bench_prng_blocks(bench_t *b, uint64_t calls)
+{ // PRNG_BUFFER_BLOCKS blocks per call, which go through AES128_ctr() in both PRNG modes
+    for (uint64_t i = 0; i < calls; i++)
+        sample_prng(&b->prng_state, b->prng_blocks, sizeof(b->prng_blocks));
+    b->sink += b->prng_blocks[0];
+    return calls;
+}
+
+static uint64_t bench_memory_insert(bench_t *b, uint64_t calls)
+{
+    trip_t t;
+
+    for (uint64_t i = 0; i < calls; i++) {
+        uint64_t r = next_rand(&b->x);
+
+        t.current_state[0] = (digit_t)(r & (((uint64_t)1 << insts_constants.NBITS_STATE) - 1));
+        t.initial_state[0] = (digit_t)((r >> 7) & (((uint64_t)1 << insts_constants.NBITS_STATE) - 1));
+        t.current_steps = 1 + (uint32_t)(r % b->S.MAX_STEPS);
+        write_to_memory(&t, &b->S, (digit_t)(r >> 11) & (b->S.MEMORY_SIZE - 1), FUNCTION_VERSION);
+    }
+    return calls;
+}
+
+static uint64_t bench_memory_lookup(bench_t *b, uint64_t calls)
+{
+    trip_t t;
+
+    for (uint64_t i = 0; i < calls; i++) {
+        if (read_from_memory(&t, &b->S, (digit_t)(next_rand(&b->x) & (b->S.MEMORY_SIZE - 1)), FUNCTION_VERSION))
+            b->sink += t.current_steps;
+    }
+    return calls;
+}
+
+static uint64_t bench_backtrack(bench_t *b, uint64_t calls)
+{ // Locates collisions of unrelated trails, which are walked to the end: both the catch-up and the lockstep phases are timed.
+  // The operations are the random function steps taken
+    private_state_t *private_state = &b->private_state;
+    uint32_t steps = private_state->number_steps_locate;
+    trip_t c0, c1;
+
+    memset(&c0, 0, sizeof(trip_t));  // The PRNG only fills the low NBYTES_STATE bytes
+    memset(&c1, 0, sizeof(trip_t));
+    for (uint64_t i = 0; i < calls; i++) {
+        sample_prng(&b->prng_state, (unsigned char *)c0.initial_state, (unsigned long)insts_constants.NBYTES_STATE);
+        sample_prng(&b->prng_state, (unsigned char *)c1.initial_state, (unsigned long)insts_constants.NBYTES_STATE);
+        c0.initial_state[0] &= (digit_t)(((uint64_t)1 << insts_constants.NBITS_STATE) - 1);
+        c1.initial_state[0] &= (digit_t)(((uint64_t)1 << insts_constants.NBITS_STATE) - 1);
+        c0.current_steps = 2*BACKTRACK_STEPS;
+        c1.current_steps = BACKTRACK_STEPS;
+        BacktrackSIDH(&c0, &c1, NULL, NULL, private_state);
+    }
+    return private_state->number_steps_locate - steps;
+}
+
+
+static double seconds(void)
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double)t.tv_sec + 1e-9*(double)t.tv_nsec;
+}
+
+static int compare_doubles(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+
+    return (x > y) - (x < y);
+}
+
+static void run_kernel(bench_t *b, const char *name, kernel_t kernel, unsigned int runs)
+{ // Times runs of the kernel after WARMUP_RUNS untimed ones, and prints the median and 95th percentile of the cycles per
+  // operation and the operations per second of the median run
+    double cycles[MAX_RUNS], ns[MAX_RUNS], t;
+    uint64_t calls = 1, ops;
+    int64_t c;
+    unsigned int i;
+
+    // Size the runs to about RUN_SECONDS, from the time of a single call
+    t = seconds();
+    kernel(b, 1);
+    t = seconds() - t;
+    if (t > 0 && t < RUN_SECONDS)
+        calls = (uint64_t)(RUN_SECONDS / t);
+
+    for (i = 0; i < WARMUP_RUNS; i++)
+        kernel(b, calls);
+    for (i = 0; i < runs; i++) {
+        t = seconds();
+        c = cpucycles();
+        ops = kernel(b, calls);
+        c = cpucycles() - c;
+        t = seconds() - t;
+        cycles[i] = (double)c / (double)ops;
+        ns[i] = 1e9 * t / (double)ops;
+    }
+    qsort(cycles, runs, sizeof(double), compare_doubles);
+    qsort(ns, runs, sizeof(double), compare_doubles);
+    printf("%-10s %-24s %16.1f %16.1f %16.0f\n", insts_constants.MODULUS, name, cycles[runs/2], cycles[(95*runs + 99)/100 - 1], 1e9 / ns[runs/2]);
+}
+
+
+int main(int argc, char **argv)
+{
+    bench_t *b;
+    unsigned int runs = DEFAULT_RUNS, memory_log_size = DEFAULT_MEMORY_LOG_SIZE;
+    bool help_flag = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+            runs = (unsigned int)atoi(argv[++i]);
+            if (runs < 1 || runs > MAX_RUNS)
+                help_flag = true;
+        } else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc) {
+            memory_log_size = (unsigned int)atoi(argv[++i]);
+            if (memory_log_size < 1 || memory_log_size > MAX_MEMORY_LOG_SIZE)
+                help_flag = true;
+        } else {
+            help_flag = true;
+        }
+    }
+    if (help_flag) {
+        printf("\n Usage:");
+        printf("\n bench_vow -r N -w N \n");
+        printf("\n -r N : N timed runs of each kernel, 1 <= N <= %d (%d by default).", MAX_RUNS, DEFAULT_RUNS);
+        printf("\n -w N : memory of 2^N triples for the insert and lookup kernels (2^%d by default).\n\n", DEFAULT_MEMORY_LOG_SIZE);
+        return 1;
+    }
+
+    b = (bench_t *)calloc(1, sizeof(bench_t));
+    if (b == NULL)
+        return 1;
+    init_stats(&b->S);
+    if (!init_shared_memory(&b->S, memory_log_size)) {
+        printf("  Memory of 2^%u triples not supported for this instance or could not be allocated\n", memory_log_size);
+        free(b);
+        return 1;
+    }
+    init_private_state(&b->S, &b->private_state);
+    init_prng(&b->prng_state, (unsigned long)insts_constants.PRNG_SEED);
+    b->x = 0x9E3779B97F4A7C15ULL;
+    next_state(b, (const unsigned char *)&b->x, sizeof(b->x));
+
+    printf("# bench_vow: %s (e = %u), median and 95th percentile of %u runs after %u warm-up runs, memory of 2^%u triples\n",
+           insts_constants.MODULUS, insts_constants.e, runs, WARMUP_RUNS, memory_log_size);
+#if defined(USE_BUFFERED_PRNG)
+    printf("# PRNG: AES-CTR buffered by %u blocks\n", (unsigned int)PRNG_BUFFER_BLOCKS);
+#else
+    printf("# PRNG: AES-CTR with one block per sample\n");
+#endif
+    printf("# XOF: %u-byte j-invariants into %u-byte states\n", (unsigned int)FP2_ENCODED_BYTES, (unsigned int)insts_constants.NBYTES_STATE);
+#if (TARGET == TARGET_ARM64)
+    printf("# %-8s %-24s %16s %16s %16s\n", "prime", "kernel", "nsec/op", "nsec/op p95", "ops/s");
+#else
+    printf("# %-8s %-24s %16s %16s %16s\n", "prime", "kernel", "cycles/op", "cycles/op p95", "ops/s");
+#endif
+    run_kernel(b, "UpdateStSIDH", bench_step, runs);
+    run_kernel(b, "GetIsogeny", bench_get_isogeny, runs);
+    run_kernel(b, "LadderThreePtSIDH", bench_ladder, runs);
+    run_kernel(b, "TraverseTree", bench_traverse_tree, runs);
+    run_kernel(b, "XOF", bench_xof, runs);
+    run_kernel(b, "XOF_XXH64", bench_xof_xxh64, runs);
+    run_kernel(b, "XOF_XXH3", bench_xof_xxh3, runs);
+    run_kernel(b, "XOF_AES", bench_xof_aes, runs);
+    run_kernel(b, "XOF_SHAKE", bench_xof_shake, runs);
+    run_kernel(b, "XOF_batch_per_input", bench_xof_batch, runs);
+    run_kernel(b, "sample_prng", bench_prng, runs);
+    run_kernel(b, "sample_prng_8_blocks", bench_prng_blocks, runs);
+    run_kernel(b, "memory_insert", bench_memory_insert, runs);
+    run_kernel(b, "memory_lookup", bench_memory_lookup, runs);
+    run_kernel(b, "BacktrackSIDH_per_step", bench_backtrack, runs);
+
+    free_shared_memory(&b->S);
+    free(b);
+    return 0;
+}
@@ -0,0 +1,685 @@
+/********************************************************************************************
+* vOW4SIKE on HW: a HW/SW co-design implementation of the vOW algorithm on SIKE
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/vOW4SIKE_on_HW
+* Released under MIT license
+*
+* Based on the SIDH library (https://github.com/microsoft/PQCrypto-SIDH) and the vOW4SIKE
+* library (https://github.com/microsoft/vOW4SIKE)
+*
+* Abstract: generator of instance files for the van Oorschot-Wiener attack
+*
+* An instance with reduced exponent e hides a cyclic isogeny of degree 2^(2d), d = e-2, from the starting curve
+* E0: y^2 = x^3 + 6x^2 + x to an ending curve E1 through a secret middle curve Em. The kernel of E0 -> Em is derived
+* from a random golden state s0 of the starting side, and the basis of E1 is chosen so that a random golden state s1
+* of the ending side gives the kernel of the dual of Em -> E1. On every curve, the 2-torsion point of the Q point
+* of the basis is (0,0), since the 4-isogeny formulas do not handle kernels containing (0,0).
+*********************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../src/vow.h"
+
+extern const uint64_t PRIME[NWORDS64_FIELD];
+
+#define MAX_SAMPLES    1000    // Attempts at sampling a point of a given order
+
+static prng_state_t prng;
+static unsigned int eA;                            // Largest power of 2 dividing p+1
+static digit_t cofactor[NWORDS_FIELD];             // (p+1)/2^eA
+static digit_t sqrt_exp[NWORDS_FIELD];             // (p+1)/4
+
+
+// Multiprecision and field helpers
+
+static unsigned int mp_bit(const digit_t *a, const unsigned int i)
+{
+    return (unsigned int)((a[i / RADIX] >> (i % RADIX)) & 1);
+}
+
+static unsigned int mp_bitlength(const digit_t *a)
+{
+    unsigned int i = NWORDS_FIELD*RADIX;
+
+    while (i > 0 && mp_bit(a, i - 1) == 0)
+        i--;
+    return i;
+}
+
+static void mp_shiftr(digit_t *a, const unsigned int n)
+{ // a = a >> n
+    unsigned int i, j;
+
+    for (j = 0; j < n; j++) {
+        for (i = 0; i < NWORDS_FIELD - 1; i++)
+            a[i] = (a[i] >> 1) | (a[i + 1] << (RADIX - 1));
+        a[NWORDS_FIELD - 1] >>= 1;
+    }
+}
+
+static void init_constants(void)
+{ // eA, (p+1)/2^eA and (p+1)/4
+    digit_t t[NWORDS_FIELD];
+    unsigned int i;
+
+    memcpy(t, PRIME, sizeof(t));
+    for (i = 0; i < NWORDS_FIELD && ++t[i] == 0; i++);    // t = p+1
+    memcpy(sqrt_exp, t, sizeof(t));
+    mp_shiftr(sqrt_exp, 2);
+    for (eA = 0; mp_bit(t, eA) == 0; eA++);
+    memcpy(cofactor, t, sizeof(t));
+    mp_shiftr(cofactor, eA);
+}
+
+static bool fpiszero(const felm_t a)
+{
+    felm_t t;
+    unsigned int i;
+
+    fpcopy(a, t);
+    fpcorrection(t);
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        if (t[i] != 0)
+            return false;
+    }
+    return true;
+}
+
+static bool fpequal(const felm_t a, const felm_t b)
+{
+    felm_t t;
+
+    fpsub(a, b, t);
+    return fpiszero(t);
+}
+
+static bool fp2iszero(const f2elm_t a)
+{
+    return fpiszero(a[0]) && fpiszero(a[1]);
+}
+
+static bool fp2equal(const f2elm_t a, const f2elm_t b)
+{
+    return fpequal(a[0], b[0]) && fpequal(a[1], b[1]);
+}
+
+static void fp2one(f2elm_t a)
+{
+    fp2zero(a);
+    fpcopy((digit_t*)&Montgomery_one, a[0]);
+}
+
+static void fp2random(f2elm_t a)
+{ // Random element with coordinates in [0, 2^(NBITS_FIELD-1)-1], read as Montgomery representations
+    unsigned int i, j;
+
+    sample_prng(&prng, (unsigned char*)a, sizeof(f2elm_t));
+    for (j = 0; j < 2; j++) {
+        for (i = 0; i < NWORDS_FIELD; i++) {
+            if ((i + 1)*RADIX > NBITS_FIELD - 1)
+                a[j][i] &= (i*RADIX >= NBITS_FIELD - 1) ? 0 : ((digit_t)1 << (NBITS_FIELD - 1 - i*RADIX)) - 1;
+        }
+    }
+}
+
+static void fpexp(const felm_t a, const digit_t *e, felm_t c)
+{ // c = a^e
+    felm_t t;
+    unsigned int i;
+
+    fpcopy((digit_t*)&Montgomery_one, t);
+    for (i = mp_bitlength(e); i > 0; i--) {
+        fpsqr_mont(t, t);
+        if (mp_bit(e, i - 1))
+            fpmul_mont(t, a, t);
+    }
+    fpcopy(t, c);
+}
+
+static bool fpsqrt(const felm_t a, felm_t c)
+{ // c = sqrt(a) in GF(p), p = 3 mod 4. Returns false if a is not a square
+    felm_t t;
+
+    fpexp(a, sqrt_exp, c);
+    fpsqr_mont(c, t);
+    return fpequal(t, a);
+}
+
+static bool fp2sqrt(const f2elm_t a, f2elm_t c)
+{ // c = sqrt(a) in GF(p^2), from the square root s of the norm a0^2 + a1^2: c0^2 = (a0 +- s)/2 and c1 = a1/(2*c0).
+  // Returns false if a is not a square
+    felm_t n, s, u, t;
+    unsigned int k;
+
+    if (fpiszero(a[1])) {    // Either a0 or -a0 is a square in GF(p)
+        fpzero(c[1]);
+        if (fpsqrt(a[0], c[0]))
+            return true;
+        fpcopy(a[0], t);
+        fpneg(t);
+        fpzero(c[0]);
+        return fpsqrt(t, c[1]);
+    }
+    fpsqr_mont(a[0], n);
+    fpsqr_mont(a[1], t);
+    fpadd(n, t, n);
+    if (!fpsqrt(n, s))
+        return false;
+    for (k = 0; k < 2; k++) {
+        if (k == 0)
+            fpadd(a[0], s, u);
+        else
+            fpsub(a[0], s, u);
+        fpdiv2(u, u);
+        if (fpiszero(u) || !fpsqrt(u, c[0]))
+            continue;
+        fpadd(c[0], c[0], t);
+        fpinv_mont(t);
+        fpmul_mont(a[1], t, c[1]);
+        return true;
+    }
+    return false;
+}
+
+
+// Curve helpers. Curves are given by their affine Montgomery coefficient A, or by a24 = (A+2)/4
+
+static void get_a24(const f2elm_t A, f2elm_t a24)
+{ // a24 = (A+2)/4
+    f2elm_t one;
+
+    fp2one(one);
+    fp2add(A, one, a24);
+    fp2add(a24, one, a24);
+    fp2div2(a24, a24);
+    fp2div2(a24, a24);
+    fp2correction(a24);
+}
+
+static void get_affine_A(const f2elm_t A24plus, const f2elm_t C24, f2elm_t A)
+{ // A = 4*A24plus/C24 - 2, for the projective constants (A24plus : C24) = (A+2C : 4C) of TraverseTree()
+    f2elm_t t, one;
+
+    fp2one(one);
+    fp2copy(C24, t);
+    fp2inv_mont(t);
+    fp2mul_mont(A24plus, t, A);
+    fp2add(A, A, A);
+    fp2add(A, A, A);
+    fp2sub(A, one, A);
+    fp2sub(A, one, A);
+    fp2correction(A);
+}
+
+static void set_affine(point_proj_t P, const f2elm_t x)
+{
+    fp2copy(x, P->X);
+    fp2one(P->Z);
+}
+
+static void get_x(const point_proj_t P, f2elm_t x)
+{ // x = X/Z
+    f2elm_t t;
+
+    fp2copy(P->Z, t);
+    fp2inv_mont(t);
+    fp2mul_mont(P->X, t, x);
+    fp2correction(x);
+}
+
+static void xDBLe_affine(const f2elm_t x, f2elm_t y, const f2elm_t a24, const unsigned int e)
+{ // x(2^e*P) from x(P)
+    point_proj_t P;
+    f2elm_t one;
+
+    fp2one(one);
+    set_affine(P, x);
+    xDBLe(P, P, a24, one, (int)e);
+    get_x(P, y);
+}
+
+static void curve_rhs(const f2elm_t A, const f2elm_t x, f2elm_t y2)
+{ // y2 = x^3 + A*x^2 + x
+    f2elm_t one;
+
+    fp2one(one);
+    fp2add(x, A, y2);
+    fp2mul_mont(y2, x, y2);
+    fp2add(y2, one, y2);
+    fp2mul_mont(y2, x, y2);
+}
+
+static void xMUL(const f2elm_t x, const digit_t *k, const f2elm_t a24, point_proj_t R)
+{ // x(k*P) from x(P) = x, for k >= 1 (Montgomery ladder)
+    point_proj_t R1;
+    f2elm_t one;
+    unsigned int i;
+
+    fp2one(one);
+    set_affine(R, x);
+    xDBLe(R, R1, a24, one, 1);
+    for (i = mp_bitlength(k) - 1; i > 0; i--) {
+        if (mp_bit(k, i - 1))
+            xDBLADD(R1, R, x, a24);
+        else
+            xDBLADD(R, R1, x, a24);
+    }
+}
+
+static void LADDER3PT(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xPQ, const uint64_t m, const unsigned int nbits, const f2elm_t a24, f2elm_t x)
+{ // x(P + m*Q) from x(P), x(Q) and x(P-Q), processing the nbits low bits of m
+    point_proj_t R0, R1, R2, T;
+    unsigned int i, bit, prevbit = 0;
+
+    set_affine(R0, xQ);
+    set_affine(R2, xPQ);
+    set_affine(R1, xP);
+    for (i = 0; i < nbits; i++) {
+        bit = (unsigned int)((m >> i) & 1);
+        if (bit ^ prevbit) {
+            memcpy(T, R1, sizeof(T));
+            memcpy(R1, R2, sizeof(T));
+            memcpy(R2, T, sizeof(T));
+        }
+        prevbit = bit;
+        xDBLADD(R0, R2, R1->X, a24);
+        fp2mul_mont(R2->X, R1->Z, R2->X);
+    }
+    get_x(prevbit ? R2 : R1, x);
+}
+
+static bool sample_point(const f2elm_t A, const unsigned int n, const f2elm_t x2, const bool equal, f2elm_t x)
+{ // x(P) for a random point P of order 2^n such that x(2^(n-1)*P) is equal (or not equal) to x2
+    point_proj_t P;
+    f2elm_t a24, y2, t, one;
+    unsigned int i;
+
+    fp2one(one);
+    get_a24(A, a24);
+    for (i = 0; i < MAX_SAMPLES; i++) {
+        fp2random(x);
+        curve_rhs(A, x, y2);
+        if (!fp2sqrt(y2, t))
+            continue;
+        xMUL(x, cofactor, a24, P);
+        xDBLe(P, P, a24, one, (int)(eA - n));
+        if (fp2iszero(P->Z))
+            continue;
+        get_x(P, x);
+        xDBLe(P, P, a24, one, (int)(n - 1));
+        if (fp2iszero(P->Z))                       // Order lower than 2^n
+            continue;
+        get_x(P, t);
+        if (fp2equal(t, x2) != equal)
+            continue;
+        return true;
+    }
+    return false;
+}
+
+static bool x_difference(const f2elm_t A, const f2elm_t xP, const f2elm_t xQ, f2elm_t x)
+{ // x(P-Q) for one choice of the y-coordinates of P and Q (the other choice gives x(P+Q), i.e., x(P-Q) for -P)
+    f2elm_t yP, yQ, t, l;
+
+    curve_rhs(A, xP, t);
+    if (!fp2sqrt(t, yP))
+        return false;
+    curve_rhs(A, xQ, t);
+    if (!fp2sqrt(t, yQ))
+        return false;
+    fp2sub(xP, xQ, t);
+    fp2inv_mont(t);
+    fp2add(yP, yQ, l);
+    fp2mul_mont(l, t, l);                          // l = (yP+yQ)/(xP-xQ)
+    fp2sqr_mont(l, x);
+    fp2sub(x, A, x);
+    fp2sub(x, xP, x);
+    fp2sub(x, xQ, x);
+    fp2correction(x);
+    return true;
+}
+
+static bool move_to_zero(f2elm_t A, const f2elm_t beta, f2elm_t *x, const unsigned int n)
+{ // Moves the 2-torsion point (beta,0) to (0,0): x' = (x-beta)/l and A' = (3*beta+A)/l, with l^2 = 3*beta^2 + 2*A*beta + 1.
+  // l exists because (beta,0) is divisible by 2 over GF(p^2)
+    f2elm_t l, t, u, one;
+    unsigned int i;
+
+    fp2one(one);
+    fp2sqr_mont(beta, t);
+    fp2add(t, t, u);
+    fp2add(u, t, u);
+    fp2mul_mont(A, beta, t);
+    fp2add(t, t, t);
+    fp2add(u, t, u);
+    fp2add(u, one, u);
+    if (!fp2sqrt(u, l))
+        return false;
+    fp2inv_mont(l);
+    for (i = 0; i < n; i++) {
+        fp2sub(x[i], beta, t);
+        fp2mul_mont(t, l, x[i]);
+        fp2correction(x[i]);
+    }
+    fp2add(beta, beta, t);
+    fp2add(t, beta, t);
+    fp2add(t, A, t);
+    fp2mul_mont(t, l, A);
+    fp2correction(A);
+    return true;
+}
+
+static void normalize_jinv(f2elm_t jinv)
+{ // Same representative of j and its Frobenius conjugate as GetIsogeny()
+    fp2correction(jinv);
+    if (jinv[1][0] & 1)
+        fpneg(jinv[1]);
+}
+
+
+// Instance construction
+
+static unsigned int balanced_strategy(unsigned int *strat, const unsigned int n)
+{ // Balanced strategy for a chain of n 4-isogenies, with lenstrat-1 entries
+    unsigned int len;
+
+    if (n <= 1)
+        return 0;
+    strat[0] = n/2;
+    len = 1 + balanced_strategy(&strat[1], n - n/2);
+    return len + balanced_strategy(&strat[len], n/2);
+}
+
+static uint64_t kernel_scalar(const st_t s, const unsigned int c, const unsigned int nbits_state, const unsigned int d)
+{ // k such that the walk from state s computes the isogeny with kernel <P + k*Q> (see LadderThreePtSIDH())
+    const unsigned char *m = (const unsigned char*)s;
+    unsigned int i, j, nbits = nbits_state;
+    uint64_t k = 0;
+
+    while (nbits > 0 && ((m[(nbits - 1) >> 3] >> ((nbits - 1) & 0x07)) & 1) == 0)
+        nbits--;
+    for (i = 2 - c, j = 0; i < nbits + 2; i++, j++) {
+        if (((m[i >> 3] >> (i & 0x07)) & 1) == 0)
+            k += (uint64_t)1 << j;
+    }
+    return k & (((uint64_t)1 << d) - 1);
+}
+
+static void set_curve(CurveAndPointsSIDHv2 *E, const f2elm_t a24, const f2elm_t xp, const f2elm_t xq, const f2elm_t xpq)
+{
+    memcpy(E->a24, a24, sizeof(f2elm_t));
+    memcpy(E->xp, xp, sizeof(f2elm_t));
+    memcpy(E->xq, xq, sizeof(f2elm_t));
+    memcpy(E->xpq, xpq, sizeof(f2elm_t));
+}
+
+static void set_table(f2elm_t64 *table, const f2elm_t a24, const f2elm_t xq, const unsigned int npoints)
+{ // Doubling table 2^j*Q, j = 0, ..., npoints-1, with one (X:Z) point per two rows
+    point_proj_t P;
+    f2elm_t one;
+    unsigned int j;
+
+    fp2one(one);
+    set_affine(P, xq);
+    for (j = 0; j < npoints; j++) {
+        if (j > 0)
+            xDBLe(P, P, a24, one, 1);
+        fp2correction(P->X);
+        fp2correction(P->Z);
+        memcpy(table[2*j], P->X, sizeof(f2elm_t));
+        memcpy(table[2*j + 1], P->Z, sizeof(f2elm_t));
+    }
+}
+
+static bool generate(instance_t *inst, f2elm_t64 *table_es, f2elm_t64 *table_ee, const unsigned int e, st_t s0, st_t s1)
+{ // Instance with exponent e, golden states s0 and s1. Returns false if e is too large for the prime
+    const unsigned int d = e - 2, nst = e - 1, lenstrat = e/2 - 1;
+    const uint64_t mask_d = ((uint64_t)1 << d) - 1, mask_2d = ((uint64_t)1 << (2*d)) - 1;
+    f2elm_t zero = {0}, one, A0, a24_0, A1, a24_1, A24plus, C24, jinv, beta;
+    f2elm_t xP2, xQ2, xR2, xP0, xQ0, xR0, xP1, xR1, xV, xVQ, xG, xG2, xB, xGB, xPE[3];
+    point_proj_t K, phiP, phiQ, phiR;
+    uint64_t k0, k1, m;
+
+    if (2*d > eA || 2*d > 64)
+        return false;
+    memset(inst, 0, sizeof(instance_t));
+    memcpy(inst->MODULUS, insts_constants.MODULUS, sizeof(inst->MODULUS));
+    inst->e = e;
+    inst->ALPHA = insts_constants.ALPHA;
+    inst->BETA = insts_constants.BETA;
+    inst->GAMMA = insts_constants.GAMMA;
+    inst->PRNG_SEED = insts_constants.PRNG_SEED;
+    inst->NBITS_STATE = nst;
+    inst->NBYTES_STATE = (nst + 7)/8;
+    inst->NWORDS_STATE = 1;
+    inst->NBITS_OVERFLOW = nst - 8*(inst->NBYTES_STATE - 1);
+    inst->MAX_FUNCTION_VERSIONS = insts_constants.MAX_FUNCTION_VERSIONS;
+    balanced_strategy(inst->STRAT, lenstrat);
+
+    // E0: y^2 = x^3 + 6x^2 + x
+    fp2one(one);
+    fp2add(one, one, a24_0);
+    fp2add(a24_0, a24_0, A0);
+    fp2add(A0, a24_0, A0);
+    fp2correction(a24_0);
+    fp2correction(A0);
+
+    // Basis (P2, Q2) of E0[2^(2d)] with 2^(2d-1)*Q2 = (0,0), and its multiples (P0, Q0) of order 2^d
+    if (!sample_point(A0, 2*d, zero, false, xP2) || !sample_point(A0, 2*d, zero, true, xQ2) || !x_difference(A0, xP2, xQ2, xR2))
+        return false;
+    xDBLe_affine(xP2, xP0, a24_0, d);
+    xDBLe_affine(xQ2, xQ0, a24_0, d);
+    xDBLe_affine(xR2, xR0, a24_0, d);
+
+    // Starting curves: kernels P0 + k*Q0 for k < 2^(d-1) (ES[0]) and k >= 2^(d-1) (ES[1], with P1 = P0 + 2^(d-1)*Q0)
+    LADDER3PT(xP0, xQ0, xR0, (uint64_t)1 << (d - 1), d, a24_0, xP1);
+    LADDER3PT(xP0, xQ0, xR0, ((uint64_t)1 << (d - 1)) - 1, d, a24_0, xR1);
+    set_curve(&inst->ES[0], a24_0, xP0, xQ0, xR0);
+    set_curve(&inst->ES[1], a24_0, xP1, xQ0, xR1);
+
+    // Golden states: c = 0 and ES[0] for s0, c = 1 for s1
+    sample_prng(&prng, (unsigned char*)s0, sizeof(st_t));
+    sample_prng(&prng, (unsigned char*)s1, sizeof(st_t));
+    s0[0] = ((s0[0] & (((digit_t)1 << nst) - 1)) | ((digit_t)1 << (nst - 1))) & ~(digit_t)3;
+    s1[0] = ((s1[0] & (((digit_t)1 << nst) - 1)) | ((digit_t)1 << (nst - 1))) | 1;
+    k0 = kernel_scalar(s0, 0, nst, d);
+    k1 = kernel_scalar(s1, 1, nst, d);
+
+    // E0 -> Em with kernel 2^d*V, V = P2 + k0*Q2, pushing V, Q2 and V-Q2
+    LADDER3PT(xP2, xQ2, xR2, k0, 2*d, a24_0, xV);
+    LADDER3PT(xP2, xQ2, xR2, (k0 - 1) & mask_2d, 2*d, a24_0, xVQ);
+    set_affine(K, xV);
+    xDBLe(K, K, a24_0, one, (int)d);
+    set_affine(phiP, xV);
+    set_affine(phiQ, xQ2);
+    set_affine(phiR, xVQ);
+    fp2copy(a24_0, A24plus);
+    fp2copy(one, C24);
+    TraverseTree(jinv, K, A24plus, C24, inst->STRAT, lenstrat, true, phiP, phiQ, phiR);
+
+    // Golden j-invariant
+    fp2add(A24plus, A24plus, A1);
+    fp2sub(A1, C24, A1);
+    fp2add(A1, A1, A1);
+    j_inv(A1, C24, jinv);
+    normalize_jinv(jinv);
+    memcpy(inst->jinv, jinv, sizeof(f2elm_t));
+
+    // Em -> E1 with kernel phi(V), pushing phi(Q2). TraverseTree() returns the pushed points in affine form in X
+    fp2copy(phiP->X, xV);
+    fp2copy(phiQ->X, xQ2);
+    set_affine(K, xV);
+    set_affine(phiP, xQ2);
+    set_affine(phiQ, xQ2);
+    set_affine(phiR, xQ2);
+    TraverseTree(jinv, K, A24plus, C24, inst->STRAT, lenstrat, true, phiP, phiQ, phiR);
+    get_affine_A(A24plus, C24, A1);
+    get_a24(A1, a24_1);
+
+    // Basis of E1: G = 2^d*psi(phi(Q2)) generates the kernel of the dual of Em -> E1, B is any point independent of G
+    fp2copy(phiP->X, xG);
+    xDBLe_affine(xG, xG, a24_1, d);
+    xDBLe_affine(xG, xG2, a24_1, d - 1);
+    if (!sample_point(A1, d, xG2, false, xB) || !x_difference(A1, xG, xB, xGB))
+        return false;
+
+    // Ending curve: PE = G - k1*B and QE = B, so that s1 gives the kernel PE + k1*QE = G
+    m = (0 - k1) & mask_d;
+    LADDER3PT(xG, xB, xGB, m, d, a24_1, xPE[0]);
+    LADDER3PT(xG, xB, xGB, (m - 1) & mask_d, d, a24_1, xPE[2]);
+    fp2copy(xB, xPE[1]);
+    xDBLe_affine(xB, beta, a24_1, d - 1);
+    if (!fp2iszero(beta)) {
+        if (!move_to_zero(A1, beta, xPE, 3))
+            return false;
+        get_a24(A1, a24_1);
+    }
+    set_curve(&inst->EE, a24_1, xPE[0], xPE[1], xPE[2]);
+
+    set_table(table_es, a24_0, xQ0, nst + 1);
+    set_table(&table_es[2*(nst + 1)], a24_0, xQ0, nst + 1);
+    set_table(table_ee, a24_1, xPE[1], nst + 1);
+    return true;
+}
+
+
+// Output
+
+static void print_words(const char *name, const uint64_t *a, const unsigned int n, const unsigned int indent)
+{ // Field as in sike_vow_constants.c, on two lines for primes of more than two words
+    unsigned int i;
+
+    printf("%*s.%s = { ", indent, "", name);
+    for (i = 0; i < n; i++) {
+        printf("0x%016llx%s", (unsigned long long)a[i], (i == n - 1) ? " },\n" : ", ");
+        if (n > 4 && i == n/2 - 1)
+            printf("\n%*s", indent + (unsigned int)strlen(name) + 5, "");
+    }
+}
+
+static void print_curve(const CurveAndPointsSIDHv2 *E)
+{
+    print_words("a24", E->a24, 2*NWORDS64_FIELD, 11);
+    print_words("xp", E->xp, 2*NWORDS64_FIELD, 11);
+    print_words("xq", E->xq, 2*NWORDS64_FIELD, 11);
+    print_words("xpq", E->xpq, 2*NWORDS64_FIELD, 11);
+}
+
+static void print_table(const char *name, const f2elm_t64 *table, const unsigned int rows, const unsigned int curves)
+{
+    unsigned int i, j;
+
+    printf("const f2elm_t64 %s[%s2*(NBITS_STATE+1)] = { // A point per row represented in (X:Z) coordinates\n", name, (curves == 2) ? "2*" : "");
+    for (i = 0; i < curves*rows; i++) {
+        if (i > 0 && i % rows == 0)
+            printf("\n");
+        printf("{ ");
+        for (j = 0; j < 2*NWORDS64_FIELD; j++)
+            printf("0x%016llX%s", (unsigned long long)table[i][j], (j == 2*NWORDS64_FIELD - 1) ? " }" : ", ");
+        printf((i & 1) ? ",\n" : ", ");
+    }
+    printf("};\n");
+}
+
+static void print_instance(const instance_t *inst, const f2elm_t64 *table_es, const f2elm_t64 *table_ee)
+{ // Instance as C code for sike_vow_constants.c
+    unsigned int i, lenstrat = inst->e/2 - 2;
+
+    printf("instance_t insts_constants = {\n");
+    printf("     .MODULUS = \"%s\",\n", inst->MODULUS);
+    printf("     .e = %u,\n", inst->e);
+    printf("     .ALPHA = %.2f,\n     .BETA = %.0f.,\n     .GAMMA = %.0f.,\n", inst->ALPHA, inst->BETA, inst->GAMMA);
+    printf("     .PRNG_SEED = %u,\n", inst->PRNG_SEED);
+    printf("     .NBITS_STATE = %u,  // log(S) = e-1\n", inst->NBITS_STATE);
+    printf("     .NBYTES_STATE = %u,\n     .NWORDS_STATE = %u,  // Assuming 64-bit words\n", inst->NBYTES_STATE, inst->NWORDS_STATE);
+    printf("     .NBITS_OVERFLOW = %u,\n     .MAX_FUNCTION_VERSIONS = %u,\n", inst->NBITS_OVERFLOW, inst->MAX_FUNCTION_VERSIONS);
+    printf("     .STRAT = {");
+    for (i = 0; i < lenstrat; i++)
+        printf("%u%s", inst->STRAT[i], (i == lenstrat - 1) ? "},\n" : ", ");
+    print_words("jinv", inst->jinv, 2*NWORDS64_FIELD, 5);
+    printf("     .ES = {\n           {\n");
+    print_curve(&inst->ES[0]);
+    printf("           },\n           {\n");
+    print_curve(&inst->ES[1]);
+    printf("           }},\n     .EE = {\n");
+    print_curve(&inst->EE);
+    printf("           }};\n\n#define NBITS_STATE  %u\n", inst->NBITS_STATE);
+    print_table("DBL_TABLE_ES", table_es, 2*(inst->NBITS_STATE + 1), 2);
+    printf("\n");
+    print_table("DBL_TABLE_EE", table_ee, 2*(inst->NBITS_STATE + 1), 1);
+}
+
+
+int main(int argc, char **argv)
+{
+    bool builtin = false, print_c = false, help_flag = false;
+    unsigned int e = insts_constants.e;
+    unsigned long seed = 1;
+    char *file = NULL;
+    instance_t inst;
+    f2elm_t64 *table_es, *table_ee;
+    st_t s0 = {0}, s1 = {0};
+    int i;
+
+    for (i = 1; i < argc && !help_flag; i++) {
+        if (strcmp(argv[i], "-e") == 0 && i + 1 < argc)
+            e = (unsigned int)atoi(argv[++i]);
+        else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+            seed = strtoul(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            file = argv[++i];
+        else if (strcmp(argv[i], "-c") == 0)
+            print_c = true;
+        else if (strcmp(argv[i], "--builtin") == 0)
+            builtin = true;
+        else
+            help_flag = true;
+    }
+    if (help_flag || (file == NULL && !print_c) || e < 6 || e % 2 != 0 || e/2 - 2 > LENSTRAT) {
+        printf("\n Usage:");
+        printf("\n gen_instance -e N -s N -o FILE -c --builtin \n");
+        printf("\n -e N : even exponent of the instance, 6 <= N <= %d (%u by default, as the built-in instance).", 2*LENSTRAT + 4, insts_constants.e);
+        printf("\n -s N : seed of the bases and golden states (1 by default).");
+        printf("\n -o FILE : write the instance to FILE, to be loaded with test_vOW_SIKE -f FILE.");
+        printf("\n -c : print the instance as C code for sike_vow_constants.c.");
+        printf("\n --builtin : write the built-in instance instead of generating one.\n\n");
+        return 1;
+    }
+
+    if (builtin) {
+        if (file == NULL || !save_instance(file, &insts_constants, (const f2elm_t64*)DBL_TABLE_ES, (const f2elm_t64*)DBL_TABLE_EE)) {
+            printf("\n  Built-in instance could not be written\n\n");
+            return 1;
+        }
+        printf("\n  Built-in instance %s with e = %u written to %s\n\n", insts_constants.MODULUS, insts_constants.e, file);
+        return 0;
+    }
+
+    init_constants();
+    init_prng(&prng, seed);
+    table_es = (f2elm_t64*)calloc(4*(size_t)e, sizeof(f2elm_t64));
+    table_ee = (f2elm_t64*)calloc(2*(size_t)e, sizeof(f2elm_t64));
+    if (table_es == NULL || table_ee == NULL || !generate(&inst, table_es, table_ee, e, s0, s1)) {
+        printf("\n  Instance with e = %u could not be generated for %s (e <= %u/2+2 is required)\n\n", e, insts_constants.MODULUS, eA);
+        return 1;
+    }
+
+    // Check the golden collision with the attack's own walks, on the instance as loaded from the file
+    if (file != NULL) {
+        if (!save_instance(file, &inst, table_es, table_ee) || !load_instance(file) || !IsGoldenPairSIDH(s0, s1)) {
+            printf("\n  Instance file %s could not be written or does not reach the golden collision\n\n", file);
+            remove(file);
+            return 1;
+        }
+        printf("\n  Instance %s with e = %u written to %s (golden states 0x%llx and 0x%llx)\n\n", inst.MODULUS, e, file,
+               (unsigned long long)s0[0], (unsigned long long)s1[0]);
+    }
+    if (print_c)
+        print_instance(&inst, table_es, table_ee);
+
+    free(table_es);
+    free(table_ee);
+    return 0;
+}
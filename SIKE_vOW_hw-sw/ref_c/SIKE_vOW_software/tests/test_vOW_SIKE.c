@@ -14,6 +14,9 @@
 #include <stdio.h>
 #include <math.h>
 #include <time.h> 
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
 #include "test_extras.h"
 #include "../src/vow.h"
 
@@ -29,12 +32,205 @@
 #define _GAMMA_CHAR ("γ")
 #endif
 
+#define STRATEGY_STEPS    256       // Random function steps per timing of the strategy optimizer
+#define STRATEGY_SAMPLES  256       // States on which the optimal strategy is checked against the fixed one
 
-int stats_vow(bool collect_stats)
+// Isogeny strategy chosen at startup, and the cycles per random function step with it and with the fixed one
+static struct {
+    bool tuned;                     // False if the fixed strategy of the instance is kept
+    const char *rejected;           // Why the optimal strategy was not used, NULL if it was or was not computed
+    const char *costs_file;         // NULL if the costs were measured
+    isogeny_costs_t costs;
+    double predicted_fixed, measured_fixed, predicted, measured;
+} strategy_report;
+
+
+static bool tune_strategy(const char *costs_file, unsigned int walks)
+{ // Replaces the strategy of the instance with the optimal one for the costs measured on the active path or read from costs_file,
+  // unless it changes the random function or is not faster than the fixed strategy when timed
+    unsigned int lenstrat = insts_constants.e/2 - 1, strat[LENSTRAT], fixed[LENSTRAT], mults, evals;
+    isogeny_costs_t *costs = &strategy_report.costs;
+    double model;
+
+    if (costs_file == NULL) {
+        if (!measure_isogeny_costs(costs, walks, STRATEGY_STEPS))
+            return false;
+    } else if (!read_isogeny_costs(costs_file, costs)) {
+        return false;
+    }
+    model = optimal_strategy(strat, lenstrat, costs);
+    if (model < 0)
+        return false;
+
+    strategy_report.measured_fixed = measure_step_cycles(walks, STRATEGY_STEPS);
+    strategy_counts(insts_constants.STRAT, lenstrat, &mults, &evals);
+    if (costs->other < 0)  // Not in the costs file: all that the model leaves out, as timed with the fixed strategy
+        costs->other = strategy_report.measured_fixed - mults*costs->dbl4 - evals*costs->eval4;
+    strategy_report.predicted_fixed = costs->other + mults*costs->dbl4 + evals*costs->eval4;
+    strategy_report.predicted = costs->other + model;
+
+    strategy_report.costs_file = costs_file;
+    if (memcmp(strat, insts_constants.STRAT, (lenstrat - 1)*sizeof(unsigned int)) == 0) {
+        strategy_report.rejected = "is the fixed one";
+        return true;
+    }
+    if (!strategy_preserves_function(strat, STRATEGY_SAMPLES)) {
+        strategy_report.rejected = "changes the j-invariants of some states";
+        return true;
+    }
+
+    memcpy(fixed, insts_constants.STRAT, sizeof(fixed));
+    memcpy(insts_constants.STRAT, strat, (lenstrat - 1)*sizeof(unsigned int));
+    strategy_report.measured = measure_step_cycles(walks, STRATEGY_STEPS);
+    if (strategy_report.measured >= strategy_report.measured_fixed) {
+        memcpy(insts_constants.STRAT, fixed, sizeof(fixed));
+        strategy_report.rejected = "is not faster when timed";
+        return true;
+    }
+    strategy_report.tuned = true;
+    return true;
+}
+
+#define REPORT_FIELDS     64
+
+// Run report written by --report: named fields, each a number, a string or missing (null in JSON, empty in CSV)
+typedef struct {
+    unsigned int count;
+    const char *keys[REPORT_FIELDS];
+    char values[REPORT_FIELDS][256];
+    bool text[REPORT_FIELDS];
+} report_t;
+
+
+static void report_add(report_t *report, const char *key, bool text, const char *format, ...)
+{ // Appends a field, formatted as with printf(). A NULL format adds a missing value
+    va_list args;
+
+    if (report->count >= REPORT_FIELDS)
+        return;
+    report->keys[report->count] = key;
+    report->text[report->count] = text;
+    report->values[report->count][0] = '\0';
+    if (format != NULL) {
+        va_start(args, format);
+        vsnprintf(report->values[report->count], sizeof(report->values[0]), format, args);
+        va_end(args);
+    }
+    report->count++;
+}
+
+
+static void report_ratio(report_t *report, const char *key, const char *expected_key, const char *ratio_key, bool known, double observed, double expected)
+{ // Appends an observed value, its expected value and their ratio
+    report_add(report, key, false, known ? "%.4f" : NULL, observed);
+    report_add(report, expected_key, false, "%.4f", expected);
+    report_add(report, ratio_key, false, known ? "%.4f" : NULL, observed / expected);
+}
+
+
+static bool write_report(const char *path, const shared_state_t *S, bool collect_stats, double cpu_time)
+{ // Appends a record of the run to the file at path: a CSV row if path ends with ".csv" (with a header if the file is empty), 
+  // a JSON object on one line otherwise
+    report_t report = { 0 };
+    double n = pow(2, insts_constants.e - 1), w = (double)S->MEMORY_SIZE, functions = S->final_avg_random_functions;
+    const char *ext = strrchr(path, '.');
+    bool csv = (ext != NULL && strcmp(ext, ".csv") == 0);
+    FILE *file;
+    long size;
+
+    report_add(&report, "modulus", true, "%s", insts_constants.MODULUS);
+    report_add(&report, "e", false, "%u", insts_constants.e);
+    report_add(&report, "alpha", false, "%.4f", insts_constants.ALPHA);
+    report_add(&report, "beta", false, "%.4f", insts_constants.BETA);
+    report_add(&report, "gamma", false, "%.4f", insts_constants.GAMMA);
+    report_add(&report, "memory_log_size", false, "%u", S->MEMORY_LOG_SIZE);
+    report_add(&report, "cores", false, "%u", S->N_OF_CORES);
+    report_add(&report, "walks", false, "%u", S->N_OF_WALKS);
+    report_add(&report, "locate_threads", false, "%u", S->LOCATE_THREADS);
+    report_add(&report, "locators", false, "%u", S->N_OF_LOCATORS);
+    report_add(&report, "trail_interval", false, "%u", S->TRAIL_INTERVAL);
+    report_add(&report, "backend", true, "%s", (S->N_OF_WALKS > 1 && fp2simd_backend != SIMD_SCALAR) ? fp2simd_name(fp2simd_backend) : "scalar");
+    report_add(&report, "strategy", true, "%s", strategy_report.tuned ? "optimal" : "fixed");
+    report_add(&report, "stats_only", false, "%s", collect_stats ? "true" : "false");
+    report_add(&report, "success", false, "%s", S->success ? "true" : "false");
+    report_add(&report, "wall_time", false, "%.3f", S->wall_time);
+    report_add(&report, "cpu_time", false, "%.3f", cpu_time);
+    report_add(&report, "steps", false, "%u", S->number_steps);
+    report_add(&report, "steps_collect", false, "%u", S->number_steps_collect);
+    report_add(&report, "steps_locate", false, "%u", S->number_steps_locate);
+    report_add(&report, "steps_per_second", false, (S->wall_time > 0) ? "%.1f" : NULL, S->number_steps / S->wall_time);
+    report_add(&report, "dist_points", false, "%u", S->dist_points);
+    report_add(&report, "collisions", false, "%u", S->collisions);
+    report_add(&report, "mem_collisions", false, "%u", S->mem_collisions);
+    report_add(&report, "dist_cols", false, collect_stats ? "%u" : NULL, S->dist_cols);
+    report_add(&report, "function_versions", false, "%.2f", functions);
+    report_ratio(&report, "collisions_per_function", "collisions_per_function_expected", "collisions_per_function_ratio", functions > 0, 
+                 S->collisions / functions, 1.3 * w);
+    report_ratio(&report, "dist_cols_per_function", "dist_cols_per_function_expected", "dist_cols_per_function_ratio", collect_stats && functions > 0, 
+                 S->dist_cols / functions, 1.1 * w);
+    if (collect_stats) {  // Predicted from the distinct collisions of one function version, as printed with -s
+        double c = S->dist_cols / functions;
+        report_ratio(&report, "function_versions_total", "function_versions_total_expected", "function_versions_total_ratio", c > 0, 
+                     n / (2 * c), 0.45 * n / w);
+        report_ratio(&report, "steps_total", "steps_total_expected", "steps_total_ratio", c > 0, 
+                     (S->number_steps / functions) * n / (2 * c), 2.5 * sqrt(n * n * n / w));
+    } else {
+        report_ratio(&report, "function_versions_total", "function_versions_total_expected", "function_versions_total_ratio", true, 
+                     functions, 0.45 * n / w);
+        report_ratio(&report, "steps_total", "steps_total_expected", "steps_total_ratio", true, 
+                     (double)S->number_steps, sqrt(n * n * n / w));
+    }
+
+    file = fopen(path, "a");
+    if (file == NULL)
+        return false;
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    if (csv) {
+        for (unsigned int i = 0; size == 0 && i < report.count; i++)
+            fprintf(file, "%s%s", report.keys[i], (i + 1 < report.count) ? "," : "\n");
+        for (unsigned int i = 0; i < report.count; i++)
+            fprintf(file, report.text[i] ? "\"%s\"%s" : "%s%s", report.values[i], (i + 1 < report.count) ? "," : "\n");
+    } else {
+        fprintf(file, "{");
+        for (unsigned int i = 0; i < report.count; i++) {
+            fprintf(file, "\"%s\": ", report.keys[i]);
+            if (report.values[i][0] == '\0')
+                fprintf(file, "null");
+            else
+                fprintf(file, report.text[i] ? "\"%s\"" : "%s", report.values[i]);
+            fprintf(file, (i + 1 < report.count) ? ", " : "}\n");
+        }
+    }
+    return (fclose(file) == 0);
+}
+
+#if defined(_PROFILE_)
+static void print_profile(void)
+{ // Breakdown of the cycles spent by the vOW threads in each stage of the attack (make PROFILE=TRUE)
+    static const char *names[PROFILE_STAGES] = { "vOW threads (total)", "SampleSIDH", "LadderThreePtSIDH", "TraverseTree: xDBLe",
+        "TraverseTree: get_4_isog", "TraverseTree: eval_4_isog", "j_inv", "fp2_encode", "XOF", "DistinguishedSIDH", "Memory read",
+        "Memory write", "BacktrackSIDH (all its steps)" };
+    double total = (double)profile_total.cycles[PROFILE_THREADS];
+
+    printf("\nProfile (cycles summed over all threads):\n");
+    printf("\t %-30s %18s %8s %14s %14s\n", "Stage", "Cycles", "%", "Calls", "Cycles/call");
+    for (unsigned int i = 0; i < PROFILE_STAGES; i++) {
+        printf("\t %-30s %18llu %7.2f%% %14llu %14.0f\n", names[i], profile_total.cycles[i], (total > 0) ? 100 * profile_total.cycles[i] / total : 0.,
+                profile_total.calls[i], (profile_total.calls[i] > 0) ? (double)profile_total.cycles[i] / profile_total.calls[i] : 0.);
+    }
+}
+#endif
+
+
+int stats_vow(bool collect_stats, uint16_t cores, uint16_t walks, unsigned int memory_log_size, const char *checkpoint_file, double checkpoint_interval, bool resume,
+              unsigned int trail_interval, uint16_t locate_threads, uint16_t locators, const char *report_file, bool serve, const char *store_host, 
+              unsigned int store_port, uint16_t store_batch)
 {
     uint32_t random_functions, collisions, mem_collisions, dist_points, number_steps_collect, number_steps_locate, number_steps, dist_cols;
     bool success;
     time_t calendar_time, current_time;
+    clock_t cpu_time;
     unsigned long long cycles, cycles1, cycles2;
     shared_state_t S;
 #if (OS_TARGET == OS_LINUX)
@@ -58,11 +254,47 @@ int stats_vow(bool collect_stats)
 
     init_stats(&S);  // Initialize shared state
     S.collect_vow_stats = collect_stats;  
+    S.N_OF_CORES = cores;
+    S.N_OF_WALKS = walks;
+    S.LOCATE_THREADS = locate_threads;
+    S.N_OF_LOCATORS = locators;
+    if (store_host != NULL) {  // Worker of a distributed attack, with the memory size and mode of the store server
+        if (!connect_store(&S, store_host, store_port, store_batch)) {
+            printf("  Could not join the store server at %s:%u (not reachable, or running another instance or XOF)\n", store_host, store_port);
+            return 1;
+        }
+        collect_stats = S.collect_vow_stats;
+    } else if (resume) {  // Continue the attack saved in the checkpoint file, with its memory size, cores and mode
+        if (!resume_shared_memory(&S, checkpoint_file)) {
+            printf("  Could not resume from checkpoint file %s\n", checkpoint_file);
+            return 1;
+        }
+        collect_stats = S.collect_vow_stats;
+    } else if (checkpoint_file != NULL) {  // Memory of w = 2^memory_log_size triples in a checkpoint file
+        if (!init_shared_memory_file(&S, memory_log_size, cores, checkpoint_file)) {
+            printf("  Memory of 2^%u triples not supported for this instance or checkpoint file %s could not be created\n", memory_log_size, checkpoint_file);
+            return 1;
+        }
+    } else if (!init_shared_memory(&S, memory_log_size)) {  // Allocate memory of w = 2^memory_log_size triples
+        printf("  Memory of 2^%u triples not supported for this instance or could not be allocated\n", memory_log_size);
+        return 1;
+    }
+    S.checkpoint_interval = checkpoint_interval;
+    if (serve && !listen_store(&S, store_port)) {
+        printf("  Store server could not listen on port %u\n", store_port);
+        free_shared_memory(&S);
+        return 1;
+    }
+    if (trail_interval > 0 && !init_trail_memory(&S, trail_interval)) {
+        printf("  Side table for trail checkpoints every %u steps could not be allocated\n", trail_interval);
+        free_shared_memory(&S);
+        return 1;
+    }
 
     printf("\n----------------------------------------------------------------------------------------\n");
     printf("\nInstance:\t");
     printf("e = %u\t    ", insts_constants.e);
-    printf("w = %u\t", MEMORY_LOG_SIZE);
+    printf("w = %u\t", S.MEMORY_LOG_SIZE);
     printf(_ALPHA_CHAR);
     printf(" = %.2f\t", insts_constants.ALPHA);
     printf(_BETA_CHAR);
@@ -72,14 +304,91 @@ int stats_vow(bool collect_stats)
     printf("modulus = %s", insts_constants.MODULUS);
     printf("\n\n");
     printf("Memory: \t\t\t\t\t");
-    printf("RAM\n\n");
+    if (checkpoint_file != NULL)
+        printf("file %s (%llu triples)\n\n", checkpoint_file, (unsigned long long)S.MEMORY_SIZE);
+    else if (store_host != NULL)
+        printf("store server at %s:%u (%llu triples)\n\n", store_host, store_port, (unsigned long long)S.MEMORY_SIZE);
+    else
+        printf("RAM (%llu triples)\n\n", (unsigned long long)S.MEMORY_SIZE);
+    if (serve || store_host != NULL) {
+        printf("Distributed attack: \t\t\t\t");
+        if (serve)
+            printf("store server on port %u (the workers run the walkers)\n\n", S.store_port);
+        else
+            printf("worker, sending batches of %u triples per core\n\n", S.STORE_BATCH);
+    }
+    if (checkpoint_file != NULL) {
+        printf("Checkpoints: \t\t\t\t\t");
+        if (checkpoint_interval > 0)
+            printf("every %.0f sec and on Ctrl+C\n\n", checkpoint_interval);
+        else
+            printf("on Ctrl+C\n\n");
+        printf("Resumed: \t\t\t\t\t");
+        if (S.resume)
+            printf("Yes (after %u checkpoints and %.2f seconds)\n\n", S.checkpoint->checkpoints, S.checkpoint->wall_time);
+        else
+            printf("No\n\n");
+    }
+    printf("Trail checkpoints: \t\t\t\t");
+    if (S.trails != NULL)
+        printf("every %u steps, up to %u per trail (side table of %.1f KB, %ux the memory)\n\n", S.TRAIL_INTERVAL, S.TRAIL_POINTS,
+                (double)S.MEMORY_SIZE * (S.TRAIL_POINTS + 2) * sizeof(uint64_t) / 1024, S.TRAIL_POINTS + 2);
+    else
+        printf("No\n\n");
+    printf("Number of cores: \t\t\t\t");
+    printf("%u\n\n", S.N_OF_CORES);
+    printf("Walks per core: \t\t\t\t");
+    printf("%u\n\n", S.N_OF_WALKS);
+    printf("Threads per core for locating collisions: \t");
+    printf("%u", S.LOCATE_THREADS);
+#if defined(_OPENMP)
+    if (S.LOCATE_THREADS > 1 && (int)S.N_OF_CORES * S.LOCATE_THREADS > omp_get_num_procs())
+        printf(" (more threads than the %d processors)", omp_get_num_procs());
+#endif
+    printf("\n\n");
+    printf("Locator threads: \t\t\t\t");
+    if (S.N_OF_LOCATORS > 0)
+        printf("%u (queue of %u collisions)\n\n", S.N_OF_LOCATORS, LOCATE_QUEUE_SIZE);
+    else
+        printf("No (collisions located by the walkers)\n\n");
+    printf("GF(p^2) arithmetic of the walks: \t\t");
+    if (S.N_OF_WALKS > 1 && fp2simd_backend != SIMD_SCALAR)
+        printf("%s (%u lanes)\n\n", fp2simd_name(fp2simd_backend), fp2simd_lanes());
+    else
+        printf("scalar\n\n");
+    printf("Isogeny strategy: \t\t\t\t");
+    if (strategy_report.tuned) {
+        if (strategy_report.costs_file != NULL)
+            printf("optimal for the costs in %s", strategy_report.costs_file);
+        else
+            printf("optimal for the costs measured at startup");
+        printf(" (4-multiplication %.0f, 4-isogeny evaluation %.0f cycles)\n\t\t\t\t\t\t{",
+                strategy_report.costs.dbl4, strategy_report.costs.eval4);
+        for (unsigned int i = 0; i + 2 < insts_constants.e/2; i++)
+            printf("%s%u", (i > 0) ? ", " : "", insts_constants.STRAT[i]);
+        printf("}\n\n");
+        printf("Cycles per random function step: \t\tpredicted %.0f, measured %.0f (fixed strategy: predicted %.0f, measured %.0f)\n\n",
+                strategy_report.predicted, strategy_report.measured, strategy_report.predicted_fixed, strategy_report.measured_fixed);
+    } else if (strategy_report.rejected != NULL) {
+        printf("fixed (the optimal strategy for the costs %s)\n\n", strategy_report.rejected);
+        if (strategy_report.measured > 0)
+            printf("Cycles per random function step: \t\tfixed strategy measured %.0f (optimal: predicted %.0f, measured %.0f)\n\n",
+                    strategy_report.measured_fixed, strategy_report.predicted, strategy_report.measured);
+    } else {
+        printf("fixed\n\n");
+    }
     printf("Statistics only: \t\t\t\t");
     printf("%s\n\n", collect_stats ? "Yes (only running one function version)" : "No");        
     
     current_time = time(NULL);
+    cpu_time = clock();
     cycles1 = cpucycles();
-    vOW(&S);  // Attack
+    if (serve)
+        vOW_serve(&S);  // Store server of a distributed attack
+    else
+        vOW(&S);  // Attack
     calendar_time = time(NULL);
+    cpu_time = clock() - cpu_time;
     cycles2 = cpucycles();
     cycles = cycles + (cycles2 - cycles1);
     calendar_time -= current_time;
@@ -92,6 +401,7 @@ int stats_vow(bool collect_stats)
     number_steps_collect += S.number_steps_collect;
     number_steps_locate += S.number_steps_locate;
     number_steps += S.number_steps;
+    dist_cols += S.dist_cols;
 
     if (!collect_stats) {
         if (S.success)
@@ -101,18 +411,18 @@ int stats_vow(bool collect_stats)
         printf("\nAll tests successful: \t\t\t\t%s\n", success ? "Yes" : "No");
         printf("\n");
         printf("Number of function iterations: \t\t%.2f (expected sqrt(n^3/w) = %.2f, ratio = %.2f)\n",
-                (double)number_steps, sqrt(pow(pow(2, insts_constants.e - 1), 3) / pow(2, MEMORY_LOG_SIZE)),
-                (double)number_steps / (sqrt(pow(pow(2, insts_constants.e - 1), 3) / pow(2, MEMORY_LOG_SIZE))));
+                (double)number_steps, sqrt(pow(pow(2, insts_constants.e - 1), 3) / pow(2, S.MEMORY_LOG_SIZE)),
+                (double)number_steps / (sqrt(pow(pow(2, insts_constants.e - 1), 3) / pow(2, S.MEMORY_LOG_SIZE))));
         printf("\t For collecting dist. points: \t%.2f (%.2f%%)\n",
                 (double)number_steps_collect, 100 * ((double)number_steps_collect / (double)number_steps));
         printf("\t For locating collisions: \t%.2f (%.2f%%)\n",
                 (double)number_steps_locate, 100 * ((double)number_steps_locate / (double)number_steps));
         printf("Number of function versions: \t\t%.2f (expected 0.45n/w = %.2f, ratio = %.2f)\n",
-                (double)random_functions, 0.45 * pow(2, insts_constants.e - 1) / pow(2, MEMORY_LOG_SIZE),
-                (double)random_functions / (0.45 * pow(2, insts_constants.e - 1) / pow(2, MEMORY_LOG_SIZE)));
+                (double)random_functions, 0.45 * pow(2, insts_constants.e - 1) / pow(2, S.MEMORY_LOG_SIZE),
+                (double)random_functions / (0.45 * pow(2, insts_constants.e - 1) / pow(2, S.MEMORY_LOG_SIZE)));
         printf("Number of collisions per function: \t%.2f (expected 1.3w = %.2f, ratio = %.2f)\n",
-                ((double)collisions / (double)random_functions), 1.3 * pow(2, MEMORY_LOG_SIZE),
-                (((double)collisions / (double)random_functions)) / (1.3 * pow(2, MEMORY_LOG_SIZE)));
+                ((double)collisions / (double)random_functions), 1.3 * pow(2, S.MEMORY_LOG_SIZE),
+                (((double)collisions / (double)random_functions)) / (1.3 * pow(2, S.MEMORY_LOG_SIZE)));
     } else {  // If stats are collected
         printf("Number of function iterations: \t\t\t%.2f\n", (double)number_steps / (double)random_functions);
         printf("\t For collecting dist. points: \t\t%.2f (%.2f%%)\n",
@@ -120,21 +430,40 @@ int stats_vow(bool collect_stats)
         printf("\t For locating collisions: \t\t%.2f (%.2f%%)\n", 
                 ((double)number_steps_locate / (double)random_functions), 100 * ((double)number_steps_locate / (double)number_steps));
         printf("Number of collisions per function: \t\t%.2f (expected 1.3w = %.2f, ratio = %.2f)\n", ((double)collisions / (double)random_functions),
-                1.3 * pow(2, (double)MEMORY_LOG_SIZE), ((double)collisions / (double)random_functions) / (1.3 * pow(2, (double)MEMORY_LOG_SIZE)));
+                1.3 * pow(2, (double)S.MEMORY_LOG_SIZE), ((double)collisions / (double)random_functions) / (1.3 * pow(2, (double)S.MEMORY_LOG_SIZE)));
         printf("Number of distinct collisions per function (c): %.2f (expected 1.1w = %.2f, ratio = %.2f)\n",
-                ((double)dist_cols / (double)random_functions), 1.1 * pow(2, (double)MEMORY_LOG_SIZE),
-                ((double)dist_cols / (double)random_functions) / (1.1 * pow(2, (double)MEMORY_LOG_SIZE)));
+                ((double)dist_cols / (double)random_functions), 1.1 * pow(2, (double)S.MEMORY_LOG_SIZE),
+                ((double)dist_cols / (double)random_functions) / (1.1 * pow(2, (double)S.MEMORY_LOG_SIZE)));
         printf("\n");
         printf("Expected number of function versions (n/(2c)): \t%.2f (expected 0.45n/w = %.2f, ratio = %.2f)\n",
                 pow(2, insts_constants.e - 1) / (2 * ((double)dist_cols / (double)random_functions)),
-                0.45 * pow(2, insts_constants.e - 1) / pow(2, (double)MEMORY_LOG_SIZE),
-                (pow(2, insts_constants.e - 1) / (2 * ((double)dist_cols / (double)random_functions))) / (0.45 * pow(2, insts_constants.e - 1) / pow(2, (double)MEMORY_LOG_SIZE)));
+                0.45 * pow(2, insts_constants.e - 1) / pow(2, (double)S.MEMORY_LOG_SIZE),
+                (pow(2, insts_constants.e - 1) / (2 * ((double)dist_cols / (double)random_functions))) / (0.45 * pow(2, insts_constants.e - 1) / pow(2, (double)S.MEMORY_LOG_SIZE)));
         printf("Expected total run-time (in/(2c)): \t\t%.2f (expected 2.5%cn^3/w = %.2f, ratio = %.2f)\n",
                 ((double)number_steps / (double)random_functions) * pow(2, insts_constants.e - 1) / (2 * ((double)dist_cols / (double)random_functions)), 251,
-                2.5 * sqrt(pow(pow(2, insts_constants.e - 1), 3) / pow(2, MEMORY_LOG_SIZE)),
-                (((double)number_steps / (double)random_functions) * pow(2, insts_constants.e - 1) / (2 * ((double)dist_cols / (double)random_functions))) / (2.5*sqrt(pow(pow(2, insts_constants.e - 1), 3) / pow(2, MEMORY_LOG_SIZE))));
+                2.5 * sqrt(pow(pow(2, insts_constants.e - 1), 3) / pow(2, S.MEMORY_LOG_SIZE)),
+                (((double)number_steps / (double)random_functions) * pow(2, insts_constants.e - 1) / (2 * ((double)dist_cols / (double)random_functions))) / (2.5*sqrt(pow(pow(2, insts_constants.e - 1), 3) / pow(2, S.MEMORY_LOG_SIZE))));
     }
-    printf("\nTotal time (one core) : %ld sec\n\n", (long)calendar_time);
+    if (S.N_OF_LOCATORS > 0) {
+        printf("\nLocate queue: \t\t\t\t\t%u collisions queued (%u located), %u located by the cores (queue full)\n",
+                S.queued_collisions, S.located_queued, S.located_inline);
+        printf("\t Queue depth: \t\t\t\tmax %u, average %.2f\n", S.max_queue_depth,
+                (S.queued_collisions > 0) ? (double)S.sum_queue_depth / (double)S.queued_collisions : 0.);
+        printf("\t Locate latency: \t\t\tmax %.3f ms, average %.3f ms\n", 1000 * S.max_locate_latency,
+                (S.located_queued > 0) ? 1000 * S.sum_locate_latency / (double)S.located_queued : 0.);
+    }
+    if (serve) {
+        printf("\nStore server: \t\t\t\t\t%u cores of workers connected, %u batches of triples\n", S.store_workers, S.store_batches);
+        printf("\t Triples: \t\t\t\t%u stored, %u returned as collisions, %u dropped (older function version)\n",
+                S.dist_points, S.store_collisions, S.store_dropped);
+    }
+#if defined(_PROFILE_)
+    print_profile();
+#endif
+    printf("\nTotal time (%u core%s) : %ld sec\n\n", S.N_OF_CORES, (S.N_OF_CORES > 1) ? "s" : "", (long)calendar_time);
+    if (report_file != NULL && !write_report(report_file, &S, collect_stats, (double)cpu_time / CLOCKS_PER_SEC))
+        printf("  Could not write the report to %s\n\n", report_file);
+    free_shared_memory(&S);
 
     return 0;
 }
@@ -144,7 +473,26 @@ int main(int argc, char **argv)
     int Status = PASSED;
     bool collect_stats = false;  // Extra collection of stats is disabled by default
     bool help_flag = false;
-    int MAX_ARGSplus1 = 3;       // Current format: "test_vOW_SIKE -s -h"
+    int cores = 1;               // Single walker by default
+    int walks = 1;               // Single walk per walker by default
+    int locate_threads = 1;      // Collisions located on the walker's thread by default
+    int locators = 0;            // No locator threads by default
+    int memory_log_size = DEFAULT_MEMORY_LOG_SIZE;
+    char *checkpoint_file = NULL;
+    char *instance_file = NULL;
+    char *costs_file = NULL;
+    char *report_file = NULL;
+    bool strategy_auto = false;
+    double checkpoint_interval = 0;
+    bool resume = false;
+    int trail_interval = 0;      // No trail checkpoints by default
+    unsigned int simd = SIMD_AUTO;  // Widest lane-parallel GF(p^2) backend that pays off on this CPU by default
+    bool serve = false;          // Not distributed by default
+    static char store_host[256];
+    int store_port = 0;
+    int store_batch = 16;        // Triples sent at a time by each core of a worker
+    char *colon;
+    int MAX_ARGSplus1 = 36;      // Current format: "test_vOW_SIKE -s -t N -k N -l N -q N -w N -c FILE -i N --resume --simd NAME -f FILE --strategy auto --costs FILE -p N --report FILE --serve PORT --connect HOST:PORT --batch N -h"
 
     // Avoid output buffering
     setvbuf(stdout, NULL, _IONBF, 0);
@@ -163,6 +511,140 @@ int main(int argc, char **argv)
         case 's':
             collect_stats = true;
             break;
+        case 't':
+            if (i + 2 >= argc) {
+                help_flag = true;
+                break;
+            }
+            cores = atoi(argv[i + 2]);
+            if (cores < 1 || cores > UINT16_MAX)
+                help_flag = true;
+            i++;
+            break;
+        case 'k':
+            if (i + 2 >= argc) {
+                help_flag = true;
+                break;
+            }
+            walks = atoi(argv[i + 2]);
+            if (walks < 1 || walks > MAX_WALKS)
+                help_flag = true;
+            i++;
+            break;
+        case 'l':
+            if (i + 2 >= argc) {
+                help_flag = true;
+                break;
+            }
+            locate_threads = atoi(argv[i + 2]);
+            if (locate_threads < 1 || locate_threads > 2)
+                help_flag = true;
+            i++;
+            break;
+        case 'q':
+            if (i + 2 >= argc) {
+                help_flag = true;
+                break;
+            }
+            locators = atoi(argv[i + 2]);
+            if (locators < 1 || locators > UINT16_MAX)
+                help_flag = true;
+            i++;
+            break;
+        case 'w':
+            if (i + 2 >= argc) {
+                help_flag = true;
+                break;
+            }
+            memory_log_size = atoi(argv[i + 2]);
+            if (memory_log_size < 1 || memory_log_size > MAX_MEMORY_LOG_SIZE)
+                help_flag = true;
+            i++;
+            break;
+        case 'c':
+            if (i + 2 >= argc) {
+                help_flag = true;
+                break;
+            }
+            checkpoint_file = argv[i + 2];
+            i++;
+            break;
+        case 'f':
+            if (i + 2 >= argc) {
+                help_flag = true;
+                break;
+            }
+            instance_file = argv[i + 2];
+            i++;
+            break;
+        case 'p':
+            if (i + 2 >= argc) {
+                help_flag = true;
+                break;
+            }
+            trail_interval = atoi(argv[i + 2]);
+            if (trail_interval < 1)
+                help_flag = true;
+            i++;
+            break;
+        case 'i':
+            if (i + 2 >= argc) {
+                help_flag = true;
+                break;
+            }
+            checkpoint_interval = atof(argv[i + 2]);
+            if (checkpoint_interval <= 0)
+                help_flag = true;
+            i++;
+            break;
+        case '-':
+            if (strcmp(argv[i + 1], "--resume") == 0)
+                resume = true;
+            else if (strcmp(argv[i + 1], "--simd") == 0 && i + 2 < argc) {
+                for (simd = SIMD_SCALAR; simd <= SIMD_AUTO; simd++) {
+                    if (strcmp(argv[i + 2], fp2simd_name(simd)) == 0)
+                        break;
+                }
+                if (simd > SIMD_AUTO)
+                    help_flag = true;
+                i++;
+            } else if (strcmp(argv[i + 1], "--strategy") == 0 && i + 2 < argc) {
+                if (strcmp(argv[i + 2], "auto") == 0)
+                    strategy_auto = true;
+                else if (strcmp(argv[i + 2], "fixed") != 0)
+                    help_flag = true;
+                i++;
+            } else if (strcmp(argv[i + 1], "--costs") == 0 && i + 2 < argc) {
+                costs_file = argv[i + 2];
+                i++;
+            } else if (strcmp(argv[i + 1], "--report") == 0 && i + 2 < argc) {
+                report_file = argv[i + 2];
+                i++;
+            } else if (strcmp(argv[i + 1], "--serve") == 0 && i + 2 < argc) {
+                serve = true;
+                store_port = atoi(argv[i + 2]);
+                if (store_port < 1 || store_port > UINT16_MAX)
+                    help_flag = true;
+                i++;
+            } else if (strcmp(argv[i + 1], "--connect") == 0 && i + 2 < argc) {
+                colon = strrchr(argv[i + 2], ':');
+                if (colon == NULL || colon == argv[i + 2] || (size_t)(colon - argv[i + 2]) >= sizeof(store_host)) {
+                    help_flag = true;
+                } else {
+                    memcpy(store_host, argv[i + 2], (size_t)(colon - argv[i + 2]));
+                    store_port = atoi(colon + 1);
+                    if (store_port < 1 || store_port > UINT16_MAX)
+                        help_flag = true;
+                }
+                i++;
+            } else if (strcmp(argv[i + 1], "--batch") == 0 && i + 2 < argc) {
+                store_batch = atoi(argv[i + 2]);
+                if (store_batch < 1 || store_batch > STORE_MAX_BATCH)
+                    help_flag = true;
+                i++;
+            } else
+                help_flag = true;
+            break;
         case 'h':
             help_flag = true;
             break;
@@ -175,7 +657,37 @@ int main(int argc, char **argv)
         }
     }
 
-    Status = stats_vow(collect_stats); // Testing
+    if ((resume || checkpoint_interval > 0) && checkpoint_file == NULL) {
+        help_flag = true;
+        goto help;
+    }
+
+    // The store server keeps the memory in RAM, without trail checkpoints, and the walkers of a worker locate collisions themselves
+    if ((serve || store_host[0] != '\0') && (checkpoint_file != NULL || trail_interval > 0 || locators > 0 || (serve && store_host[0] != '\0'))) {
+        help_flag = true;
+        goto help;
+    }
+
+    if (instance_file != NULL && !load_instance(instance_file)) {
+        printf("\n  Instance file %s cannot be read or was not generated for this prime\n\n", instance_file);
+        return 1;
+    }
+
+    if (!fp2simd_select(simd)) {
+        printf("\n  GF(p^2) backend %s not compiled in or not supported by this CPU\n\n", fp2simd_name(simd));
+        return 1;
+    }
+
+    if ((strategy_auto || costs_file != NULL) && !tune_strategy(costs_file, (unsigned int)walks)) {
+        if (costs_file != NULL)
+            printf("\n  Costs file %s cannot be read or has no positive dbl4 and eval4 costs\n\n", costs_file);
+        else
+            printf("\n  Isogeny costs could not be fitted to the timings (tree too small or timer not available)\n\n");
+        return 1;
+    }
+
+    Status = stats_vow(collect_stats, (uint16_t)cores, (uint16_t)walks, (unsigned int)memory_log_size, checkpoint_file, checkpoint_interval, resume, (unsigned int)trail_interval, (uint16_t)locate_threads, (uint16_t)locators, report_file, 
+                       serve, (store_host[0] != '\0') ? store_host : NULL, (unsigned int)store_port, (uint16_t)store_batch); // Testing
     if (Status != PASSED) {
         printf("\n\n   Error detected while running attack... \n\n");
         return 1;
@@ -184,8 +696,25 @@ int main(int argc, char **argv)
 help:
     if (help_flag) {
         printf("\n Usage:");
-        printf("\n test_vOW_SIKE -s -h \n");
+        printf("\n test_vOW_SIKE -s -t N -k N -l N -q N -w N -c FILE -i N --resume --simd NAME -f FILE --strategy auto --costs FILE -p N --report FILE --serve PORT --connect HOST:PORT --batch N -h \n");
         printf("\n -s : collection of attack stats on (off by default).");
+        printf("\n -t N : number of cores (walkers) sharing the memory (1 by default).");
+        printf("\n -k N : number of walks advanced in lockstep by each core, 1 <= N <= %d (1 by default).", MAX_WALKS);
+        printf("\n -l N : number of threads used by each core to locate collisions, 1 or 2 (1 by default).");
+        printf("\n -q N : N threads locate the collisions queued by the cores, which keep mining (off by default).");
+        printf("\n -w N : memory of 2^N triples, 1 <= N <= %d (2^%d by default).", MAX_MEMORY_LOG_SIZE, DEFAULT_MEMORY_LOG_SIZE);
+        printf("\n -c FILE : keep the memory and walkers in checkpoint file FILE, saved on Ctrl+C (off by default).");
+        printf("\n -i N : also save the checkpoint file every N seconds (requires -c).");
+        printf("\n --resume : continue the attack saved in the checkpoint file (requires -c).");
+        printf("\n --simd NAME : GF(p^2) arithmetic of the lockstep walks, NAME in {scalar, avx2, avx512, auto} (auto by default).");
+        printf("\n -f FILE : run the attack on the instance in FILE, written by gen_instance (built-in instance by default).");
+        printf("\n --strategy NAME : isogeny strategy, NAME in {fixed, auto}: the instance's, or the optimal one for costs measured at startup (fixed by default).");
+        printf("\n --costs FILE : use the optimal isogeny strategy for the costs in FILE, with lines \"dbl4 N\", \"eval4 N\" and optionally \"other N\" in cycles.");
+        printf("\n -p N : keep the state of every walk each N steps, to locate collisions from near where the trails merge (off by default).");
+        printf("\n --report FILE : append a record of the run to FILE, as a CSV row if FILE ends with .csv and as a JSON line otherwise.");
+        printf("\n --serve PORT : store server of a distributed attack, keeping the memory (-w N) for the workers that connect on TCP port PORT.");
+        printf("\n --connect HOST:PORT : worker of a distributed attack, running -t N cores against the store server at HOST:PORT.");
+        printf("\n --batch N : triples sent at a time by each core of a worker, 1 <= N <= %d (16 by default).", STORE_MAX_BATCH);
         printf("\n -h : this help.\n\n");
     }
 
@@ -0,0 +1,180 @@
+/********************************************************************************************
+* vOW4SIKE on HW: a HW/SW co-design implementation of the vOW algorithm on SIKE
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/vOW4SIKE_on_HW
+* Released under MIT license
+*
+* Based on the SIDH library (https://github.com/microsoft/PQCrypto-SIDH) and the vOW4SIKE
+* library (https://github.com/microsoft/vOW4SIKE)
+*
+* Abstract: distributed attack with a store server and several worker processes on localhost
+*********************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "test_extras.h"
+#include "../src/vow.h"
+
+#define MAX_WORKERS       16
+#define DEFAULT_WORKERS   3
+#define STORE_HOST        "127.0.0.1"
+
+// Outcome of the part of the attack run by a process (the store server or a worker), sent to the parent through a pipe
+typedef struct
+{
+    bool ran;                       // The process joined the attack
+    bool success;
+    uint32_t function_version;      // Last function version of the process
+    uint32_t workers;               // Store server: walkers that connected
+    uint32_t dist_points;
+    uint32_t collisions;
+    uint32_t dist_cols;
+    uint32_t number_steps;
+    uint64_t MAX_DIST;
+    double wall_time;
+} outcome_t;
+
+
+static pid_t run_child(int *fd, shared_state_t *S, bool server, uint16_t cores, uint16_t walks, uint16_t batch, unsigned int port)
+{ // Forks a process running the store server (on the memory and socket in S) or a worker, whose outcome can be read from *fd
+    outcome_t outcome;
+    shared_state_t W;
+    int fds[2];
+    pid_t pid;
+
+    if (pipe(fds) != 0)
+        return -1;
+    pid = fork();
+    if (pid != 0) {
+        close(fds[1]);
+        *fd = fds[0];
+        return pid;
+    }
+
+    close(fds[0]);
+    memset(&outcome, 0, sizeof(outcome));
+    if (server) {
+        outcome.ran = true;
+        vOW_serve(S);
+        outcome.workers = S->store_workers;
+    } else {
+        free_shared_memory(S);  // Only the server listens
+        init_stats(&W);
+        W.N_OF_CORES = cores;
+        W.N_OF_WALKS = walks;
+        outcome.ran = connect_store(&W, STORE_HOST, port, batch);
+        if (outcome.ran)
+            vOW(&W);
+        S = &W;
+    }
+    outcome.success = S->success;
+    outcome.function_version = S->function_version;
+    outcome.dist_points = S->dist_points;
+    outcome.collisions = S->collisions;
+    outcome.dist_cols = S->dist_cols;
+    outcome.number_steps = S->number_steps;
+    outcome.MAX_DIST = S->MAX_DIST;
+    outcome.wall_time = S->wall_time;
+    free_shared_memory(S);
+    if (write(fds[1], &outcome, sizeof(outcome)) != (ssize_t)sizeof(outcome))
+        _exit(1);
+    _exit(0);
+}
+
+static bool collect_outcome(int fd, pid_t pid, outcome_t *outcome)
+{ // Waits for a child process and reads its outcome
+    int status;
+    bool ok = (read(fd, outcome, sizeof(*outcome)) == (ssize_t)sizeof(*outcome));
+
+    close(fd);
+    return (waitpid(pid, &status, 0) == pid && WIFEXITED(status) && WEXITSTATUS(status) == 0 && ok && outcome->ran);
+}
+
+static bool test_distributed(bool collect_stats, unsigned int workers, uint16_t cores, uint16_t walks, uint16_t batch)
+{ // Runs an attack with a store server and the given number of worker processes, and checks that all of them stopped with the
+  // outcome of the server: the golden collision found (or one function version of stats collected) and its last function version
+    outcome_t outcomes[MAX_WORKERS + 1], *server = &outcomes[0];
+    int fds[MAX_WORKERS + 1];
+    pid_t pids[MAX_WORKERS + 1];
+    bool passed = true, ok;
+    shared_state_t S;
+    unsigned int i;
+
+    printf("  %s, %u workers of %u cores with %u walks, batches of %u triples\n", collect_stats ? "One function version (stats)" : "Full attack",
+           workers, cores, walks, batch);
+    init_stats(&S);
+    S.collect_vow_stats = collect_stats;
+    if (!init_shared_memory(&S, DEFAULT_MEMORY_LOG_SIZE) || !listen_store(&S, 0)) {
+        printf("    Store server could not be set up\n");
+        free_shared_memory(&S);
+        return false;
+    }
+    // Fork before any OpenMP thread is started
+    pids[0] = run_child(&fds[0], &S, true, 0, 0, 0, 0);
+    for (i = 1; i <= workers && pids[0] > 0; i++)
+        pids[i] = run_child(&fds[i], &S, false, cores, walks, batch, S.store_port);
+    free_shared_memory(&S);
+    if (pids[0] <= 0) {
+        printf("    Could not start the processes\n");
+        return false;
+    }
+
+    for (i = 0; i <= workers; i++) {
+        ok = (pids[i] > 0 && collect_outcome(fds[i], pids[i], &outcomes[i]));
+        if (!ok) {
+            printf("    %s %u did not finish\n", (i == 0) ? "store server" : "worker", i);
+            passed = false;
+            continue;
+        }
+        if (i == 0)
+            printf("    store server: %u walkers, %u function versions, %u points stored, %u collisions located, %u steps, %.2f sec\n",
+                   server->workers, server->function_version, server->dist_points, server->collisions, server->number_steps, server->wall_time);
+        else
+            printf("    worker %u: function version %u, %u points, %u collisions located, %u steps, %s\n", i, outcomes[i].function_version,
+                   outcomes[i].dist_points, outcomes[i].collisions, outcomes[i].number_steps, outcomes[i].success ? "golden collision" : "stopped");
+    }
+    if (!passed)
+        return false;
+
+    // All workers got the broadcasts of the server
+    for (i = 1; i <= workers; i++)
+        passed &= (outcomes[i].success == server->success && outcomes[i].function_version == server->function_version);
+    passed &= (server->workers == workers * cores);
+    if (collect_stats) {
+        // The server stops after the points of one function version
+        passed &= (!server->success && server->function_version == 1 && server->dist_points == server->MAX_DIST && server->dist_cols > 0);
+        printf("    distinct collisions: %u\n", server->dist_cols);
+    } else {
+        passed &= server->success;
+    }
+    return passed;
+}
+
+int main(int argc, char **argv)
+{
+    int workers = DEFAULT_WORKERS;
+    bool passed = true;
+
+    // Avoid output buffering, which the forked processes would duplicate
+    setvbuf(stdout, NULL, _IONBF, 0);
+
+    if (argc > 1)
+        workers = atoi(argv[1]);
+    if (argc > 2 || workers < 1 || workers > MAX_WORKERS) {
+        printf("\n Usage: test_vOW_distributed [N]   (N worker processes, 1 <= N <= %d, %d by default)\n\n", MAX_WORKERS, DEFAULT_WORKERS);
+        return 1;
+    }
+
+    printf("\nTesting the distributed vOW attack on localhost");
+    printf("\n----------------------------------------------------------------------------------------\n\n");
+    passed &= test_distributed(false, (unsigned int)workers, 1, 1, 16);
+    passed &= test_distributed(false, (unsigned int)workers, 2, 4, 4);
+    passed &= test_distributed(true, (unsigned int)workers, 2, 2, 16);
+
+    printf("\nAll tests successful: \t\t\t\t%s\n\n", passed ? "Yes" : "No");
+    return passed ? PASSED : FAILURE;
+}
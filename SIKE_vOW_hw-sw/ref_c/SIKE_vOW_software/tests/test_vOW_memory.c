@@ -0,0 +1,142 @@
+/********************************************************************************************
+* vOW4SIKE on HW: a HW/SW co-design implementation of the vOW algorithm on SIKE
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/vOW4SIKE_on_HW
+* Released under MIT license
+*
+* Based on the SIDH library (https://github.com/microsoft/PQCrypto-SIDH) and the vOW4SIKE
+* library (https://github.com/microsoft/vOW4SIKE)
+*
+* Abstract: contention benchmark and tearing test for the shared memory of triples
+*********************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "test_extras.h"
+#include "../src/vow.h"
+
+#define OPS_PER_THREAD    2000000     // Memory operations done by each thread
+#define WRITE_PERCENTAGE  50          // Share of the operations that are inserts
+
+
+static uint64_t next_rand(uint64_t *x)
+{ // xorshift64
+    *x ^= *x << 13;
+    *x ^= *x >> 7;
+    *x ^= *x << 17;
+    return *x;
+}
+
+#define FUNCTION_VERSION  1
+
+static digit_t make_trip(trip_t *t, const shared_state_t *S, uint64_t r)
+{ // Distinguished triples whose fields can be checked against each other to detect torn reads. Returns the triple's address
+    uint64_t val = (r >> 40) % (S->DIST_BOUND + 1);
+    uint64_t high = (val - (uint64_t)FUNCTION_VERSION * S->DIST_BOUND) & (((uint64_t)1 << (insts_constants.NBITS_STATE - S->MEMORY_LOG_SIZE)) - 1);
+    uint64_t state = (high << S->MEMORY_LOG_SIZE) | (r & (S->MEMORY_SIZE - 1));
+
+    t->current_state[0] = (digit_t)state;
+    t->initial_state[0] = (digit_t)((state * 0x9E3779B97F4A7C15ULL) & (((uint64_t)1 << insts_constants.NBITS_STATE) - 1));
+    t->current_steps = 1 + (uint32_t)(state % S->MAX_STEPS);
+    return (digit_t)((state + FUNCTION_VERSION) & (S->MEMORY_SIZE - 1));  // As in MemIndexSIDH()
+}
+
+static bool is_consistent_trip(const trip_t *t, const shared_state_t *S)
+{
+    uint64_t state = (uint64_t)t->current_state[0];
+
+    return (t->initial_state[0] == (digit_t)((state * 0x9E3779B97F4A7C15ULL) & (((uint64_t)1 << insts_constants.NBITS_STATE) - 1)) && 
+            t->current_steps == 1 + (uint32_t)(state % S->MAX_STEPS));
+}
+
+static double wall_clock(void)
+{
+#if defined(_OPENMP)
+    return omp_get_wtime();
+#else
+    return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+static int run_contention(shared_state_t *S, int cores)
+{ // Runs OPS_PER_THREAD random inserts/lookups on each of the given number of cores
+    uint64_t reads = 0, writes = 0, dropped = 0, torn = 0;
+    double start, elapsed;
+
+    memset(S->memory, 0, (size_t)S->MEMORY_SIZE * sizeof(mem_slot_t));
+    init_stats(S);
+    start = wall_clock();
+
+#pragma omp parallel num_threads(cores) reduction(+:reads, writes, dropped, torn)
+    {
+        uint64_t x = 0x2545F4914F6CDD1DULL;
+        trip_t t;
+#if defined(_OPENMP)
+        x += (uint64_t)omp_get_thread_num() * 0x9E3779B97F4A7C15ULL;
+#endif
+        for (unsigned int i = 0; i < OPS_PER_THREAD; i++) {
+            uint64_t r = next_rand(&x);
+            digit_t address = make_trip(&t, S, r);
+
+            if ((r >> 32) % 100 < WRITE_PERCENTAGE) {
+                if (write_to_memory(&t, S, address, FUNCTION_VERSION))
+                    writes++;
+                else
+                    dropped++;
+            } else {
+                if (read_from_memory(&t, S, address, FUNCTION_VERSION) && !is_consistent_trip(&t, S))
+                    torn++;
+                reads++;
+            }
+        }
+    }
+    elapsed = wall_clock() - start;
+
+    printf("  %5d  %12.2f  %12.2f  %12.2f  %10llu  %10llu\n", cores, (double)writes / elapsed / 1e6, (double)reads / elapsed / 1e6,
+           (double)(reads + writes + dropped) / elapsed / 1e6, (unsigned long long)dropped, (unsigned long long)torn);
+
+    return (torn == 0) ? PASSED : FAILURE;
+}
+
+int main(int argc, char **argv)
+{
+    int Status = PASSED;
+    int max_cores = 1;
+    static shared_state_t S;
+
+    if (argc > 1) {
+        max_cores = atoi(argv[1]);
+    } else {
+#if defined(_OPENMP)
+        max_cores = omp_get_num_procs();
+#endif
+    }
+    if (max_cores < 1) {
+        printf("\n Usage: test_vOW_memory [max_cores]\n\n");
+        return FAILURE;
+    }
+    if (!init_shared_memory(&S, DEFAULT_MEMORY_LOG_SIZE)) {
+        printf("\n Could not allocate the memory\n\n");
+        return FAILURE;
+    }
+
+    printf("\nContention benchmark for the shared memory of triples");
+    printf("\n----------------------------------------------------------------------------------------\n\n");
+    printf("Memory size: %llu triples, %d%% inserts, %d operations per core\n", (unsigned long long)S.MEMORY_SIZE, WRITE_PERCENTAGE, OPS_PER_THREAD);
+    printf("Packed triple: %u bits (%u step bits, %u distinguisher bits, %u state bits, %u tag bits)\n\n", 
+           (unsigned int)(8*sizeof(mem_slot_t)), S.STEPS_BITS, S.DIST_BITS, insts_constants.NBITS_STATE, S.TAG_BITS);
+    printf("  cores  inserts Mop/s    reads Mop/s    total Mop/s     dropped        torn\n");
+
+    for (int cores = 1; cores <= max_cores; cores = (cores < max_cores && 2*cores > max_cores) ? max_cores : 2*cores) {
+        Status |= run_contention(&S, cores);
+        if (cores == max_cores)
+            break;
+    }
+
+    free_shared_memory(&S);
+    printf("\nNo torn reads: \t\t\t\t%s\n\n", (Status == PASSED) ? "Yes" : "No");
+    return Status;
+}
@@ -0,0 +1,162 @@
+/********************************************************************************************
+* vOW4SIKE on HW: a HW/SW co-design implementation of the vOW algorithm on SIKE
+* Copyright (c) Microsoft Corporation
+*
+* Website: https://github.com/microsoft/vOW4SIKE_on_HW
+* Released under MIT license
+*
+* Based on the SIDH library (https://github.com/microsoft/PQCrypto-SIDH) and the vOW4SIKE
+* library (https://github.com/microsoft/vOW4SIKE)
+*
+* Abstract: cross-check of the batched XOF against the scalar XOF, and its cost per input
+*********************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../src/prng.h"
+
+#define MAX_INPUTS        16          // Inputs per batch in the cross-check (several groups of lanes)
+#define MAX_INPUT_BYTES   200         // Longer than the j-invariant encoding of P751 (188 bytes)
+#define MAX_OUTPUT_BYTES  24
+#define BENCH_INPUTS      8           // Inputs per batch in the benchmark, as with -k 8
+#define BENCH_LOOPS       2000
+#define BENCH_REPEATS     15
+
+static const unsigned int backends[] = { SIMD_SCALAR, SIMD_AVX2, SIMD_AVX512 };
+static const unsigned long bench_lengths[] = { 18, 110, 188 };  // j-invariant encodings of P128, P434 and P751
+
+
+static uint64_t next_rand(uint64_t *x)
+{ // xorshift64
+    *x ^= *x << 13;
+    *x ^= *x >> 7;
+    *x ^= *x << 17;
+    return *x;
+}
+
+static const char* backend_name(const unsigned int backend)
+{
+    switch (backend) {
+    case SIMD_AVX2:   return "avx2";
+    case SIMD_AVX512: return "avx512";
+    default:          return "scalar";
+    }
+}
+
+static bool cross_check(const unsigned int backend)
+{ // XOF_batch() against XOF() for all input lengths up to MAX_INPUT_BYTES and a few batch and output sizes
+    static unsigned char in[MAX_INPUTS][MAX_INPUT_BYTES], out[MAX_INPUTS][MAX_OUTPUT_BYTES], ref[MAX_OUTPUT_BYTES];
+    unsigned char *inputs[MAX_INPUTS], *outputs[MAX_INPUTS];
+    static const unsigned int batch_sizes[] = { 1, 2, 3, 4, 5, 8, 13, 16 };
+    static const unsigned long output_sizes[] = { 1, 2, 3, 8, 9, 24 };
+    uint64_t x = 0x9E3779B97F4A7C15ULL;
+    unsigned long len, salt;
+    unsigned int b, o, k, i, mismatches = 0, checks = 0;
+
+    for (k = 0; k < MAX_INPUTS; k++) {
+        for (i = 0; i < MAX_INPUT_BYTES; i++)
+            in[k][i] = (unsigned char)next_rand(&x);
+        inputs[k] = in[k];
+        outputs[k] = out[k];
+    }
+    for (len = 0; len <= MAX_INPUT_BYTES; len++) {
+        for (b = 0; b < sizeof(batch_sizes)/sizeof(batch_sizes[0]); b++) {
+            for (o = 0; o < sizeof(output_sizes)/sizeof(output_sizes[0]); o++) {
+                salt = (unsigned long)(next_rand(&x) >> 32);
+                XOF_batch(outputs, inputs, batch_sizes[b], output_sizes[o], len, salt);
+                for (k = 0; k < batch_sizes[b]; k++) {
+                    XOF(ref, in[k], output_sizes[o], len, salt);
+                    mismatches += (memcmp(ref, out[k], output_sizes[o]) != 0);
+                    checks++;
+                }
+            }
+        }
+        in[(len * 7) % MAX_INPUTS][len % MAX_INPUT_BYTES] ^= 0x5A;  // Vary the inputs between lengths
+    }
+    printf("  %-8s %9u outputs checked, %u mismatches\n", backend_name(backend), checks, mismatches);
+    return (mismatches == 0);
+}
+
+static double bench_one(unsigned char in[][MAX_INPUT_BYTES], unsigned char out[][8], const unsigned long nbytes_input, const bool batch)
+{ // Cycles per input of XOF() or XOF_batch() on BENCH_INPUTS inputs, the fastest of BENCH_REPEATS runs
+    unsigned char *inputs[BENCH_INPUTS], *outputs[BENCH_INPUTS];
+    unsigned long long cycles, best = 0;
+    unsigned int r, i, k;
+
+    for (k = 0; k < BENCH_INPUTS; k++) {
+        inputs[k] = in[k];
+        outputs[k] = out[k];
+    }
+    for (r = 0; r < BENCH_REPEATS; r++) {
+        cycles = cpucycles();
+        for (i = 0; i < BENCH_LOOPS; i++) {
+            if (batch) {
+                XOF_batch(outputs, inputs, BENCH_INPUTS, 3, nbytes_input, i);
+            } else {
+                for (k = 0; k < BENCH_INPUTS; k++)
+                    XOF(out[k], in[k], 3, nbytes_input, i);
+            }
+            in[i % BENCH_INPUTS][0] ^= out[0][0];
+        }
+        cycles = cpucycles() - cycles;
+        if (r == 0 || cycles < best)
+            best = cycles;
+    }
+    return (double)best / (BENCH_LOOPS * BENCH_INPUTS);
+}
+
+static void bench(void)
+{ // Cycles per input of XOF() and of XOF_batch() with each available backend
+    static unsigned char in[BENCH_INPUTS][MAX_INPUT_BYTES], out[BENCH_INPUTS][8];
+    unsigned int l, b, k, i;
+
+    for (k = 0; k < BENCH_INPUTS; k++)
+        for (i = 0; i < MAX_INPUT_BYTES; i++)
+            in[k][i] = (unsigned char)(k * 31 + i);
+    printf("\n  input bytes    XOF     ");
+    for (b = 0; b < sizeof(backends)/sizeof(backends[0]); b++)
+        if (XOF_batch_supported(backends[b]))
+            printf(" batch %-8s", backend_name(backends[b]));
+    printf("  (%d inputs of 3 output bytes, ", BENCH_INPUTS); print_unit; printf(" per input)\n");
+
+    for (l = 0; l < sizeof(bench_lengths)/sizeof(bench_lengths[0]); l++) {
+        printf("  %11lu %8.1f", bench_lengths[l], bench_one(in, out, bench_lengths[l], false));
+        for (b = 0; b < sizeof(backends)/sizeof(backends[0]); b++)
+            if (XOF_batch_select(backends[b]))
+                printf(" %14.1f", bench_one(in, out, bench_lengths[l], true));
+        printf("\n");
+    }
+    XOF_batch_select(SIMD_AUTO);
+}
+
+int main(void)
+{
+    int Status = PASSED;
+    unsigned int b;
+
+    printf("\nCross-check of the batched XOF against the scalar XOF");
+    printf("\n----------------------------------------------------------------------------------------\n\n");
+#if defined(USE_XXHASH_XOF)
+    printf("XOF: XXH64, hashed in SIMD lanes by the batched XOF\n\n");
+#elif defined(USE_SHAKE_XOF)
+    printf("XOF: SHAKE128, hashed 4 inputs at a time by the batched XOF (the backends do not apply)\n\n");
+#else
+    printf("XOF: not XXH64, hashed one input at a time by the batched XOF\n\n");
+#endif
+
+    for (b = 0; b < sizeof(backends)/sizeof(backends[0]); b++) {
+        if (!XOF_batch_select(backends[b])) {
+            printf("  %-8s not available\n", backend_name(backends[b]));
+            continue;
+        }
+        if (!cross_check(backends[b]))
+            Status = FAILURE;
+    }
+    XOF_batch_select(SIMD_AUTO);
+    bench();
+
+    printf("\nAll batched outputs match: \t\t%s\n\n", (Status == PASSED) ? "Yes" : "No");
+    return Status;
+}
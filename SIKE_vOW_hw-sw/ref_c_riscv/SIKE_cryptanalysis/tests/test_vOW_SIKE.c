@@ -56,13 +56,17 @@ int stats_vow(bool collect_stats)
     dist_cols = 0;
     cycles = 0;
 
+    if (!init_shared_memory(&S, DEFAULT_MEMORY_LOG_SIZE)) {  // Allocate memory of w = 2^DEFAULT_MEMORY_LOG_SIZE triples
+        printf("  Could not allocate the memory\n");
+        return 1;
+    }
     init_stats(&S);  // Initialize shared state
     S.collect_vow_stats = collect_stats;  
 
     printf("\n----------------------------------------------------------------------------------------\n");
     printf("\nInstance:\t");
     printf("e = %u\t    ", insts_constants.e);
-    printf("w = %u\t", MEMORY_LOG_SIZE);
+    printf("w = %u\t", S.MEMORY_LOG_SIZE);
     printf(_ALPHA_CHAR);
     printf(" = %.2f\t", insts_constants.ALPHA);
     printf(_BETA_CHAR);
@@ -137,6 +141,7 @@ int stats_vow(bool collect_stats)
  
     printf("\n------------PERFORMANCE------------\n\n");
     printf("Total cycles for the vOW attack: %" PRIu64 "\n\n", cycles);
+    free_shared_memory(&S);
 
     return 0;
 }
@@ -31,14 +31,20 @@
 #define AB_1_1_BIT  10  
 #define AB_1_0_BIT  11
 
-#if defined(P377)
+#if defined(P128)
+    #define NWORDS 2
+#elif defined(P377)
     #define NWORDS 6
 #elif defined(P434)
     #define NWORDS 7
 #elif defined(P503)
     #define NWORDS 8
+#elif defined(P546)
+    #define NWORDS 9
 #elif defined(P610)
     #define NWORDS 10
+#elif defined(P697)
+    #define NWORDS 11
 #else // p751
     #define NWORDS 12
 #endif
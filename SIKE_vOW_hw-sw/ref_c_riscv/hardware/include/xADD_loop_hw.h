@@ -53,9 +53,15 @@
 #elif defined(P503)
   #define NWORDS 16
   #define SKWORDS 109
+#elif defined(P546)
+  #define NWORDS 18
+  #define SKWORDS 118
 #elif defined(P610)
   #define NWORDS 20
   #define SKWORDS 131
+#elif defined(P697)
+  #define NWORDS 22
+  #define SKWORDS 150
 #else // p751
   #define NWORDS 24
   #define SKWORDS 161
@@ -40,8 +40,12 @@
   #define NWORDS 14
 #elif defined(P503)
   #define NWORDS 16
+#elif defined(P546)
+  #define NWORDS 18
 #elif defined(P610)
   #define NWORDS 20
+#elif defined(P697)
+  #define NWORDS 22
 #else // p751
   #define NWORDS 24
 #endif